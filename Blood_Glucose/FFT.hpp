@@ -0,0 +1,341 @@
+#ifndef __FFT_HPP__
+#define __FFT_HPP__
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/*
+FFT engine for the power spectrum of a window - Replaces the DFT in process(), which took 200 multiply-accumulates on doubles for each
+of its 31 bins.
+- ComplexFFT<N> is a mixed radix FFT for lengths made of the factors 2, 3 and 5, with radix 4, 2, 3 and 5 butterflies. Its twiddles
+  and the order of the stages are worked out once when it is constructed.
+- RealFFT<N> takes real samples. An even N is packed into a complex FFT of N/2 points and split back out, so the 200 sample window
+  (200 = 2^3 * 5^2) costs one 100 point FFT (4 * 5 * 5) and a pass to unpack it.
+- Any other length works - An odd N goes through a complex FFT of N, or through Bluestein's algorithm (BluesteinFFT<N>) if N has a
+  prime factor above 5, which turns it into a convolution done with power of 2 FFTs.
+- power() gives |X[k]|^2 for the first bins, the values process() put in resultArray[0], and binHz() the frequency of a bin.
+- float throughout - The Cortex-M4F has a single precision FPU and does doubles in software.
+- Every buffer is a member sized at compile time, so nothing is allocated. The objects are large, so make them global or static rather
+  than putting them on a thread stack.
+- No Mbed dependency, so Spectrum_Benchmark can check and time it on the host.
+*/
+
+struct FFTComplex {
+    float re;
+    float im;
+};
+
+inline FFTComplex fftAdd(FFTComplex a, FFTComplex b) {
+    return {a.re + b.re, a.im + b.im};
+}
+
+inline FFTComplex fftSub(FFTComplex a, FFTComplex b) {
+    return {a.re - b.re, a.im - b.im};
+}
+
+inline FFTComplex fftMul(FFTComplex a, FFTComplex b) {
+    return {(a.re * b.re) - (a.im * b.im), (a.re * b.im) + (a.im * b.re)};
+}
+
+inline FFTComplex fftConj(FFTComplex a) {
+    return {a.re, -a.im};
+}
+
+//exp(-2*pi*i*numerator/denominator) - Worked out in double as the tables are only made once
+inline FFTComplex fftTwiddle(uint64_t numerator, uint64_t denominator) {
+    const double pi = 3.14159265358979323846;
+    double phase = (-2.0 * pi * (double)numerator) / (double)denominator;
+    return {(float)cos(phase), (float)sin(phase)};
+}
+
+//Whether n is made only of the factors the butterflies handle
+constexpr bool fftSmooth(uint32_t n) {
+    return (n == 0) ? false : (n == 1) ? true : ((n % 2) == 0) ? fftSmooth(n / 2) : ((n % 3) == 0) ? fftSmooth(n / 3) : ((n % 5) == 0) ? fftSmooth(n / 5) : false;
+}
+
+constexpr uint32_t fftNextPow2(uint32_t n) {
+    return (n <= 1) ? 1 : 2 * fftNextPow2((n + 1) / 2);
+}
+
+//Frequency of bin k of an N point transform of samples taken at rateHz
+inline float binHz(uint32_t k, uint32_t N, float rateHz) {
+    return (k * rateHz) / N;
+}
+
+template <uint32_t N>
+class ComplexFFT {
+    static_assert(fftSmooth(N), "ComplexFFT lengths must be made of the factors 2, 3 and 5 - Use BluesteinFFT for other lengths");
+
+private:
+    static const int maxStages = 32;
+    FFTComplex twiddles[N]; //exp(-2*pi*i*k/N)
+    uint32_t factors[2 * maxStages]; //Radix of each stage and the length of the transforms below it
+
+    void butterfly2(FFTComplex *out, size_t stride, uint32_t m) const {
+        for (uint32_t k = 0; k < m; k++) {
+            FFTComplex t = fftMul(out[k + m], twiddles[k * stride]);
+            out[k + m] = fftSub(out[k], t);
+            out[k] = fftAdd(out[k], t);
+        }
+    }
+
+    void butterfly3(FFTComplex *out, size_t stride, uint32_t m) const {
+        const float epi3 = twiddles[stride * m].im; //Imaginary part of exp(-2*pi*i/3)
+        for (uint32_t k = 0; k < m; k++) {
+            FFTComplex s1 = fftMul(out[k + m], twiddles[k * stride]);
+            FFTComplex s2 = fftMul(out[k + (2 * m)], twiddles[2 * k * stride]);
+            FFTComplex sum = fftAdd(s1, s2);
+            FFTComplex diff = fftSub(s1, s2);
+            FFTComplex a = {out[k].re - (sum.re * 0.5f), out[k].im - (sum.im * 0.5f)};
+            diff = {diff.re * epi3, diff.im * epi3};
+
+            out[k] = fftAdd(out[k], sum);
+            out[k + m] = {a.re - diff.im, a.im + diff.re};
+            out[k + (2 * m)] = {a.re + diff.im, a.im - diff.re};
+        }
+    }
+
+    void butterfly4(FFTComplex *out, size_t stride, uint32_t m) const {
+        for (uint32_t k = 0; k < m; k++) {
+            FFTComplex s0 = fftMul(out[k + m], twiddles[k * stride]);
+            FFTComplex s1 = fftMul(out[k + (2 * m)], twiddles[2 * k * stride]);
+            FFTComplex s2 = fftMul(out[k + (3 * m)], twiddles[3 * k * stride]);
+            FFTComplex s5 = fftSub(out[k], s1);
+            FFTComplex first = fftAdd(out[k], s1);
+            FFTComplex s3 = fftAdd(s0, s2);
+            FFTComplex s4 = fftSub(s0, s2);
+
+            out[k] = fftAdd(first, s3);
+            out[k + (2 * m)] = fftSub(first, s3);
+            out[k + m] = {s5.re + s4.im, s5.im - s4.re};
+            out[k + (3 * m)] = {s5.re - s4.im, s5.im + s4.re};
+        }
+    }
+
+    void butterfly5(FFTComplex *out, size_t stride, uint32_t m) const {
+        const FFTComplex ya = twiddles[stride * m]; //exp(-2*pi*i/5)
+        const FFTComplex yb = twiddles[2 * stride * m]; //exp(-4*pi*i/5)
+        for (uint32_t k = 0; k < m; k++) {
+            FFTComplex s0 = out[k];
+            FFTComplex s1 = fftMul(out[k + m], twiddles[k * stride]);
+            FFTComplex s2 = fftMul(out[k + (2 * m)], twiddles[2 * k * stride]);
+            FFTComplex s3 = fftMul(out[k + (3 * m)], twiddles[3 * k * stride]);
+            FFTComplex s4 = fftMul(out[k + (4 * m)], twiddles[4 * k * stride]);
+            FFTComplex s7 = fftAdd(s1, s4);
+            FFTComplex s10 = fftSub(s1, s4);
+            FFTComplex s8 = fftAdd(s2, s3);
+            FFTComplex s9 = fftSub(s2, s3);
+
+            out[k] = {s0.re + s7.re + s8.re, s0.im + s7.im + s8.im};
+
+            FFTComplex s5 = {s0.re + (s7.re * ya.re) + (s8.re * yb.re), s0.im + (s7.im * ya.re) + (s8.im * yb.re)};
+            FFTComplex s6 = {(s10.im * ya.im) + (s9.im * yb.im), -(s10.re * ya.im) - (s9.re * yb.im)};
+            out[k + m] = fftSub(s5, s6);
+            out[k + (4 * m)] = fftAdd(s5, s6);
+
+            FFTComplex s11 = {s0.re + (s7.re * yb.re) + (s8.re * ya.re), s0.im + (s7.im * yb.re) + (s8.im * ya.re)};
+            FFTComplex s12 = {-(s10.im * yb.im) + (s9.im * ya.im), (s10.re * yb.im) - (s9.re * ya.im)};
+            out[k + (2 * m)] = fftAdd(s11, s12);
+            out[k + (3 * m)] = fftSub(s11, s12);
+        }
+    }
+
+    //One stage - The p transforms of length m below it are done first, each from every p'th input, then combined with radix p butterflies
+    void stage(FFTComplex *out, const FFTComplex *in, size_t stride, const uint32_t *factor) const {
+        const uint32_t p = factor[0];
+        const uint32_t m = factor[1];
+        FFTComplex *end = out + (p * m);
+
+        if (m == 1) {
+            for (FFTComplex *o = out; o != end; o++, in += stride) {
+                *o = *in;
+            }
+        }
+        else {
+            for (FFTComplex *o = out; o != end; o += m, in += stride) {
+                stage(o, in, stride * p, factor + 2);
+            }
+        }
+
+        switch (p) {
+            case 2: butterfly2(out, stride, m); break;
+            case 3: butterfly3(out, stride, m); break;
+            case 4: butterfly4(out, stride, m); break;
+            default: butterfly5(out, stride, m); break;
+        }
+    }
+
+public:
+    ComplexFFT() {
+        for (uint32_t k = 0; k < N; k++) {
+            twiddles[k] = fftTwiddle(k, N);
+        }
+
+        //Radix 4 stages first as they need the fewest multiplies, then 2, 3 and 5
+        uint32_t n = N;
+        uint32_t p = 4;
+        int s = 0;
+        while (n > 1) {
+            while ((n % p) != 0) {
+                p = (p == 4) ? 2 : (p == 2) ? 3 : 5;
+            }
+            n /= p;
+            factors[s++] = p;
+            factors[s++] = n;
+        }
+    }
+
+    //Forward transform of N points - in and out must not overlap
+    void transform(const FFTComplex *in, FFTComplex *out) const {
+        if (N == 1) {
+            out[0] = in[0];
+            return;
+        }
+        stage(out, in, 1, factors);
+    }
+};
+
+//Transform of any length N as a circular convolution with a chirp, done with FFTs of the next power of 2 at or above 2N - 1
+template <uint32_t N>
+class BluesteinFFT {
+private:
+    static const uint32_t M = fftNextPow2((2 * N) - 1);
+    ComplexFFT<M> fft;
+    FFTComplex chirp[N]; //exp(-pi*i*n^2/N)
+    FFTComplex filter[M]; //Transform of the conjugate chirp, scaled by 1/M for the inverse transform
+    FFTComplex work[M];
+    FFTComplex result[M];
+
+public:
+    BluesteinFFT() {
+        for (uint32_t n = 0; n < N; n++) {
+            chirp[n] = fftTwiddle(((uint64_t)n * n) % (2 * N), 2 * N); //n^2 is taken mod 2N so the phase stays accurate
+        }
+
+        for (uint32_t i = 0; i < M; i++) {
+            work[i] = {0.0f, 0.0f};
+        }
+        work[0] = fftConj(chirp[0]);
+        for (uint32_t n = 1; n < N; n++) {
+            work[n] = fftConj(chirp[n]);
+            work[M - n] = work[n];
+        }
+        fft.transform(work, filter);
+        for (uint32_t i = 0; i < M; i++) {
+            filter[i] = {filter[i].re / M, filter[i].im / M};
+        }
+    }
+
+    //Forward transform of N points - in and out may be the same buffer
+    void transform(const FFTComplex *in, FFTComplex *out) {
+        for (uint32_t n = 0; n < N; n++) {
+            work[n] = fftMul(in[n], chirp[n]);
+        }
+        for (uint32_t i = N; i < M; i++) {
+            work[i] = {0.0f, 0.0f};
+        }
+        fft.transform(work, result);
+
+        //The inverse transform is a forward one with the data conjugated either side of it
+        for (uint32_t i = 0; i < M; i++) {
+            work[i] = fftConj(fftMul(result[i], filter[i]));
+        }
+        fft.transform(work, result);
+        for (uint32_t k = 0; k < N; k++) {
+            out[k] = fftMul(fftConj(result[k]), chirp[k]);
+        }
+    }
+};
+
+//Transform of N real samples - Only the first N/2 + 1 bins are given, as the rest mirror them
+template <uint32_t N, bool Packed = ((N % 2) == 0) && fftSmooth(N / 2)>
+class RealFFT {
+private:
+    ComplexFFT<N / 2> fft;
+    FFTComplex split[N / 2]; //exp(-2*pi*i*k/N) - Combines the transforms of the even and odd samples
+    FFTComplex packed[N / 2];
+    FFTComplex half[N / 2];
+
+    //Runs the half length transform of the samples packed in pairs - Even samples as the real part, odd ones as the imaginary part
+    void run(const float *in) {
+        for (uint32_t n = 0; n < N / 2; n++) {
+            packed[n] = {in[2 * n], in[(2 * n) + 1]};
+        }
+        fft.transform(packed, half);
+    }
+
+    //Bin k of the full transform from the half length one
+    FFTComplex bin(uint32_t k) const {
+        if (k == 0 || k == N / 2) {
+            return {(k == 0) ? (half[0].re + half[0].im) : (half[0].re - half[0].im), 0.0f};
+        }
+        FFTComplex a = half[k];
+        FFTComplex b = fftConj(half[(N / 2) - k]);
+        FFTComplex even = {(a.re + b.re) * 0.5f, (a.im + b.im) * 0.5f};
+        FFTComplex odd = {(a.im - b.im) * 0.5f, (b.re - a.re) * 0.5f};
+        return fftAdd(even, fftMul(split[k], odd));
+    }
+
+public:
+    static const uint32_t bins = (N / 2) + 1;
+
+    RealFFT() {
+        for (uint32_t k = 0; k < N / 2; k++) {
+            split[k] = fftTwiddle(k, N);
+        }
+    }
+
+    //Spectrum of N samples - Writes bins values to out
+    void transform(const float *in, FFTComplex *out) {
+        run(in);
+        for (uint32_t k = 0; k < bins; k++) {
+            out[k] = bin(k);
+        }
+    }
+
+    //Power |X[k]|^2 of the first count bins, up to bins
+    void power(const float *in, float *out, uint32_t count) {
+        run(in);
+        for (uint32_t k = 0; k < count && k < bins; k++) {
+            FFTComplex x = bin(k);
+            out[k] = (x.re * x.re) + (x.im * x.im);
+        }
+    }
+};
+
+//Odd lengths, and even ones whose half has a prime factor above 5 - The samples go through a complex transform of all N points
+template <uint32_t N>
+class RealFFT<N, false> {
+private:
+    typename std::conditional<fftSmooth(N), ComplexFFT<N>, BluesteinFFT<N>>::type fft;
+    FFTComplex samples[N];
+    FFTComplex spectrum[N];
+
+    void run(const float *in) {
+        for (uint32_t n = 0; n < N; n++) {
+            samples[n] = {in[n], 0.0f};
+        }
+        fft.transform(samples, spectrum);
+    }
+
+public:
+    static const uint32_t bins = (N / 2) + 1;
+
+    void transform(const float *in, FFTComplex *out) {
+        run(in);
+        for (uint32_t k = 0; k < bins; k++) {
+            out[k] = spectrum[k];
+        }
+    }
+
+    void power(const float *in, float *out, uint32_t count) {
+        run(in);
+        for (uint32_t k = 0; k < count && k < bins; k++) {
+            out[k] = (spectrum[k].re * spectrum[k].re) + (spectrum[k].im * spectrum[k].im);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,260 @@
+#ifndef __FIXED_DFT_HPP__
+#define __FIXED_DFT_HPP__
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "coefficients.hpp"
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cmsis.h"
+#endif
+
+/*
+Fixed point DFT of the first bins of an N sample window - process() does its sums on doubles, which the Cortex-M4F only has in
+software. These kernels stay in integers.
+- DFTQ15 takes Q15 samples and keeps one period of cos and -sin in Q15, N of each (800 bytes for 200), stepping through them k at a
+  time for bin k as DFTQ31 does. The compiler builds them (TwiddlesQ15, constexpr, from sineOfTurns() in coefficients.hpp), so they
+  sit in flash and take no RAM. Its inner loop takes two samples per 32 bit load, packs the two coefficients they need into one word
+  and sums both products with one SMLALD into a 64 bit accumulator, so nothing overflows whatever N and the samples are.
+- Bins x N tables would let the coefficients be loaded in pairs too, but take 24.8KB of flash for 31 bins of 200 - More than the
+  quarter wave table saved (coefficients.hpp) - to save the two halfword loads and the pack of every pair.
+- The dual multiply-accumulate path (binQ15Dual) uses the CMSIS __SMLALD intrinsic where the core has the DSP extension
+  (__ARM_FEATURE_DSP), and otherwise a C version that does what the instruction does. binQ15Scalar is the plain loop. Both are integer
+  sums that cannot overflow, so they give the same bits, and transform() takes the dual path on the target and the scalar one
+  elsewhere. Both are kept callable so that can be checked - Spectrum_Benchmark on the host, fft-benchmark on the board.
+- DFTQ31 takes Q31 samples. The M4 has no dual 32 bit multiply, so each product is a 64 bit SMULL, cut to 2.48 and summed in 64 bits
+  (16 bits of headroom, as CMSIS-DSP does). It keeps one table of N coefficients and steps through it for each bin.
+- power() gives |X[k]|^2 - For DFTQ15 in Q30 (the square of the sample units, as GoertzelBankQ), for DFTQ31 in Q46. A float window
+  scaled so full scale is 1.0 has the power process() gives divided by 2^30 or 2^46.
+- Spectrum_Benchmark checks both against a DFT worked out in double.
+*/
+
+//Float sample to Q15, saturated - fullScale maps to 1.0
+inline int16_t toQ15(float x, float fullScale) {
+    float scaled = roundf((x / fullScale) * 32768.0f);
+    return (int16_t)((scaled > 32767.0f) ? 32767.0f : (scaled < -32768.0f) ? -32768.0f : scaled);
+}
+
+//Float sample to Q31, saturated
+inline int32_t toQ31(float x, float fullScale) {
+    double scaled = round(((double)x / fullScale) * 2147483648.0);
+    return (int32_t)((scaled > 2147483647.0) ? 2147483647.0 : (scaled < -2147483648.0) ? -2147483648.0 : scaled);
+}
+
+//SMLALD - acc + lo(a) * lo(b) + hi(a) * hi(b), with the halves signed
+inline int64_t dspSmlald(uint32_t a, uint32_t b, int64_t acc) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    return (int64_t)__SMLALD(a, b, (uint64_t)acc);
+#else
+    int32_t lo = (int32_t)(int16_t)(a & 0xFFFF) * (int16_t)(b & 0xFFFF);
+    int32_t hi = (int32_t)(int16_t)(a >> 16) * (int16_t)(b >> 16);
+    return (int64_t)((uint64_t)acc + (uint64_t)(int64_t)lo + (uint64_t)(int64_t)hi);
+#endif
+}
+
+//Two Q15 values from one 32 bit load - The first in the low half, as the core is little endian
+inline uint32_t dspLoadPair(const int16_t *p) {
+    uint32_t pair;
+    memcpy(&pair, p, sizeof(pair));
+    return pair;
+}
+
+//Two Q15 values in one word as a pair load gives them - PKHBT on the target
+inline uint32_t dspPack(int16_t lo, int16_t hi) {
+    return (uint32_t)(uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
+
+//Next index into a period of n coefficients, k on from m - k is below n
+inline uint32_t dspStep(uint32_t m, uint32_t k, uint32_t n) {
+    return (m + k >= n) ? m + k - n : m + k;
+}
+
+//Bin k of the n samples of x in Q30, one product at a time - cosTable and sineTable hold one period of n coefficients, read at k*i mod n.
+//Even and odd samples step through them 2k at a time on their own, so the two index updates do not wait on each other. k is below n
+inline void binQ15Scalar(const int16_t *x, const int16_t *cosTable, const int16_t *sineTable, uint32_t n, uint32_t k, int64_t &re,
+                         int64_t &im) {
+    int64_t sumRe = 0;
+    int64_t sumIm = 0;
+    uint32_t step = dspStep(k, k, n);
+    uint32_t even = 0;
+    uint32_t odd = k;
+    uint32_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        sumRe += (int32_t)x[i] * cosTable[even];
+        sumRe += (int32_t)x[i + 1] * cosTable[odd];
+        sumIm += (int32_t)x[i] * sineTable[even];
+        sumIm += (int32_t)x[i + 1] * sineTable[odd];
+        even = dspStep(even, step, n);
+        odd = dspStep(odd, step, n);
+    }
+    if (i < n) {
+        sumRe += (int32_t)x[i] * cosTable[even];
+        sumIm += (int32_t)x[i] * sineTable[even];
+    }
+    re = sumRe;
+    im = sumIm;
+}
+
+//Bin k in Q30, two samples per load and two products per SMLALD - The coefficients of the pair are packed into one word. An odd last
+//sample is done on its own
+inline void binQ15Dual(const int16_t *x, const int16_t *cosTable, const int16_t *sineTable, uint32_t n, uint32_t k, int64_t &re,
+                       int64_t &im) {
+    int64_t sumRe = 0;
+    int64_t sumIm = 0;
+    uint32_t step = dspStep(k, k, n);
+    uint32_t even = 0;
+    uint32_t odd = k;
+    uint32_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        uint32_t pair = dspLoadPair(x + i);
+        sumRe = dspSmlald(pair, dspPack(cosTable[even], cosTable[odd]), sumRe);
+        sumIm = dspSmlald(pair, dspPack(sineTable[even], sineTable[odd]), sumIm);
+        even = dspStep(even, step, n);
+        odd = dspStep(odd, step, n);
+    }
+    if (i < n) {
+        sumRe += (int32_t)x[i] * cosTable[even];
+        sumIm += (int32_t)x[i] * sineTable[even];
+    }
+    re = sumRe;
+    im = sumIm;
+}
+
+inline void binQ15(const int16_t *x, const int16_t *cosTable, const int16_t *sineTable, uint32_t n, uint32_t k, int64_t &re, int64_t &im) {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    binQ15Dual(x, cosTable, sineTable, n, k, re, im);
+#else
+    binQ15Scalar(x, cosTable, sineTable, n, k, re, im);
+#endif
+}
+
+//Rounded arithmetic shift right of a 64 bit sum
+inline int64_t dspRound(int64_t value, int shift) {
+    return (value + (1LL << (shift - 1))) >> shift;
+}
+
+//Double to Q15, rounded half away from zero and saturated - round() is not constexpr
+constexpr int16_t coefficientQ15(double value) {
+    double scaled = value * 32768.0;
+    scaled = (scaled < 0.0) ? -(double)(int64_t)(0.5 - scaled) : (double)(int64_t)(scaled + 0.5);
+    return (int16_t)((scaled > 32767.0) ? 32767.0 : (scaled < -32768.0) ? -32768.0 : scaled);
+}
+
+//Coefficients of DFTQ15 - One period of each, read at (k * n) mod N for bin k
+template <uint32_t N>
+struct TwiddlesQ15 {
+    int16_t cosTable[N]; //cos(2*pi*m/N) in Q15
+    int16_t sineTable[N]; //-sin(2*pi*m/N) in Q15
+
+    constexpr TwiddlesQ15() : cosTable(), sineTable() {
+        for (uint32_t m = 0; m < N; m++) {
+            cosTable[m] = coefficientQ15(sineOfTurns((4 * m) + N, 4 * N)); //A quarter turn on
+            sineTable[m] = coefficientQ15(-sineOfTurns(m, N));
+        }
+    }
+};
+
+template <uint32_t N>
+constexpr TwiddlesQ15<N> twiddlesQ15 = TwiddlesQ15<N>();
+
+template <uint32_t N, uint32_t Bins>
+class DFTQ15 {
+    static_assert(Bins > 0 && Bins <= (N / 2) + 1, "DFTQ15 gives bins 0 to N/2 of a real signal");
+
+private:
+    //Bins in Q30 through the given kernel
+    template <typename Bin>
+    void transformWith(Bin bin, const int16_t *x, int64_t *re, int64_t *im) const {
+        for (uint32_t k = 0; k < Bins; k++) {
+            bin(x, twiddlesQ15<N>.cosTable, twiddlesQ15<N>.sineTable, N, k, re[k], im[k]);
+        }
+    }
+
+public:
+
+    //Real and imaginary parts of each bin in Q30 - The dual multiply-accumulate path where the core has it
+    void transform(const int16_t *x, int64_t *re, int64_t *im) const {
+        transformWith(binQ15, x, re, im);
+    }
+
+    void transformScalar(const int16_t *x, int64_t *re, int64_t *im) const {
+        transformWith(binQ15Scalar, x, re, im);
+    }
+
+    void transformDual(const int16_t *x, int64_t *re, int64_t *im) const {
+        transformWith(binQ15Dual, x, re, im);
+    }
+
+    //|X[k]|^2 in Q30 for the first count bins (up to Bins)
+    void power(const int16_t *x, int64_t *out, uint32_t count) const {
+        count = (count < Bins) ? count : Bins;
+        for (uint32_t k = 0; k < count; k++) {
+            int64_t re;
+            int64_t im;
+            binQ15(x, twiddlesQ15<N>.cosTable, twiddlesQ15<N>.sineTable, N, k, re, im);
+            re = dspRound(re, 15);
+            im = dspRound(im, 15);
+            out[k] = (re * re) + (im * im);
+        }
+    }
+};
+
+template <uint32_t N, uint32_t Bins>
+class DFTQ31 {
+    static_assert(Bins > 0 && Bins <= (N / 2) + 1, "DFTQ31 gives bins 0 to N/2 of a real signal");
+    static_assert(N <= 256, "DFTQ31 power needs |X[k]| below 2^8 to fit Q46 in 64 bits");
+
+private:
+    int32_t cosTable[N]; //cos(2*pi*m/N) in Q31
+    int32_t sineTable[N]; //-sin(2*pi*m/N) in Q31
+
+    static int32_t coefficient(double value) {
+        double scaled = round(value * 2147483648.0);
+        return (int32_t)((scaled > 2147483647.0) ? 2147483647.0 : (scaled < -2147483648.0) ? -2147483648.0 : scaled);
+    }
+
+    //Bin k in 16.48 - Stepping through the tables k at a time
+    void bin(const int32_t *x, uint32_t k, int64_t &re, int64_t &im) const {
+        int64_t sumRe = 0;
+        int64_t sumIm = 0;
+        uint32_t m = 0; //k*n mod N
+        for (uint32_t n = 0; n < N; n++) {
+            sumRe += ((int64_t)x[n] * cosTable[m]) >> 14;
+            sumIm += ((int64_t)x[n] * sineTable[m]) >> 14;
+            m = (m + k >= N) ? m + k - N : m + k;
+        }
+        re = sumRe;
+        im = sumIm;
+    }
+
+public:
+    DFTQ31() {
+        const double pi = 3.14159265358979323846;
+        for (uint32_t m = 0; m < N; m++) {
+            cosTable[m] = coefficient(cos((2.0 * pi * m) / N));
+            sineTable[m] = coefficient(-sin((2.0 * pi * m) / N));
+        }
+    }
+
+    //Real and imaginary parts of each bin in 16.48
+    void transform(const int32_t *x, int64_t *re, int64_t *im) const {
+        for (uint32_t k = 0; k < Bins; k++) {
+            bin(x, k, re[k], im[k]);
+        }
+    }
+
+    //|X[k]|^2 in Q46 for the first count bins (up to Bins) - Each part is cut to 8.23 first
+    void power(const int32_t *x, int64_t *out, uint32_t count) const {
+        count = (count < Bins) ? count : Bins;
+        for (uint32_t k = 0; k < count; k++) {
+            int64_t re;
+            int64_t im;
+            bin(x, k, re, im);
+            re = dspRound(re, 25);
+            im = dspRound(im, 25);
+            out[k] = (re * re) + (im * im);
+        }
+    }
+};
+
+#endif
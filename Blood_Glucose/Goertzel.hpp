@@ -0,0 +1,198 @@
+#ifndef __GOERTZEL_HPP__
+#define __GOERTZEL_HPP__
+
+#include <cmath>
+#include <cstdint>
+
+/*
+Goertzel filter bank for the low frequency bins - Only the 31 bins process() wants (0 to 15Hz of a 200 sample window at 100Hz) are
+worked out, a sample at a time as the samples arrive, so the spectral work is spread evenly over the window rather than landing as one
+burst at the end of it.
+- Each bin is a second order resonator, s[n] = x[n] + 2cos(w)s[n-1] - s[n-2]. One multiply and two adds per bin per sample.
+- At the end of each window the power of every bin, s1^2 + s2^2 - 2cos(w)s1s2, is latched and the resonators are cleared for the next one.
+  push() returns true when that happens and power() reads the latched results until the next window ends.
+- Near DC (and near half the rate) s1 and s2 grow large and nearly equal, so the power is worked out as (s1 - s2)^2 + (2 - 2cos(w))s1s2
+  (or (s1 + s2)^2 - (2 + 2cos(w))s1s2) - Both terms stay the size of the result rather than cancelling.
+- The power is |sum of x[n]e^(-iwn)|^2 for the window, which is the DFT bin power process() gives when a target frequency is a whole
+  number of bins (k * rate / N - See binFrequencies()). Targets do not have to be, so a bin can sit on a known pulse or breathing rate.
+- GoertzelBank works in float. GoertzelBankQ takes integer samples (up to +/-32767) and works in fixed point, with Q29 coefficients,
+  32 bit resonators and 64 bit products, for cores without an FPU. Its power comes out in sample units squared.
+- A float coefficient moves a target below 1Hz by up to ~1e-5Hz, which on a large DC level shows as errors up to ~1e-3 of the peak
+  there. GoertzelBankQ keeps those to ~1e-5.
+- Spectrum_Benchmark checks both against a direct DFT on the host.
+*/
+
+//Target frequencies of the first count DFT bins of an N sample window - k * rateHz / N, as process() uses
+inline void binFrequencies(float *frequenciesHz, uint32_t count, float rateHz, uint32_t N) {
+    for (uint32_t k = 0; k < count; k++) {
+        frequenciesHz[k] = (k * rateHz) / N;
+    }
+}
+
+//2cos(2*pi*f/rate) - Worked out in double as it is only done when the bank is set up
+inline double goertzelCoefficient(float frequencyHz, float rateHz) {
+    const double pi = 3.14159265358979323846;
+    return 2.0 * cos((2.0 * pi * frequencyHz) / rateHz);
+}
+
+template <uint32_t MaxBins>
+class GoertzelBank {
+private:
+    float coefficients[MaxBins];
+    float s1[MaxBins];
+    float s2[MaxBins];
+    float results[MaxBins];
+    uint32_t bins = 0;
+    uint32_t windowSamples = 0;
+    uint32_t count = 0;
+
+public:
+    //Sets count target frequencies for windows of windowLength samples taken at rateHz - Returns false if there are too many or the
+    //window is empty. The window starts again from the next sample
+    bool configure(const float *frequenciesHz, uint32_t binCount, float rateHz, uint32_t windowLength) {
+        if (binCount > MaxBins || windowLength == 0) {
+            return false;
+        }
+        bins = binCount;
+        windowSamples = windowLength;
+        for (uint32_t b = 0; b < bins; b++) {
+            coefficients[b] = (float)goertzelCoefficient(frequenciesHz[b], rateHz);
+            results[b] = 0.0f;
+        }
+        restart();
+        return true;
+    }
+
+    //Drops the window in progress - The next sample starts a new one
+    void restart() {
+        for (uint32_t b = 0; b < bins; b++) {
+            s1[b] = 0.0f;
+            s2[b] = 0.0f;
+        }
+        count = 0;
+    }
+
+    //Adds a sample to every bin - Returns true if it ended a window, with the power of each bin ready from power()
+    bool push(float x) {
+        for (uint32_t b = 0; b < bins; b++) {
+            float s = x + (coefficients[b] * s1[b]) - s2[b];
+            s2[b] = s1[b];
+            s1[b] = s;
+        }
+        if (++count < windowSamples) {
+            return false;
+        }
+
+        for (uint32_t b = 0; b < bins; b++) {
+            if (coefficients[b] >= 0.0f) {
+                float d = s1[b] - s2[b];
+                results[b] = (d * d) + ((2.0f - coefficients[b]) * s1[b] * s2[b]);
+            } else {
+                float d = s1[b] + s2[b];
+                results[b] = (d * d) - ((2.0f + coefficients[b]) * s1[b] * s2[b]);
+            }
+        }
+        restart();
+        return true;
+    }
+
+    //Power of each bin for the last window that ended
+    void power(float *out) const {
+        for (uint32_t b = 0; b < bins; b++) {
+            out[b] = results[b];
+        }
+    }
+
+    uint32_t binCount() const {
+        return bins;
+    }
+};
+
+template <uint32_t MaxBins>
+class GoertzelBankQ {
+public:
+    //A full scale DC input grows its resonator as x * n^2 / 2, so windows are limited to keep that inside 32 bits. Other bins grow
+    //less, as x * n / sin(w) at most
+    static const uint32_t maxWindowSamples = 360;
+
+private:
+    static const int coefficientBits = 29;
+    int32_t coefficients[MaxBins]; //2cos(w) in Q29
+    int32_t s1[MaxBins];
+    int32_t s2[MaxBins];
+    int64_t results[MaxBins];
+    uint32_t bins = 0;
+    uint32_t windowSamples = 0;
+    uint32_t count = 0;
+
+    //c * s in Q29, rounded to the nearest - Kept in 64 bits as 2cos(w) * s can pass 32 bits on the way to the next state
+    static int64_t scale(int32_t c, int32_t s) {
+        return (((int64_t)c * s) + (1LL << (coefficientBits - 1))) >> coefficientBits;
+    }
+
+public:
+    //As GoertzelBank::configure() - Also returns false for windows over maxWindowSamples
+    bool configure(const float *frequenciesHz, uint32_t binCount, float rateHz, uint32_t windowLength) {
+        if (binCount > MaxBins || windowLength == 0 || windowLength > maxWindowSamples) {
+            return false;
+        }
+        bins = binCount;
+        windowSamples = windowLength;
+        for (uint32_t b = 0; b < bins; b++) {
+            double c = goertzelCoefficient(frequenciesHz[b], rateHz) * (double)(1LL << coefficientBits);
+            coefficients[b] = (int32_t)((c < 0) ? (c - 0.5) : (c + 0.5));
+            results[b] = 0;
+        }
+        restart();
+        return true;
+    }
+
+    void restart() {
+        for (uint32_t b = 0; b < bins; b++) {
+            s1[b] = 0;
+            s2[b] = 0;
+        }
+        count = 0;
+    }
+
+    //Adds a sample, up to +/-32767, to every bin - Returns true if it ended a window
+    bool push(int32_t x) {
+        for (uint32_t b = 0; b < bins; b++) {
+            int32_t s = (int32_t)(x + scale(coefficients[b], s1[b]) - s2[b]);
+            s2[b] = s1[b];
+            s1[b] = s;
+        }
+        if (++count < windowSamples) {
+            return false;
+        }
+
+        //2 - 2cos(w) and 2 + 2cos(w) both fit Q29 in 32 bits when unsigned, and the products with s1 stay small where they are used
+        const int64_t two = 1LL << (coefficientBits + 1);
+        for (uint32_t b = 0; b < bins; b++) {
+            if (coefficients[b] >= 0) {
+                int64_t d = (int64_t)s1[b] - s2[b];
+                int64_t cross = ((((two - coefficients[b]) * s1[b]) + (1LL << (coefficientBits - 1))) >> coefficientBits) * s2[b];
+                results[b] = (d * d) + cross;
+            } else {
+                int64_t d = (int64_t)s1[b] + s2[b];
+                int64_t cross = ((((two + coefficients[b]) * s1[b]) + (1LL << (coefficientBits - 1))) >> coefficientBits) * s2[b];
+                results[b] = (d * d) - cross;
+            }
+        }
+        restart();
+        return true;
+    }
+
+    //Power of each bin for the last window that ended, in sample units squared
+    void power(int64_t *out) const {
+        for (uint32_t b = 0; b < bins; b++) {
+            out[b] = results[b];
+        }
+    }
+
+    uint32_t binCount() const {
+        return bins;
+    }
+};
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef __SLIDING_DFT_HPP__
+#define __SLIDING_DFT_HPP__
+
+#include "FFT.hpp"
+#include <cstdint>
+
+/*
+Sliding DFT of the first bins of an N sample window - A fresh power spectrum of the last N samples after every sample, for display
+and heart rate tracking at the full sample rate, where process() and RealFFT give one per window.
+- Each bin is updated in O(1) per sample, X[k] = (X[k] + x[n] - x[n - N]) * exp(2*pi*i*k/N), so Bins bins cost Bins complex multiplies.
+  The last N samples are kept to know what leaves the window.
+- The recursion never forgets its rounding errors, and a float exp(2*pi*i*k/N) that is not exactly on the unit circle makes a bin grow
+  or decay over time. To bound that it is re-anchored - Alongside the slide, each window is also summed directly, x[n]exp(-2*pi*i*k*m/N)
+  as sample m of it arrives, and at the end of the window that exact DFT replaces the slid one. The same work every sample, so there
+  is no burst, and the error never builds over more than two windows.
+- ready() is false until N samples have arrived - Before that the bins are of a window padded with zeros.
+- power() gives |X[k]|^2 as process() and RealFFT::power() do, and binHz() in FFT.hpp the frequency of a bin.
+- Spectrum_Benchmark measures the drift with and without re-anchoring against a DFT worked out again in double.
+*/
+
+template <uint32_t N, uint32_t Bins>
+class SlidingDFT {
+    static_assert(Bins > 0 && Bins <= (N / 2) + 1, "SlidingDFT tracks bins 0 to N/2 of a real signal");
+
+private:
+    FFTComplex twiddles[N]; //exp(-2*pi*i*m/N)
+    float history[N];
+    FFTComplex bins[Bins]; //Slid DFT of the last N samples
+    FFTComplex anchor[Bins]; //Direct DFT of the window in progress
+    uint32_t anchorIndex[Bins]; //k*m mod N for the next sample of the window in progress
+    uint32_t position = 0; //Oldest sample in history, where the next one goes
+    uint32_t anchorCount = 0;
+    uint32_t filled = 0;
+    bool anchoring = true;
+
+public:
+    SlidingDFT() {
+        for (uint32_t m = 0; m < N; m++) {
+            twiddles[m] = fftTwiddle(m, N);
+        }
+        reset();
+    }
+
+    //Clears the window - The next N samples fill it again
+    void reset() {
+        for (uint32_t m = 0; m < N; m++) {
+            history[m] = 0.0f;
+        }
+        for (uint32_t k = 0; k < Bins; k++) {
+            bins[k] = {0.0f, 0.0f};
+            anchor[k] = {0.0f, 0.0f};
+            anchorIndex[k] = 0;
+        }
+        position = 0;
+        anchorCount = 0;
+        filled = 0;
+    }
+
+    //Whether the window has been re-anchored each time it ends - On by default, Spectrum_Benchmark turns it off to see the drift
+    void setAnchoring(bool enabled) {
+        anchoring = enabled;
+        anchorCount = 0;
+        for (uint32_t k = 0; k < Bins; k++) {
+            anchor[k] = {0.0f, 0.0f};
+            anchorIndex[k] = 0;
+        }
+    }
+
+    //Slides the window on by one sample
+    void push(float x) {
+        float delta = x - history[position];
+        history[position] = x;
+        position = (position + 1 == N) ? 0 : position + 1;
+        filled = (filled < N) ? filled + 1 : N;
+
+        //exp(2*pi*i*k/N) is the conjugate of twiddles[k]
+        for (uint32_t k = 0; k < Bins; k++) {
+            FFTComplex sum = {bins[k].re + delta, bins[k].im};
+            bins[k] = fftMul(sum, fftConj(twiddles[k]));
+        }
+        if (!anchoring) {
+            return;
+        }
+
+        for (uint32_t k = 0; k < Bins; k++) {
+            const FFTComplex &w = twiddles[anchorIndex[k]];
+            anchor[k].re += x * w.re;
+            anchor[k].im += x * w.im;
+            anchorIndex[k] = (anchorIndex[k] + k >= N) ? anchorIndex[k] + k - N : anchorIndex[k] + k;
+        }
+        if (++anchorCount < N) {
+            return;
+        }
+
+        //The window that just ended is the last N samples, so the direct sum is what the slide should hold
+        for (uint32_t k = 0; k < Bins; k++) {
+            bins[k] = anchor[k];
+            anchor[k] = {0.0f, 0.0f};
+            anchorIndex[k] = 0;
+        }
+        anchorCount = 0;
+    }
+
+    bool ready() const {
+        return filled == N;
+    }
+
+    //|X[k]|^2 of the last N samples for the first count bins (up to Bins)
+    void power(float *out, uint32_t count) const {
+        count = (count < Bins) ? count : Bins;
+        for (uint32_t k = 0; k < count; k++) {
+            out[k] = (bins[k].re * bins[k].re) + (bins[k].im * bins[k].im);
+        }
+    }
+
+    FFTComplex bin(uint32_t k) const {
+        return bins[k];
+    }
+};
+
+#endif
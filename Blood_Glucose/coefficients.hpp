@@ -1,74 +1,120 @@
-#include "mbed.h"
-#include <iostream>
-#include <math.h>
-#include <cmath>
+#ifndef __COEFFICIENTS_HPP__
+#define __COEFFICIENTS_HPP__
 
-//Cos Coeffs
-const float cosCoeff[31][200] = {
-{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
-{1,0.999506560365732,0.998026728428272,0.99556196460308,0.992114701314478,0.987688340595138,0.982287250728689,0.975916761938747,0.968583161128631,0.960293685676943,0.951056516295154,0.940880768954225,0.929776485888251,0.917754625683981,0.90482705246602,0.891006524188368,0.876306680043864,0.860742027003944,0.844327925502015,0.827080574274562,0.809016994374947,0.79015501237569,0.770513242775789,0.75011106963046,0.728968627421412,0.707106781186548,0.684547105928689,0.661311865323652,0.63742398974869,0.612907053652976,0.587785252292473,0.562083377852131,0.535826794978997,0.509041415750371,0.481753674101715,0.453990499739547,0.425779291565073,0.397147890634781,0.368124552684678,0.338737920245291,0.309016994374947,0.278991106039229,0.248689887164855,0.218143241396543,0.187381314585725,0.156434465040231,0.125333233564304,0.0941083133185143,0.0627905195293135,0.0314107590781284,6.12323399573677e-17,-0.0314107590781283,-0.0627905195293134,-0.0941083133185144,-0.125333233564304,-0.156434465040231,-0.187381314585725,-0.218143241396542,-0.248689887164855,-0.278991106039229,-0.309016994374947,-0.338737920245291,-0.368124552684678,-0.397147890634781,-0.425779291565073,-0.453990499739547,-0.481753674101715,-0.509041415750371,-0.535826794978997,-0.562083377852131,-0.587785252292473,-0.612907053652977,-0.63742398974869,-0.661311865323652,-0.684547105928689,-0.707106781186547,-0.728968627421411,-0.750111069630459,-0.770513242775789,-0.79015501237569,-0.809016994374947,-0.827080574274562,-0.844327925502015,-0.860742027003944,-0.876306680043864,-0.891006524188368,-0.904827052466019,-0.917754625683981,-0.929776485888251,-0.940880768954225,-0.951056516295154,-0.960293685676943,-0.968583161128631,-0.975916761938747,-0.982287250728689,-0.987688340595138,-0.992114701314478,-0.99556196460308,-0.998026728428272,-0.999506560365732,-1,-0.999506560365732,-0.998026728428272,-0.99556196460308,-0.992114701314478,-0.987688340595138,-0.982287250728689,-0.975916761938747,-0.968583161128631,-0.960293685676943,-0.951056516295154,-0.940880768954225,-0.929776485888251,-0.917754625683981,-0.90482705246602,-0.891006524188368,-0.876306680043864,-0.860742027003944,-0.844327925502015,-0.827080574274562,-0.809016994374948,-0.79015501237569,-0.770513242775789,-0.75011106963046,-0.728968627421412,-0.707106781186548,-0.684547105928689,-0.661311865323652,-0.63742398974869,-0.612907053652976,-0.587785252292473,-0.562083377852131,-0.535826794978996,-0.509041415750371,-0.481753674101715,-0.453990499739547,-0.425779291565072,-0.39714789063478,-0.368124552684678,-0.338737920245291,-0.309016994374948,-0.27899110603923,-0.248689887164854,-0.218143241396542,-0.187381314585725,-0.156434465040231,-0.125333233564305,-0.094108313318514,-0.0627905195293132,-0.0314107590781283,-1.83697019872103e-16,0.0314107590781279,0.0627905195293128,0.0941083133185145,0.125333233564304,0.156434465040231,0.187381314585724,0.218143241396542,0.248689887164855,0.278991106039229,0.309016994374947,0.338737920245291,0.368124552684677,0.39714789063478,0.425779291565072,0.453990499739546,0.481753674101716,0.509041415750372,0.535826794978997,0.562083377852131,0.587785252292473,0.612907053652976,0.637423989748689,0.661311865323651,0.684547105928688,0.707106781186547,0.728968627421411,0.75011106963046,0.770513242775789,0.79015501237569,0.809016994374947,0.827080574274562,0.844327925502015,0.860742027003943,0.876306680043863,0.891006524188368,0.904827052466019,0.917754625683981,0.929776485888251,0.940880768954225,0.951056516295154,0.960293685676943,0.968583161128631,0.975916761938747,0.982287250728689,0.987688340595138,0.992114701314478,0.99556196460308,0.998026728428272,0.999506560365732},
-{1,0.998026728428272,0.992114701314478,0.982287250728689,0.968583161128631,0.951056516295154,0.929776485888251,0.90482705246602,0.876306680043864,0.844327925502015,0.809016994374947,0.770513242775789,0.728968627421412,0.684547105928689,0.63742398974869,0.587785252292473,0.535826794978997,0.481753674101715,0.425779291565073,0.368124552684678,0.309016994374947,0.248689887164855,0.187381314585725,0.125333233564304,0.0627905195293135,6.12323399573677e-17,-0.0627905195293134,-0.125333233564304,-0.187381314585725,-0.248689887164855,-0.309016994374947,-0.368124552684678,-0.425779291565073,-0.481753674101715,-0.535826794978997,-0.587785252292473,-0.63742398974869,-0.684547105928689,-0.728968627421411,-0.770513242775789,-0.809016994374947,-0.844327925502015,-0.876306680043864,-0.904827052466019,-0.929776485888251,-0.951056516295154,-0.968583161128631,-0.982287250728689,-0.992114701314478,-0.998026728428272,-1,-0.998026728428272,-0.992114701314478,-0.982287250728689,-0.968583161128631,-0.951056516295154,-0.929776485888251,-0.90482705246602,-0.876306680043864,-0.844327925502015,-0.809016994374948,-0.770513242775789,-0.728968627421412,-0.684547105928689,-0.63742398974869,-0.587785252292473,-0.535826794978996,-0.481753674101715,-0.425779291565072,-0.368124552684678,-0.309016994374948,-0.248689887164854,-0.187381314585725,-0.125333233564305,-0.0627905195293132,-1.83697019872103e-16,0.0627905195293128,0.125333233564304,0.187381314585724,0.248689887164855,0.309016994374947,0.368124552684677,0.425779291565072,0.481753674101716,0.535826794978997,0.587785252292473,0.637423989748689,0.684547105928688,0.728968627421411,0.770513242775789,0.809016994374947,0.844327925502015,0.876306680043863,0.904827052466019,0.929776485888251,0.951056516295154,0.968583161128631,0.982287250728689,0.992114701314478,0.998026728428272,1,0.998026728428272,0.992114701314478,0.982287250728689,0.968583161128631,0.951056516295154,0.929776485888251,0.90482705246602,0.876306680043864,0.844327925502016,0.809016994374948,0.770513242775789,0.728968627421412,0.684547105928689,0.63742398974869,0.587785252292473,0.535826794978996,0.481753674101715,0.425779291565073,0.368124552684679,0.309016994374949,0.248689887164855,0.187381314585725,0.125333233564305,0.0627905195293142,1.19434011948696e-15,-0.0627905195293136,-0.125333233564304,-0.187381314585725,-0.248689887164855,-0.309016994374947,-0.368124552684677,-0.425779291565073,-0.481753674101716,-0.535826794978997,-0.587785252292473,-0.637423989748691,-0.684547105928689,-0.728968627421412,-0.770513242775789,-0.809016994374947,-0.844327925502015,-0.876306680043864,-0.90482705246602,-0.929776485888251,-0.951056516295153,-0.968583161128631,-0.982287250728689,-0.992114701314478,-0.998026728428272,-1,-0.998026728428272,-0.992114701314478,-0.982287250728689,-0.968583161128631,-0.951056516295154,-0.929776485888252,-0.90482705246602,-0.876306680043863,-0.844327925502015,-0.809016994374948,-0.77051324277579,-0.728968627421412,-0.68454710592869,-0.637423989748691,-0.587785252292475,-0.535826794978996,-0.481753674101715,-0.425779291565072,-0.368124552684678,-0.309016994374948,-0.248689887164856,-0.187381314585726,-0.125333233564306,-0.0627905195293152,-2.20498321910182e-15,0.0627905195293126,0.125333233564305,0.187381314585725,0.248689887164855,0.309016994374947,0.368124552684677,0.425779291565072,0.481753674101714,0.535826794978995,0.587785252292473,0.637423989748689,0.684547105928689,0.728968627421412,0.770513242775789,0.809016994374947,0.844327925502015,0.876306680043863,0.904827052466019,0.929776485888251,0.951056516295153,0.968583161128631,0.982287250728688,0.992114701314478,0.998026728428272},
-{1,0.99556196460308,0.982287250728689,0.960293685676943,0.929776485888251,0.891006524188368,0.844327925502015,0.79015501237569,0.728968627421412,0.661311865323652,0.587785252292473,0.509041415750371,0.425779291565073,0.338737920245291,0.248689887164855,0.156434465040231,0.0627905195293135,-0.0314107590781283,-0.125333233564304,-0.218143241396542,-0.309016994374947,-0.397147890634781,-0.481753674101715,-0.562083377852131,-0.63742398974869,-0.707106781186547,-0.770513242775789,-0.827080574274562,-0.876306680043864,-0.917754625683981,-0.951056516295154,-0.975916761938747,-0.992114701314478,-0.999506560365732,-0.998026728428272,-0.987688340595138,-0.968583161128631,-0.940880768954225,-0.90482705246602,-0.860742027003944,-0.809016994374948,-0.75011106963046,-0.684547105928689,-0.612907053652976,-0.535826794978996,-0.453990499739547,-0.368124552684678,-0.27899110603923,-0.187381314585725,-0.094108313318514,-1.83697019872103e-16,0.0941083133185145,0.187381314585724,0.278991106039229,0.368124552684677,0.453990499739546,0.535826794978997,0.612907053652976,0.684547105928688,0.75011106963046,0.809016994374947,0.860742027003943,0.904827052466019,0.940880768954225,0.968583161128631,0.987688340595138,0.998026728428272,0.999506560365732,0.992114701314478,0.975916761938748,0.951056516295154,0.917754625683981,0.876306680043864,0.827080574274562,0.770513242775789,0.707106781186548,0.63742398974869,0.56208337785213,0.481753674101715,0.397147890634781,0.309016994374949,0.218143241396543,0.125333233564305,0.0314107590781293,-0.0627905195293136,-0.156434465040231,-0.248689887164855,-0.338737920245291,-0.425779291565073,-0.509041415750371,-0.587785252292473,-0.661311865323653,-0.728968627421412,-0.79015501237569,-0.844327925502015,-0.891006524188368,-0.929776485888251,-0.960293685676943,-0.982287250728689,-0.99556196460308,-1,-0.99556196460308,-0.982287250728689,-0.960293685676943,-0.929776485888252,-0.891006524188368,-0.844327925502015,-0.790155012375691,-0.728968627421412,-0.661311865323652,-0.587785252292475,-0.509041415750372,-0.425779291565072,-0.338737920245293,-0.248689887164856,-0.15643446504023,-0.0627905195293152,0.0314107590781277,0.125333233564305,0.218143241396541,0.309016994374947,0.397147890634781,0.481753674101714,0.56208337785213,0.637423989748689,0.707106781186547,0.770513242775789,0.827080574274561,0.876306680043863,0.917754625683981,0.951056516295153,0.975916761938747,0.992114701314478,0.999506560365732,0.998026728428272,0.987688340595138,0.968583161128631,0.940880768954226,0.90482705246602,0.860742027003944,0.809016994374948,0.75011106963046,0.684547105928689,0.612907053652977,0.535826794978997,0.453990499739546,0.368124552684678,0.27899110603923,0.187381314585724,0.0941083133185161,5.51091059616309e-16,-0.094108313318515,-0.187381314585723,-0.278991106039229,-0.368124552684679,-0.453990499739545,-0.535826794978996,-0.612907053652977,-0.684547105928688,-0.750111069630459,-0.809016994374946,-0.860742027003943,-0.90482705246602,-0.940880768954225,-0.968583161128631,-0.987688340595138,-0.998026728428271,-0.999506560365732,-0.992114701314478,-0.975916761938748,-0.951056516295153,-0.917754625683982,-0.876306680043864,-0.827080574274561,-0.77051324277579,-0.707106781186547,-0.637423989748689,-0.562083377852131,-0.481753674101715,-0.397147890634779,-0.309016994374948,-0.218143241396542,-0.125333233564302,-0.0314107590781288,0.0627905195293141,0.156434465040233,0.248689887164854,0.338737920245292,0.425779291565071,0.509041415750371,0.587785252292474,0.661311865323651,0.728968627421412,0.790155012375691,0.844327925502015,0.891006524188368,0.929776485888252,0.960293685676943,0.982287250728689,0.99556196460308},
-{1,0.992114701314478,0.968583161128631,0.929776485888251,0.876306680043864,0.809016994374947,0.728968627421412,0.63742398974869,0.535826794978997,0.425779291565073,0.309016994374947,0.187381314585725,0.0627905195293135,-0.0627905195293134,-0.187381314585725,-0.309016994374947,-0.425779291565073,-0.535826794978997,-0.63742398974869,-0.728968627421411,-0.809016994374947,-0.876306680043864,-0.929776485888251,-0.968583161128631,-0.992114701314478,-1,-0.992114701314478,-0.968583161128631,-0.929776485888251,-0.876306680043864,-0.809016994374948,-0.728968627421412,-0.63742398974869,-0.535826794978996,-0.425779291565072,-0.309016994374948,-0.187381314585725,-0.0627905195293132,0.0627905195293128,0.187381314585724,0.309016994374947,0.425779291565072,0.535826794978997,0.637423989748689,0.728968627421411,0.809016994374947,0.876306680043863,0.929776485888251,0.968583161128631,0.992114701314478,1,0.992114701314478,0.968583161128631,0.929776485888251,0.876306680043864,0.809016994374948,0.728968627421412,0.63742398974869,0.535826794978996,0.425779291565073,0.309016994374949,0.187381314585725,0.0627905195293142,-0.0627905195293136,-0.187381314585725,-0.309016994374947,-0.425779291565073,-0.535826794978997,-0.637423989748691,-0.728968627421412,-0.809016994374947,-0.876306680043864,-0.929776485888251,-0.968583161128631,-0.992114701314478,-1,-0.992114701314478,-0.968583161128631,-0.929776485888252,-0.876306680043863,-0.809016994374948,-0.728968627421412,-0.637423989748691,-0.535826794978996,-0.425779291565072,-0.309016994374948,-0.187381314585726,-0.0627905195293152,0.0627905195293126,0.187381314585725,0.309016994374947,0.425779291565072,0.535826794978995,0.637423989748689,0.728968627421412,0.809016994374947,0.876306680043863,0.929776485888251,0.968583161128631,0.992114701314478,1,0.992114701314478,0.968583161128631,0.929776485888252,0.876306680043863,0.809016994374948,0.728968627421411,0.63742398974869,0.535826794978997,0.425779291565074,0.309016994374948,0.187381314585724,0.0627905195293136,-0.0627905195293125,-0.187381314585723,-0.309016994374949,-0.425779291565073,-0.535826794978996,-0.637423989748689,-0.72896862742141,-0.809016994374946,-0.876306680043864,-0.929776485888251,-0.968583161128631,-0.992114701314478,-1,-0.992114701314478,-0.968583161128631,-0.929776485888251,-0.876306680043864,-0.809016994374948,-0.728968627421412,-0.637423989748689,-0.535826794978996,-0.425779291565073,-0.309016994374948,-0.187381314585722,-0.0627905195293119,0.0627905195293141,0.187381314585725,0.309016994374947,0.425779291565071,0.535826794978998,0.63742398974869,0.728968627421412,0.809016994374947,0.876306680043863,0.929776485888252,0.968583161128631,0.992114701314478,1,0.992114701314478,0.968583161128632,0.929776485888251,0.876306680043864,0.809016994374948,0.728968627421413,0.637423989748691,0.535826794978996,0.425779291565073,0.309016994374948,0.187381314585726,0.0627905195293156,-0.0627905195293104,-0.187381314585721,-0.309016994374943,-0.425779291565074,-0.535826794978998,-0.63742398974869,-0.728968627421411,-0.809016994374947,-0.876306680043863,-0.929776485888251,-0.96858316112863,-0.992114701314477,-1,-0.992114701314478,-0.968583161128631,-0.929776485888251,-0.876306680043864,-0.809016994374948,-0.728968627421413,-0.637423989748692,-0.535826794978999,-0.425779291565076,-0.309016994374948,-0.187381314585726,-0.0627905195293122,0.0627905195293139,0.187381314585724,0.309016994374947,0.425779291565071,0.535826794978995,0.637423989748687,0.728968627421411,0.809016994374947,0.876306680043863,0.929776485888251,0.968583161128631,0.992114701314478},
-{1,0.987688340595138,0.951056516295154,0.891006524188368,0.809016994374947,0.707106781186548,0.587785252292473,0.453990499739547,0.309016994374947,0.156434465040231,6.12323399573677e-17,-0.156434465040231,-0.309016994374947,-0.453990499739547,-0.587785252292473,-0.707106781186547,-0.809016994374947,-0.891006524188368,-0.951056516295154,-0.987688340595138,-1,-0.987688340595138,-0.951056516295154,-0.891006524188368,-0.809016994374948,-0.707106781186548,-0.587785252292473,-0.453990499739547,-0.309016994374948,-0.156434465040231,-1.83697019872103e-16,0.156434465040231,0.309016994374947,0.453990499739546,0.587785252292473,0.707106781186547,0.809016994374947,0.891006524188368,0.951056516295154,0.987688340595138,1,0.987688340595138,0.951056516295154,0.891006524188368,0.809016994374948,0.707106781186548,0.587785252292473,0.453990499739547,0.309016994374949,0.156434465040231,1.19434011948696e-15,-0.156434465040231,-0.309016994374947,-0.453990499739547,-0.587785252292473,-0.707106781186548,-0.809016994374947,-0.891006524188368,-0.951056516295153,-0.987688340595138,-1,-0.987688340595138,-0.951056516295154,-0.891006524188368,-0.809016994374948,-0.707106781186548,-0.587785252292475,-0.453990499739548,-0.309016994374948,-0.15643446504023,-2.20498321910182e-15,0.15643446504023,0.309016994374947,0.453990499739547,0.587785252292473,0.707106781186547,0.809016994374947,0.891006524188368,0.951056516295153,0.987688340595138,1,0.987688340595138,0.951056516295154,0.891006524188368,0.809016994374948,0.707106781186549,0.587785252292474,0.453990499739546,0.309016994374948,0.156434465040232,5.51091059616309e-16,-0.156434465040231,-0.309016994374949,-0.453990499739545,-0.587785252292473,-0.707106781186548,-0.809016994374946,-0.891006524188367,-0.951056516295153,-0.987688340595138,-1,-0.987688340595138,-0.951056516295153,-0.891006524188369,-0.809016994374948,-0.707106781186547,-0.587785252292472,-0.453990499739545,-0.309016994374948,-0.156434465040231,1.10280109986921e-15,0.156434465040233,0.309016994374947,0.453990499739547,0.587785252292474,0.707106781186546,0.809016994374947,0.891006524188368,0.951056516295154,0.987688340595137,1,0.987688340595138,0.951056516295153,0.891006524188369,0.809016994374948,0.707106781186547,0.587785252292472,0.453990499739548,0.309016994374948,0.156434465040231,2.57237725884603e-15,-0.156434465040229,-0.309016994374943,-0.453990499739547,-0.587785252292471,-0.707106781186549,-0.809016994374947,-0.891006524188366,-0.951056516295154,-0.987688340595137,-1,-0.987688340595138,-0.951056516295154,-0.891006524188367,-0.809016994374948,-0.70710678118655,-0.587785252292472,-0.453990499739548,-0.309016994374948,-0.156434465040231,-2.69484193876077e-15,0.156434465040229,0.309016994374947,0.453990499739547,0.587785252292474,0.707106781186546,0.809016994374947,0.891006524188368,0.951056516295153,0.987688340595137,1,0.987688340595138,0.951056516295154,0.891006524188369,0.809016994374948,0.707106781186548,0.587785252292472,0.453990499739548,0.309016994374948,0.156434465040231,2.8173066186755e-15,-0.156434465040232,-0.309016994374946,-0.453990499739547,-0.587785252292474,-0.707106781186546,-0.809016994374947,-0.891006524188368,-0.951056516295153,-0.987688340595138,-1,-0.987688340595138,-0.951056516295153,-0.891006524188369,-0.809016994374946,-0.707106781186548,-0.587785252292475,-0.453990499739545,-0.309016994374949,-0.156434465040235,6.12942380210265e-16,0.156434465040229,0.309016994374943,0.453990499739547,0.587785252292471,0.707106781186549,0.809016994374947,0.891006524188366,0.951056516295154,0.987688340595137},
-{1,0.982287250728689,0.929776485888251,0.844327925502015,0.728968627421412,0.587785252292473,0.425779291565073,0.248689887164855,0.0627905195293135,-0.125333233564304,-0.309016994374947,-0.481753674101715,-0.63742398974869,-0.770513242775789,-0.876306680043864,-0.951056516295154,-0.992114701314478,-0.998026728428272,-0.968583161128631,-0.90482705246602,-0.809016994374948,-0.684547105928689,-0.535826794978996,-0.368124552684678,-0.187381314585725,-1.83697019872103e-16,0.187381314585724,0.368124552684677,0.535826794978997,0.684547105928688,0.809016994374947,0.904827052466019,0.968583161128631,0.998026728428272,0.992114701314478,0.951056516295154,0.876306680043864,0.770513242775789,0.63742398974869,0.481753674101715,0.309016994374949,0.125333233564305,-0.0627905195293136,-0.248689887164855,-0.425779291565073,-0.587785252292473,-0.728968627421412,-0.844327925502015,-0.929776485888251,-0.982287250728689,-1,-0.982287250728689,-0.929776485888252,-0.844327925502015,-0.728968627421412,-0.587785252292475,-0.425779291565072,-0.248689887164856,-0.0627905195293152,0.125333233564305,0.309016994374947,0.481753674101714,0.637423989748689,0.770513242775789,0.876306680043863,0.951056516295153,0.992114701314478,0.998026728428272,0.968583161128631,0.90482705246602,0.809016994374948,0.684547105928689,0.535826794978997,0.368124552684678,0.187381314585724,5.51091059616309e-16,-0.187381314585723,-0.368124552684679,-0.535826794978996,-0.684547105928688,-0.809016994374946,-0.90482705246602,-0.968583161128631,-0.998026728428271,-0.992114701314478,-0.951056516295153,-0.876306680043864,-0.77051324277579,-0.637423989748689,-0.481753674101715,-0.309016994374948,-0.125333233564302,0.0627905195293141,0.248689887164854,0.425779291565071,0.587785252292474,0.728968627421412,0.844327925502015,0.929776485888252,0.982287250728689,1,0.982287250728689,0.929776485888251,0.844327925502015,0.728968627421413,0.587785252292472,0.425779291565073,0.248689887164856,0.0627905195293156,-0.125333233564305,-0.309016994374943,-0.481753674101714,-0.63742398974869,-0.770513242775787,-0.876306680043863,-0.951056516295154,-0.992114701314477,-0.998026728428272,-0.968583161128631,-0.904827052466021,-0.809016994374948,-0.684547105928688,-0.535826794978999,-0.368124552684678,-0.187381314585726,-2.69484193876077e-15,0.187381314585724,0.368124552684677,0.535826794978995,0.684547105928689,0.809016994374947,0.904827052466019,0.968583161128631,0.998026728428272,0.992114701314478,0.951056516295154,0.876306680043864,0.77051324277579,0.637423989748692,0.481753674101715,0.309016994374948,0.125333233564306,-0.0627905195293137,-0.248689887164854,-0.425779291565071,-0.587785252292474,-0.728968627421411,-0.844327925502014,-0.929776485888252,-0.982287250728688,-1,-0.982287250728688,-0.929776485888253,-0.844327925502016,-0.72896862742141,-0.587785252292475,-0.425779291565073,-0.248689887164853,-0.062790519529316,0.125333233564304,0.309016994374943,0.481753674101713,0.63742398974869,0.770513242775786,0.876306680043863,0.951056516295154,0.992114701314477,0.998026728428272,0.968583161128631,0.904827052466021,0.809016994374946,0.68454710592869,0.535826794978996,0.368124552684676,0.187381314585727,-4.9047770029553e-16,-0.187381314585728,-0.368124552684676,-0.535826794978997,-0.684547105928691,-0.809016994374947,-0.90482705246602,-0.968583161128632,-0.998026728428271,-0.992114701314478,-0.951056516295152,-0.876306680043864,-0.770513242775788,-0.637423989748692,-0.481753674101716,-0.309016994374945,-0.125333233564307,0.0627905195293134,0.248689887164857,0.425779291565071,0.587785252292473,0.728968627421413,0.844327925502014,0.929776485888252,0.982287250728688},
-{1,0.975916761938747,0.90482705246602,0.79015501237569,0.63742398974869,0.453990499739547,0.248689887164855,0.0314107590781284,-0.187381314585725,-0.397147890634781,-0.587785252292473,-0.750111069630459,-0.876306680043864,-0.960293685676943,-0.998026728428272,-0.987688340595138,-0.929776485888251,-0.827080574274562,-0.684547105928689,-0.509041415750371,-0.309016994374948,-0.094108313318514,0.125333233564304,0.338737920245291,0.535826794978997,0.707106781186547,0.844327925502015,0.940880768954225,0.992114701314478,0.99556196460308,0.951056516295154,0.860742027003944,0.728968627421412,0.56208337785213,0.368124552684679,0.156434465040231,-0.0627905195293136,-0.278991106039229,-0.481753674101716,-0.661311865323653,-0.809016994374947,-0.917754625683981,-0.982287250728689,-0.999506560365732,-0.968583161128631,-0.891006524188368,-0.77051324277579,-0.612907053652977,-0.425779291565072,-0.218143241396542,-2.20498321910182e-15,0.218143241396541,0.425779291565072,0.612907053652976,0.770513242775789,0.891006524188368,0.968583161128631,0.999506560365732,0.982287250728689,0.917754625683982,0.809016994374948,0.661311865323652,0.481753674101716,0.27899110603923,0.0627905195293136,-0.156434465040231,-0.368124552684679,-0.562083377852129,-0.72896862742141,-0.860742027003943,-0.951056516295153,-0.99556196460308,-0.992114701314478,-0.940880768954226,-0.844327925502015,-0.707106781186547,-0.535826794978996,-0.33873792024529,-0.125333233564302,0.0941083133185131,0.309016994374947,0.509041415750371,0.684547105928689,0.827080574274562,0.929776485888252,0.987688340595137,0.998026728428272,0.960293685676943,0.876306680043864,0.750111069630459,0.587785252292472,0.397147890634782,0.187381314585726,-0.0314107590781273,-0.248689887164854,-0.453990499739547,-0.63742398974869,-0.790155012375691,-0.90482705246602,-0.975916761938747,-1,-0.975916761938748,-0.904827052466021,-0.790155012375692,-0.637423989748692,-0.453990499739548,-0.248689887164856,-0.031410759078129,0.187381314585724,0.397147890634781,0.587785252292474,0.750111069630458,0.876306680043863,0.960293685676943,0.998026728428272,0.987688340595138,0.929776485888251,0.827080574274561,0.68454710592869,0.509041415750373,0.309016994374948,0.0941083133185148,-0.125333233564304,-0.338737920245289,-0.535826794978995,-0.707106781186546,-0.844327925502014,-0.940880768954225,-0.992114701314478,-0.99556196460308,-0.951056516295153,-0.860742027003943,-0.72896862742141,-0.562083377852129,-0.368124552684682,-0.156434465040235,0.0627905195293101,0.278991106039227,0.481753674101713,0.661311865323651,0.809016994374947,0.917754625683981,0.982287250728689,0.999506560365732,0.968583161128631,0.891006524188367,0.77051324277579,0.61290705365298,0.425779291565073,0.218143241396546,-4.9047770029553e-16,-0.21814324139654,-0.425779291565074,-0.612907053652975,-0.770513242775791,-0.891006524188368,-0.968583161128632,-0.999506560365732,-0.982287250728689,-0.917754625683983,-0.809016994374948,-0.661311865323655,-0.481753674101716,-0.278991106039232,-0.0627905195293127,0.156434465040229,0.36812455268468,0.56208337785213,0.728968627421413,0.860742027003944,0.951056516295153,0.995561964603079,0.992114701314478,0.940880768954227,0.844327925502016,0.70710678118655,0.535826794978997,0.338737920245294,0.125333233564303,-0.0941083133185123,-0.309016994374949,-0.50904141575037,-0.684547105928686,-0.827080574274562,-0.92977648588825,-0.987688340595138,-0.998026728428272,-0.960293685676945,-0.876306680043864,-0.750111069630462,-0.587785252292473,-0.397147890634783,-0.187381314585723,0.0314107590781265,0.248689887164857,0.453990499739546,0.637423989748692,0.790155012375691,0.904827052466018,0.975916761938748},
-{1,0.968583161128631,0.876306680043864,0.728968627421412,0.535826794978997,0.309016994374947,0.0627905195293135,-0.187381314585725,-0.425779291565073,-0.63742398974869,-0.809016994374947,-0.929776485888251,-0.992114701314478,-0.992114701314478,-0.929776485888251,-0.809016994374948,-0.63742398974869,-0.425779291565072,-0.187381314585725,0.0627905195293128,0.309016994374947,0.535826794978997,0.728968627421411,0.876306680043863,0.968583161128631,1,0.968583161128631,0.876306680043864,0.728968627421412,0.535826794978996,0.309016994374949,0.0627905195293142,-0.187381314585725,-0.425779291565073,-0.637423989748691,-0.809016994374947,-0.929776485888251,-0.992114701314478,-0.992114701314478,-0.929776485888252,-0.809016994374948,-0.637423989748691,-0.425779291565072,-0.187381314585726,0.0627905195293126,0.309016994374947,0.535826794978995,0.728968627421412,0.876306680043863,0.968583161128631,1,0.968583161128631,0.876306680043863,0.728968627421411,0.535826794978997,0.309016994374948,0.0627905195293136,-0.187381314585723,-0.425779291565073,-0.637423989748689,-0.809016994374946,-0.929776485888251,-0.992114701314478,-0.992114701314478,-0.929776485888251,-0.809016994374948,-0.637423989748689,-0.425779291565073,-0.187381314585722,0.0627905195293141,0.309016994374947,0.535826794978998,0.728968627421412,0.876306680043863,0.968583161128631,1,0.968583161128632,0.876306680043864,0.728968627421413,0.535826794978996,0.309016994374948,0.0627905195293156,-0.187381314585721,-0.425779291565074,-0.63742398974869,-0.809016994374947,-0.929776485888251,-0.992114701314477,-0.992114701314478,-0.929776485888251,-0.809016994374948,-0.637423989748692,-0.425779291565076,-0.187381314585726,0.0627905195293139,0.309016994374947,0.535826794978995,0.728968627421411,0.876306680043863,0.968583161128631,1,0.968583161128632,0.876306680043864,0.728968627421413,0.535826794978996,0.309016994374948,0.0627905195293123,-0.187381314585724,-0.425779291565071,-0.637423989748687,-0.809016994374947,-0.929776485888252,-0.992114701314478,-0.992114701314478,-0.929776485888253,-0.809016994374946,-0.637423989748689,-0.425779291565073,-0.187381314585726,0.0627905195293101,0.309016994374943,0.535826794978997,0.728968627421411,0.876306680043863,0.96858316112863,1,0.968583161128631,0.876306680043864,0.72896862742141,0.535826794978996,0.309016994374949,0.0627905195293161,-0.187381314585728,-0.425779291565074,-0.63742398974869,-0.809016994374947,-0.929776485888253,-0.992114701314478,-0.992114701314478,-0.929776485888251,-0.809016994374948,-0.637423989748692,-0.42577929156507,-0.187381314585723,0.0627905195293134,0.309016994374946,0.535826794978994,0.728968627421413,0.876306680043864,0.968583161128631,1,0.968583161128632,0.876306680043866,0.728968627421411,0.535826794978997,0.309016994374949,0.0627905195293163,-0.18738131458572,-0.425779291565074,-0.63742398974869,-0.809016994374947,-0.92977648588825,-0.992114701314477,-0.992114701314479,-0.929776485888254,-0.809016994374953,-0.637423989748687,-0.42577929156507,-0.187381314585723,0.0627905195293131,0.309016994374946,0.535826794978994,0.728968627421408,0.876306680043861,0.968583161128629,1,0.968583161128632,0.876306680043862,0.728968627421411,0.535826794978997,0.309016994374949,0.0627905195293166,-0.18738131458572,-0.425779291565067,-0.637423989748684,-0.809016994374946,-0.92977648588825,-0.992114701314478,-0.992114701314478,-0.929776485888252,-0.809016994374949,-0.637423989748692,-0.425779291565077,-0.187381314585731,0.0627905195293129,0.309016994374946,0.535826794978994,0.728968627421408,0.876306680043864,0.968583161128631},
-{1,0.960293685676943,0.844327925502015,0.661311865323652,0.425779291565073,0.156434465040231,-0.125333233564304,-0.397147890634781,-0.63742398974869,-0.827080574274562,-0.951056516295154,-0.999506560365732,-0.968583161128631,-0.860742027003944,-0.684547105928689,-0.453990499739547,-0.187381314585725,0.0941083133185145,0.368124552684677,0.612907053652976,0.809016994374947,0.940880768954225,0.998026728428272,0.975916761938748,0.876306680043864,0.707106781186548,0.481753674101715,0.218143241396543,-0.0627905195293136,-0.338737920245291,-0.587785252292473,-0.79015501237569,-0.929776485888251,-0.99556196460308,-0.982287250728689,-0.891006524188368,-0.728968627421412,-0.509041415750372,-0.248689887164856,0.0314107590781277,0.309016994374947,0.56208337785213,0.770513242775789,0.917754625683981,0.992114701314478,0.987688340595138,0.90482705246602,0.75011106963046,0.535826794978997,0.27899110603923,5.51091059616309e-16,-0.278991106039229,-0.535826794978996,-0.750111069630459,-0.90482705246602,-0.987688340595138,-0.992114701314478,-0.917754625683982,-0.77051324277579,-0.562083377852131,-0.309016994374948,-0.0314107590781288,0.248689887164854,0.509041415750371,0.728968627421412,0.891006524188368,0.982287250728689,0.99556196460308,0.929776485888251,0.79015501237569,0.587785252292472,0.338737920245294,0.0627905195293156,-0.218143241396544,-0.481753674101714,-0.707106781186549,-0.876306680043863,-0.975916761938747,-0.998026728428272,-0.940880768954226,-0.809016994374948,-0.612907053652977,-0.368124552684678,-0.0941083133185147,0.187381314585724,0.453990499739547,0.684547105928689,0.860742027003944,0.968583161128631,0.999506560365731,0.951056516295154,0.827080574274561,0.637423989748692,0.397147890634779,0.125333233564306,-0.156434465040232,-0.425779291565071,-0.661311865323653,-0.844327925502014,-0.960293685676944,-1,-0.960293685676942,-0.844327925502016,-0.661311865323655,-0.425779291565073,-0.156434465040235,0.125333233564304,0.397147890634777,0.63742398974869,0.82708057427456,0.951056516295154,0.999506560365731,0.968583161128631,0.860742027003945,0.68454710592869,0.453990499739549,0.187381314585727,-0.0941083133185125,-0.368124552684676,-0.612907053652975,-0.809016994374947,-0.940880768954225,-0.998026728428271,-0.975916761938748,-0.876306680043864,-0.707106781186548,-0.481753674101716,-0.218143241396543,0.0627905195293134,0.338737920245285,0.587785252292473,0.790155012375686,0.929776485888252,0.995561964603079,0.982287250728688,0.891006524188371,0.728968627421411,0.509041415750376,0.248689887164853,-0.031410759078123,-0.309016994374949,-0.562083377852126,-0.770513242775786,-0.917754625683979,-0.992114701314477,-0.987688340595138,-0.904827052466018,-0.750111069630462,-0.535826794979,-0.278991106039233,3.67579733935182e-15,0.278991106039226,0.535826794978994,0.750111069630458,0.904827052466018,0.987688340595137,0.992114701314478,0.917754625683982,0.770513242775791,0.562083377852132,0.309016994374949,0.0314107590781299,-0.248689887164853,-0.50904141575037,-0.728968627421411,-0.891006524188367,-0.982287250728688,-0.99556196460308,-0.929776485888252,-0.790155012375695,-0.587785252292473,-0.338737920245291,-0.0627905195293131,0.218143241396536,0.481753674101716,0.707106781186548,0.876306680043864,0.975916761938746,0.998026728428271,0.940880768954225,0.809016994374951,0.612907053652981,0.368124552684676,0.0941083133185123,-0.18738131458572,-0.453990499739543,-0.684547105928691,-0.860742027003945,-0.96858316112863,-0.999506560365732,-0.951056516295153,-0.82708057427456,-0.637423989748692,-0.397147890634784,-0.1253332335643,0.156434465040228,0.42577929156507,0.66131186532365,0.844327925502018,0.960293685676942},
-{1,0.951056516295154,0.809016994374947,0.587785252292473,0.309016994374947,6.12323399573677e-17,-0.309016994374947,-0.587785252292473,-0.809016994374947,-0.951056516295154,-1,-0.951056516295154,-0.809016994374948,-0.587785252292473,-0.309016994374948,-1.83697019872103e-16,0.309016994374947,0.587785252292473,0.809016994374947,0.951056516295154,1,0.951056516295154,0.809016994374948,0.587785252292473,0.309016994374949,1.19434011948696e-15,-0.309016994374947,-0.587785252292473,-0.809016994374947,-0.951056516295153,-1,-0.951056516295154,-0.809016994374948,-0.587785252292475,-0.309016994374948,-2.20498321910182e-15,0.309016994374947,0.587785252292473,0.809016994374947,0.951056516295153,1,0.951056516295154,0.809016994374948,0.587785252292474,0.309016994374948,5.51091059616309e-16,-0.309016994374949,-0.587785252292473,-0.809016994374946,-0.951056516295153,-1,-0.951056516295153,-0.809016994374948,-0.587785252292472,-0.309016994374948,1.10280109986921e-15,0.309016994374947,0.587785252292474,0.809016994374947,0.951056516295154,1,0.951056516295153,0.809016994374948,0.587785252292472,0.309016994374948,2.57237725884603e-15,-0.309016994374943,-0.587785252292471,-0.809016994374947,-0.951056516295154,-1,-0.951056516295154,-0.809016994374948,-0.587785252292472,-0.309016994374948,-2.69484193876077e-15,0.309016994374947,0.587785252292474,0.809016994374947,0.951056516295153,1,0.951056516295154,0.809016994374948,0.587785252292472,0.309016994374948,2.8173066186755e-15,-0.309016994374946,-0.587785252292474,-0.809016994374947,-0.951056516295153,-1,-0.951056516295153,-0.809016994374946,-0.587785252292475,-0.309016994374949,6.12942380210265e-16,0.309016994374943,0.587785252292471,0.809016994374947,0.951056516295154,1,0.951056516295155,0.809016994374946,0.587785252292476,0.309016994374949,-4.9047770029553e-16,-0.30901699437495,-0.587785252292476,-0.809016994374947,-0.951056516295154,-1,-0.951056516295152,-0.809016994374948,-0.587785252292473,-0.309016994374945,-3.18470065841971e-15,0.309016994374946,0.587785252292473,0.809016994374949,0.951056516295153,1,0.951056516295154,0.809016994374946,0.587785252292476,0.309016994374949,-2.45548340466059e-16,-0.309016994374949,-0.58778525229247,-0.809016994374947,-0.951056516295154,-1,-0.951056516295155,-0.809016994374953,-0.587785252292473,-0.309016994374952,3.67579733935182e-15,0.309016994374946,0.587785252292467,0.809016994374949,0.951056516295153,1,0.951056516295154,0.809016994374951,0.58778525229247,0.309016994374949,7.10480837696441e-15,-0.309016994374949,-0.58778525229247,-0.809016994374946,-0.951056516295154,-1,-0.951056516295155,-0.809016994374949,-0.587785252292473,-0.309016994374946,-3.67455937807865e-15,0.309016994374946,0.587785252292473,0.809016994374944,0.951056516295152,1,0.951056516295154,0.809016994374951,0.587785252292476,0.309016994374949,2.44310379192882e-16,-0.309016994374949,-0.58778525229247,-0.809016994374946,-0.951056516295154,-1,-0.951056516295153,-0.809016994374949,-0.587785252292473,-0.309016994374946,-3.91948873790812e-15,0.309016994374945,0.587785252292473,0.809016994374944,0.951056516295155,1,0.951056516295156,0.809016994374947,0.587785252292476,0.309016994374943,4.89239739022353e-16,-0.309016994374942,-0.587785252292476,-0.809016994374946,-0.951056516295151,-1,-0.951056516295155,-0.809016994374953,-0.587785252292474,-0.309016994374953,2.94100925986341e-15,0.309016994374945,0.587785252292467,0.809016994374948,0.951056516295152},
-{1,0.940880768954225,0.770513242775789,0.509041415750371,0.187381314585725,-0.156434465040231,-0.481753674101715,-0.750111069630459,-0.929776485888251,-0.999506560365732,-0.951056516295154,-0.790155012375691,-0.535826794978997,-0.218143241396543,0.125333233564303,0.453990499739546,0.728968627421411,0.917754625683981,0.998026728428272,0.960293685676943,0.809016994374948,0.562083377852132,0.248689887164855,-0.0941083133185135,-0.425779291565072,-0.707106781186547,-0.904827052466019,-0.99556196460308,-0.968583161128632,-0.827080574274563,-0.587785252292475,-0.278991106039232,0.0627905195293126,0.39714789063478,0.684547105928688,0.891006524188367,0.992114701314478,0.975916761938748,0.844327925502016,0.612907053652978,0.30901699437495,-0.0314107590781258,-0.368124552684675,-0.66131186532365,-0.876306680043863,-0.987688340595138,-0.982287250728689,-0.860742027003945,-0.637423989748691,-0.338737920245293,-2.44991257893129e-15,0.338737920245289,0.637423989748688,0.860742027003942,0.982287250728688,0.987688340595138,0.876306680043865,0.661311865323655,0.368124552684682,0.0314107590781325,-0.309016994374943,-0.612907053652973,-0.844327925502013,-0.975916761938747,-0.992114701314478,-0.891006524188369,-0.68454710592869,-0.397147890634783,-0.0627905195293157,0.278991106039227,0.587785252292471,0.82708057427456,0.96858316112863,0.99556196460308,0.904827052466021,0.70710678118655,0.425779291565076,0.0941083133185184,-0.248689887164851,-0.562083377852127,-0.809016994374945,-0.960293685676942,-0.998026728428272,-0.917754625683983,-0.728968627421415,-0.453990499739552,-0.12533323356431,0.218143241396537,0.535826794978994,0.790155012375689,0.951056516295153,0.999506560365732,0.929776485888253,0.750111069630464,0.481753674101719,0.156434465040238,-0.187381314585721,-0.509041415750365,-0.770513242775786,-0.940880768954223,-1,-0.940880768954226,-0.770513242775793,-0.509041415750373,-0.18738131458573,0.156434465040229,0.48175367410171,0.750111069630458,0.929776485888249,0.999506560365731,0.951056516295156,0.790155012375693,0.535826794979003,0.218143241396546,-0.125333233564297,-0.453990499739543,-0.728968627421406,-0.917754625683979,-0.998026728428271,-0.960293685676945,-0.809016994374953,-0.562083377852135,-0.248689887164864,0.0941083133185086,0.425779291565064,0.707106781186543,0.904827052466018,0.995561964603079,0.968583161128632,0.827080574274566,0.587785252292476,0.278991106039236,-0.0627905195293095,-0.397147890634774,-0.684547105928686,-0.891006524188364,-0.992114701314477,-0.975916761938749,-0.844327925502018,-0.612907053652983,-0.309016994374953,0.0314107590781191,0.368124552684673,0.661311865323645,0.876306680043861,0.987688340595136,0.98228725072869,0.860742027003949,0.637423989748695,0.338737920245301,7.34973773679388e-15,-0.338737920245288,-0.637423989748684,-0.860742027003941,-0.982287250728687,-0.987688340595138,-0.876306680043868,-0.661311865323656,-0.368124552684686,-0.0314107590781338,0.309016994374939,0.612907053652972,0.84432792550201,0.975916761938746,0.992114701314479,0.891006524188371,0.684547105928696,0.397147890634787,0.0627905195293241,-0.278991106039222,-0.587785252292464,-0.827080574274557,-0.968583161128628,-0.995561964603081,-0.904827052466025,-0.707106781186554,-0.425779291565077,-0.0941083133185232,0.248689887164849,0.562083377852123,0.809016994374944,0.96029368567694,0.998026728428272,0.917754625683985,0.728968627421416,0.453990499739556,0.125333233564318,-0.218143241396532,-0.53582679497899,-0.790155012375688,-0.951056516295149,-0.999506560365732,-0.929776485888254,-0.750111069630463,-0.481753674101729,-0.156434465040243,0.187381314585716,0.509041415750366,0.770513242775779,0.940880768954221},
-{1,0.929776485888251,0.728968627421412,0.425779291565073,0.0627905195293135,-0.309016994374947,-0.63742398974869,-0.876306680043864,-0.992114701314478,-0.968583161128631,-0.809016994374948,-0.535826794978996,-0.187381314585725,0.187381314585724,0.535826794978997,0.809016994374947,0.968583161128631,0.992114701314478,0.876306680043864,0.63742398974869,0.309016994374949,-0.0627905195293136,-0.425779291565073,-0.728968627421412,-0.929776485888251,-1,-0.929776485888252,-0.728968627421412,-0.425779291565072,-0.0627905195293152,0.309016994374947,0.637423989748689,0.876306680043863,0.992114701314478,0.968583161128631,0.809016994374948,0.535826794978997,0.187381314585724,-0.187381314585723,-0.535826794978996,-0.809016994374946,-0.968583161128631,-0.992114701314478,-0.876306680043864,-0.637423989748689,-0.309016994374948,0.0627905195293141,0.425779291565071,0.728968627421412,0.929776485888252,1,0.929776485888251,0.728968627421413,0.425779291565073,0.0627905195293156,-0.309016994374943,-0.63742398974869,-0.876306680043863,-0.992114701314477,-0.968583161128631,-0.809016994374948,-0.535826794978999,-0.187381314585726,0.187381314585724,0.535826794978995,0.809016994374947,0.968583161128631,0.992114701314478,0.876306680043864,0.637423989748692,0.309016994374948,-0.0627905195293137,-0.425779291565071,-0.728968627421411,-0.929776485888252,-1,-0.929776485888253,-0.72896862742141,-0.425779291565073,-0.062790519529316,0.309016994374943,0.63742398974869,0.876306680043863,0.992114701314477,0.968583161128631,0.809016994374946,0.535826794978996,0.187381314585727,-0.187381314585728,-0.535826794978997,-0.809016994374947,-0.968583161128632,-0.992114701314478,-0.876306680043864,-0.637423989748692,-0.309016994374945,0.0627905195293134,0.425779291565071,0.728968627421413,0.929776485888252,1,0.929776485888253,0.728968627421411,0.425779291565073,0.0627905195293163,-0.309016994374949,-0.63742398974869,-0.876306680043862,-0.992114701314477,-0.968583161128631,-0.809016994374953,-0.535826794979,-0.187381314585723,0.187381314585717,0.535826794978994,0.809016994374949,0.968583161128629,0.992114701314478,0.876306680043862,0.637423989748695,0.309016994374949,-0.0627905195293166,-0.425779291565067,-0.728968627421411,-0.92977648588825,-1,-0.929776485888252,-0.728968627421413,-0.425779291565077,-0.0627905195293131,0.309016994374946,0.637423989748687,0.876306680043864,0.992114701314478,0.968583161128632,0.809016994374951,0.535826794978997,0.187381314585727,-0.18738131458572,-0.535826794978997,-0.809016994374946,-0.96858316112863,-0.992114701314478,-0.876306680043864,-0.637423989748692,-0.309016994374946,0.0627905195293127,0.42577929156507,0.728968627421413,0.929776485888249,1,0.92977648588825,0.728968627421416,0.425779291565074,0.06279051952931,-0.309016994374942,-0.637423989748689,-0.876306680043866,-0.992114701314477,-0.968583161128631,-0.809016994374953,-0.535826794979,-0.187381314585724,0.187381314585716,0.535826794978993,0.809016994374948,0.968583161128629,0.992114701314478,0.876306680043863,0.637423989748695,0.309016994374943,-0.0627905195293087,-0.425779291565073,-0.728968627421415,-0.92977648588825,-1,-0.929776485888249,-0.728968627421414,-0.425779291565071,-0.0627905195293068,0.309016994374945,0.637423989748692,0.876306680043867,0.992114701314478,0.96858316112863,0.809016994374943,0.535826794978998,0.187381314585721,-0.187381314585719,-0.535826794978996,-0.80901699437495,-0.96858316112863,-0.992114701314478,-0.876306680043861,-0.637423989748693,-0.309016994374947,0.062790519529319,0.425779291565069,0.728968627421412,0.929776485888248},
-{1,0.917754625683981,0.684547105928689,0.338737920245291,-0.0627905195293134,-0.453990499739547,-0.770513242775789,-0.960293685676943,-0.992114701314478,-0.860742027003944,-0.587785252292473,-0.218143241396542,0.187381314585725,0.562083377852131,0.844327925502016,0.987688340595138,0.968583161128631,0.79015501237569,0.481753674101715,0.0941083133185141,-0.309016994374947,-0.661311865323653,-0.90482705246602,-0.999506560365732,-0.929776485888251,-0.707106781186547,-0.368124552684678,0.0314107590781277,0.425779291565075,0.750111069630461,0.951056516295154,0.99556196460308,0.876306680043863,0.612907053652977,0.248689887164854,-0.156434465040231,-0.535826794978996,-0.827080574274562,-0.982287250728689,-0.975916761938747,-0.809016994374948,-0.509041415750372,-0.125333233564302,0.27899110603923,0.63742398974869,0.891006524188368,0.998026728428272,0.940880768954225,0.72896862742141,0.397147890634779,-9.80336419954471e-16,-0.397147890634784,-0.728968627421411,-0.940880768954226,-0.998026728428272,-0.891006524188367,-0.637423989748686,-0.278991106039229,0.125333233564308,0.509041415750371,0.809016994374949,0.975916761938747,0.982287250728688,0.827080574274561,0.535826794978996,0.156434465040228,-0.248689887164854,-0.612907053652978,-0.876306680043864,-0.99556196460308,-0.951056516295153,-0.750111069630459,-0.425779291565073,-0.0314107590781257,0.36812455268468,0.707106781186549,0.929776485888252,0.999506560365732,0.904827052466018,0.661311865323652,0.309016994374949,-0.0941083133185196,-0.481753674101713,-0.790155012375693,-0.968583161128632,-0.987688340595137,-0.844327925502014,-0.562083377852129,-0.187381314585723,0.218143241396543,0.587785252292473,0.860742027003944,0.992114701314479,0.960293685676943,0.770513242775786,0.453990499739549,0.0627905195293092,-0.338737920245295,-0.684547105928691,-0.917754625683982,-1,-0.917754625683981,-0.684547105928683,-0.338737920245291,0.0627905195293131,0.453990499739552,0.770513242775793,0.960293685676943,0.992114701314478,0.860742027003942,0.58778525229247,0.21814324139654,-0.187381314585734,-0.562083377852132,-0.844327925502016,-0.987688340595138,-0.968583161128629,-0.790155012375691,-0.481753674101716,-0.0941083133185157,0.309016994374952,0.661311865323655,0.904827052466018,0.999506560365732,0.92977648588825,0.707106781186546,0.368124552684676,-0.0314107590781368,-0.425779291565073,-0.75011106963046,-0.951056516295156,-0.995561964603079,-0.876306680043864,-0.612907053652978,-0.24868988716485,0.156434465040235,0.535826794979,0.827080574274567,0.982287250728689,0.975916761938747,0.809016994374947,0.509041415750365,0.125333233564304,-0.278991106039229,-0.637423989748689,-0.89100652418837,-0.998026728428272,-0.940880768954226,-0.728968627421409,-0.397147890634777,2.94100925986341e-15,0.397147890634776,0.728968627421413,0.940880768954226,0.998026728428272,0.891006524188365,0.637423989748685,0.278991106039223,-0.125333233564303,-0.509041415750376,-0.809016994374946,-0.975916761938748,-0.982287250728687,-0.82708057427456,-0.535826794979001,-0.156434465040229,0.248689887164863,0.612907053652977,0.876306680043867,0.995561964603081,0.951056516295152,0.75011106963046,0.425779291565068,0.0314107590781167,-0.368124552684682,-0.707106781186545,-0.929776485888252,-0.999506560365731,-0.904827052466019,-0.661311865323656,-0.309016994374947,0.0941083133185215,0.481753674101715,0.790155012375694,0.968583161128634,0.987688340595137,0.844327925502017,0.562083377852127,0.187381314585714,-0.218143241396545,-0.587785252292469,-0.860742027003945,-0.992114701314479,-0.960293685676943,-0.770513242775785,-0.453990499739547,-0.0627905195293073,0.33873792024529,0.684547105928692,0.91775462568398},
-{1,0.90482705246602,0.63742398974869,0.248689887164855,-0.187381314585725,-0.587785252292473,-0.876306680043864,-0.998026728428272,-0.929776485888251,-0.684547105928689,-0.309016994374948,0.125333233564304,0.535826794978997,0.844327925502015,0.992114701314478,0.951056516295154,0.728968627421412,0.368124552684679,-0.0627905195293136,-0.481753674101716,-0.809016994374947,-0.982287250728689,-0.968583161128631,-0.77051324277579,-0.425779291565072,-2.20498321910182e-15,0.425779291565072,0.770513242775789,0.968583161128631,0.982287250728689,0.809016994374948,0.481753674101716,0.0627905195293136,-0.368124552684679,-0.72896862742141,-0.951056516295153,-0.992114701314478,-0.844327925502015,-0.535826794978996,-0.125333233564302,0.309016994374947,0.684547105928689,0.929776485888252,0.998026728428272,0.876306680043864,0.587785252292472,0.187381314585726,-0.248689887164854,-0.63742398974869,-0.90482705246602,-1,-0.904827052466021,-0.637423989748692,-0.248689887164856,0.187381314585724,0.587785252292474,0.876306680043863,0.998026728428272,0.929776485888251,0.68454710592869,0.309016994374948,-0.125333233564304,-0.535826794978995,-0.844327925502014,-0.992114701314478,-0.951056516295153,-0.72896862742141,-0.368124552684682,0.0627905195293101,0.481753674101713,0.809016994374947,0.982287250728689,0.968583161128631,0.77051324277579,0.425779291565073,-4.9047770029553e-16,-0.425779291565074,-0.770513242775791,-0.968583161128632,-0.982287250728689,-0.809016994374948,-0.481753674101716,-0.0627905195293127,0.36812455268468,0.728968627421413,0.951056516295153,0.992114701314478,0.844327925502016,0.535826794978997,0.125333233564303,-0.309016994374949,-0.684547105928686,-0.92977648588825,-0.998026728428272,-0.876306680043864,-0.587785252292473,-0.187381314585723,0.248689887164857,0.637423989748692,0.904827052466018,1,0.904827052466023,0.637423989748695,0.24868988716486,-0.18738131458572,-0.58778525229247,-0.876306680043862,-0.998026728428271,-0.929776485888252,-0.684547105928688,-0.309016994374946,0.1253332335643,0.535826794978994,0.844327925502014,0.992114701314478,0.951056516295154,0.728968627421411,0.368124552684676,-0.0627905195293092,-0.481753674101713,-0.809016994374946,-0.982287250728688,-0.968583161128631,-0.770513242775793,-0.425779291565077,-3.91948873790812e-15,0.42577929156507,0.770513242775788,0.968583161128631,0.982287250728689,0.809016994374947,0.481753674101713,0.06279051952931,-0.368124552684682,-0.728968627421406,-0.951056516295151,-0.992114701314479,-0.844327925502018,-0.535826794979,-0.125333233564308,0.309016994374945,0.684547105928688,0.929776485888251,0.998026728428272,0.876306680043863,0.587785252292471,0.187381314585728,-0.248689887164846,-0.637423989748689,-0.904827052466016,-1,-0.904827052466022,-0.637423989748687,-0.248689887164858,0.18738131458573,0.587785252292472,0.876306680043867,0.998026728428272,0.929776485888253,0.684547105928697,0.30901699437495,-0.125333233564296,-0.535826794978996,-0.844327925502012,-0.992114701314478,-0.951056516295155,-0.728968627421409,-0.36812455268468,0.062790519529319,0.481753674101715,0.809016994374944,0.982287250728686,0.968583161128632,0.770513242775796,0.425779291565075,8.32945517611177e-15,-0.425779291565072,-0.770513242775785,-0.968583161128632,-0.982287250728689,-0.809016994374945,-0.481753674101717,-0.0627905195293215,0.368124552684678,0.728968627421407,0.951056516295154,0.992114701314478,0.84432792550202,0.535826794978998,0.125333233564312,-0.309016994374948,-0.684547105928685,-0.929776485888252,-0.998026728428272,-0.876306680043861,-0.587785252292474,-0.187381314585718,0.248689887164855,0.637423989748685,0.904827052466021},
-{1,0.891006524188368,0.587785252292473,0.156434465040231,-0.309016994374947,-0.707106781186547,-0.951056516295153,-0.987688340595138,-0.809016994374948,-0.453990499739547,-1.83697019872103e-16,0.453990499739546,0.809016994374947,0.987688340595138,0.951056516295154,0.707106781186548,0.309016994374949,-0.15643446504023,-0.587785252292473,-0.891006524188367,-1,-0.891006524188368,-0.587785252292475,-0.156434465040232,0.309016994374945,0.707106781186547,0.951056516295153,0.987688340595138,0.809016994374949,0.45399049973955,5.51091059616309e-16,-0.453990499739545,-0.809016994374946,-0.987688340595138,-0.951056516295154,-0.707106781186547,-0.309016994374948,0.156434465040229,0.587785252292471,0.891006524188366,1,0.891006524188369,0.587785252292475,0.156434465040234,-0.309016994374943,-0.707106781186546,-0.951056516295153,-0.987688340595138,-0.80901699437495,-0.453990499739548,-2.69484193876077e-15,0.453990499739547,0.809016994374947,0.987688340595137,0.951056516295154,0.70710678118655,0.309016994374952,-0.156434465040225,-0.587785252292468,-0.891006524188368,-1,-0.891006524188369,-0.587785252292475,-0.156434465040235,0.309016994374943,0.707106781186544,0.951056516295153,0.987688340595138,0.80901699437495,0.453990499739555,-4.9047770029553e-16,-0.453990499739543,-0.809016994374947,-0.987688340595137,-0.951056516295155,-0.707106781186553,-0.309016994374952,0.156434465040229,0.587785252292468,0.891006524188366,1,0.891006524188371,0.587785252292476,0.156434465040232,-0.309016994374943,-0.707106781186546,-0.951056516295151,-0.987688340595138,-0.809016994374953,-0.453990499739546,-3.42963001824918e-15,0.453990499739546,0.809016994374944,0.987688340595137,0.951056516295156,0.707106781186551,0.309016994374956,-0.156434465040225,-0.58778525229247,-0.891006524188364,-1,-0.891006524188372,-0.587785252292473,-0.156434465040242,0.309016994374946,0.707106781186543,0.951056516295152,0.987688340595138,0.809016994374951,0.453990499739549,7.34973773679388e-15,-0.453990499739543,-0.809016994374942,-0.987688340595137,-0.951056516295157,-0.707106781186553,-0.30901699437496,0.156434465040228,0.587785252292473,0.891006524188366,1,0.891006524188371,0.587785252292476,0.156434465040239,-0.309016994374942,-0.70710678118654,-0.951056516295151,-0.98768834059514,-0.809016994374953,-0.453990499739547,-1.12698454553386e-14,0.453990499739545,0.809016994374944,0.987688340595137,0.951056516295156,0.707106781186551,0.309016994374957,-0.156434465040231,-0.587785252292458,-0.891006524188364,-1,-0.891006524188369,-0.58778525229248,-0.156434465040243,0.309016994374945,0.707106781186542,0.95105651629515,0.98768834059514,0.809016994374951,0.453990499739556,1.51899531738833e-14,-0.453990499739542,-0.809016994374942,-0.987688340595138,-0.951056516295155,-0.707106781186554,-0.30901699437496,0.156434465040227,0.587785252292466,0.891006524188362,1,0.891006524188371,0.587785252292483,0.156434465040247,-0.309016994374941,-0.70710678118654,-0.951056516295153,-0.987688340595139,-0.809016994374953,-0.45399049973956,-4.899206177226e-15,0.453990499739538,0.809016994374939,0.987688340595137,0.951056516295156,0.707106781186557,0.309016994374964,-0.156434465040209,-0.587785252292475,-0.891006524188367,-1,-0.891006524188379,-0.587785252292474,-0.156434465040237,0.309016994374937,0.707106781186547,0.951056516295152,0.987688340595139,0.809016994374956,0.453990499739551,8.81931389577071e-15,-0.453990499739535,-0.809016994374937,-0.987688340595136,-0.951056516295157,-0.707106781186559,-0.309016994374954,0.156434465040219,0.58778525229246,0.891006524188359},
-{1,0.876306680043864,0.535826794978997,0.0627905195293135,-0.425779291565073,-0.809016994374947,-0.992114701314478,-0.929776485888251,-0.63742398974869,-0.187381314585725,0.309016994374947,0.728968627421411,0.968583161128631,0.968583161128631,0.728968627421412,0.309016994374949,-0.187381314585725,-0.637423989748691,-0.929776485888251,-0.992114701314478,-0.809016994374948,-0.425779291565072,0.0627905195293126,0.535826794978995,0.876306680043863,1,0.876306680043863,0.535826794978997,0.0627905195293136,-0.425779291565073,-0.809016994374946,-0.992114701314478,-0.929776485888251,-0.637423989748689,-0.187381314585722,0.309016994374947,0.728968627421412,0.968583161128631,0.968583161128632,0.728968627421413,0.309016994374948,-0.187381314585721,-0.63742398974869,-0.929776485888251,-0.992114701314478,-0.809016994374948,-0.425779291565076,0.0627905195293139,0.535826794978995,0.876306680043863,1,0.876306680043864,0.535826794978996,0.0627905195293123,-0.425779291565071,-0.809016994374947,-0.992114701314478,-0.929776485888253,-0.637423989748689,-0.187381314585726,0.309016994374943,0.728968627421411,0.96858316112863,0.968583161128631,0.72896862742141,0.309016994374949,-0.187381314585728,-0.63742398974869,-0.929776485888253,-0.992114701314478,-0.809016994374948,-0.42577929156507,0.0627905195293134,0.535826794978994,0.876306680043864,1,0.876306680043866,0.535826794978997,0.0627905195293163,-0.425779291565074,-0.809016994374947,-0.992114701314477,-0.929776485888254,-0.637423989748687,-0.187381314585723,0.309016994374946,0.728968627421408,0.968583161128629,0.968583161128632,0.728968627421411,0.309016994374949,-0.18738131458572,-0.637423989748684,-0.92977648588825,-0.992114701314478,-0.809016994374949,-0.425779291565077,0.0627905195293129,0.535826794978994,0.876306680043864,1,0.876306680043866,0.535826794978997,0.0627905195293168,-0.425779291565073,-0.809016994374946,-0.992114701314478,-0.929776485888252,-0.637423989748692,-0.187381314585731,0.309016994374945,0.728968627421413,0.968583161128631,0.968583161128632,0.728968627421416,0.309016994374943,-0.187381314585727,-0.637423989748689,-0.92977648588825,-0.992114701314479,-0.809016994374953,-0.425779291565071,0.0627905195293124,0.535826794978993,0.87630668004386,1,0.876306680043863,0.535826794978998,0.0627905195293102,-0.425779291565073,-0.809016994374946,-0.992114701314477,-0.929776485888249,-0.637423989748687,-0.187381314585724,0.309016994374945,0.728968627421418,0.968583161128633,0.96858316112863,0.728968627421411,0.30901699437495,-0.187381314585719,-0.637423989748694,-0.929776485888252,-0.992114701314478,-0.809016994374949,-0.425779291565078,0.062790519529319,0.535826794978999,0.876306680043864,1,0.876306680043866,0.535826794979004,0.0627905195293107,-0.425779291565072,-0.809016994374946,-0.992114701314477,-0.929776485888255,-0.637423989748688,-0.187381314585725,0.309016994374944,0.728968627421407,0.968583161128629,0.968583161128634,0.728968627421422,0.309016994374964,-0.187381314585733,-0.637423989748694,-0.929776485888252,-0.992114701314478,-0.809016994374949,-0.425779291565078,0.0627905195293043,0.535826794978987,0.876306680043856,1,0.876306680043867,0.535826794978992,0.0627905195293112,-0.425779291565072,-0.809016994374945,-0.992114701314477,-0.929776485888255,-0.637423989748699,-0.187381314585739,0.309016994374944,0.728968627421407,0.968583161128632,0.968583161128631,0.728968627421412,0.309016994374951,-0.187381314585718,-0.637423989748682,-0.929776485888247,-0.992114701314478,-0.80901699437495,-0.425779291565079,0.0627905195293039,0.535826794978998,0.876306680043863},
-{1,0.860742027003944,0.481753674101715,-0.0314107590781285,-0.535826794978997,-0.891006524188368,-0.998026728428272,-0.827080574274562,-0.425779291565072,0.0941083133185145,0.587785252292473,0.917754625683981,0.992114701314478,0.79015501237569,0.368124552684678,-0.156434465040231,-0.637423989748691,-0.940880768954225,-0.982287250728689,-0.750111069630459,-0.309016994374948,0.218143241396544,0.684547105928689,0.960293685676943,0.968583161128631,0.707106781186547,0.248689887164854,-0.278991106039229,-0.728968627421412,-0.975916761938748,-0.951056516295153,-0.661311865323652,-0.187381314585722,0.338737920245292,0.770513242775789,0.987688340595138,0.929776485888251,0.612907053652974,0.125333233564303,-0.397147890634784,-0.809016994374947,-0.99556196460308,-0.904827052466018,-0.562083377852131,-0.0627905195293122,0.45399049973955,0.844327925502014,0.999506560365732,0.876306680043862,0.509041415750373,-7.35407060125e-16,-0.509041415750371,-0.876306680043864,-0.999506560365731,-0.844327925502016,-0.453990499739545,0.0627905195293136,0.56208337785213,0.90482705246602,0.99556196460308,0.809016994374946,0.39714789063478,-0.125333233564304,-0.612907053652975,-0.929776485888253,-0.987688340595137,-0.770513242775788,-0.338737920245291,0.187381314585724,0.66131186532365,0.951056516295155,0.975916761938747,0.728968627421411,0.278991106039229,-0.248689887164861,-0.707106781186546,-0.968583161128632,-0.960293685676943,-0.684547105928683,-0.218143241396543,0.309016994374946,0.750111069630458,0.982287250728689,0.940880768954225,0.637423989748684,0.156434465040232,-0.368124552684676,-0.790155012375693,-0.992114701314478,-0.917754625683981,-0.587785252292467,-0.0941083133185157,0.42577929156507,0.827080574274564,0.998026728428272,0.891006524188364,0.535826794978991,0.0314107590781301,-0.481753674101713,-0.860742027003945,-1,-0.86074202700394,-0.481753674101716,0.031410759078126,0.535826794979,0.891006524188369,0.998026728428271,0.827080574274558,0.425779291565074,-0.0941083133185115,-0.587785252292476,-0.917754625683982,-0.992114701314478,-0.790155012375686,-0.36812455268468,0.156434465040228,0.637423989748692,0.940880768954226,0.982287250728687,0.750111069630456,0.309016994374943,-0.218143241396546,-0.68454710592869,-0.960293685676943,-0.968583161128631,-0.707106781186539,-0.248689887164858,0.278991106039225,0.728968627421418,0.975916761938749,0.951056516295152,0.661311865323659,0.187381314585721,-0.338737920245294,-0.77051324277579,-0.987688340595138,-0.929776485888252,-0.612907053652979,-0.125333233564308,0.397147890634776,0.809016994374952,0.995561964603081,0.904827052466017,0.562083377852127,0.0627905195293107,-0.453990499739548,-0.844327925502015,-0.999506560365731,-0.876306680043858,-0.509041415750374,-4.899206177226e-15,0.509041415750378,0.876306680043867,0.999506560365731,0.844327925502013,0.453990499739544,-0.0627905195293293,-0.562083377852143,-0.904827052466019,-0.99556196460308,-0.809016994374949,-0.397147890634785,0.125333233564298,0.612907053652982,0.929776485888254,0.987688340595137,0.770513242775787,0.338737920245289,-0.187381314585739,-0.661311865323651,-0.951056516295153,-0.975916761938748,-0.728968627421414,-0.278991106039235,0.248689887164862,0.707106781186552,0.968583161128632,0.960293685676942,0.684547105928687,0.218143241396528,-0.309016994374961,-0.750111069630459,-0.982287250728688,-0.940880768954227,-0.637423989748694,-0.156434465040223,0.368124552684684,0.790155012375694,0.992114701314478,0.91775462568398,0.58778525229246,0.0941083133185001,-0.425779291565084,-0.82708057427456,-0.998026728428271,-0.89100652418837,-0.535826794979002,-0.0314107590781216,0.48175367410172,0.860742027003946},
-{1,0.844327925502015,0.425779291565073,-0.125333233564304,-0.63742398974869,-0.951056516295154,-0.968583161128631,-0.684547105928689,-0.187381314585725,0.368124552684677,0.809016994374947,0.998026728428272,0.876306680043864,0.481753674101715,-0.0627905195293136,-0.587785252292473,-0.929776485888251,-0.982287250728689,-0.728968627421412,-0.248689887164856,0.309016994374947,0.770513242775789,0.992114701314478,0.90482705246602,0.535826794978997,5.51091059616309e-16,-0.535826794978996,-0.90482705246602,-0.992114701314478,-0.77051324277579,-0.309016994374948,0.248689887164854,0.728968627421412,0.982287250728689,0.929776485888251,0.587785252292472,0.0627905195293156,-0.481753674101714,-0.876306680043863,-0.998026728428272,-0.809016994374948,-0.368124552684678,0.187381314585724,0.684547105928689,0.968583161128631,0.951056516295154,0.637423989748692,0.125333233564306,-0.425779291565071,-0.844327925502014,-1,-0.844327925502016,-0.425779291565073,0.125333233564304,0.63742398974869,0.951056516295154,0.968583161128631,0.68454710592869,0.187381314585727,-0.368124552684676,-0.809016994374947,-0.998026728428271,-0.876306680043864,-0.481753674101716,0.0627905195293134,0.587785252292473,0.929776485888252,0.982287250728688,0.728968627421411,0.248689887164853,-0.309016994374949,-0.770513242775786,-0.992114701314477,-0.904827052466018,-0.535826794979,3.67579733935182e-15,0.535826794978994,0.904827052466018,0.992114701314478,0.770513242775791,0.309016994374949,-0.248689887164853,-0.728968627421411,-0.982287250728688,-0.929776485888252,-0.587785252292473,-0.0627905195293131,0.481753674101716,0.876306680043864,0.998026728428271,0.809016994374951,0.368124552684676,-0.18738131458572,-0.684547105928691,-0.96858316112863,-0.951056516295153,-0.637423989748692,-0.1253332335643,0.42577929156507,0.844327925502018,1,0.844327925502012,0.425779291565074,-0.125333233564296,-0.637423989748689,-0.951056516295151,-0.968583161128631,-0.684547105928694,-0.187381314585724,0.368124552684672,0.809016994374948,0.998026728428271,0.876306680043863,0.48175367410172,-0.0627905195293087,-0.58778525229247,-0.92977648588825,-0.982287250728689,-0.728968627421414,-0.248689887164858,0.309016994374945,0.770513242775788,0.992114701314478,0.90482705246602,0.535826794978998,9.79098458681294e-16,-0.535826794978996,-0.904827052466019,-0.992114701314478,-0.770513242775798,-0.309016994374947,0.248689887164842,0.728968627421412,0.982287250728686,0.929776485888251,0.587785252292483,0.0627905195293107,-0.481753674101705,-0.876306680043865,-0.998026728428272,-0.809016994374945,-0.368124552684687,0.187381314585715,0.684547105928682,0.968583161128629,0.951056516295156,0.637423989748685,0.125333233564312,-0.425779291565066,-0.844327925502011,-1,-0.844327925502019,-0.425779291565078,0.125333233564298,0.637423989748685,0.951056516295152,0.968583161128632,0.684547105928692,0.187381314585729,-0.368124552684674,-0.809016994374945,-0.998026728428271,-0.876306680043865,-0.481753674101717,0.0627905195293112,0.587785252292472,0.929776485888251,0.982287250728689,0.728968627421412,0.248689887164869,-0.309016994374947,-0.770513242775789,-0.992114701314478,-0.904827052466025,-0.535826794978996,1.47143310088659e-15,0.535826794978998,0.904827052466014,0.992114701314478,0.770513242775787,0.309016994374958,-0.248689887164844,-0.728968627421414,-0.982287250728689,-0.929776485888255,-0.587785252292481,-0.0627905195293083,0.48175367410172,0.87630668004386,0.998026728428272,0.809016994374944,0.368124552684672,-0.187381314585718,-0.684547105928684,-0.968583161128633,-0.951056516295155,-0.637423989748694,-0.12533323356431,0.425779291565081,0.844327925502013},
-{1,0.827080574274562,0.368124552684678,-0.218143241396542,-0.728968627421411,-0.987688340595138,-0.90482705246602,-0.509041415750372,0.0627905195293128,0.612907053652976,0.951056516295154,0.960293685676943,0.63742398974869,0.094108313318515,-0.481753674101714,-0.891006524188367,-0.992114701314478,-0.75011106963046,-0.248689887164856,0.338737920245291,0.809016994374947,0.999506560365732,0.844327925502016,0.397147890634781,-0.187381314585723,-0.707106781186546,-0.982287250728688,-0.917754625683982,-0.535826794978999,0.0314107590781274,0.587785252292471,0.940880768954225,0.968583161128632,0.661311865323655,0.125333233564306,-0.453990499739547,-0.876306680043863,-0.99556196460308,-0.77051324277579,-0.278991106039232,0.309016994374947,0.790155012375689,0.998026728428272,0.860742027003945,0.425779291565076,-0.156434465040225,-0.684547105928689,-0.975916761938747,-0.929776485888253,-0.562083377852135,-2.93977129859024e-15,0.56208337785213,0.92977648588825,0.975916761938748,0.68454710592869,0.156434465040238,-0.425779291565068,-0.860742027003942,-0.998026728428272,-0.790155012375695,-0.309016994374952,0.278991106039226,0.770513242775789,0.995561964603079,0.876306680043866,0.453990499739549,-0.125333233564297,-0.661311865323653,-0.96858316112863,-0.940880768954228,-0.587785252292473,-0.0314107590781262,0.535826794978994,0.917754625683981,0.98228725072869,0.707106781186551,0.187381314585727,-0.397147890634774,-0.844327925502012,-0.999506560365732,-0.809016994374949,-0.338737920245291,0.24868988716485,0.750111069630457,0.992114701314478,0.891006524188371,0.481753674101719,-0.0941083133185047,-0.637423989748684,-0.960293685676942,-0.951056516295157,-0.612907053652978,-0.0627905195293134,0.509041415750367,0.904827052466018,0.987688340595138,0.728968627421416,0.218143241396547,-0.368124552684669,-0.827080574274557,-1,-0.827080574274568,-0.36812455268468,0.218143241396542,0.728968627421408,0.987688340595137,0.904827052466023,0.509041415750377,-0.0627905195293087,-0.612907053652974,-0.951056516295149,-0.960293685676947,-0.637423989748698,-0.0941083133185235,0.481753674101709,0.891006524188365,0.992114701314478,0.75011106963046,0.248689887164868,-0.33873792024528,-0.809016994374942,-0.999506560365731,-0.844327925502018,-0.397147890634784,0.187381314585722,0.707106781186547,0.982287250728686,0.917754625683985,0.535826794979004,-0.0314107590781216,-0.587785252292469,-0.94088076895422,-0.968583161128635,-0.661311865323662,-0.125333233564301,0.453990499739538,0.87630668004386,0.995561964603081,0.770513242775801,0.278991106039231,-0.309016994374948,-0.790155012375683,-0.998026728428272,-0.860742027003948,-0.425779291565078,0.156434465040213,0.684547105928687,0.975916761938744,0.929776485888256,0.562083377852139,8.81931389577071e-15,-0.562083377852125,-0.92977648588825,-0.975916761938748,-0.6845471059287,-0.15643446504023,0.425779291565062,0.860742027003939,0.998026728428273,0.790155012375694,0.309016994374951,-0.278991106039214,-0.770513242775789,-0.995561964603079,-0.876306680043868,-0.453990499739554,0.125333233564298,0.661311865323638,0.968583161128631,0.94088076895423,0.587785252292483,0.031410759078125,-0.535826794978989,-0.917754625683978,-0.982287250728692,-0.70710678118655,-0.18738131458574,0.397147890634768,0.844327925502009,0.999506560365732,0.80901699437496,0.338737920245297,-0.248689887164851,-0.750111069630449,-0.992114701314478,-0.891006524188373,-0.481753674101724,0.0941083133184918,0.637423989748685,0.960293685676938,0.951056516295154,0.612907053652988,0.0627905195293263,-0.509041415750374,-0.904827052466016,-0.987688340595139,-0.728968627421425,-0.218143241396546,0.368124552684663,0.827080574274554},
-{1,0.809016994374947,0.309016994374947,-0.309016994374947,-0.809016994374947,-1,-0.809016994374948,-0.309016994374948,0.309016994374947,0.809016994374947,1,0.809016994374948,0.309016994374949,-0.309016994374947,-0.809016994374947,-1,-0.809016994374948,-0.309016994374948,0.309016994374947,0.809016994374947,1,0.809016994374948,0.309016994374948,-0.309016994374949,-0.809016994374946,-1,-0.809016994374948,-0.309016994374948,0.309016994374947,0.809016994374947,1,0.809016994374948,0.309016994374948,-0.309016994374943,-0.809016994374947,-1,-0.809016994374948,-0.309016994374948,0.309016994374947,0.809016994374947,1,0.809016994374948,0.309016994374948,-0.309016994374946,-0.809016994374947,-1,-0.809016994374946,-0.309016994374949,0.309016994374943,0.809016994374947,1,0.809016994374946,0.309016994374949,-0.30901699437495,-0.809016994374947,-1,-0.809016994374948,-0.309016994374945,0.309016994374946,0.809016994374949,1,0.809016994374946,0.309016994374949,-0.309016994374949,-0.809016994374947,-1,-0.809016994374953,-0.309016994374952,0.309016994374946,0.809016994374949,1,0.809016994374951,0.309016994374949,-0.309016994374949,-0.809016994374946,-1,-0.809016994374949,-0.309016994374946,0.309016994374946,0.809016994374944,1,0.809016994374951,0.309016994374949,-0.309016994374949,-0.809016994374946,-1,-0.809016994374949,-0.309016994374946,0.309016994374945,0.809016994374944,1,0.809016994374947,0.309016994374943,-0.309016994374942,-0.809016994374946,-1,-0.809016994374953,-0.309016994374953,0.309016994374945,0.809016994374948,1,0.809016994374951,0.309016994374943,-0.309016994374942,-0.809016994374946,-1,-0.809016994374945,-0.30901699437494,0.309016994374945,0.809016994374948,1,0.809016994374943,0.30901699437495,-0.309016994374948,-0.80901699437495,-1,-0.809016994374949,-0.309016994374947,0.309016994374951,0.809016994374944,1,0.809016994374947,0.309016994374944,-0.309016994374941,-0.809016994374946,-1,-0.809016994374945,-0.309016994374954,0.309016994374944,0.809016994374948,1,0.809016994374951,0.309016994374964,-0.309016994374948,-0.809016994374941,-1,-0.809016994374949,-0.309016994374961,0.309016994374951,0.809016994374943,1,0.809016994374947,0.309016994374957,-0.309016994374954,-0.809016994374945,-1,-0.809016994374945,-0.309016994374954,0.309016994374944,0.809016994374947,1,0.809016994374952,0.309016994374951,-0.309016994374947,-0.809016994374949,-1,-0.80901699437495,-0.309016994374948,0.309016994374937,0.809016994374943,1,0.809016994374948,0.309016994374958,-0.30901699437494,-0.809016994374945,-1,-0.809016994374946,-0.309016994374955,0.309016994374944,0.809016994374947,1,0.809016994374944,0.309016994374951,-0.309016994374947,-0.809016994374949,-1,-0.80901699437495,-0.309016994374948,0.309016994374937,0.809016994374951,1,0.809016994374956,0.309016994374945,-0.30901699437494,-0.809016994374953,-1,-0.809016994374954,-0.309016994374942,0.309016994374943,0.809016994374938,1,0.809016994374952,0.309016994374965,-0.309016994374946,-0.80901699437494,-1,-0.80901699437495,-0.309016994374962,0.30901699437495,0.809016994374942},
-{1,0.79015501237569,0.248689887164855,-0.397147890634781,-0.876306680043864,-0.987688340595138,-0.684547105928689,-0.094108313318514,0.535826794978997,0.940880768954225,0.951056516295154,0.56208337785213,-0.0627905195293136,-0.661311865323653,-0.982287250728689,-0.891006524188368,-0.425779291565072,0.218143241396544,0.770513242775789,0.999506560365732,0.809016994374948,0.278991106039228,-0.368124552684679,-0.860742027003943,-0.992114701314478,-0.707106781186547,-0.125333233564302,0.509041415750371,0.929776485888252,0.960293685676942,0.587785252292472,-0.0314107590781273,-0.63742398974869,-0.975916761938748,-0.904827052466018,-0.453990499739548,0.187381314585724,0.75011106963046,0.998026728428272,0.827080574274561,0.309016994374948,-0.338737920245292,-0.844327925502016,-0.99556196460308,-0.72896862742141,-0.156434465040228,0.481753674101713,0.917754625683981,0.968583161128631,0.612907053652975,-4.9047770029553e-16,-0.612907053652975,-0.968583161128632,-0.91775462568398,-0.481753674101716,0.156434465040229,0.728968627421413,0.99556196460308,0.844327925502012,0.338737920245294,-0.309016994374949,-0.827080574274562,-0.998026728428272,-0.750111069630457,-0.187381314585723,0.453990499739546,0.904827052466021,0.975916761938747,0.637423989748684,0.0314107590781299,-0.58778525229247,-0.960293685676944,-0.929776485888252,-0.509041415750373,0.125333233564307,0.707106781186548,0.992114701314478,0.860742027003942,0.368124552684676,-0.278991106039236,-0.809016994374946,-0.999506560365732,-0.770513242775789,-0.218143241396543,0.425779291565076,0.891006524188369,0.982287250728689,0.661311865323648,0.06279051952931,-0.562083377852126,-0.951056516295156,-0.940880768954226,-0.535826794979,0.0941083133185149,0.684547105928688,0.987688340595138,0.876306680043863,0.397147890634781,-0.24868988716486,-0.790155012375688,-1,-0.790155012375687,-0.248689887164858,0.397147890634783,0.876306680043867,0.987688340595138,0.684547105928686,0.0941083133185201,-0.535826794978996,-0.940880768954227,-0.951056516295155,-0.56208337785213,0.062790519529319,0.661311865323649,0.982287250728689,0.891006524188365,0.425779291565062,-0.218143241396545,-0.770513242775785,-0.999506560365731,-0.809016994374945,-0.278991106039234,0.368124552684678,0.860742027003946,0.992114701314478,0.707106781186557,0.125333233564298,-0.509041415750381,-0.929776485888252,-0.960293685676945,-0.587785252292474,0.0314107590781319,0.637423989748696,0.975916761938747,0.904827052466017,0.453990499739551,-0.187381314585739,-0.750111069630463,-0.998026728428271,-0.827080574274561,-0.309016994374954,0.338737920245289,0.844327925502017,0.995561964603079,0.728968627421412,0.156434465040227,-0.481753674101711,-0.917754625683987,-0.96858316112863,-0.612907053652979,1.47143310088659e-15,0.61290705365297,0.968583161128631,0.91775462568398,0.481753674101708,-0.15643446504023,-0.728968627421414,-0.99556196460308,-0.844327925502008,-0.338737920245287,0.309016994374944,0.827080574274562,0.998026728428272,0.750111069630452,0.187381314585722,-0.453990499739553,-0.904827052466019,-0.97591676193875,-0.637423989748683,-0.0314107590781147,0.587785252292477,0.960293685676942,0.929776485888251,0.509041415750379,-0.125333233564315,-0.707106781186549,-0.992114701314479,-0.860742027003945,-0.368124552684688,0.278991106039237,0.809016994374955,0.999506560365731,0.770513242775792,0.218143241396542,-0.425779291565064,-0.891006524188373,-0.982287250728688,-0.661311865323647,-0.0627905195293161,0.562083377852121,0.951056516295156,0.940880768954226,0.535826794978994,-0.0941083133185088,-0.684547105928688,-0.987688340595141,-0.876306680043859,-0.39714789063478,0.248689887164847,0.79015501237568},
-{1,0.770513242775789,0.187381314585725,-0.481753674101715,-0.929776485888251,-0.951056516295154,-0.535826794978997,0.125333233564303,0.728968627421411,0.998026728428272,0.809016994374948,0.248689887164855,-0.425779291565072,-0.904827052466019,-0.968583161128632,-0.587785252292475,0.0627905195293126,0.684547105928688,0.992114701314478,0.844327925502016,0.30901699437495,-0.368124552684675,-0.876306680043863,-0.982287250728689,-0.637423989748691,-2.44991257893129e-15,0.637423989748688,0.982287250728688,0.876306680043865,0.368124552684682,-0.309016994374943,-0.844327925502013,-0.992114701314478,-0.68454710592869,-0.0627905195293157,0.587785252292471,0.96858316112863,0.904827052466021,0.425779291565076,-0.248689887164851,-0.809016994374945,-0.998026728428272,-0.728968627421415,-0.12533323356431,0.535826794978994,0.951056516295153,0.929776485888253,0.481753674101719,-0.187381314585721,-0.770513242775786,-1,-0.770513242775793,-0.18738131458573,0.48175367410171,0.929776485888249,0.951056516295156,0.535826794979003,-0.125333233564297,-0.728968627421406,-0.998026728428271,-0.809016994374953,-0.248689887164864,0.425779291565064,0.904827052466018,0.968583161128632,0.587785252292476,-0.0627905195293095,-0.684547105928686,-0.992114701314477,-0.844327925502018,-0.309016994374953,0.368124552684673,0.876306680043861,0.98228725072869,0.637423989748695,7.34973773679388e-15,-0.637423989748684,-0.982287250728687,-0.876306680043868,-0.368124552684686,0.309016994374939,0.84432792550201,0.992114701314479,0.684547105928696,0.0627905195293241,-0.587785252292464,-0.968583161128628,-0.904827052466025,-0.425779291565077,0.248689887164849,0.809016994374944,0.998026728428272,0.728968627421416,0.125333233564318,-0.53582679497899,-0.951056516295149,-0.929776485888254,-0.481753674101729,0.187381314585716,0.770513242775779,1,0.770513242775791,0.187381314585735,-0.481753674101712,-0.929776485888247,-0.951056516295155,-0.535826794979007,0.125333233564299,0.728968627421403,0.998026728428271,0.809016994374955,0.248689887164861,-0.42577929156506,-0.904827052466016,-0.968583161128635,-0.58778525229248,0.0627905195292975,0.684547105928682,0.992114701314476,0.84432792550202,0.309016994374964,-0.368124552684668,-0.876306680043855,-0.982287250728691,-0.637423989748704,-1.22495628946565e-14,0.637423989748685,0.982287250728686,0.876306680043867,0.368124552684691,-0.309016994374941,-0.844327925502007,-0.992114701314479,-0.6845471059287,-0.0627905195293219,0.58778525229246,0.968583161128629,0.904827052466027,0.425779291565082,-0.248689887164838,-0.809016994374941,-0.998026728428273,-0.72896862742142,-0.125333233564323,0.535826794978986,0.951056516295147,0.929776485888256,0.481753674101733,-0.187381314585711,-0.770513242775776,-1,-0.770513242775794,-0.18738131458574,0.481753674101708,0.929776485888245,0.951056516295157,0.535826794979011,-0.125333233564294,-0.728968627421399,-0.998026728428271,-0.809016994374958,-0.248689887164866,0.425779291565055,0.904827052466014,0.968583161128636,0.587785252292484,-0.0627905195292926,-0.684547105928678,-0.992114701314475,-0.844327925502023,-0.309016994374969,0.368124552684663,0.876306680043852,0.982287250728692,0.637423989748708,1.71493880525191e-14,-0.637423989748682,-0.982287250728685,-0.876306680043869,-0.368124552684695,0.309016994374936,0.844327925502005,0.992114701314479,0.684547105928703,0.0627905195293268,-0.587785252292456,-0.968583161128624,-0.904827052466029,-0.425779291565086,0.248689887164847,0.80901699437493,0.998026728428273,0.728968627421423,0.125333233564314,-0.53582679497897,-0.951056516295146,-0.929776485888258,-0.481753674101725,0.187381314585692,0.770513242775772},
-{1,0.75011106963046,0.125333233564304,-0.562083377852131,-0.968583161128631,-0.891006524188368,-0.368124552684678,0.338737920245291,0.876306680043863,0.975916761938748,0.587785252292474,-0.0941083133185135,-0.728968627421412,-0.999506560365732,-0.77051324277579,-0.156434465040232,0.535826794978995,0.960293685676943,0.90482705246602,0.397147890634781,-0.309016994374945,-0.860742027003943,-0.982287250728689,-0.612907053652977,0.0627905195293141,0.707106781186546,0.998026728428272,0.790155012375692,0.187381314585726,-0.509041415750368,-0.951056516295153,-0.917754625683982,-0.425779291565076,0.278991106039227,0.844327925502014,0.987688340595138,0.637423989748692,-0.0314107590781235,-0.684547105928689,-0.99556196460308,-0.80901699437495,-0.218143241396542,0.481753674101713,0.940880768954224,0.929776485888253,0.453990499739549,-0.248689887164854,-0.827080574274558,-0.992114701314478,-0.661311865323655,-3.18470065841971e-15,0.66131186532365,0.992114701314478,0.827080574274561,0.24868988716486,-0.453990499739543,-0.92977648588825,-0.940880768954226,-0.481753674101722,0.218143241396543,0.809016994374944,0.99556196460308,0.684547105928691,0.031410759078137,-0.637423989748684,-0.987688340595138,-0.844327925502018,-0.278991106039233,0.42577929156507,0.917754625683978,0.951056516295154,0.509041415750377,-0.18738131458572,-0.790155012375688,-0.998026728428272,-0.707106781186553,-0.0627905195293134,0.612907053652972,0.982287250728688,0.860742027003945,0.309016994374956,-0.39714789063478,-0.90482705246602,-0.960293685676945,-0.535826794979,0.156434465040221,0.770513242775783,0.999506560365732,0.728968627421416,0.0941083133185269,-0.58778525229247,-0.975916761938745,-0.876306680043864,-0.338737920245299,0.368124552684665,0.891006524188365,0.96858316112863,0.562083377852133,-0.125333233564296,-0.75011106963045,-1,-0.750111069630458,-0.125333233564308,0.562083377852122,0.968583161128631,0.891006524188371,0.368124552684677,-0.338737920245287,-0.876306680043858,-0.975916761938748,-0.58778525229248,0.0941083133185001,0.728968627421407,0.999506560365731,0.770513242775791,0.15643446504024,-0.535826794978984,-0.960293685676941,-0.904827052466019,-0.397147890634785,0.309016994374937,0.860742027003935,0.98228725072869,0.612907053652976,-0.0627905195293078,-0.707106781186549,-0.99802672842827,-0.790155012375696,-0.187381314585739,0.509041415750366,0.951056516295154,0.917754625683988,0.425779291565082,-0.278991106039214,-0.844327925502011,-0.987688340595138,-0.637423989748694,0.0314107590781172,0.684547105928676,0.995561964603079,0.809016994374948,0.218143241396549,-0.481753674101705,-0.940880768954219,-0.929776485888255,-0.453990499739548,0.248689887164848,0.827080574274562,0.99211470131448,0.66131186532366,1.66595293328601e-14,-0.661311865323646,-0.992114701314478,-0.827080574274565,-0.248689887164866,0.453990499739531,0.929776485888248,0.940880768954226,0.481753674101721,-0.21814324139653,-0.809016994374936,-0.995561964603081,-0.68454710592869,-0.0314107590781363,0.63742398974869,0.987688340595135,0.844327925502021,0.278991106039246,-0.425779291565064,-0.917754625683981,-0.95105651629516,-0.509041415750382,0.187381314585707,0.790155012375684,0.998026728428272,0.707106781186553,0.0627905195293268,-0.612907053652961,-0.982287250728684,-0.860742027003945,-0.309016994374956,0.397147890634767,0.904827052466011,0.96029368567695,0.535826794979,-0.156434465040221,-0.770513242775779,-0.999506560365732,-0.72896862742143,-0.0941083133185191,0.587785252292464,0.975916761938744,0.876306680043861,0.338737920245318,-0.368124552684673,-0.891006524188363,-0.968583161128636,-0.562083377852126,0.125333233564275,0.750111069630455},
-{1,0.728968627421412,0.0627905195293135,-0.63742398974869,-0.992114701314478,-0.809016994374948,-0.187381314585725,0.535826794978997,0.968583161128631,0.876306680043864,0.309016994374949,-0.425779291565073,-0.929776485888251,-0.929776485888252,-0.425779291565072,0.309016994374947,0.876306680043863,0.968583161128631,0.535826794978997,-0.187381314585723,-0.809016994374946,-0.992114701314478,-0.637423989748689,0.0627905195293141,0.728968627421412,1,0.728968627421413,0.0627905195293156,-0.63742398974869,-0.992114701314477,-0.809016994374948,-0.187381314585726,0.535826794978995,0.968583161128631,0.876306680043864,0.309016994374948,-0.425779291565071,-0.929776485888252,-0.929776485888253,-0.425779291565073,0.309016994374943,0.876306680043863,0.968583161128631,0.535826794978996,-0.187381314585728,-0.809016994374947,-0.992114701314478,-0.637423989748692,0.0627905195293134,0.728968627421413,1,0.728968627421411,0.0627905195293163,-0.63742398974869,-0.992114701314477,-0.809016994374953,-0.187381314585723,0.535826794978994,0.968583161128629,0.876306680043862,0.309016994374949,-0.425779291565067,-0.92977648588825,-0.929776485888252,-0.425779291565077,0.309016994374946,0.876306680043864,0.968583161128632,0.535826794978997,-0.18738131458572,-0.809016994374946,-0.992114701314478,-0.637423989748692,0.0627905195293127,0.728968627421413,1,0.728968627421416,0.06279051952931,-0.637423989748689,-0.992114701314477,-0.809016994374953,-0.187381314585724,0.535826794978993,0.968583161128629,0.876306680043863,0.309016994374943,-0.425779291565073,-0.92977648588825,-0.929776485888249,-0.425779291565071,0.309016994374945,0.876306680043867,0.96858316112863,0.535826794978998,-0.187381314585719,-0.80901699437495,-0.992114701314478,-0.637423989748693,0.062790519529319,0.728968627421412,1,0.728968627421417,0.0627905195293107,-0.637423989748689,-0.992114701314477,-0.809016994374945,-0.187381314585725,0.535826794978993,0.968583161128629,0.876306680043863,0.309016994374964,-0.425779291565066,-0.929776485888252,-0.929776485888257,-0.425779291565078,0.309016994374951,0.876306680043856,0.968583161128632,0.535826794978992,-0.187381314585711,-0.809016994374945,-0.992114701314477,-0.637423989748699,0.0627905195293112,0.728968627421407,1,0.728968627421412,0.0627905195293185,-0.637423989748682,-0.992114701314478,-0.80901699437495,-0.187381314585733,0.535826794978998,0.968583161128631,0.876306680043867,0.309016994374958,-0.425779291565072,-0.929776485888249,-0.929776485888255,-0.425779291565072,0.309016994374944,0.87630668004386,0.968583161128631,0.535826794978999,-0.187381314585718,-0.809016994374949,-0.992114701314478,-0.637423989748694,0.0627905195293176,0.728968627421402,1,0.728968627421408,0.0627905195293263,-0.637423989748687,-0.992114701314479,-0.809016994374954,-0.187381314585726,0.535826794979004,0.968583161128629,0.876306680043864,0.309016994374965,-0.425779291565064,-0.929776485888252,-0.929776485888258,-0.42577929156508,0.30901699437495,0.876306680043856,0.968583161128633,0.535826794978994,-0.18738131458571,-0.809016994374953,-0.992114701314479,-0.637423989748689,0.0627905195293239,0.728968627421406,1,0.728968627421403,0.06279051952932,-0.637423989748692,-0.99211470131448,-0.809016994374951,-0.18738131458572,0.535826794979009,0.96858316112863,0.876306680043861,0.309016994374932,-0.42577929156507,-0.929776485888254,-0.929776485888256,-0.425779291565074,0.309016994374956,0.876306680043859,0.968583161128631,0.535826794978988,-0.187381314585716,-0.809016994374948,-0.992114701314476,-0.637423989748695,0.0627905195293161,0.728968627421401},
-{1,0.707106781186548,6.12323399573677e-17,-0.707106781186547,-1,-0.707106781186547,-1.83697019872103e-16,0.707106781186548,1,0.707106781186548,-5.82016719913287e-16,-0.707106781186548,-1,-0.707106781186547,1.34773045969868e-15,0.707106781186547,1,0.707106781186547,5.51091059616309e-16,-0.707106781186548,-1,-0.707106781186547,1.10280109986921e-15,0.707106781186549,1,0.707106781186547,-9.80336419954471e-16,-0.707106781186549,-1,-0.70710678118655,-2.69484193876077e-15,0.707106781186546,1,0.707106781186548,-7.35407060125e-16,-0.707106781186549,-1,-0.707106781186548,6.12942380210265e-16,0.707106781186549,1,0.707106781186545,-4.9047770029553e-16,-0.707106781186546,-1,-0.707106781186548,3.9207266991813e-15,0.707106781186548,1,0.70710678118655,-2.45548340466059e-16,-0.707106781186546,-1,-0.707106781186548,3.67579733935182e-15,0.707106781186548,1,0.707106781186546,7.10480837696441e-15,-0.707106781186546,-1,-0.707106781186548,-3.67455937807865e-15,0.707106781186548,1,0.707106781186546,2.44310379192882e-16,-0.70710678118655,-1,-0.707106781186543,3.18593861969288e-15,0.707106781186543,1,0.707106781186551,4.89239739022353e-16,-0.707106781186545,-1,-0.707106781186549,2.94100925986341e-15,0.707106781186548,1,0.707106781186546,-6.37125825874918e-15,-0.70710678118655,-1,-0.707106781186549,-4.40934745756706e-15,0.707106781186542,1,0.707106781186546,9.79098458681294e-16,-0.707106781186545,-1,-0.707106781186544,2.45115054020447e-15,0.707106781186547,1,0.707106781186551,8.32945517611177e-15,-0.70710678118655,-1,-0.707106781186549,-4.899206177226e-15,0.707106781186552,1,0.707106781186557,1.46895717834024e-15,-0.707106781186545,-1,-0.707106781186554,1.96129182054553e-15,0.707106781186547,1,0.707106781186552,-5.3915408194313e-15,-0.707106781186549,-1,-0.707106781186549,-5.38906489688494e-15,0.707106781186552,1,0.707106781186547,1.95881589799918e-15,-0.707106781186554,-1,-0.707106781186545,1.47143310088659e-15,0.707106781186557,1,0.707106781186552,-4.90168209977235e-15,-0.707106781186539,-1,-0.70710678118655,8.33193109865812e-15,0.707106781186541,1,0.707106781186547,-1.17621800975439e-14,-0.707106781186544,-1,-0.707106781186545,-1.32292803339744e-14,0.707106781186546,1,0.707106781186542,9.79903133508859e-15,-0.707106781186549,-1,-0.70710678118654,-6.36878233620282e-15,0.707106781186551,1,0.707106781186538,2.93853333731706e-15,-0.707106781186544,-1,-0.707106781186555,4.91715661568706e-16,0.707106781186546,1,0.707106781186553,-3.92196466045447e-15,-0.707106781186538,-1,-0.70710678118654,7.35221365934024e-15,0.707106781186551,1,0.707106781186548,3.428392056976e-15,-0.707106781186543,-1,-0.707106781186536,-1.42089977732922e-14,0.707106781186556,1,0.707106781186543,-3.43210594079553e-15,-0.707106781186548,-1,-0.707106781186551,-7.34849977552071e-15,0.70710678118654,1,0.707106781186558,-1.02926039385671e-14,-0.707106781186553,-1,-0.707106781186546,-4.88001777749176e-16,0.707106781186545,1,0.707106781186554,1.12686074940654e-14,-0.707106781186558,-1,-0.707106781186541,6.37249622002235e-15,0.70710678118655},
-{1,0.684547105928689,-0.0627905195293134,-0.770513242775789,-0.992114701314478,-0.587785252292473,0.187381314585725,0.844327925502016,0.968583161128631,0.481753674101715,-0.309016994374947,-0.90482705246602,-0.929776485888251,-0.368124552684678,0.425779291565075,0.951056516295154,0.876306680043863,0.248689887164854,-0.535826794978996,-0.982287250728689,-0.809016994374948,-0.125333233564302,0.63742398974869,0.998026728428272,0.72896862742141,-9.80336419954471e-16,-0.728968627421411,-0.998026728428272,-0.637423989748686,0.125333233564308,0.809016994374949,0.982287250728688,0.535826794978996,-0.248689887164854,-0.876306680043864,-0.951056516295153,-0.425779291565073,0.36812455268468,0.929776485888252,0.904827052466018,0.309016994374949,-0.481753674101713,-0.968583161128632,-0.844327925502014,-0.187381314585723,0.587785252292473,0.992114701314479,0.770513242775786,0.0627905195293092,-0.684547105928691,-1,-0.684547105928683,0.0627905195293131,0.770513242775793,0.992114701314478,0.58778525229247,-0.187381314585734,-0.844327925502016,-0.968583161128629,-0.481753674101716,0.309016994374952,0.904827052466018,0.92977648588825,0.368124552684676,-0.425779291565073,-0.951056516295156,-0.876306680043864,-0.24868988716485,0.535826794979,0.982287250728689,0.809016994374947,0.125333233564304,-0.637423989748689,-0.998026728428272,-0.728968627421409,2.94100925986341e-15,0.728968627421413,0.998026728428272,0.637423989748685,-0.125333233564303,-0.809016994374946,-0.982287250728687,-0.535826794979001,0.248689887164863,0.876306680043867,0.951056516295152,0.425779291565068,-0.368124552684682,-0.929776485888252,-0.904827052466019,-0.309016994374947,0.481753674101715,0.968583161128634,0.844327925502017,0.187381314585714,-0.587785252292469,-0.992114701314479,-0.770513242775785,-0.0627905195293073,0.684547105928692,1,0.684547105928687,-0.0627905195293293,-0.77051324277579,-0.992114701314478,-0.587785252292463,0.187381314585736,0.844327925502013,0.968583161128632,0.481753674101708,-0.309016994374954,-0.904827052466022,-0.929776485888244,-0.368124552684674,0.425779291565075,0.951056516295154,0.876306680043856,0.248689887164855,-0.535826794978995,-0.982287250728688,-0.809016994374941,-0.125333233564295,0.637423989748685,0.998026728428272,0.728968627421407,-4.90168209977235e-15,-0.728968627421414,-0.99802672842827,-0.637423989748689,0.125333233564305,0.809016994374955,0.982287250728686,0.535826794978999,-0.248689887164851,-0.876306680043868,-0.951056516295151,-0.425779291565066,0.368124552684697,0.929776485888253,0.904827052466018,0.309016994374945,-0.481753674101729,-0.968583161128631,-0.844327925502015,-0.187381314585726,0.587785252292482,0.992114701314479,0.770513242775792,0.0627905195293053,-0.684547105928694,-1,-0.684547105928695,0.0627905195293171,0.770513242775791,0.992114701314478,0.587785252292461,-0.187381314585738,-0.844327925502022,-0.968583161128632,-0.481753674101706,0.309016994374943,0.904827052466023,0.929776485888244,0.368124552684673,-0.425779291565064,-0.951056516295155,-0.876306680043855,-0.248689887164853,0.535826794979009,0.982287250728694,0.80901699437494,0.125333233564307,-0.637423989748698,-0.998026728428273,-0.728968627421406,-7.34849977552071e-15,0.728968627421415,0.99802672842827,0.637423989748687,-0.125333233564293,-0.809016994374948,-0.982287250728686,-0.535826794978997,0.248689887164867,0.876306680043876,0.95105651629515,0.425779291565077,-0.368124552684685,-0.929776485888259,-0.904827052466017,-0.309016994374957,0.481753674101718,0.968583161128635,0.844327925502014,0.18738131458571,-0.587785252292472,-0.992114701314479,-0.770513242775791,-0.0627905195293034,0.684547105928685},
-{1,0.661311865323652,-0.125333233564304,-0.827080574274562,-0.968583161128631,-0.453990499739547,0.368124552684677,0.940880768954225,0.876306680043864,0.218143241396543,-0.587785252292473,-0.99556196460308,-0.728968627421412,0.0314107590781277,0.770513242775788,0.987688340595138,0.535826794978997,-0.278991106039229,-0.90482705246602,-0.917754625683982,-0.309016994374948,0.509041415750371,0.982287250728688,0.790155012375692,0.0627905195293156,-0.707106781186546,-0.998026728428272,-0.612907053652977,0.187381314585721,0.860742027003944,0.951056516295154,0.397147890634779,-0.425779291565071,-0.960293685676942,-0.844327925502016,-0.156434465040235,0.63742398974869,0.999506560365731,0.68454710592869,-0.0941083133185125,-0.809016994374947,-0.975916761938749,-0.481753674101716,0.338737920245285,0.929776485888249,0.891006524188371,0.24868988716486,-0.562083377852126,-0.992114701314477,-0.750111069630462,-3.42963001824918e-15,0.750111069630458,0.992114701314478,0.562083377852132,-0.248689887164853,-0.891006524188364,-0.929776485888254,-0.338737920245291,0.481753674101716,0.975916761938746,0.809016994374951,0.0941083133185193,-0.684547105928691,-0.999506560365732,-0.637423989748692,0.156434465040228,0.84432792550201,0.960293685676944,0.425779291565074,-0.39714789063478,-0.951056516295151,-0.860742027003947,-0.187381314585724,0.612907053652977,0.998026728428271,0.707106781186551,-0.0627905195293087,-0.790155012375688,-0.982287250728689,-0.509041415750374,0.309016994374945,0.91775462568398,0.904827052466026,0.27899110603923,-0.535826794978996,-0.987688340595138,-0.770513242775798,-0.0314107590781416,0.728968627421403,0.99556196460308,0.587785252292483,-0.218143241396531,-0.876306680043858,-0.940880768954229,-0.368124552684687,0.453990499739538,0.968583161128629,0.827080574274566,0.125333233564312,-0.661311865323646,-1,-0.661311865323667,0.125333233564298,0.827080574274559,0.968583161128632,0.453990499739551,-0.368124552684674,-0.940880768954224,-0.876306680043865,-0.218143241396559,0.58778525229246,0.995561964603079,0.728968627421422,-0.0314107590781279,-0.770513242775789,-0.987688340595138,-0.535826794978996,0.278991106039217,0.904827052466014,0.917754625683986,0.309016994374958,-0.509041415750362,-0.982287250728687,-0.790155012375688,-0.0627905195293083,0.707106781186541,0.998026728428272,0.612907053652982,-0.187381314585718,-0.86074202700394,-0.951056516295155,-0.397147890634799,0.425779291565055,0.960293685676938,0.844327925502017,0.156434465040234,-0.637423989748687,-0.999506560365731,-0.68454710592869,0.0941083133184986,0.809016994374938,0.975916761938751,0.481753674101728,-0.338737920245278,-0.929776485888252,-0.891006524188367,-0.248689887164853,0.562083377852121,0.992114701314476,0.750111069630467,1.02888900547475e-14,-0.750111069630453,-0.992114701314479,-0.562083377852138,0.248689887164847,0.891006524188364,0.929776485888254,0.338737920245298,-0.48175367410171,-0.975916761938746,-0.809016994374951,-0.0941083133185191,0.684547105928686,0.999506560365732,0.637423989748714,-0.1564344650402,-0.844327925502014,-0.960293685676944,-0.425779291565074,0.39714789063478,0.951056516295154,0.860742027003944,0.187381314585752,-0.612907053652955,-0.99802672842827,-0.707106781186566,0.0627905195292877,0.790155012375692,0.982287250728688,0.509041415750368,-0.309016994374925,-0.917754625683972,-0.904827052466029,-0.278991106039251,0.535826794978978,0.987688340595134,0.770513242775802,0.0314107590781201,-0.728968627421398,-0.995561964603082,-0.587785252292488,0.218143241396525,0.876306680043855,0.940880768954231,0.368124552684694,-0.453990499739532,-0.968583161128627,-0.82708057427457,-0.125333233564319,0.661311865323641},
-{1,0.63742398974869,-0.187381314585725,-0.876306680043864,-0.929776485888251,-0.309016994374948,0.535826794978997,0.992114701314478,0.728968627421412,-0.0627905195293136,-0.809016994374947,-0.968583161128631,-0.425779291565072,0.425779291565072,0.968583161128631,0.809016994374948,0.0627905195293136,-0.72896862742141,-0.992114701314478,-0.535826794978996,0.309016994374947,0.929776485888252,0.876306680043864,0.187381314585726,-0.63742398974869,-1,-0.637423989748692,0.187381314585724,0.876306680043863,0.929776485888251,0.309016994374948,-0.535826794978995,-0.992114701314478,-0.72896862742141,0.0627905195293101,0.809016994374947,0.968583161128631,0.425779291565073,-0.425779291565074,-0.968583161128632,-0.809016994374948,-0.0627905195293127,0.728968627421413,0.992114701314478,0.535826794978997,-0.309016994374949,-0.92977648588825,-0.876306680043864,-0.187381314585723,0.637423989748692,1,0.637423989748695,-0.18738131458572,-0.876306680043862,-0.929776485888252,-0.309016994374946,0.535826794978994,0.992114701314478,0.728968627421411,-0.0627905195293092,-0.809016994374946,-0.968583161128631,-0.425779291565077,0.42577929156507,0.968583161128631,0.809016994374947,0.06279051952931,-0.728968627421406,-0.992114701314479,-0.535826794979,0.309016994374945,0.929776485888251,0.876306680043863,0.187381314585728,-0.637423989748689,-1,-0.637423989748687,0.18738131458573,0.876306680043867,0.929776485888253,0.30901699437495,-0.535826794978996,-0.992114701314478,-0.728968627421409,0.062790519529319,0.809016994374944,0.968583161128632,0.425779291565075,-0.425779291565072,-0.968583161128632,-0.809016994374945,-0.0627905195293215,0.728968627421407,0.992114701314478,0.535826794978998,-0.309016994374948,-0.929776485888252,-0.876306680043861,-0.187381314585718,0.637423989748685,1,0.637423989748702,-0.187381314585711,-0.876306680043858,-0.929776485888255,-0.309016994374954,0.535826794978992,0.992114701314477,0.728968627421412,-0.0627905195293146,-0.809016994374949,-0.968583161128633,-0.425779291565079,0.425779291565068,0.968583161128631,0.809016994374948,0.0627905195293117,-0.728968627421414,-0.992114701314479,-0.535826794979002,0.309016994374944,0.929776485888251,0.876306680043864,0.187381314585736,-0.637423989748682,-1,-0.637423989748694,0.187381314585721,0.876306680043863,0.929776485888251,0.309016994374945,-0.535826794979001,-0.992114701314479,-0.728968627421405,0.062790519529296,0.809016994374938,0.968583161128634,0.425779291565083,-0.425779291565064,-0.968583161128629,-0.80901699437495,-0.0627905195293161,0.728968627421411,0.992114701314478,0.535826794978994,-0.309016994374953,-0.929776485888249,-0.876306680043872,-0.187381314585727,0.637423989748679,1,0.637423989748698,-0.187381314585731,-0.876306680043861,-0.929776485888248,-0.309016994374949,0.535826794979009,0.992114701314478,0.728968627421418,-0.0627905195292916,-0.809016994374944,-0.968583161128636,-0.425779291565074,0.425779291565061,0.968583161128632,0.809016994374953,0.0627905195293063,-0.728968627421408,-0.992114701314476,-0.535826794978997,0.309016994374935,0.929776485888242,0.876306680043868,0.187381314585745,-0.637423989748686,-1,-0.63742398974869,0.187381314585712,0.876306680043865,0.929776485888254,0.30901699437494,-0.535826794978993,-0.992114701314476,-0.728968627421411,0.0627905195293014,0.80901699437495,0.968583161128633,0.425779291565091,-0.425779291565069,-0.968583161128627,-0.809016994374947,-0.0627905195293249,0.728968627421415,0.992114701314479,0.535826794978989,-0.309016994374944,-0.929776485888256,-0.876306680043863,-0.187381314585735,0.637423989748694},
-{1,0.612907053652976,-0.248689887164855,-0.917754625683981,-0.876306680043864,-0.15643446504023,0.684547105928688,0.99556196460308,0.535826794978996,-0.338737920245291,-0.951056516295154,-0.827080574274562,-0.0627905195293152,0.750111069630458,0.982287250728689,0.453990499739546,-0.425779291565073,-0.975916761938748,-0.77051324277579,0.0314107590781274,0.809016994374949,0.960293685676943,0.368124552684678,-0.509041415750374,-0.992114701314477,-0.70710678118655,0.125333233564301,0.860742027003944,0.929776485888251,0.278991106039229,-0.587785252292474,-0.999506560365732,-0.637423989748689,0.218143241396544,0.90482705246602,0.891006524188367,0.187381314585727,-0.661311865323653,-0.998026728428272,-0.562083377852129,0.309016994374953,0.940880768954224,0.844327925502016,0.0941083133185188,-0.728968627421411,-0.987688340595138,-0.48175367410171,0.397147890634784,0.968583161128629,0.790155012375688,7.10480837696441e-15,-0.790155012375693,-0.968583161128633,-0.397147890634777,0.481753674101716,0.987688340595138,0.728968627421411,-0.0941083133185188,-0.844327925502016,-0.940880768954224,-0.309016994374946,0.562083377852135,0.998026728428272,0.661311865323648,-0.187381314585727,-0.891006524188367,-0.904827052466019,-0.218143241396544,0.637423989748692,0.999506560365732,0.587785252292471,-0.278991106039222,-0.92977648588825,-0.860742027003944,-0.125333233564301,0.707106781186542,0.992114701314478,0.509041415750371,-0.368124552684682,-0.960293685676941,-0.809016994374941,-0.0314107590781274,0.770513242775783,0.975916761938749,0.425779291565075,-0.453990499739548,-0.982287250728687,-0.750111069630454,0.0627905195293117,0.827080574274563,0.951056516295156,0.338737920245283,-0.535826794979008,-0.995561964603079,-0.684547105928684,0.156434465040241,0.876306680043856,0.917754625683986,0.248689887164848,-0.612907053652985,-1,-0.612907053652974,0.248689887164862,0.917754625683986,0.87630668004387,0.156434465040227,-0.684547105928694,-0.995561964603079,-0.535826794978996,0.338737920245296,0.951056516295156,0.827080574274555,0.0627905195293117,-0.750111069630463,-0.982287250728687,-0.453990499739548,0.425779291565075,0.975916761938749,0.770513242775783,-0.0314107590781274,-0.809016994374949,-0.960293685676941,-0.368124552684668,0.509041415750371,0.992114701314478,0.707106781186542,-0.125333233564315,-0.860742027003944,-0.92977648588825,-0.278991106039222,0.587785252292471,0.999506560365732,0.637423989748686,-0.218143241396551,-0.904827052466019,-0.891006524188367,-0.18738131458572,0.661311865323658,0.998026728428272,0.562083377852129,-0.309016994374953,-0.940880768954229,-0.844327925502023,-0.0941083133185259,0.728968627421406,0.987688340595138,0.481753674101716,-0.397147890634784,-0.968583161128633,-0.790155012375701,-1.42089977732922e-14,0.790155012375684,0.968583161128633,0.397147890634784,-0.481753674101716,-0.987688340595138,-0.728968627421406,0.0941083133184976,0.844327925502008,0.940880768954229,0.309016994374926,-0.562083377852129,-0.998026728428272,-0.661311865323648,0.187381314585706,0.891006524188361,0.904827052466025,0.218143241396523,-0.637423989748686,-0.999506560365732,-0.587785252292471,0.278991106039236,0.929776485888245,0.860742027003951,0.125333233564287,-0.707106781186563,-0.992114701314478,-0.509041415750371,0.368124552684682,0.960293685676937,0.809016994374957,0.0314107590781132,-0.770513242775801,-0.975916761938743,-0.425779291565049,0.453990499739523,0.982287250728684,0.750111069630472,-0.0627905195293259,-0.827080574274571,-0.951056516295147,-0.338737920245269,0.535826794978972,0.995561964603078,0.684547105928705,-0.156434465040241,-0.87630668004387,-0.917754625683974,-0.248689887164834,0.612907053652996},
-{1,0.587785252292473,-0.309016994374947,-0.951056516295153,-0.809016994374948,-1.83697019872103e-16,0.809016994374947,0.951056516295154,0.309016994374949,-0.587785252292473,-1,-0.587785252292475,0.309016994374945,0.951056516295153,0.809016994374949,5.51091059616309e-16,-0.809016994374946,-0.951056516295154,-0.309016994374948,0.587785252292471,1,0.587785252292475,-0.309016994374943,-0.951056516295153,-0.80901699437495,-2.69484193876077e-15,0.809016994374947,0.951056516295154,0.309016994374952,-0.587785252292468,-1,-0.587785252292475,0.309016994374943,0.951056516295153,0.80901699437495,-4.9047770029553e-16,-0.809016994374947,-0.951056516295155,-0.309016994374952,0.587785252292468,1,0.587785252292476,-0.309016994374943,-0.951056516295151,-0.809016994374953,-3.42963001824918e-15,0.809016994374944,0.951056516295156,0.309016994374956,-0.58778525229247,-1,-0.587785252292473,0.309016994374946,0.951056516295152,0.809016994374951,7.34973773679388e-15,-0.809016994374942,-0.951056516295157,-0.30901699437496,0.587785252292473,1,0.587785252292476,-0.309016994374942,-0.951056516295151,-0.809016994374953,-1.12698454553386e-14,0.809016994374944,0.951056516295156,0.309016994374957,-0.587785252292458,-1,-0.58778525229248,0.309016994374945,0.95105651629515,0.809016994374951,1.51899531738833e-14,-0.809016994374942,-0.951056516295155,-0.30901699437496,0.587785252292466,1,0.587785252292483,-0.309016994374941,-0.951056516295153,-0.809016994374953,-4.899206177226e-15,0.809016994374939,0.951056516295156,0.309016994374964,-0.587785252292475,-1,-0.587785252292474,0.309016994374937,0.951056516295152,0.809016994374956,8.81931389577071e-15,-0.809016994374937,-0.951056516295157,-0.309016994374954,0.58778525229246,1,0.587785252292489,-0.309016994374947,-0.951056516295146,-0.80901699437495,-1.27394216143154e-14,0.809016994374943,0.951056516295154,0.309016994374958,-0.587785252292468,-1,-0.587785252292481,0.30901699437493,0.95105651629515,0.80901699437496,1.66595293328601e-14,-0.809016994374932,-0.951056516295155,-0.309016994374948,0.587785252292465,1,0.587785252292484,-0.30901699437494,-0.951056516295148,-0.809016994374954,-2.05796370514048e-14,0.809016994374938,0.951056516295161,0.309016994374965,-0.587785252292474,-1,-0.587785252292476,0.309016994374936,0.951056516295152,0.809016994374957,1.02888900547475e-14,-0.809016994374936,-0.951056516295154,-0.309016994374983,0.587785252292459,1,0.587785252292479,-0.309016994374932,-0.951056516295146,-0.809016994374951,-1.42089977732922e-14,0.809016994374934,0.951056516295164,0.309016994374959,-0.587785252292456,-1,-0.587785252292482,0.309016994374929,0.951056516295154,0.809016994374953,1.81291054918369e-14,-0.809016994374931,-0.951056516295156,-0.309016994374963,0.587785252292453,1,0.587785252292485,-0.309016994374925,-0.951056516295144,-0.809016994374955,-2.20492132103817e-14,0.809016994374946,0.951056516295157,0.309016994374967,-0.587785252292449,-1,-0.587785252292488,0.309016994374921,0.951056516295151,0.809016994374957,2.59693209289264e-14,-0.809016994374927,-0.951056516295167,-0.309016994374944,0.587785252292469,1,0.587785252292514,-0.309016994374944,-0.95105651629515,-0.80901699437496,-1.46771921706706e-15,0.809016994374941,0.95105651629516,0.309016994374974,-0.587785252292466,-1,-0.587785252292495,0.309016994374914,0.951056516295149,0.809016994374962,3.38095363660158e-14,-0.809016994374939,-0.951056516295161,-0.309016994374978,0.58778525229244}
+#include <cstdint>
+
+/*
+DFT coefficients for process() - cos(2*pi*k*n/N) and -sin(2*pi*k*n/N) for the first coefficientBins bins of a coefficientSamples
+sample window.
+- These were two 31 x 200 float tables exported from MATLAB, 49.6KB of flash. Every value is the same sinusoid at (k * n) mod N, so a
+  quarter of one period is enough - QuarterWave<N> holds sin(2*pi*m/N) for m = 0 to N/4 (51 floats, 204 bytes for a 200 sample
+  window) and cos()/negSine() map any index onto it by symmetry.
+- The compiler builds the table (constexpr), so a different N or number of bins needs nothing exported. If N is not a multiple of 4
+  the quarter does not fall on whole indices, so the table is built over a period of 4N instead.
+- cosCoeff(k, n) and sineCoeff(k, n) stand in for cosCoeff[k][n] and sineCoeff[k][n]. They work out (k * n) mod N each call - In a
+  loop over n, step an index by k, wrap it at N and use quarterWave<N>.twiddle() directly.
+*/
+
+//sin(2*pi*m/period) in double - Folded into the first quadrant and summed as a Taylor series, as std::sin is not constexpr
+constexpr double sineOfTurns(uint32_t m, uint32_t period) {
+    double t = (double)(m % period) / period;
+    double sign = 1.0;
+    if (t >= 0.5) {
+        t -= 0.5;
+        sign = -1.0;
+    }
+    if (t > 0.25) {
+        t = 0.5 - t;
+    }
+    double x = 2.0 * 3.14159265358979323846 * t;
+    double term = x;
+    double sum = x;
+    for (int i = 1; i < 12; i++) {
+        term *= -(x * x) / ((2.0 * i) * ((2.0 * i) + 1.0));
+        sum += term;
+    }
+    return sign * sum;
+}
+
+template <uint32_t N>
+struct QuarterWave {
+    static const uint32_t period = ((N % 4) == 0) ? N : 4 * N; //A multiple of 4, so a quarter of it is whole indices
+    static const uint32_t step = period / N;
+    static const uint32_t quarter = period / 4;
+    float values[quarter + 1]; //sin(2*pi*m/period) for m = 0 to period/4
+
+    constexpr QuarterWave() : values() {
+        for (uint32_t m = 0; m <= quarter; m++) {
+            values[m] = (float)sineOfTurns(m, period);
+        }
+    }
+
+    //cos(2*pi*i/N) for i below N
+    constexpr float cos(uint32_t i) const {
+        uint32_t j = i * step;
+        if (j <= quarter) {
+            return values[quarter - j];
+        }
+        if (j <= 2 * quarter) {
+            return -values[j - quarter];
+        }
+        if (j <= 3 * quarter) {
+            return -values[(3 * quarter) - j];
+        }
+        return values[j - (3 * quarter)];
+    }
+
+    //-sin(2*pi*i/N) for i below N
+    constexpr float negSine(uint32_t i) const {
+        uint32_t j = i * step;
+        if (j <= quarter) {
+            return -values[j];
+        }
+        if (j <= 2 * quarter) {
+            return -values[(2 * quarter) - j];
+        }
+        if (j <= 3 * quarter) {
+            return values[j - (2 * quarter)];
+        }
+        return values[(4 * quarter) - j];
+    }
+
+    //cos() and negSine() together, sharing the test for the quadrant - For inner loops
+    void twiddle(uint32_t i, float &cosValue, float &negSineValue) const {
+        uint32_t j = i * step;
+        if (j <= quarter) {
+            cosValue = values[quarter - j];
+            negSineValue = -values[j];
+        } else if (j <= 2 * quarter) {
+            cosValue = -values[j - quarter];
+            negSineValue = -values[(2 * quarter) - j];
+        } else if (j <= 3 * quarter) {
+            cosValue = -values[(3 * quarter) - j];
+            negSineValue = values[j - (2 * quarter)];
+        } else {
+            cosValue = values[j - (3 * quarter)];
+            negSineValue = values[(4 * quarter) - j];
+        }
+    }
 };
 
-//-Sine Coeffs - The negatation value has already been performed.   
-const float sineCoeff[31][200] = {
-{-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0,-0},
-{-0,-0.0314107590781283,-0.0627905195293134,-0.0941083133185143,-0.125333233564304,-0.156434465040231,-0.187381314585725,-0.218143241396543,-0.248689887164855,-0.278991106039229,-0.309016994374947,-0.338737920245291,-0.368124552684678,-0.397147890634781,-0.425779291565073,-0.453990499739547,-0.481753674101715,-0.509041415750371,-0.535826794978997,-0.562083377852131,-0.587785252292473,-0.612907053652976,-0.63742398974869,-0.661311865323652,-0.684547105928689,-0.707106781186547,-0.728968627421412,-0.750111069630459,-0.770513242775789,-0.79015501237569,-0.809016994374947,-0.827080574274562,-0.844327925502015,-0.860742027003944,-0.876306680043864,-0.891006524188368,-0.90482705246602,-0.917754625683981,-0.929776485888251,-0.940880768954225,-0.951056516295154,-0.960293685676943,-0.968583161128631,-0.975916761938747,-0.982287250728689,-0.987688340595138,-0.992114701314478,-0.99556196460308,-0.998026728428272,-0.999506560365732,-1,-0.999506560365732,-0.998026728428272,-0.99556196460308,-0.992114701314478,-0.987688340595138,-0.982287250728689,-0.975916761938747,-0.968583161128631,-0.960293685676943,-0.951056516295154,-0.940880768954225,-0.929776485888251,-0.917754625683981,-0.904827052466019,-0.891006524188368,-0.876306680043863,-0.860742027003944,-0.844327925502015,-0.827080574274562,-0.809016994374947,-0.79015501237569,-0.770513242775789,-0.75011106963046,-0.728968627421411,-0.707106781186548,-0.684547105928689,-0.661311865323652,-0.63742398974869,-0.612907053652976,-0.587785252292473,-0.562083377852131,-0.535826794978997,-0.509041415750371,-0.481753674101715,-0.453990499739547,-0.425779291565073,-0.397147890634781,-0.368124552684678,-0.338737920245291,-0.309016994374948,-0.27899110603923,-0.248689887164855,-0.218143241396543,-0.187381314585725,-0.156434465040231,-0.125333233564305,-0.0941083133185144,-0.0627905195293136,-0.0314107590781282,-1.22464679914735e-16,0.031410759078128,0.0627905195293133,0.0941083133185141,0.125333233564304,0.156434465040231,0.187381314585725,0.218143241396543,0.248689887164855,0.278991106039229,0.309016994374947,0.338737920245291,0.368124552684678,0.39714789063478,0.425779291565072,0.453990499739547,0.481753674101715,0.509041415750371,0.535826794978996,0.56208337785213,0.587785252292473,0.612907053652977,0.63742398974869,0.661311865323652,0.684547105928688,0.707106781186547,0.728968627421412,0.750111069630459,0.770513242775789,0.79015501237569,0.809016994374947,0.827080574274562,0.844327925502015,0.860742027003944,0.876306680043864,0.891006524188368,0.90482705246602,0.917754625683981,0.929776485888251,0.940880768954225,0.951056516295154,0.960293685676943,0.968583161128631,0.975916761938747,0.982287250728689,0.987688340595138,0.992114701314478,0.99556196460308,0.998026728428272,0.999506560365732,1,0.999506560365732,0.998026728428272,0.99556196460308,0.992114701314478,0.987688340595138,0.982287250728689,0.975916761938748,0.968583161128631,0.960293685676943,0.951056516295154,0.940880768954226,0.929776485888252,0.917754625683981,0.90482705246602,0.891006524188368,0.876306680043863,0.860742027003943,0.844327925502015,0.827080574274562,0.809016994374948,0.790155012375691,0.77051324277579,0.75011106963046,0.728968627421412,0.707106781186548,0.684547105928689,0.661311865323652,0.63742398974869,0.612907053652976,0.587785252292473,0.562083377852131,0.535826794978997,0.509041415750372,0.481753674101716,0.453990499739547,0.425779291565073,0.39714789063478,0.368124552684678,0.338737920245291,0.309016994374948,0.27899110603923,0.248689887164855,0.218143241396543,0.187381314585725,0.156434465040231,0.125333233564305,0.0941083133185149,0.0627905195293133,0.0314107590781284},
-{-0,-0.0627905195293134,-0.125333233564304,-0.187381314585725,-0.248689887164855,-0.309016994374947,-0.368124552684678,-0.425779291565073,-0.481753674101715,-0.535826794978997,-0.587785252292473,-0.63742398974869,-0.684547105928689,-0.728968627421412,-0.770513242775789,-0.809016994374947,-0.844327925502015,-0.876306680043864,-0.90482705246602,-0.929776485888251,-0.951056516295154,-0.968583161128631,-0.982287250728689,-0.992114701314478,-0.998026728428272,-1,-0.998026728428272,-0.992114701314478,-0.982287250728689,-0.968583161128631,-0.951056516295154,-0.929776485888251,-0.904827052466019,-0.876306680043863,-0.844327925502015,-0.809016994374947,-0.770513242775789,-0.728968627421411,-0.684547105928689,-0.63742398974869,-0.587785252292473,-0.535826794978997,-0.481753674101715,-0.425779291565073,-0.368124552684678,-0.309016994374948,-0.248689887164855,-0.187381314585725,-0.125333233564305,-0.0627905195293136,-1.22464679914735e-16,0.0627905195293133,0.125333233564304,0.187381314585725,0.248689887164855,0.309016994374947,0.368124552684678,0.425779291565072,0.481753674101715,0.535826794978996,0.587785252292473,0.63742398974869,0.684547105928688,0.728968627421412,0.770513242775789,0.809016994374947,0.844327925502015,0.876306680043864,0.90482705246602,0.929776485888251,0.951056516295154,0.968583161128631,0.982287250728689,0.992114701314478,0.998026728428272,1,0.998026728428272,0.992114701314478,0.982287250728689,0.968583161128631,0.951056516295154,0.929776485888252,0.90482705246602,0.876306680043863,0.844327925502015,0.809016994374948,0.77051324277579,0.728968627421412,0.684547105928689,0.63742398974869,0.587785252292473,0.535826794978997,0.481753674101716,0.425779291565073,0.368124552684678,0.309016994374948,0.248689887164855,0.187381314585725,0.125333233564305,0.0627905195293133,2.44929359829471e-16,-0.0627905195293128,-0.125333233564304,-0.187381314585724,-0.248689887164855,-0.309016994374947,-0.368124552684678,-0.425779291565073,-0.481753674101715,-0.535826794978996,-0.587785252292473,-0.63742398974869,-0.684547105928689,-0.728968627421411,-0.770513242775789,-0.809016994374948,-0.844327925502015,-0.876306680043864,-0.904827052466019,-0.929776485888251,-0.951056516295153,-0.968583161128631,-0.982287250728689,-0.992114701314478,-0.998026728428272,-1,-0.998026728428272,-0.992114701314478,-0.982287250728689,-0.968583161128631,-0.951056516295154,-0.929776485888252,-0.904827052466019,-0.876306680043863,-0.844327925502015,-0.809016994374948,-0.770513242775789,-0.728968627421411,-0.684547105928688,-0.63742398974869,-0.587785252292473,-0.535826794978997,-0.481753674101715,-0.425779291565072,-0.368124552684678,-0.309016994374948,-0.248689887164855,-0.187381314585724,-0.125333233564304,-0.0627905195293134,-3.67394039744206e-16,0.0627905195293127,0.125333233564303,0.187381314585725,0.248689887164855,0.309016994374947,0.368124552684677,0.425779291565072,0.481753674101716,0.535826794978997,0.587785252292473,0.637423989748689,0.684547105928688,0.728968627421411,0.770513242775788,0.809016994374946,0.844327925502016,0.876306680043864,0.90482705246602,0.929776485888251,0.951056516295153,0.968583161128631,0.982287250728688,0.992114701314478,0.998026728428271,1,0.998026728428272,0.992114701314478,0.982287250728689,0.968583161128631,0.951056516295154,0.929776485888252,0.90482705246602,0.876306680043864,0.844327925502016,0.809016994374948,0.77051324277579,0.728968627421411,0.684547105928689,0.63742398974869,0.587785252292473,0.535826794978997,0.481753674101716,0.425779291565074,0.368124552684678,0.309016994374948,0.248689887164856,0.187381314585726,0.125333233564304,0.0627905195293135},
-{-0,-0.0941083133185143,-0.187381314585725,-0.278991106039229,-0.368124552684678,-0.453990499739547,-0.535826794978997,-0.612907053652976,-0.684547105928689,-0.750111069630459,-0.809016994374947,-0.860742027003944,-0.90482705246602,-0.940880768954225,-0.968583161128631,-0.987688340595138,-0.998026728428272,-0.999506560365732,-0.992114701314478,-0.975916761938747,-0.951056516295154,-0.917754625683981,-0.876306680043863,-0.827080574274562,-0.770513242775789,-0.707106781186548,-0.63742398974869,-0.562083377852131,-0.481753674101715,-0.397147890634781,-0.309016994374948,-0.218143241396543,-0.125333233564305,-0.0314107590781282,0.0627905195293133,0.156434465040231,0.248689887164855,0.338737920245291,0.425779291565072,0.509041415750371,0.587785252292473,0.661311865323652,0.728968627421412,0.79015501237569,0.844327925502015,0.891006524188368,0.929776485888251,0.960293685676943,0.982287250728689,0.99556196460308,1,0.99556196460308,0.982287250728689,0.960293685676943,0.929776485888252,0.891006524188368,0.844327925502015,0.790155012375691,0.728968627421412,0.661311865323652,0.587785252292473,0.509041415750372,0.425779291565073,0.338737920245291,0.248689887164855,0.156434465040231,0.0627905195293133,-0.0314107590781279,-0.125333233564304,-0.218143241396542,-0.309016994374947,-0.397147890634781,-0.481753674101715,-0.562083377852131,-0.63742398974869,-0.707106781186547,-0.770513242775789,-0.827080574274562,-0.876306680043864,-0.917754625683981,-0.951056516295153,-0.975916761938747,-0.992114701314478,-0.999506560365731,-0.998026728428272,-0.987688340595138,-0.968583161128631,-0.940880768954226,-0.904827052466019,-0.860742027003944,-0.809016994374948,-0.750111069630459,-0.684547105928688,-0.612907053652977,-0.535826794978997,-0.453990499739546,-0.368124552684678,-0.27899110603923,-0.187381314585724,-0.0941083133185141,-3.67394039744206e-16,0.0941083133185134,0.187381314585725,0.278991106039229,0.368124552684677,0.453990499739547,0.535826794978997,0.612907053652976,0.684547105928688,0.75011106963046,0.809016994374946,0.860742027003943,0.90482705246602,0.940880768954225,0.968583161128631,0.987688340595138,0.998026728428271,0.999506560365732,0.992114701314478,0.975916761938748,0.951056516295154,0.917754625683981,0.876306680043864,0.827080574274562,0.77051324277579,0.707106781186548,0.63742398974869,0.562083377852131,0.481753674101716,0.397147890634781,0.309016994374948,0.218143241396544,0.125333233564304,0.0314107590781286,-0.0627905195293125,-0.15643446504023,-0.248689887164855,-0.338737920245291,-0.425779291565072,-0.509041415750371,-0.587785252292473,-0.661311865323651,-0.728968627421412,-0.79015501237569,-0.844327925502015,-0.891006524188368,-0.929776485888251,-0.960293685676943,-0.982287250728689,-0.99556196460308,-1,-0.99556196460308,-0.982287250728689,-0.960293685676943,-0.929776485888251,-0.891006524188369,-0.844327925502015,-0.79015501237569,-0.728968627421412,-0.661311865323652,-0.587785252292475,-0.509041415750372,-0.425779291565073,-0.338737920245293,-0.248689887164856,-0.156434465040231,-0.0627905195293154,0.0314107590781275,0.125333233564305,0.218143241396541,0.309016994374949,0.39714789063478,0.481753674101715,0.562083377852132,0.637423989748689,0.707106781186548,0.77051324277579,0.827080574274561,0.876306680043864,0.917754625683982,0.951056516295153,0.975916761938748,0.992114701314478,0.999506560365731,0.998026728428272,0.987688340595137,0.968583161128631,0.940880768954225,0.90482705246602,0.860742027003944,0.809016994374947,0.75011106963046,0.684547105928689,0.612907053652975,0.535826794978998,0.453990499739547,0.368124552684677,0.27899110603923,0.187381314585724,0.0941083133185163},
-{-0,-0.125333233564304,-0.248689887164855,-0.368124552684678,-0.481753674101715,-0.587785252292473,-0.684547105928689,-0.770513242775789,-0.844327925502015,-0.90482705246602,-0.951056516295154,-0.982287250728689,-0.998026728428272,-0.998026728428272,-0.982287250728689,-0.951056516295154,-0.904827052466019,-0.844327925502015,-0.770513242775789,-0.684547105928689,-0.587785252292473,-0.481753674101715,-0.368124552684678,-0.248689887164855,-0.125333233564305,-1.22464679914735e-16,0.125333233564304,0.248689887164855,0.368124552684678,0.481753674101715,0.587785252292473,0.684547105928688,0.770513242775789,0.844327925502015,0.90482705246602,0.951056516295154,0.982287250728689,0.998026728428272,0.998026728428272,0.982287250728689,0.951056516295154,0.90482705246602,0.844327925502015,0.77051324277579,0.684547105928689,0.587785252292473,0.481753674101716,0.368124552684678,0.248689887164855,0.125333233564305,2.44929359829471e-16,-0.125333233564304,-0.248689887164855,-0.368124552684678,-0.481753674101715,-0.587785252292473,-0.684547105928689,-0.770513242775789,-0.844327925502015,-0.904827052466019,-0.951056516295153,-0.982287250728689,-0.998026728428272,-0.998026728428272,-0.982287250728689,-0.951056516295154,-0.904827052466019,-0.844327925502015,-0.770513242775789,-0.684547105928688,-0.587785252292473,-0.481753674101715,-0.368124552684678,-0.248689887164855,-0.125333233564304,-3.67394039744206e-16,0.125333233564303,0.248689887164855,0.368124552684677,0.481753674101716,0.587785252292473,0.684547105928688,0.770513242775788,0.844327925502016,0.90482705246602,0.951056516295153,0.982287250728688,0.998026728428271,0.998026728428272,0.982287250728689,0.951056516295154,0.90482705246602,0.844327925502016,0.77051324277579,0.684547105928689,0.587785252292473,0.481753674101716,0.368124552684678,0.248689887164856,0.125333233564304,4.89858719658941e-16,-0.125333233564303,-0.248689887164855,-0.368124552684677,-0.481753674101715,-0.587785252292473,-0.684547105928689,-0.770513242775789,-0.844327925502015,-0.904827052466019,-0.951056516295153,-0.982287250728689,-0.998026728428272,-0.998026728428272,-0.982287250728689,-0.951056516295153,-0.904827052466019,-0.844327925502015,-0.77051324277579,-0.68454710592869,-0.587785252292475,-0.481753674101715,-0.368124552684678,-0.248689887164856,-0.125333233564306,-2.38868023897393e-15,0.125333233564305,0.248689887164855,0.368124552684679,0.481753674101715,0.587785252292473,0.684547105928688,0.77051324277579,0.844327925502016,0.90482705246602,0.951056516295153,0.982287250728689,0.998026728428272,0.998026728428272,0.982287250728689,0.951056516295154,0.90482705246602,0.844327925502014,0.770513242775789,0.684547105928689,0.587785252292474,0.481753674101717,0.368124552684677,0.248689887164854,0.125333233564304,7.34788079488412e-16,-0.125333233564303,-0.248689887164853,-0.368124552684679,-0.481753674101715,-0.587785252292472,-0.684547105928688,-0.770513242775788,-0.844327925502015,-0.904827052466019,-0.951056516295153,-0.982287250728688,-0.998026728428271,-0.998026728428272,-0.982287250728689,-0.951056516295155,-0.904827052466019,-0.844327925502014,-0.770513242775789,-0.684547105928689,-0.587785252292474,-0.481753674101717,-0.36812455268468,-0.248689887164858,-0.125333233564308,-4.40996643820365e-15,0.125333233564303,0.248689887164856,0.368124552684678,0.481753674101715,0.587785252292472,0.684547105928688,0.770513242775788,0.844327925502013,0.904827052466018,0.951056516295153,0.982287250728688,0.998026728428272,0.998026728428272,0.982287250728689,0.951056516295154,0.90482705246602,0.844327925502016,0.770513242775791,0.684547105928689,0.587785252292474,0.481753674101717,0.36812455268468,0.248689887164854,0.125333233564305},
-{-0,-0.156434465040231,-0.309016994374947,-0.453990499739547,-0.587785252292473,-0.707106781186547,-0.809016994374947,-0.891006524188368,-0.951056516295154,-0.987688340595138,-1,-0.987688340595138,-0.951056516295154,-0.891006524188368,-0.809016994374947,-0.707106781186548,-0.587785252292473,-0.453990499739547,-0.309016994374948,-0.156434465040231,-1.22464679914735e-16,0.156434465040231,0.309016994374947,0.453990499739547,0.587785252292473,0.707106781186547,0.809016994374947,0.891006524188368,0.951056516295154,0.987688340595138,1,0.987688340595138,0.951056516295154,0.891006524188368,0.809016994374948,0.707106781186548,0.587785252292473,0.453990499739547,0.309016994374948,0.156434465040231,2.44929359829471e-16,-0.156434465040231,-0.309016994374947,-0.453990499739547,-0.587785252292473,-0.707106781186547,-0.809016994374948,-0.891006524188368,-0.951056516295153,-0.987688340595138,-1,-0.987688340595138,-0.951056516295154,-0.891006524188368,-0.809016994374948,-0.707106781186547,-0.587785252292473,-0.453990499739546,-0.309016994374948,-0.15643446504023,-3.67394039744206e-16,0.156434465040231,0.309016994374947,0.453990499739547,0.587785252292473,0.707106781186547,0.809016994374946,0.891006524188367,0.951056516295153,0.987688340595138,1,0.987688340595138,0.951056516295154,0.891006524188368,0.809016994374948,0.707106781186548,0.587785252292473,0.453990499739546,0.309016994374948,0.156434465040232,4.89858719658941e-16,-0.15643446504023,-0.309016994374947,-0.453990499739547,-0.587785252292473,-0.707106781186547,-0.809016994374947,-0.891006524188368,-0.951056516295153,-0.987688340595138,-1,-0.987688340595138,-0.951056516295153,-0.891006524188369,-0.809016994374948,-0.707106781186547,-0.587785252292475,-0.453990499739548,-0.309016994374948,-0.156434465040231,-2.38868023897393e-15,0.156434465040229,0.309016994374949,0.453990499739545,0.587785252292473,0.707106781186548,0.809016994374948,0.891006524188369,0.951056516295153,0.987688340595138,1,0.987688340595137,0.951056516295154,0.891006524188368,0.809016994374947,0.707106781186549,0.587785252292474,0.453990499739547,0.309016994374946,0.156434465040232,7.34788079488412e-16,-0.156434465040231,-0.309016994374948,-0.453990499739545,-0.587785252292472,-0.707106781186548,-0.809016994374948,-0.891006524188367,-0.951056516295153,-0.987688340595138,-1,-0.987688340595138,-0.951056516295155,-0.891006524188368,-0.809016994374949,-0.707106781186546,-0.587785252292474,-0.45399049973955,-0.309016994374947,-0.156434465040233,-4.40996643820365e-15,0.156434465040231,0.309016994374945,0.453990499739548,0.587785252292472,0.707106781186545,0.809016994374948,0.891006524188367,0.951056516295153,0.987688340595138,1,0.987688340595138,0.951056516295154,0.891006524188368,0.809016994374947,0.707106781186549,0.587785252292474,0.453990499739547,0.30901699437495,0.156434465040233,9.79717439317883e-16,-0.156434465040231,-0.309016994374945,-0.453990499739545,-0.587785252292472,-0.707106781186547,-0.809016994374948,-0.891006524188367,-0.951056516295153,-0.987688340595138,-1,-0.987688340595137,-0.951056516295154,-0.891006524188368,-0.809016994374947,-0.707106781186549,-0.587785252292474,-0.453990499739547,-0.30901699437495,-0.156434465040229,-1.10218211923262e-15,0.156434465040227,0.309016994374948,0.453990499739545,0.587785252292475,0.707106781186547,0.809016994374946,0.891006524188369,0.951056516295153,0.987688340595137,1,0.987688340595138,0.951056516295155,0.891006524188368,0.809016994374949,0.707106781186546,0.587785252292474,0.45399049973955,0.309016994374947,0.156434465040233},
-{-0,-0.187381314585725,-0.368124552684678,-0.535826794978997,-0.684547105928689,-0.809016994374947,-0.90482705246602,-0.968583161128631,-0.998026728428272,-0.992114701314478,-0.951056516295154,-0.876306680043863,-0.770513242775789,-0.63742398974869,-0.481753674101715,-0.309016994374948,-0.125333233564305,0.0627905195293133,0.248689887164855,0.425779291565072,0.587785252292473,0.728968627421412,0.844327925502015,0.929776485888251,0.982287250728689,1,0.982287250728689,0.929776485888252,0.844327925502015,0.728968627421412,0.587785252292473,0.425779291565073,0.248689887164855,0.0627905195293133,-0.125333233564304,-0.309016994374947,-0.481753674101715,-0.63742398974869,-0.770513242775789,-0.876306680043864,-0.951056516295153,-0.992114701314478,-0.998026728428272,-0.968583161128631,-0.904827052466019,-0.809016994374948,-0.684547105928688,-0.535826794978997,-0.368124552684678,-0.187381314585724,-3.67394039744206e-16,0.187381314585725,0.368124552684677,0.535826794978997,0.684547105928688,0.809016994374946,0.90482705246602,0.968583161128631,0.998026728428271,0.992114701314478,0.951056516295154,0.876306680043864,0.77051324277579,0.63742398974869,0.481753674101716,0.309016994374948,0.125333233564304,-0.0627905195293125,-0.248689887164855,-0.425779291565072,-0.587785252292473,-0.728968627421412,-0.844327925502015,-0.929776485888251,-0.982287250728689,-1,-0.982287250728689,-0.929776485888251,-0.844327925502015,-0.728968627421412,-0.587785252292475,-0.425779291565073,-0.248689887164856,-0.0627905195293154,0.125333233564305,0.309016994374949,0.481753674101715,0.637423989748689,0.77051324277579,0.876306680043864,0.951056516295153,0.992114701314478,0.998026728428272,0.968583161128631,0.90482705246602,0.809016994374947,0.684547105928689,0.535826794978998,0.368124552684677,0.187381314585724,7.34788079488412e-16,-0.187381314585723,-0.368124552684679,-0.535826794978996,-0.684547105928688,-0.809016994374948,-0.904827052466019,-0.968583161128631,-0.998026728428271,-0.992114701314478,-0.951056516295155,-0.876306680043864,-0.770513242775789,-0.637423989748693,-0.481753674101717,-0.309016994374947,-0.125333233564308,0.0627905195293122,0.248689887164856,0.42577929156507,0.587785252292472,0.728968627421413,0.844327925502013,0.929776485888251,0.982287250728688,1,0.982287250728689,0.929776485888252,0.844327925502016,0.728968627421411,0.587785252292474,0.425779291565074,0.248689887164854,0.062790519529314,-0.125333233564303,-0.309016994374945,-0.481753674101715,-0.637423989748689,-0.770513242775788,-0.876306680043864,-0.951056516295153,-0.992114701314478,-0.998026728428272,-0.968583161128631,-0.90482705246602,-0.809016994374947,-0.684547105928689,-0.535826794978998,-0.368124552684677,-0.187381314585728,-1.10218211923262e-15,0.187381314585726,0.368124552684675,0.535826794978996,0.68454710592869,0.809016994374946,0.904827052466019,0.968583161128632,0.998026728428271,0.992114701314478,0.951056516295155,0.876306680043865,0.770513242775789,0.637423989748693,0.481753674101717,0.309016994374947,0.125333233564308,-0.0627905195293118,-0.248689887164856,-0.425779291565069,-0.587785252292475,-0.72896862742141,-0.844327925502015,-0.929776485888252,-0.982287250728688,-1,-0.982287250728688,-0.929776485888252,-0.844327925502015,-0.728968627421409,-0.587785252292474,-0.425779291565072,-0.248689887164851,-0.0627905195293144,0.125333233564306,0.309016994374951,0.481753674101715,0.637423989748691,0.770513242775787,0.876306680043863,0.951056516295154,0.992114701314478,0.998026728428272,0.968583161128631,0.90482705246602,0.809016994374947,0.684547105928687,0.535826794978998,0.368124552684677,0.187381314585729},
-{-0,-0.218143241396543,-0.425779291565073,-0.612907053652976,-0.770513242775789,-0.891006524188368,-0.968583161128631,-0.999506560365732,-0.982287250728689,-0.917754625683981,-0.809016994374947,-0.661311865323652,-0.481753674101715,-0.27899110603923,-0.0627905195293136,0.156434465040231,0.368124552684678,0.56208337785213,0.728968627421412,0.860742027003944,0.951056516295154,0.99556196460308,0.992114701314478,0.940880768954226,0.844327925502015,0.707106781186548,0.535826794978997,0.338737920245291,0.125333233564305,-0.0941083133185144,-0.309016994374947,-0.509041415750371,-0.684547105928689,-0.827080574274562,-0.929776485888251,-0.987688340595138,-0.998026728428272,-0.960293685676943,-0.876306680043863,-0.750111069630459,-0.587785252292473,-0.39714789063478,-0.187381314585724,0.0314107590781278,0.248689887164855,0.453990499739547,0.637423989748689,0.79015501237569,0.90482705246602,0.975916761938748,1,0.975916761938748,0.90482705246602,0.790155012375691,0.63742398974869,0.453990499739546,0.248689887164856,0.0314107590781286,-0.187381314585725,-0.39714789063478,-0.587785252292473,-0.75011106963046,-0.876306680043863,-0.960293685676943,-0.998026728428272,-0.987688340595138,-0.929776485888251,-0.827080574274563,-0.68454710592869,-0.509041415750372,-0.309016994374948,-0.0941083133185144,0.125333233564305,0.338737920245291,0.535826794978996,0.707106781186548,0.844327925502016,0.940880768954226,0.992114701314478,0.99556196460308,0.951056516295154,0.860742027003944,0.728968627421411,0.56208337785213,0.368124552684677,0.156434465040232,-0.0627905195293123,-0.278991106039229,-0.481753674101715,-0.661311865323652,-0.809016994374948,-0.91775462568398,-0.982287250728688,-0.999506560365732,-0.968583161128631,-0.891006524188368,-0.770513242775789,-0.612907053652976,-0.425779291565071,-0.218143241396544,-4.40996643820365e-15,0.218143241396539,0.42577929156507,0.612907053652974,0.770513242775788,0.891006524188367,0.968583161128631,0.999506560365731,0.982287250728689,0.917754625683981,0.809016994374947,0.661311865323653,0.481753674101717,0.27899110603923,0.062790519529314,-0.156434465040231,-0.368124552684678,-0.562083377852131,-0.72896862742141,-0.860742027003943,-0.951056516295153,-0.99556196460308,-0.992114701314478,-0.940880768954226,-0.844327925502016,-0.707106781186549,-0.535826794978998,-0.338737920245292,-0.125333233564305,0.0941083133185144,0.309016994374948,0.509041415750372,0.68454710592869,0.827080574274563,0.92977648588825,0.987688340595137,0.998026728428272,0.960293685676944,0.876306680043865,0.750111069630461,0.587785252292474,0.397147890634781,0.187381314585725,-0.0314107590781287,-0.248689887164856,-0.453990499739548,-0.637423989748689,-0.790155012375688,-0.904827052466019,-0.975916761938747,-1,-0.975916761938748,-0.904827052466019,-0.790155012375691,-0.637423989748688,-0.453990499739547,-0.248689887164851,-0.0314107590781277,0.187381314585722,0.397147890634776,0.587785252292472,0.750111069630457,0.876306680043863,0.960293685676942,0.998026728428272,0.987688340595138,0.929776485888251,0.827080574274562,0.684547105928687,0.509041415750371,0.309016994374951,0.0941083133185206,-0.125333233564302,-0.338737920245286,-0.535826794978996,-0.707106781186545,-0.844327925502015,-0.940880768954224,-0.992114701314478,-0.99556196460308,-0.951056516295153,-0.860742027003944,-0.728968627421414,-0.562083377852131,-0.368124552684681,-0.15643446504023,0.0627905195293114,0.278991106039224,0.481753674101714,0.661311865323649,0.809016994374947,0.91775462568398,0.982287250728689,0.999506560365732,0.968583161128631,0.891006524188368,0.770513242775787,0.612907053652976,0.425779291565075,0.218143241396541},
-{-0,-0.248689887164855,-0.481753674101715,-0.684547105928689,-0.844327925502015,-0.951056516295154,-0.998026728428272,-0.982287250728689,-0.904827052466019,-0.770513242775789,-0.587785252292473,-0.368124552684678,-0.125333233564305,0.125333233564304,0.368124552684678,0.587785252292473,0.770513242775789,0.90482705246602,0.982287250728689,0.998026728428272,0.951056516295154,0.844327925502015,0.684547105928689,0.481753674101716,0.248689887164855,2.44929359829471e-16,-0.248689887164855,-0.481753674101715,-0.684547105928689,-0.844327925502015,-0.951056516295153,-0.998026728428272,-0.982287250728689,-0.904827052466019,-0.770513242775789,-0.587785252292473,-0.368124552684678,-0.125333233564304,0.125333233564303,0.368124552684677,0.587785252292473,0.770513242775788,0.90482705246602,0.982287250728688,0.998026728428272,0.951056516295154,0.844327925502016,0.684547105928689,0.481753674101716,0.248689887164856,4.89858719658941e-16,-0.248689887164855,-0.481753674101715,-0.684547105928689,-0.844327925502015,-0.951056516295153,-0.998026728428272,-0.982287250728689,-0.904827052466019,-0.77051324277579,-0.587785252292475,-0.368124552684678,-0.125333233564306,0.125333233564305,0.368124552684679,0.587785252292473,0.77051324277579,0.90482705246602,0.982287250728689,0.998026728428272,0.951056516295154,0.844327925502014,0.684547105928689,0.481753674101717,0.248689887164854,7.34788079488412e-16,-0.248689887164853,-0.481753674101715,-0.684547105928688,-0.844327925502015,-0.951056516295153,-0.998026728428271,-0.982287250728689,-0.904827052466019,-0.770513242775789,-0.587785252292474,-0.36812455268468,-0.125333233564308,0.125333233564303,0.368124552684678,0.587785252292472,0.770513242775788,0.904827052466018,0.982287250728688,0.998026728428272,0.951056516295154,0.844327925502016,0.684547105928689,0.481753674101717,0.248689887164854,9.79717439317883e-16,-0.248689887164852,-0.481753674101715,-0.684547105928687,-0.844327925502015,-0.951056516295153,-0.998026728428272,-0.982287250728689,-0.90482705246602,-0.770513242775791,-0.587785252292474,-0.368124552684677,-0.125333233564305,0.125333233564302,0.368124552684675,0.587785252292475,0.77051324277579,0.904827052466019,0.982287250728688,0.998026728428272,0.951056516295155,0.844327925502015,0.684547105928689,0.481753674101717,0.248689887164858,4.77736047794785e-15,-0.248689887164856,-0.481753674101715,-0.68454710592869,-0.844327925502015,-0.951056516295153,-0.998026728428271,-0.982287250728688,-0.904827052466019,-0.770513242775789,-0.587785252292474,-0.368124552684674,-0.125333233564301,0.125333233564306,0.368124552684678,0.587785252292472,0.770513242775787,0.904827052466021,0.982287250728689,0.998026728428272,0.951056516295154,0.844327925502017,0.684547105928687,0.481753674101714,0.248689887164855,1.46957615897682e-15,-0.248689887164852,-0.481753674101711,-0.68454710592869,-0.844327925502015,-0.951056516295153,-0.998026728428271,-0.982287250728689,-0.904827052466019,-0.770513242775789,-0.587785252292474,-0.368124552684681,-0.125333233564309,0.125333233564298,0.368124552684671,0.587785252292466,0.770513242775792,0.904827052466021,0.982287250728689,0.998026728428272,0.951056516295154,0.844327925502017,0.684547105928692,0.48175367410172,0.248689887164862,8.8199328764073e-15,-0.248689887164852,-0.481753674101717,-0.68454710592869,-0.844327925502015,-0.951056516295153,-0.998026728428271,-0.982287250728689,-0.904827052466022,-0.770513242775794,-0.587785252292475,-0.368124552684681,-0.125333233564302,0.125333233564305,0.368124552684678,0.587785252292472,0.770513242775787,0.904827052466018,0.982287250728687,0.998026728428272,0.951056516295154,0.844327925502017,0.684547105928692,0.481753674101714,0.248689887164855},
-{-0,-0.278991106039229,-0.535826794978997,-0.750111069630459,-0.90482705246602,-0.987688340595138,-0.992114701314478,-0.917754625683981,-0.770513242775789,-0.562083377852131,-0.309016994374948,-0.0314107590781282,0.248689887164855,0.509041415750371,0.728968627421412,0.891006524188368,0.982287250728689,0.99556196460308,0.929776485888252,0.790155012375691,0.587785252292473,0.338737920245291,0.0627905195293133,-0.218143241396542,-0.481753674101715,-0.707106781186547,-0.876306680043864,-0.975916761938747,-0.998026728428272,-0.940880768954226,-0.809016994374948,-0.612907053652977,-0.368124552684678,-0.0941083133185141,0.187381314585725,0.453990499739547,0.684547105928688,0.860742027003943,0.968583161128631,0.999506560365732,0.951056516295154,0.827080574274562,0.63742398974869,0.397147890634781,0.125333233564304,-0.15643446504023,-0.425779291565072,-0.661311865323651,-0.844327925502015,-0.960293685676943,-1,-0.960293685676943,-0.844327925502015,-0.661311865323652,-0.425779291565073,-0.156434465040231,0.125333233564305,0.39714789063478,0.637423989748689,0.827080574274561,0.951056516295153,0.999506560365731,0.968583161128631,0.860742027003944,0.684547105928689,0.453990499739547,0.187381314585724,-0.0941083133185148,-0.368124552684679,-0.612907053652977,-0.809016994374948,-0.940880768954225,-0.998026728428271,-0.975916761938747,-0.876306680043864,-0.707106781186546,-0.481753674101717,-0.218143241396544,0.0627905195293122,0.33873792024529,0.587785252292472,0.79015501237569,0.929776485888251,0.99556196460308,0.982287250728689,0.891006524188368,0.728968627421411,0.509041415750371,0.248689887164854,-0.0314107590781289,-0.309016994374945,-0.562083377852131,-0.770513242775788,-0.917754625683982,-0.992114701314478,-0.987688340595137,-0.90482705246602,-0.750111069630458,-0.535826794978998,-0.278991106039227,-1.10218211923262e-15,0.278991106039232,0.535826794978996,0.750111069630457,0.904827052466019,0.987688340595137,0.992114701314478,0.917754625683983,0.770513242775789,0.562083377852133,0.309016994374947,0.0314107590781311,-0.248689887164856,-0.509041415750369,-0.72896862742141,-0.891006524188367,-0.982287250728688,-0.99556196460308,-0.929776485888252,-0.790155012375691,-0.587785252292474,-0.338737920245292,-0.0627905195293144,0.218143241396542,0.481753674101715,0.707106781186547,0.876306680043863,0.975916761938747,0.998026728428272,0.940880768954228,0.809016994374947,0.612907053652982,0.368124552684677,0.0941083133185206,-0.187381314585726,-0.453990499739542,-0.68454710592869,-0.860742027003941,-0.968583161128632,-0.999506560365732,-0.951056516295153,-0.827080574274565,-0.637423989748693,-0.397147890634785,-0.125333233564309,0.156434465040227,0.425779291565075,0.661311865323649,0.844327925502013,0.960293685676942,1,0.960293685676944,0.844327925502017,0.661311865323654,0.425779291565075,0.156434465040233,-0.125333233564302,-0.397147890634779,-0.637423989748688,-0.827080574274561,-0.951056516295153,-0.999506560365731,-0.968583161128632,-0.860742027003944,-0.68454710592869,-0.453990499739548,-0.187381314585725,0.0941083133185137,0.368124552684678,0.612907053652971,0.809016994374947,0.940880768954225,0.998026728428272,0.975916761938749,0.876306680043863,0.707106781186547,0.481753674101714,0.218143241396548,-0.0627905195293146,-0.338737920245293,-0.587785252292469,-0.790155012375687,-0.929776485888252,-0.99556196460308,-0.98228725072869,-0.89100652418837,-0.72896862742141,-0.509041415750369,-0.248689887164859,0.0314107590781243,0.309016994374951,0.562083377852133,0.770513242775787,0.91775462568398,0.992114701314478,0.987688340595138,0.904827052466021,0.750111069630461,0.535826794978993,0.278991106039232},
-{-0,-0.309016994374947,-0.587785252292473,-0.809016994374947,-0.951056516295154,-1,-0.951056516295154,-0.809016994374947,-0.587785252292473,-0.309016994374948,-1.22464679914735e-16,0.309016994374947,0.587785252292473,0.809016994374947,0.951056516295154,1,0.951056516295154,0.809016994374948,0.587785252292473,0.309016994374948,2.44929359829471e-16,-0.309016994374947,-0.587785252292473,-0.809016994374948,-0.951056516295153,-1,-0.951056516295154,-0.809016994374948,-0.587785252292473,-0.309016994374948,-3.67394039744206e-16,0.309016994374947,0.587785252292473,0.809016994374946,0.951056516295153,1,0.951056516295154,0.809016994374948,0.587785252292473,0.309016994374948,4.89858719658941e-16,-0.309016994374947,-0.587785252292473,-0.809016994374947,-0.951056516295153,-1,-0.951056516295153,-0.809016994374948,-0.587785252292475,-0.309016994374948,-2.38868023897393e-15,0.309016994374949,0.587785252292473,0.809016994374948,0.951056516295153,1,0.951056516295154,0.809016994374947,0.587785252292474,0.309016994374946,7.34788079488412e-16,-0.309016994374948,-0.587785252292472,-0.809016994374948,-0.951056516295153,-1,-0.951056516295155,-0.809016994374949,-0.587785252292474,-0.309016994374947,-4.40996643820365e-15,0.309016994374945,0.587785252292472,0.809016994374948,0.951056516295153,1,0.951056516295154,0.809016994374947,0.587785252292474,0.30901699437495,9.79717439317883e-16,-0.309016994374945,-0.587785252292472,-0.809016994374948,-0.951056516295153,-1,-0.951056516295154,-0.809016994374947,-0.587785252292474,-0.30901699437495,-1.10218211923262e-15,0.309016994374948,0.587785252292475,0.809016994374946,0.951056516295153,1,0.951056516295155,0.809016994374949,0.587785252292474,0.309016994374947,4.77736047794785e-15,-0.309016994374945,-0.587785252292475,-0.809016994374946,-0.951056516295153,-1,-0.951056516295153,-0.809016994374945,-0.587785252292474,-0.309016994374947,2.20560219973841e-15,0.309016994374951,0.587785252292472,0.809016994374948,0.951056516295154,1,0.951056516295154,0.809016994374947,0.587785252292471,0.309016994374951,1.46957615897682e-15,-0.309016994374948,-0.587785252292475,-0.809016994374945,-0.951056516295153,-1,-0.951056516295153,-0.809016994374949,-0.587785252292474,-0.309016994374947,-5.14475451769206e-15,0.309016994374944,0.587785252292466,0.809016994374947,0.951056516295152,1,0.951056516295154,0.809016994374952,0.587785252292472,0.309016994374951,8.8199328764073e-15,-0.309016994374947,-0.587785252292469,-0.80901699437495,-0.951056516295153,-1,-0.951056516295153,-0.80901699437495,-0.587785252292475,-0.309016994374947,-5.38968387752153e-15,0.309016994374944,0.587785252292472,0.809016994374947,0.951056516295154,1,0.951056516295154,0.809016994374947,0.587785252292478,0.309016994374951,1.95943487863577e-15,-0.309016994374947,-0.587785252292469,-0.809016994374945,-0.951056516295153,-1,-0.951056516295153,-0.80901699437495,-0.587785252292475,-0.309016994374948,-5.634613237351e-15,0.309016994374951,0.587785252292471,0.809016994374947,0.951056516295154,1,0.951056516295154,0.809016994374948,0.587785252292478,0.309016994374944,2.20436423846524e-15,-0.30901699437494,-0.587785252292474,-0.809016994374945,-0.951056516295155,-1,-0.951056516295155,-0.809016994374946,-0.587785252292475,-0.309016994374955,1.22588476042053e-15,0.309016994374944,0.587785252292465,0.809016994374947,0.951056516295152,1,0.951056516295154,0.809016994374952,0.587785252292472,0.309016994374951},
-{-0,-0.338737920245291,-0.63742398974869,-0.860742027003944,-0.982287250728689,-0.987688340595138,-0.876306680043864,-0.661311865323652,-0.368124552684678,-0.0314107590781287,0.309016994374947,0.612907053652976,0.844327925502015,0.975916761938747,0.992114701314478,0.891006524188368,0.684547105928689,0.397147890634781,0.0627905195293142,-0.278991106039228,-0.587785252292472,-0.827080574274561,-0.968583161128631,-0.99556196460308,-0.90482705246602,-0.707106781186548,-0.425779291565074,-0.0941083133185159,0.248689887164853,0.562083377852129,0.809016994374946,0.960293685676942,0.998026728428272,0.917754625683981,0.728968627421412,0.453990499739548,0.125333233564306,-0.218143241396541,-0.535826794978995,-0.790155012375689,-0.951056516295153,-0.999506560365732,-0.929776485888252,-0.750111069630461,-0.481753674101716,-0.156434465040232,0.187381314585723,0.50904141575037,0.770513242775788,0.940880768954225,1,0.940880768954226,0.770513242775791,0.509041415750374,0.187381314585728,-0.156434465040228,-0.481753674101712,-0.750111069630457,-0.92977648588825,-0.999506560365731,-0.951056516295155,-0.790155012375693,-0.535826794979001,-0.218143241396544,0.125333233564303,0.453990499739545,0.72896862742141,0.91775462568398,0.998026728428271,0.960293685676944,0.809016994374949,0.562083377852133,0.248689887164858,-0.094108313318511,-0.425779291565069,-0.707106781186545,-0.904827052466018,-0.99556196460308,-0.968583161128632,-0.827080574274564,-0.587785252292477,-0.278991106039234,0.0627905195293084,0.397147890634776,0.684547105928685,0.891006524188365,0.992114701314477,0.975916761938749,0.844327925502017,0.612907053652979,0.30901699437495,-0.0314107590781251,-0.368124552684675,-0.661311865323646,-0.876306680043862,-0.987688340595137,-0.982287250728689,-0.860742027003948,-0.637423989748693,-0.338737920245299,-4.89982515786259e-15,0.33873792024529,0.637423989748686,0.860742027003943,0.982287250728688,0.987688340595138,0.876306680043866,0.661311865323654,0.368124552684684,0.0314107590781314,-0.309016994374941,-0.612907053652974,-0.844327925502011,-0.975916761938747,-0.992114701314479,-0.89100652418837,-0.684547105928694,-0.397147890634785,-0.0627905195293217,0.278991106039224,0.587785252292466,0.827080574274559,0.968583161128629,0.995561964603081,0.904827052466024,0.707106781186552,0.425779291565075,0.0941083133185208,-0.248689887164852,-0.562083377852125,-0.809016994374945,-0.960293685676941,-0.998026728428272,-0.917754625683984,-0.728968627421414,-0.453990499739554,-0.125333233564309,0.218143241396534,0.535826794978992,0.790155012375685,0.951056516295152,0.999506560365732,0.929776485888254,0.750111069630466,0.481753674101721,0.156434465040241,-0.187381314585718,-0.509041415750362,-0.770513242775785,-0.940880768954222,-1,-0.940880768954227,-0.770513242775794,-0.509041415750375,-0.187381314585733,0.156434465040226,0.481753674101708,0.750111069630456,0.929776485888248,0.999506560365731,0.951056516295156,0.790155012375694,0.535826794979005,0.218143241396549,-0.125333233564294,-0.453990499739541,-0.728968627421404,-0.917754625683978,-0.998026728428271,-0.960293685676945,-0.809016994374954,-0.562083377852137,-0.248689887164866,0.0941083133185062,0.425779291565062,0.707106781186541,0.904827052466017,0.995561964603079,0.968583161128633,0.827080574274567,0.587785252292478,0.278991106039239,-0.062790519529307,-0.397147890634771,-0.684547105928684,-0.891006524188363,-0.992114701314476,-0.97591676193875,-0.844327925502019,-0.61290705365298,-0.309016994374962,0.0314107590781167,0.36812455268467,0.661311865323648,0.876306680043856,0.987688340595136,0.98228725072869,0.860742027003947,0.637423989748702,0.338737920245304},
-{-0,-0.368124552684678,-0.684547105928689,-0.90482705246602,-0.998026728428272,-0.951056516295154,-0.770513242775789,-0.481753674101715,-0.125333233564305,0.248689887164855,0.587785252292473,0.844327925502015,0.982287250728689,0.982287250728689,0.844327925502015,0.587785252292473,0.248689887164855,-0.125333233564304,-0.481753674101715,-0.770513242775789,-0.951056516295153,-0.998026728428272,-0.904827052466019,-0.684547105928688,-0.368124552684678,-3.67394039744206e-16,0.368124552684677,0.684547105928688,0.90482705246602,0.998026728428271,0.951056516295154,0.77051324277579,0.481753674101716,0.125333233564304,-0.248689887164855,-0.587785252292473,-0.844327925502015,-0.982287250728689,-0.982287250728689,-0.844327925502015,-0.587785252292475,-0.248689887164856,0.125333233564305,0.481753674101715,0.77051324277579,0.951056516295153,0.998026728428272,0.90482705246602,0.684547105928689,0.368124552684677,7.34788079488412e-16,-0.368124552684679,-0.684547105928688,-0.904827052466019,-0.998026728428271,-0.951056516295155,-0.770513242775789,-0.481753674101717,-0.125333233564308,0.248689887164856,0.587785252292472,0.844327925502013,0.982287250728688,0.982287250728689,0.844327925502016,0.587785252292474,0.248689887164854,-0.125333233564303,-0.481753674101715,-0.770513242775788,-0.951056516295153,-0.998026728428272,-0.90482705246602,-0.684547105928689,-0.368124552684677,-1.10218211923262e-15,0.368124552684675,0.68454710592869,0.904827052466019,0.998026728428271,0.951056516295155,0.770513242775789,0.481753674101717,0.125333233564308,-0.248689887164856,-0.587785252292475,-0.844327925502015,-0.982287250728688,-0.982287250728688,-0.844327925502015,-0.587785252292474,-0.248689887164851,0.125333233564306,0.481753674101715,0.770513242775787,0.951056516295154,0.998026728428272,0.90482705246602,0.684547105928687,0.368124552684677,1.46957615897682e-15,-0.368124552684675,-0.68454710592869,-0.904827052466019,-0.998026728428271,-0.951056516295153,-0.770513242775789,-0.481753674101717,-0.125333233564309,0.248689887164855,0.587785252292466,0.844327925502013,0.982287250728689,0.98228725072869,0.844327925502017,0.587785252292472,0.248689887164862,-0.125333233564302,-0.481753674101717,-0.770513242775785,-0.951056516295153,-0.998026728428271,-0.904827052466022,-0.68454710592869,-0.368124552684681,-5.38968387752153e-15,0.368124552684678,0.684547105928687,0.904827052466018,0.998026728428272,0.951056516295154,0.770513242775792,0.481753674101714,0.125333233564305,-0.248689887164851,-0.587785252292469,-0.844327925502015,-0.982287250728688,-0.98228725072869,-0.844327925502015,-0.587785252292475,-0.248689887164859,0.125333233564305,0.481753674101714,0.770513242775787,0.951056516295154,0.998026728428272,0.904827052466021,0.684547105928687,0.368124552684685,2.20436423846524e-15,-0.368124552684681,-0.684547105928684,-0.904827052466019,-0.998026728428272,-0.951056516295155,-0.77051324277579,-0.481753674101712,-0.125333233564309,0.248689887164855,0.587785252292465,0.844327925502013,0.982287250728689,0.98228725072869,0.844327925502017,0.587785252292472,0.248689887164863,-0.125333233564301,-0.481753674101717,-0.770513242775784,-0.951056516295155,-0.998026728428272,-0.904827052466019,-0.684547105928685,-0.368124552684682,9.80955400591059e-16,0.368124552684683,0.684547105928686,0.90482705246602,0.998026728428272,0.951056516295154,0.770513242775788,0.481753674101709,0.125333233564306,-0.248689887164858,-0.58778525229248,-0.844327925502014,-0.982287250728689,-0.98228725072869,-0.844327925502015,-0.58778525229247,-0.24868988716486,0.125333233564304,0.48175367410172,0.770513242775786,0.951056516295154,0.998026728428271,0.904827052466021,0.684547105928688,0.368124552684685},
-{-0,-0.397147890634781,-0.728968627421412,-0.940880768954226,-0.998026728428272,-0.891006524188368,-0.63742398974869,-0.278991106039229,0.125333233564304,0.509041415750371,0.809016994374947,0.975916761938747,0.982287250728689,0.827080574274562,0.535826794978996,0.15643446504023,-0.248689887164855,-0.612907053652977,-0.876306680043864,-0.99556196460308,-0.951056516295154,-0.750111069630459,-0.425779291565072,-0.0314107590781267,0.368124552684679,0.707106781186548,0.929776485888251,0.999506560365732,0.904827052466018,0.66131186532365,0.309016994374946,-0.0941083133185151,-0.481753674101715,-0.79015501237569,-0.968583161128631,-0.987688340595138,-0.844327925502015,-0.56208337785213,-0.187381314585724,0.218143241396544,0.587785252292473,0.860742027003943,0.992114701314478,0.960293685676943,0.770513242775789,0.453990499739547,0.0627905195293102,-0.338737920245294,-0.68454710592869,-0.917754625683982,-1,-0.91775462568398,-0.684547105928689,-0.338737920245289,0.0627905195293122,0.453990499739548,0.770513242775792,0.960293685676943,0.992114701314477,0.860742027003944,0.587785252292471,0.218143241396544,-0.187381314585726,-0.562083377852131,-0.844327925502015,-0.987688340595138,-0.968583161128631,-0.790155012375689,-0.481753674101714,-0.0941083133185131,0.309016994374948,0.661311865323652,0.904827052466019,0.999506560365732,0.929776485888251,0.707106781186546,0.368124552684677,-0.0314107590781287,-0.425779291565076,-0.750111069630459,-0.951056516295153,-0.99556196460308,-0.876306680043865,-0.612907053652973,-0.248689887164851,0.156434465040234,0.535826794978999,0.827080574274563,0.982287250728689,0.975916761938747,0.809016994374947,0.509041415750371,0.125333233564298,-0.278991106039228,-0.637423989748694,-0.891006524188367,-0.998026728428272,-0.940880768954224,-0.728968627421409,-0.397147890634778,1.96067283990894e-15,0.397147890634782,0.728968627421417,0.940880768954226,0.998026728428272,0.891006524188365,0.637423989748685,0.278991106039231,-0.125333233564302,-0.509041415750375,-0.80901699437495,-0.975916761938748,-0.982287250728687,-0.827080574274561,-0.535826794978995,-0.15643446504023,0.248689887164862,0.612907053652976,0.876306680043863,0.99556196460308,0.951056516295152,0.750111069630456,0.425779291565075,0.0314107590781247,-0.368124552684681,-0.707106781186549,-0.929776485888252,-0.999506560365731,-0.904827052466019,-0.661311865323652,-0.309016994374941,0.0941083133185206,0.481753674101714,0.790155012375689,0.968583161128632,0.987688340595137,0.844327925502013,0.562083377852122,0.187381314585722,-0.218143241396544,-0.587785252292474,-0.860742027003948,-0.992114701314478,-0.960293685676943,-0.77051324277579,-0.453990499739542,-0.0627905195293083,0.338737920245289,0.684547105928692,0.917754625683983,1,0.917754625683983,0.684547105928687,0.33873792024529,-0.0627905195293141,-0.453990499739553,-0.770513242775794,-0.960293685676945,-0.992114701314478,-0.860742027003941,-0.587785252292475,-0.218143241396539,0.187381314585735,0.562083377852133,0.844327925502013,0.987688340595138,0.968583161128629,0.79015501237569,0.481753674101709,0.0941083133185005,-0.309016994374953,-0.661311865323651,-0.904827052466022,-0.999506560365732,-0.92977648588825,-0.70710678118655,-0.368124552684675,0.0314107590781377,0.425779291565074,0.750111069630456,0.951056516295154,0.995561964603079,0.876306680043864,0.612907053652972,0.248689887164842,-0.156434465040236,-0.535826794978994,-0.827080574274564,-0.982287250728691,-0.975916761938747,-0.80901699437495,-0.50904141575037,-0.125333233564296,0.27899110603923,0.637423989748695,0.891006524188368,0.998026728428272,0.940880768954226,0.728968627421408,0.397147890634783},
-{-0,-0.425779291565073,-0.770513242775789,-0.968583161128631,-0.982287250728689,-0.809016994374947,-0.481753674101715,-0.0627905195293136,0.368124552684678,0.728968627421412,0.951056516295154,0.992114701314478,0.844327925502015,0.535826794978997,0.125333233564305,-0.309016994374947,-0.684547105928689,-0.929776485888251,-0.998026728428272,-0.876306680043863,-0.587785252292473,-0.187381314585724,0.248689887164855,0.637423989748689,0.90482705246602,1,0.90482705246602,0.63742398974869,0.248689887164856,-0.187381314585725,-0.587785252292473,-0.876306680043863,-0.998026728428272,-0.929776485888251,-0.68454710592869,-0.309016994374948,0.125333233564305,0.535826794978996,0.844327925502016,0.992114701314478,0.951056516295154,0.728968627421411,0.368124552684677,-0.0627905195293123,-0.481753674101715,-0.809016994374948,-0.982287250728688,-0.968583161128631,-0.770513242775789,-0.425779291565071,-4.40996643820365e-15,0.42577929156507,0.770513242775788,0.968583161128631,0.982287250728689,0.809016994374947,0.481753674101717,0.062790519529314,-0.368124552684678,-0.72896862742141,-0.951056516295153,-0.992114701314478,-0.844327925502016,-0.535826794978998,-0.125333233564305,0.309016994374948,0.68454710592869,0.92977648588825,0.998026728428272,0.876306680043865,0.587785252292474,0.187381314585725,-0.248689887164856,-0.637423989748689,-0.904827052466019,-1,-0.904827052466019,-0.637423989748688,-0.248689887164851,0.187381314585722,0.587785252292472,0.876306680043863,0.998026728428272,0.929776485888251,0.684547105928687,0.309016994374951,-0.125333233564302,-0.535826794978996,-0.844327925502015,-0.992114701314478,-0.951056516295153,-0.728968627421414,-0.368124552684681,0.0627905195293114,0.481753674101714,0.809016994374947,0.982287250728689,0.968583161128631,0.770513242775787,0.425779291565075,8.8199328764073e-15,-0.425779291565066,-0.770513242775785,-0.96858316112863,-0.982287250728689,-0.80901699437495,-0.481753674101717,-0.0627905195293149,0.368124552684678,0.728968627421412,0.951056516295154,0.992114701314478,0.844327925502017,0.535826794978999,0.125333233564305,-0.309016994374947,-0.684547105928689,-0.929776485888252,-0.998026728428272,-0.876306680043865,-0.587785252292475,-0.187381314585726,0.248689887164855,0.637423989748685,0.904827052466017,1,0.904827052466021,0.637423989748691,0.248689887164856,-0.187381314585725,-0.587785252292474,-0.876306680043865,-0.998026728428272,-0.92977648588825,-0.684547105928695,-0.309016994374955,0.125333233564298,0.535826794978992,0.844327925502013,0.992114701314477,0.951056516295154,0.728968627421412,0.368124552684678,-0.0627905195293141,-0.481753674101717,-0.809016994374949,-0.982287250728688,-0.968583161128633,-0.77051324277579,-0.425779291565079,9.80955400591059e-16,0.425779291565068,0.770513242775791,0.96858316112863,0.982287250728688,0.809016994374948,0.481753674101709,0.0627905195293122,-0.368124552684673,-0.728968627421404,-0.951056516295153,-0.992114701314479,-0.844327925502015,-0.535826794979002,-0.125333233564303,0.309016994374943,0.684547105928691,0.92977648588825,0.998026728428271,0.876306680043864,0.587785252292478,0.187381314585737,-0.248689887164851,-0.637423989748682,-0.904827052466019,-1,-0.90482705246602,-0.637423989748695,-0.248689887164853,0.187381314585721,0.587785252292476,0.876306680043863,0.998026728428271,0.929776485888251,0.684547105928693,0.309016994374945,-0.1253332335643,-0.535826794978988,-0.844327925502014,-0.992114701314477,-0.951056516295154,-0.728968627421415,-0.368124552684676,0.0627905195293097,0.481753674101719,0.809016994374947,0.98228725072869,0.968583161128631,0.770513242775793,0.42577929156507},
-{-0,-0.453990499739547,-0.809016994374947,-0.987688340595138,-0.951056516295154,-0.707106781186548,-0.309016994374948,0.15643446504023,0.587785252292473,0.891006524188368,1,0.891006524188368,0.587785252292474,0.156434465040231,-0.309016994374946,-0.707106781186547,-0.951056516295153,-0.987688340595138,-0.809016994374948,-0.453990499739548,-3.67394039744206e-16,0.453990499739546,0.809016994374946,0.987688340595138,0.951056516295154,0.707106781186548,0.309016994374948,-0.15643446504023,-0.587785252292471,-0.891006524188366,-1,-0.891006524188369,-0.587785252292475,-0.156434465040232,0.309016994374945,0.707106781186548,0.951056516295153,0.987688340595138,0.809016994374949,0.45399049973955,7.34788079488412e-16,-0.453990499739545,-0.809016994374946,-0.987688340595137,-0.951056516295155,-0.707106781186549,-0.30901699437495,0.156434465040227,0.58778525229247,0.891006524188367,1,0.891006524188368,0.587785252292474,0.156434465040233,-0.309016994374945,-0.707106781186545,-0.951056516295152,-0.987688340595139,-0.809016994374951,-0.453990499739547,-1.10218211923262e-15,0.453990499739545,0.809016994374946,0.987688340595137,0.951056516295155,0.707106781186552,0.30901699437495,-0.156434465040227,-0.587785252292469,-0.891006524188364,-1,-0.89100652418837,-0.587785252292474,-0.156434465040237,0.309016994374944,0.707106781186542,0.951056516295152,0.987688340595138,0.809016994374951,0.45399049973955,1.46957615897682e-15,-0.453990499739542,-0.809016994374945,-0.987688340595138,-0.951056516295155,-0.707106781186549,-0.309016994374954,0.156434465040227,0.587785252292466,0.891006524188368,1,0.891006524188368,0.587785252292477,0.156434465040233,-0.309016994374941,-0.707106781186544,-0.951056516295151,-0.987688340595139,-0.80901699437495,-0.453990499739554,-5.38968387752153e-15,0.453990499739538,0.809016994374947,0.987688340595136,0.951056516295154,0.707106781186552,0.309016994374951,-0.15643446504023,-0.587785252292469,-0.891006524188367,-1,-0.89100652418837,-0.587785252292481,-0.156434465040237,0.309016994374937,0.707106781186542,0.95105651629515,0.987688340595138,0.809016994374948,0.453990499739551,2.20436423846524e-15,-0.453990499739541,-0.809016994374945,-0.987688340595136,-0.951056516295155,-0.707106781186555,-0.309016994374955,0.156434465040219,0.587785252292465,0.891006524188368,1,0.891006524188369,0.587785252292478,0.156434465040234,-0.30901699437494,-0.707106781186544,-0.951056516295151,-0.987688340595138,-0.809016994374958,-0.453990499739555,9.80955400591059e-16,0.453990499739544,0.809016994374943,0.987688340595136,0.951056516295154,0.707106781186553,0.309016994374958,-0.156434465040215,-0.587785252292468,-0.891006524188363,-1,-0.89100652418837,-0.587785252292481,-0.156434465040231,0.309016994374943,0.707106781186541,0.951056516295149,0.987688340595138,0.809016994374952,0.453990499739558,2.93915231795365e-15,-0.45399049973954,-0.80901699437494,-0.987688340595135,-0.951056516295156,-0.707106781186555,-0.309016994374949,0.156434465040225,0.587785252292465,0.891006524188361,1,0.891006524188372,0.587785252292484,0.156434465040235,-0.309016994374939,-0.707106781186538,-0.951056516295148,-0.987688340595141,-0.809016994374946,-0.453990499739549,-6.85926003649835e-15,0.453990499739524,0.809016994374947,0.987688340595137,0.951056516295157,0.707106781186548,0.309016994374952,-0.156434465040221,-0.587785252292462,-0.891006524188366,-1,-0.891006524188374,-0.587785252292487,-0.156434465040239,0.309016994374936,0.707106781186536,0.951056516295151,0.98768834059514,0.809016994374957,0.453990499739565},
-{-0,-0.481753674101715,-0.844327925502015,-0.998026728428272,-0.904827052466019,-0.587785252292473,-0.125333233564305,0.368124552684678,0.770513242775789,0.982287250728689,0.951056516295154,0.684547105928689,0.248689887164855,-0.248689887164855,-0.684547105928689,-0.951056516295153,-0.982287250728689,-0.770513242775789,-0.368124552684678,0.125333233564303,0.587785252292473,0.90482705246602,0.998026728428272,0.844327925502016,0.481753674101716,4.89858719658941e-16,-0.481753674101715,-0.844327925502015,-0.998026728428272,-0.904827052466019,-0.587785252292475,-0.125333233564306,0.368124552684679,0.77051324277579,0.982287250728689,0.951056516295154,0.684547105928689,0.248689887164854,-0.248689887164853,-0.684547105928688,-0.951056516295153,-0.982287250728689,-0.770513242775789,-0.36812455268468,0.125333233564303,0.587785252292472,0.904827052466018,0.998026728428272,0.844327925502016,0.481753674101717,9.79717439317883e-16,-0.481753674101715,-0.844327925502015,-0.998026728428272,-0.90482705246602,-0.587785252292474,-0.125333233564305,0.368124552684675,0.77051324277579,0.982287250728688,0.951056516295155,0.684547105928689,0.248689887164858,-0.248689887164856,-0.68454710592869,-0.951056516295153,-0.982287250728688,-0.770513242775789,-0.368124552684674,0.125333233564306,0.587785252292472,0.904827052466021,0.998026728428272,0.844327925502017,0.481753674101714,1.46957615897682e-15,-0.481753674101711,-0.844327925502015,-0.998026728428271,-0.904827052466019,-0.587785252292474,-0.125333233564309,0.368124552684671,0.770513242775792,0.982287250728689,0.951056516295154,0.684547105928692,0.248689887164862,-0.248689887164852,-0.68454710592869,-0.951056516295153,-0.982287250728689,-0.770513242775794,-0.368124552684681,0.125333233564305,0.587785252292472,0.904827052466018,0.998026728428272,0.844327925502017,0.481753674101714,1.95943487863577e-15,-0.481753674101711,-0.844327925502015,-0.998026728428271,-0.904827052466019,-0.587785252292475,-0.125333233564302,0.368124552684677,0.770513242775787,0.982287250728687,0.951056516295154,0.684547105928687,0.248689887164856,-0.248689887164851,-0.684547105928684,-0.951056516295155,-0.982287250728688,-0.77051324277579,-0.368124552684681,0.125333233564298,0.587785252292465,0.90482705246602,0.998026728428272,0.844327925502017,0.481753674101721,9.55472095589571e-15,-0.481753674101717,-0.844327925502015,-0.998026728428272,-0.904827052466019,-0.587785252292475,-0.12533323356431,0.368124552684683,0.770513242775791,0.982287250728689,0.951056516295154,0.684547105928682,0.248689887164849,-0.248689887164858,-0.684547105928689,-0.951056516295153,-0.98228725072869,-0.770513242775786,-0.368124552684675,0.125333233564304,0.587785252292471,0.904827052466017,0.998026728428271,0.844327925502014,0.481753674101715,2.93915231795365e-15,-0.48175367410171,-0.84432792550201,-0.998026728428272,-0.90482705246602,-0.587785252292476,-0.12533323356431,0.36812455268467,0.770513242775791,0.982287250728689,0.951056516295155,0.684547105928693,0.248689887164863,-0.248689887164843,-0.684547105928678,-0.951056516295148,-0.982287250728687,-0.770513242775786,-0.368124552684676,0.125333233564304,0.58778525229247,0.904827052466017,0.998026728428272,0.844327925502022,0.481753674101728,1.76398657528146e-14,-0.48175367410171,-0.844327925502018,-0.998026728428272,-0.90482705246602,-0.587785252292476,-0.125333233564311,0.368124552684669,0.770513242775781,0.982287250728686,0.951056516295155,0.684547105928693,0.24868988716485,-0.248689887164857,-0.684547105928688,-0.951056516295152,-0.98228725072869,-0.770513242775795,-0.368124552684689,0.125333233564303,0.58778525229247,0.904827052466017,0.998026728428272,0.844327925502014,0.481753674101716},
-{-0,-0.509041415750371,-0.876306680043864,-0.999506560365732,-0.844327925502015,-0.453990499739547,0.0627905195293138,0.562083377852131,0.90482705246602,0.99556196460308,0.809016994374948,0.39714789063478,-0.125333233564305,-0.612907053652977,-0.929776485888251,-0.987688340595138,-0.770513242775789,-0.338737920245292,0.187381314585725,0.661311865323652,0.951056516295153,0.975916761938747,0.728968627421411,0.27899110603923,-0.248689887164856,-0.707106781186548,-0.968583161128631,-0.960293685676943,-0.684547105928689,-0.218143241396542,0.309016994374949,0.750111069630459,0.982287250728689,0.940880768954225,0.63742398974869,0.156434465040229,-0.368124552684679,-0.790155012375692,-0.992114701314478,-0.91775462568398,-0.587785252292474,-0.0941083133185129,0.425779291565076,0.827080574274561,0.998026728428272,0.891006524188366,0.535826794978998,0.0314107590781273,-0.481753674101718,-0.860742027003943,-1,-0.860742027003944,-0.481753674101714,0.0314107590781288,0.535826794978996,0.891006524188369,0.998026728428272,0.827080574274562,0.425779291565071,-0.0941083133185179,-0.587785252292475,-0.917754625683982,-0.992114701314478,-0.790155012375691,-0.368124552684674,0.156434465040234,0.637423989748691,0.940880768954226,0.982287250728689,0.750111069630461,0.309016994374944,-0.218143241396545,-0.68454710592869,-0.960293685676943,-0.96858316112863,-0.707106781186549,-0.248689887164851,0.278991106039231,0.728968627421417,0.975916761938747,0.951056516295154,0.661311865323654,0.187381314585722,-0.338737920245293,-0.770513242775794,-0.987688340595138,-0.929776485888252,-0.612907053652974,-0.125333233564302,0.397147890634782,0.809016994374952,0.99556196460308,0.904827052466021,0.562083377852128,0.0627905195293114,-0.453990499739554,-0.844327925502019,-0.999506560365731,-0.876306680043865,-0.509041415750369,1.47081412025e-15,0.509041415750378,0.876306680043863,0.999506560365732,0.844327925502013,0.453990499739545,-0.0627905195293144,-0.562083377852136,-0.904827052466019,-0.99556196460308,-0.809016994374946,-0.397147890634779,0.125333233564305,0.612907053652981,0.929776485888251,0.987688340595138,0.770513242775788,0.33873792024529,-0.187381314585732,-0.661311865323656,-0.951056516295155,-0.975916761938747,-0.72896862742141,-0.278991106039228,0.248689887164854,0.707106781186556,0.96858316112863,0.960293685676944,0.684547105928682,0.218143241396535,-0.309016994374953,-0.750111069630453,-0.982287250728689,-0.940880768954225,-0.637423989748689,-0.156434465040231,0.368124552684677,0.790155012375689,0.992114701314477,0.917754625683983,0.587785252292467,0.0941083133185079,-0.425779291565077,-0.827080574274564,-0.998026728428272,-0.891006524188367,-0.535826794978996,-0.0314107590781294,0.481753674101726,0.860742027003942,1,0.86074202700394,0.481753674101709,-0.0314107590781338,-0.535826794979,-0.891006524188369,-0.998026728428271,-0.827080574274554,-0.425779291565073,0.0941083133185123,0.58778525229247,0.917754625683979,0.992114701314479,0.790155012375686,0.368124552684673,-0.156434465040235,-0.637423989748692,-0.940880768954226,-0.982287250728686,-0.75011106963046,-0.309016994374949,0.21814324139654,0.684547105928686,0.960293685676942,0.968583161128629,0.707106781186543,0.24868988716485,-0.278991106039233,-0.728968627421413,-0.975916761938751,-0.951056516295149,-0.661311865323653,-0.187381314585727,0.338737920245288,0.770513242775786,0.987688340595139,0.929776485888249,0.612907053652972,0.1253332335643,-0.397147890634783,-0.809016994374957,-0.995561964603081,-0.904827052466014,-0.562083377852133,-0.0627905195293171,0.453990499739542,0.844327925502012,0.999506560365732,0.876306680043861,0.509041415750368},
-{-0,-0.535826794978997,-0.90482705246602,-0.992114701314478,-0.770513242775789,-0.309016994374948,0.248689887164855,0.728968627421412,0.982287250728689,0.929776485888252,0.587785252292473,0.0627905195293133,-0.481753674101715,-0.876306680043864,-0.998026728428272,-0.809016994374948,-0.368124552684678,0.187381314585725,0.684547105928688,0.968583161128631,0.951056516295154,0.63742398974869,0.125333233564304,-0.425779291565072,-0.844327925502015,-1,-0.844327925502015,-0.425779291565073,0.125333233564305,0.637423989748689,0.951056516295153,0.968583161128631,0.684547105928689,0.187381314585724,-0.368124552684679,-0.809016994374948,-0.998026728428271,-0.876306680043864,-0.481753674101717,0.0627905195293122,0.587785252292472,0.929776485888251,0.982287250728689,0.728968627421411,0.248689887164854,-0.309016994374945,-0.770513242775788,-0.992114701314478,-0.90482705246602,-0.535826794978998,-1.10218211923262e-15,0.535826794978996,0.904827052466019,0.992114701314478,0.770513242775789,0.309016994374947,-0.248689887164856,-0.72896862742141,-0.982287250728688,-0.929776485888252,-0.587785252292474,-0.0627905195293144,0.481753674101715,0.876306680043863,0.998026728428272,0.809016994374947,0.368124552684677,-0.187381314585726,-0.68454710592869,-0.968583161128632,-0.951056516295153,-0.637423989748693,-0.125333233564309,0.425779291565075,0.844327925502013,1,0.844327925502017,0.425779291565075,-0.125333233564302,-0.637423989748688,-0.951056516295153,-0.968583161128632,-0.68454710592869,-0.187381314585725,0.368124552684678,0.809016994374947,0.998026728428272,0.876306680043863,0.481753674101714,-0.0627905195293146,-0.587785252292469,-0.929776485888252,-0.98228725072869,-0.72896862742141,-0.248689887164859,0.309016994374951,0.770513242775787,0.992114701314478,0.904827052466021,0.535826794978993,2.20436423846524e-15,-0.535826794979001,-0.904827052466019,-0.992114701314479,-0.77051324277579,-0.309016994374955,0.248689887164855,0.728968627421407,0.982287250728689,0.929776485888254,0.587785252292472,0.062790519529319,-0.481753674101717,-0.876306680043861,-0.998026728428272,-0.80901699437495,-0.368124552684682,0.187381314585721,0.684547105928686,0.96858316112863,0.951056516295154,0.637423989748692,0.125333233564306,-0.425779291565071,-0.844327925502014,-1,-0.844327925502015,-0.425779291565073,0.125333233564304,0.637423989748679,0.951056516295154,0.968583161128634,0.684547105928688,0.187381314585737,-0.36812455268468,-0.80901699437494,-0.998026728428272,-0.876306680043869,-0.481753674101712,0.0627905195293029,0.587785252292476,0.929776485888248,0.98228725072869,0.728968627421418,0.248689887164863,-0.309016994374939,-0.770513242775793,-0.992114701314477,-0.904827052466023,-0.535826794979003,7.35159467870365e-15,0.535826794978991,0.904827052466017,0.992114701314479,0.770513242775793,0.309016994374952,-0.24868988716485,-0.728968627421408,-0.982287250728688,-0.929776485888253,-0.587785252292476,-0.0627905195293166,0.481753674101713,0.876306680043862,0.998026728428272,0.809016994374949,0.368124552684679,-0.187381314585723,-0.684547105928688,-0.968583161128627,-0.951056516295154,-0.63742398974869,-0.125333233564304,0.425779291565061,0.844327925502016,1,0.844327925502014,0.425779291565084,-0.125333233564307,-0.637423989748692,-0.95105651629515,-0.968583161128634,-0.684547105928686,-0.187381314585721,0.368124552684669,0.809016994374942,0.998026728428272,0.876306680043861,0.481753674101723,-0.0627905195293053,-0.587785252292478,-0.929776485888254,-0.98228725072869,-0.728968627421416,-0.248689887164847,0.309016994374942,0.770513242775786,0.992114701314477,0.904827052466016,0.535826794979001},
-{-0,-0.562083377852131,-0.929776485888251,-0.975916761938747,-0.684547105928689,-0.156434465040231,0.425779291565072,0.860742027003943,0.998026728428272,0.790155012375691,0.309016994374948,-0.278991106039228,-0.770513242775789,-0.99556196460308,-0.876306680043864,-0.453990499739548,0.125333233564303,0.661311865323651,0.968583161128631,0.940880768954226,0.587785252292473,0.0314107590781286,-0.535826794978995,-0.917754625683981,-0.982287250728689,-0.707106781186549,-0.187381314585726,0.39714789063478,0.844327925502014,0.999506560365732,0.809016994374949,0.338737920245292,-0.248689887164853,-0.750111069630457,-0.992114701314478,-0.891006524188368,-0.481753674101717,0.0941083133185112,0.637423989748689,0.960293685676942,0.951056516295154,0.612907053652978,0.062790519529314,-0.509041415750369,-0.904827052466018,-0.987688340595139,-0.728968627421412,-0.218143241396544,0.368124552684675,0.827080574274559,1,0.827080574274562,0.36812455268468,-0.218143241396538,-0.72896862742141,-0.987688340595137,-0.904827052466022,-0.509041415750374,0.0627905195293117,0.612907053652971,0.951056516295152,0.960293685676944,0.637423989748691,0.0941083133185206,-0.481753674101711,-0.891006524188367,-0.992114701314479,-0.750111069630459,-0.248689887164858,0.338737920245283,0.809016994374947,0.999506560365732,0.844327925502017,0.397147890634782,-0.187381314585718,-0.707106781186544,-0.982287250728688,-0.917754625683984,-0.535826794979001,0.0314107590781174,0.587785252292472,0.940880768954225,0.968583161128632,0.661311865323654,0.125333233564305,-0.453990499739541,-0.876306680043861,-0.995561964603081,-0.770513242775794,-0.278991106039235,0.309016994374937,0.790155012375689,0.998026728428272,0.860742027003946,0.425779291565076,-0.15643446504023,-0.684547105928684,-0.975916761938746,-0.929776485888255,-0.562083377852137,-5.87954259718047e-15,0.562083377852121,0.929776485888251,0.975916761938747,0.684547105928693,0.156434465040234,-0.425779291565065,-0.86074202700394,-0.998026728428272,-0.790155012375692,-0.309016994374962,0.278991106039217,0.770513242775782,0.995561964603079,0.876306680043867,0.453990499739552,-0.125333233564301,-0.661311865323651,-0.968583161128628,-0.940880768954229,-0.587785252292481,-0.0314107590781363,0.535826794978992,0.917754625683979,0.982287250728689,0.707106781186548,0.187381314585737,-0.397147890634771,-0.84432792550201,-0.999506560365732,-0.80901699437495,-0.338737920245307,0.24868988716484,0.750111069630451,0.992114701314478,0.891006524188372,0.481753674101722,-0.0941083133185088,-0.637423989748676,-0.960293685676943,-0.951056516295154,-0.612907053652986,-0.0627905195293092,0.509041415750364,0.904827052466017,0.987688340595141,0.728968627421413,0.218143241396557,-0.368124552684666,-0.827080574274556,-1,-0.827080574274566,-0.368124552684683,0.21814324139654,0.728968627421401,0.987688340595138,0.904827052466024,0.50904141575038,-0.0627905195292916,-0.612907053652972,-0.951056516295152,-0.960293685676948,-0.63742398974869,-0.0941083133185264,0.481753674101706,0.891006524188364,0.992114701314479,0.750111069630472,0.248689887164857,-0.338737920245277,-0.80901699437494,-0.999506560365732,-0.84432792550202,-0.397147890634787,0.187381314585706,0.707106781186545,0.982287250728686,0.917754625683986,0.535826794979006,-0.0314107590781186,-0.587785252292455,-0.940880768954223,-0.968583161128632,-0.661311865323664,-0.125333233564304,0.453990499739536,0.876306680043859,0.995561964603082,0.770513242775793,0.278991106039247,-0.309016994374945,-0.790155012375681,-0.998026728428271,-0.860742027003942,-0.425779291565081,0.156434465040224,0.684547105928675,0.975916761938747,0.929776485888257,0.562083377852142},
-{-0,-0.587785252292473,-0.951056516295154,-0.951056516295154,-0.587785252292473,-1.22464679914735e-16,0.587785252292473,0.951056516295154,0.951056516295154,0.587785252292473,2.44929359829471e-16,-0.587785252292473,-0.951056516295153,-0.951056516295154,-0.587785252292473,-3.67394039744206e-16,0.587785252292473,0.951056516295153,0.951056516295154,0.587785252292473,4.89858719658941e-16,-0.587785252292473,-0.951056516295153,-0.951056516295153,-0.587785252292475,-2.38868023897393e-15,0.587785252292473,0.951056516295153,0.951056516295154,0.587785252292474,7.34788079488412e-16,-0.587785252292472,-0.951056516295153,-0.951056516295155,-0.587785252292474,-4.40996643820365e-15,0.587785252292472,0.951056516295153,0.951056516295154,0.587785252292474,9.79717439317883e-16,-0.587785252292472,-0.951056516295153,-0.951056516295154,-0.587785252292474,-1.10218211923262e-15,0.587785252292475,0.951056516295153,0.951056516295155,0.587785252292474,4.77736047794785e-15,-0.587785252292475,-0.951056516295153,-0.951056516295153,-0.587785252292474,2.20560219973841e-15,0.587785252292472,0.951056516295154,0.951056516295154,0.587785252292471,1.46957615897682e-15,-0.587785252292475,-0.951056516295153,-0.951056516295153,-0.587785252292474,-5.14475451769206e-15,0.587785252292466,0.951056516295152,0.951056516295154,0.587785252292472,8.8199328764073e-15,-0.587785252292469,-0.951056516295153,-0.951056516295153,-0.587785252292475,-5.38968387752153e-15,0.587785252292472,0.951056516295154,0.951056516295154,0.587785252292478,1.95943487863577e-15,-0.587785252292469,-0.951056516295153,-0.951056516295153,-0.587785252292475,-5.634613237351e-15,0.587785252292471,0.951056516295154,0.951056516295154,0.587785252292478,2.20436423846524e-15,-0.587785252292474,-0.951056516295155,-0.951056516295155,-0.587785252292475,1.22588476042053e-15,0.587785252292465,0.951056516295152,0.951056516295154,0.587785252292472,9.55472095589571e-15,-0.587785252292468,-0.951056516295155,-0.951056516295155,-0.587785252292475,9.80955400591059e-16,0.587785252292477,0.951056516295156,0.951056516295154,0.587785252292472,-4.41120439947682e-15,-0.58778525229248,-0.951056516295153,-0.951056516295153,-0.58778525229247,-6.36940131683941e-15,0.587785252292471,0.951056516295154,0.951056516295152,0.587785252292478,2.93915231795365e-15,-0.587785252292474,-0.951056516295155,-0.951056516295156,-0.587785252292476,4.91096680932118e-16,0.587785252292476,0.951056516295152,0.951056516295155,0.587785252292473,1.02895090353841e-14,-0.587785252292468,-0.951056516295148,-0.951056516295154,-0.587785252292482,7.35159467870365e-15,0.58778525229247,0.951056516295149,0.951056516295152,0.587785252292479,1.76398657528146e-14,-0.587785252292473,-0.95105651629515,-0.951056516295151,-0.587785252292476,-1.42096167539288e-14,0.587785252292476,0.951056516295151,0.951056516295155,0.587785252292473,1.07793677550431e-14,-0.587785252292467,-0.951056516295152,-0.951056516295154,-0.58778525229247,-7.3491187561573e-15,0.58778525229247,0.951056516295154,0.951056516295157,0.587785252292479,3.91886975727153e-15,-0.587785252292473,-0.95105651629515,-0.951056516295156,-0.587785252292476,-4.88620758385765e-16,0.587785252292476,0.951056516295151,0.951056516295155,0.587785252292474,1.1269226474702e-14,-0.587785252292478,-0.951056516295152,-0.951056516295154,-0.587785252292471,-7.83897747581624e-15,0.58778525229247,0.951056516295153,0.951056516295157,0.587785252292468,4.40872847693047e-15,-0.587785252292461,-0.951056516295154,-0.951056516295156,-0.587785252292465,-9.78479478044706e-16,0.587785252292464,0.951056516295155,0.951056516295155,0.587785252292485,-2.45176952084106e-15,-0.587785252292466,-0.951056516295148,-0.951056516295154,-0.587785252292483,5.88201851972683e-15,0.587785252292469,0.951056516295149,0.951056516295153,0.58778525229248},
-{-0,-0.612907053652976,-0.968583161128631,-0.917754625683981,-0.481753674101715,0.156434465040231,0.728968627421412,0.99556196460308,0.844327925502015,0.338737920245291,-0.309016994374947,-0.827080574274562,-0.998026728428272,-0.750111069630459,-0.187381314585724,0.453990499739547,0.90482705246602,0.975916761938747,0.63742398974869,0.0314107590781286,-0.587785252292473,-0.960293685676943,-0.929776485888251,-0.509041415750372,0.125333233564305,0.707106781186548,0.992114701314478,0.860742027003944,0.368124552684677,-0.278991106039232,-0.809016994374948,-0.999506560365732,-0.770513242775789,-0.21814324139654,0.425779291565076,0.891006524188367,0.982287250728689,0.661311865323651,0.062790519529314,-0.562083377852131,-0.951056516295153,-0.940880768954225,-0.535826794978995,0.0941083133185144,0.68454710592869,0.987688340595138,0.876306680043865,0.397147890634781,-0.248689887164856,-0.790155012375692,-1,-0.790155012375691,-0.248689887164851,0.397147890634782,0.876306680043863,0.987688340595138,0.684547105928687,0.0941083133185135,-0.535826794979002,-0.940880768954224,-0.951056516295153,-0.562083377852131,0.0627905195293114,0.661311865323654,0.982287250728689,0.891006524188368,0.425779291565069,-0.218143241396545,-0.770513242775794,-0.999506560365731,-0.80901699437495,-0.278991106039228,0.368124552684678,0.860742027003942,0.992114701314478,0.707106781186547,0.125333233564305,-0.509041415750375,-0.929776485888252,-0.960293685676941,-0.587785252292475,0.0314107590781243,0.637423989748691,0.975916761938747,0.904827052466018,0.453990499739545,-0.187381314585725,-0.750111069630463,-0.998026728428272,-0.827080574274565,-0.309016994374941,0.338737920245289,0.844327925502013,0.99556196460308,0.728968627421412,0.156434465040227,-0.481753674101717,-0.917754625683981,-0.96858316112863,-0.61290705365298,9.80955400591059e-16,0.612907053652981,0.96858316112863,0.91775462568398,0.481753674101709,-0.156434465040229,-0.728968627421414,-0.995561964603079,-0.844327925502015,-0.338737920245287,0.309016994374943,0.827080574274562,0.998026728428271,0.750111069630462,0.187381314585723,-0.453990499739553,-0.904827052466025,-0.975916761938747,-0.637423989748695,-0.0314107590781294,0.587785252292476,0.960293685676942,0.929776485888251,0.509041415750367,-0.1253332335643,-0.707106781186538,-0.992114701314479,-0.860742027003938,-0.368124552684676,0.278991106039223,0.809016994374947,0.999506560365731,0.770513242775784,0.218143241396543,-0.425779291565077,-0.891006524188366,-0.982287250728686,-0.661311865323647,-0.0627905195293166,0.562083377852132,0.951056516295151,0.940880768954226,0.535826794978994,-0.0941083133185225,-0.684547105928688,-0.987688340595138,-0.876306680043866,-0.397147890634767,0.24868988716486,0.790155012375688,1,0.790155012375695,0.248689887164857,-0.397147890634783,-0.876306680043867,-0.987688340595138,-0.684547105928686,-0.0941083133185196,0.535826794979009,0.940880768954227,0.951056516295155,0.56208337785213,-0.0627905195293053,-0.66131186532366,-0.982287250728689,-0.891006524188365,-0.425779291565074,0.218143241396532,0.770513242775795,0.999506560365732,0.809016994374945,0.278991106039234,-0.368124552684678,-0.860742027003939,-0.992114701314476,-0.707106781186546,-0.125333233564297,0.509041415750369,0.929776485888247,0.960293685676941,0.587785252292462,-0.0314107590781323,-0.637423989748686,-0.975916761938747,-0.904827052466023,-0.453990499739538,0.187381314585726,0.750111069630464,0.998026728428271,0.827080574274568,0.30901699437494,-0.33873792024529,-0.844327925502017,-0.995561964603081,-0.728968627421412,-0.156434465040212,0.481753674101724,0.917754625683981,0.968583161128633,0.61290705365299},
-{-0,-0.63742398974869,-0.982287250728689,-0.876306680043864,-0.368124552684678,0.309016994374947,0.844327925502015,0.992114701314478,0.684547105928689,0.0627905195293142,-0.587785252292472,-0.968583161128631,-0.90482705246602,-0.425779291565074,0.248689887164853,0.809016994374946,0.998026728428272,0.728968627421412,0.125333233564306,-0.535826794978995,-0.951056516295153,-0.929776485888252,-0.481753674101716,0.187381314585723,0.770513242775788,1,0.770513242775791,0.187381314585728,-0.481753674101712,-0.92977648588825,-0.951056516295155,-0.535826794979001,0.125333233564303,0.72896862742141,0.998026728428271,0.809016994374949,0.248689887164858,-0.425779291565069,-0.904827052466018,-0.968583161128632,-0.587785252292477,0.0627905195293084,0.684547105928685,0.992114701314477,0.844327925502017,0.30901699437495,-0.368124552684675,-0.876306680043862,-0.982287250728689,-0.637423989748693,-4.89982515786259e-15,0.637423989748686,0.982287250728688,0.876306680043866,0.368124552684684,-0.309016994374941,-0.844327925502011,-0.992114701314479,-0.684547105928694,-0.0627905195293217,0.587785252292466,0.968583161128629,0.904827052466024,0.425779291565075,-0.248689887164852,-0.809016994374945,-0.998026728428272,-0.728968627421414,-0.125333233564309,0.535826794978992,0.951056516295152,0.929776485888254,0.481753674101721,-0.187381314585718,-0.770513242775785,-1,-0.770513242775794,-0.187381314585733,0.481753674101708,0.929776485888248,0.951056516295156,0.535826794979005,-0.125333233564294,-0.728968627421404,-0.998026728428271,-0.809016994374954,-0.248689887164866,0.425779291565062,0.904827052466017,0.968583161128633,0.587785252292478,-0.062790519529307,-0.684547105928684,-0.992114701314476,-0.844327925502019,-0.309016994374962,0.36812455268467,0.876306680043856,0.98228725072869,0.637423989748702,9.79965031572518e-15,-0.637423989748687,-0.982287250728687,-0.876306680043865,-0.368124552684688,0.309016994374943,0.844327925502009,0.992114701314479,0.684547105928698,0.0627905195293195,-0.587785252292462,-0.968583161128629,-0.904827052466026,-0.42577929156508,0.24868988716484,0.809016994374942,0.998026728428273,0.728968627421418,0.125333233564321,-0.535826794978988,-0.951056516295148,-0.929776485888255,-0.481753674101731,0.187381314585713,0.770513242775777,1,0.770513242775793,0.187381314585737,-0.48175367410171,-0.929776485888246,-0.951056516295156,-0.535826794979009,0.125333233564296,0.728968627421401,0.998026728428271,0.809016994374957,0.248689887164864,-0.425779291565057,-0.904827052466015,-0.968583161128636,-0.587785252292482,0.062790519529295,0.68454710592868,0.992114701314475,0.844327925502022,0.309016994374966,-0.368124552684666,-0.876306680043854,-0.982287250728691,-0.637423989748706,-1.46994754735878e-14,0.637423989748684,0.982287250728686,0.876306680043868,0.368124552684693,-0.309016994374938,-0.844327925502006,-0.992114701314479,-0.684547105928702,-0.0627905195293244,0.587785252292458,0.968583161128628,0.904827052466028,0.425779291565084,-0.248689887164835,-0.80901699437494,-0.998026728428273,-0.728968627421421,-0.125333233564326,0.535826794978984,0.951056516295147,0.929776485888257,0.481753674101736,-0.187381314585709,-0.770513242775774,-1,-0.770513242775796,-0.187381314585742,0.481753674101705,0.929776485888245,0.951056516295157,0.535826794979013,-0.125333233564292,-0.728968627421398,-0.998026728428271,-0.80901699437496,-0.248689887164882,0.425779291565053,0.904827052466013,0.968583161128633,0.587785252292497,-0.0627905195292902,-0.684547105928677,-0.992114701314477,-0.844327925502032,-0.309016994374971,0.368124552684661,0.876306680043858,0.982287250728695,0.63742398974871},
-{-0,-0.661311865323652,-0.992114701314478,-0.827080574274562,-0.248689887164855,0.453990499739546,0.929776485888251,0.940880768954226,0.481753674101716,-0.218143241396542,-0.809016994374947,-0.99556196460308,-0.684547105928688,-0.0314107590781285,0.637423989748689,0.987688340595138,0.844327925502016,0.27899110603923,-0.425779291565072,-0.917754625683981,-0.951056516295154,-0.509041415750372,0.187381314585723,0.79015501237569,0.998026728428272,0.707106781186549,0.0627905195293137,-0.612907053652974,-0.982287250728688,-0.860742027003946,-0.30901699437495,0.397147890634779,0.904827052466018,0.960293685676944,0.535826794978998,-0.156434465040231,-0.770513242775788,-0.999506560365732,-0.728968627421412,-0.0941083133185167,0.587785252292469,0.975916761938747,0.876306680043865,0.338737920245296,-0.368124552684675,-0.891006524188367,-0.968583161128631,-0.562083377852136,0.125333233564306,0.750111069630457,1,0.750111069630461,0.125333233564305,-0.562083377852131,-0.96858316112863,-0.89100652418837,-0.368124552684681,0.33873792024529,0.87630668004386,0.975916761938747,0.587785252292477,-0.0941083133185103,-0.72896862742141,-0.999506560365731,-0.770513242775794,-0.15643446504023,0.535826794978992,0.960293685676942,0.904827052466021,0.397147890634788,-0.309016994374947,-0.860742027003941,-0.98228725072869,-0.612907053652979,0.0627905195293039,0.707106781186542,0.998026728428272,0.790155012375694,0.187381314585729,-0.509041415750368,-0.951056516295151,-0.917754625683982,-0.425779291565072,0.278991106039224,0.844327925502013,0.987688340595139,0.637423989748697,-0.0314107590781274,-0.684547105928684,-0.995561964603079,-0.80901699437495,-0.218143241396553,0.481753674101714,0.940880768954223,0.929776485888256,0.453990499739552,-0.248689887164858,-0.82708057427456,-0.992114701314479,-0.661311865323663,-6.36940131683941e-15,0.661311865323653,0.992114701314477,0.827080574274567,0.248689887164856,-0.45399049973954,-0.929776485888252,-0.940880768954227,-0.481753674101725,0.21814324139654,0.809016994374942,0.995561964603081,0.684547105928693,0.0314107590781402,-0.637423989748687,-0.987688340595136,-0.844327925502023,-0.278991106039236,0.425779291565074,0.917754625683979,0.951056516295157,0.509041415750385,-0.187381314585717,-0.790155012375691,-0.998026728428272,-0.707106781186546,-0.0627905195293307,0.612907053652969,0.982287250728686,0.860742027003947,0.309016994374946,-0.397147890634764,-0.904827052466015,-0.960293685676948,-0.535826794979003,0.156434465040232,0.770513242775786,0.999506560365732,0.728968627421423,0.094108313318523,-0.587785252292473,-0.975916761938746,-0.876306680043869,-0.338737920245308,0.368124552684669,0.891006524188367,0.968583161128633,0.56208337785213,-0.125333233564285,-0.750111069630452,-1,-0.750111069630465,-0.125333233564304,0.562083377852126,0.968583161128628,0.891006524188376,0.368124552684687,-0.33873792024529,-0.87630668004386,-0.97591676193875,-0.587785252292488,0.094108313318504,0.72896862742141,0.999506560365731,0.770513242775789,0.15643446504025,-0.535826794978987,-0.960293685676938,-0.904827052466023,-0.397147890634781,0.309016994374928,0.860742027003937,0.982287250728692,0.612907053652984,-0.0627905195293117,-0.707106781186542,-0.998026728428271,-0.790155012375702,-0.187381314585749,0.509041415750369,0.951056516295151,0.917754625683987,0.425779291565091,-0.278991106039204,-0.844327925502013,-0.987688340595139,-0.637423989748702,0.0314107590781069,0.684547105928669,0.99556196460308,0.809016994374954,0.218143241396559,-0.48175367410172,-0.940880768954216,-0.929776485888254,-0.453990499739557,0.248689887164838,0.827080574274565,0.992114701314482,0.661311865323657},
-{-0,-0.684547105928689,-0.998026728428272,-0.770513242775789,-0.125333233564305,0.587785252292473,0.982287250728689,0.844327925502015,0.248689887164855,-0.481753674101715,-0.951056516295153,-0.904827052466019,-0.368124552684678,0.368124552684677,0.90482705246602,0.951056516295154,0.481753674101716,-0.248689887164855,-0.844327925502015,-0.982287250728689,-0.587785252292475,0.125333233564305,0.77051324277579,0.998026728428272,0.684547105928689,7.34788079488412e-16,-0.684547105928688,-0.998026728428271,-0.770513242775789,-0.125333233564308,0.587785252292472,0.982287250728688,0.844327925502016,0.248689887164854,-0.481753674101715,-0.951056516295153,-0.90482705246602,-0.368124552684677,0.368124552684675,0.904827052466019,0.951056516295155,0.481753674101717,-0.248689887164856,-0.844327925502015,-0.982287250728688,-0.587785252292474,0.125333233564306,0.770513242775787,0.998026728428272,0.684547105928687,1.46957615897682e-15,-0.68454710592869,-0.998026728428271,-0.770513242775789,-0.125333233564309,0.587785252292466,0.982287250728689,0.844327925502017,0.248689887164862,-0.481753674101717,-0.951056516295153,-0.904827052466022,-0.368124552684681,0.368124552684678,0.904827052466018,0.951056516295154,0.481753674101714,-0.248689887164851,-0.844327925502015,-0.98228725072869,-0.587785252292475,0.125333233564305,0.770513242775787,0.998026728428272,0.684547105928687,2.20436423846524e-15,-0.684547105928684,-0.998026728428272,-0.77051324277579,-0.125333233564309,0.587785252292465,0.982287250728689,0.844327925502017,0.248689887164863,-0.481753674101717,-0.951056516295155,-0.904827052466019,-0.368124552684682,0.368124552684683,0.90482705246602,0.951056516295154,0.481753674101709,-0.248689887164858,-0.844327925502014,-0.98228725072869,-0.58778525229247,0.125333233564304,0.770513242775786,0.998026728428271,0.684547105928688,2.93915231795365e-15,-0.684547105928683,-0.998026728428272,-0.77051324277579,-0.12533323356431,0.587785252292476,0.982287250728689,0.844327925502018,0.248689887164863,-0.481753674101716,-0.951056516295148,-0.904827052466023,-0.368124552684676,0.368124552684663,0.904827052466017,0.951056516295152,0.481753674101728,-0.24868988716485,-0.844327925502018,-0.982287250728691,-0.587785252292476,0.125333233564311,0.770513242775781,0.998026728428272,0.684547105928693,1.07793677550431e-14,-0.684547105928688,-0.998026728428271,-0.770513242775795,-0.125333233564304,0.58778525229247,0.982287250728687,0.844327925502014,0.248689887164857,-0.481753674101709,-0.95105651629515,-0.90482705246602,-0.368124552684683,0.368124552684669,0.90482705246602,0.951056516295155,0.481753674101723,-0.248689887164856,-0.844327925502014,-0.98228725072869,-0.587785252292471,0.125333233564303,0.770513242775786,0.998026728428271,0.684547105928699,4.40872847693047e-15,-0.684547105928693,-0.998026728428271,-0.770513242775791,-0.125333233564297,0.587785252292464,0.982287250728688,0.844327925502011,0.248689887164865,-0.481753674101715,-0.951056516295148,-0.904827052466023,-0.368124552684677,0.368124552684662,0.904827052466016,0.951056516295153,0.48175367410173,-0.248689887164849,-0.844327925502017,-0.982287250728691,-0.587785252292466,0.125333233564295,0.77051324277579,0.998026728428271,0.684547105928694,-1.96191080118212e-15,-0.684547105928697,-0.998026728428271,-0.770513242775787,-0.125333233564291,0.587785252292469,0.982287250728689,0.844327925502007,0.248689887164859,-0.48175367410172,-0.951056516295159,-0.904827052466021,-0.368124552684671,0.368124552684668,0.904827052466019,0.951056516295151,0.481753674101724,-0.248689887164855,-0.84432792550202,-0.98228725072869,-0.587785252292472,0.125333233564315,0.770513242775785,0.998026728428271,0.6845471059287},
-{-0,-0.707106781186547,-1,-0.707106781186548,-1.22464679914735e-16,0.707106781186548,1,0.707106781186547,2.44929359829471e-16,-0.707106781186547,-1,-0.707106781186547,-3.67394039744206e-16,0.707106781186548,1,0.707106781186548,4.89858719658941e-16,-0.707106781186548,-1,-0.707106781186547,1.16403343982657e-15,0.707106781186548,1,0.707106781186546,7.34788079488412e-16,-0.707106781186548,-1,-0.707106781186546,2.69546091939735e-15,0.707106781186545,1,0.707106781186549,9.79717439317883e-16,-0.707106781186547,-1,-0.707106781186546,-1.10218211923262e-15,0.707106781186547,1,0.707106781186546,-2.32806687965315e-15,-0.70710678118655,-1,-0.707106781186549,2.20560219973841e-15,0.707106781186547,1,0.707106781186547,1.46957615897682e-15,-0.707106781186545,-1,-0.707106781186549,1.96067283990894e-15,0.707106781186547,1,0.707106781186547,-5.39092183879471e-15,-0.707106781186549,-1,-0.707106781186549,-5.38968387752153e-15,0.707106781186547,1,0.707106781186547,1.95943487863577e-15,-0.707106781186549,-1,-0.707106781186545,1.47081412025e-15,0.707106781186552,1,0.707106781186552,2.20436423846524e-15,-0.707106781186544,-1,-0.70710678118655,1.22588476042053e-15,0.707106781186546,1,0.707106781186547,-4.6561337593063e-15,-0.707106781186549,-1,-0.707106781186545,9.80955400591059e-16,0.707106781186546,1,0.707106781186553,-4.41120439947682e-15,-0.707106781186549,-1,-0.70710678118655,7.84145339836259e-15,0.707106781186551,1,0.707106781186548,2.93915231795365e-15,-0.707106781186544,-1,-0.707106781186545,4.91096680932118e-16,0.707106781186546,1,0.707106781186543,-3.92134567981788e-15,-0.707106781186538,-1,-0.70710678118655,7.35159467870365e-15,0.707106781186541,1,0.707106781186548,-1.07818436775894e-14,-0.707106781186543,-1,-0.707106781186546,-1.42096167539288e-14,0.707106781186546,1,0.707106781186543,1.07793677550431e-14,-0.707106781186548,-1,-0.707106781186541,-7.3491187561573e-15,0.70710678118655,1,0.707106781186538,3.91886975727153e-15,-0.707106781186543,-1,-0.707106781186556,-4.88620758385765e-16,0.707106781186545,1,0.707106781186554,-2.9416282405e-15,-0.707106781186548,-1,-0.707106781186551,6.37187723938577e-15,0.70710678118655,1,0.707106781186549,4.40872847693047e-15,-0.707106781186553,-1,-0.707106781186546,-9.78479478044706e-16,0.707106781186555,1,0.707106781186544,-2.45176952084106e-15,-0.707106781186557,-1,-0.707106781186551,5.88201851972683e-15,0.70710678118654,1,0.707106781186549,-9.31226751861259e-15,-0.707106781186542,-1,-0.707106781186557,1.27425165174984e-14,0.707106781186555,1,0.707106781186544,-1.96191080118212e-15,-0.707106781186547,-1,-0.707106781186552,-8.81869491513412e-15,0.707106781186559,1,0.707106781186539,-8.82240879895365e-15,-0.707106781186552,-1,-0.707106781186547,-1.95819691736259e-15,0.707106781186544,1,0.707106781186555,-1.56829067967252e-14,-0.707106781186537,-1,-0.707106781186542,4.90230108040894e-15,0.707106781186549,1,0.70710678118655,5.8783046359073e-15,-0.707106781186541,-1,-0.707106781186537,-1.66589103522235e-14,0.707106781186554,1,0.707106781186545},
-{-0,-0.728968627421412,-0.998026728428272,-0.63742398974869,0.125333233564304,0.809016994374947,0.982287250728689,0.535826794978996,-0.248689887164855,-0.876306680043864,-0.951056516295154,-0.425779291565072,0.368124552684679,0.929776485888251,0.904827052466018,0.309016994374946,-0.481753674101715,-0.968583161128631,-0.844327925502015,-0.187381314585724,0.587785252292473,0.992114701314478,0.770513242775789,0.0627905195293102,-0.68454710592869,-1,-0.684547105928689,0.0627905195293122,0.770513242775792,0.992114701314477,0.587785252292471,-0.187381314585726,-0.844327925502015,-0.968583161128631,-0.481753674101714,0.309016994374948,0.904827052466019,0.929776485888251,0.368124552684677,-0.425779291565076,-0.951056516295153,-0.876306680043865,-0.248689887164851,0.535826794978999,0.982287250728689,0.809016994374947,0.125333233564298,-0.637423989748694,-0.998026728428272,-0.728968627421409,1.96067283990894e-15,0.728968627421417,0.998026728428272,0.637423989748685,-0.125333233564302,-0.80901699437495,-0.982287250728687,-0.535826794978995,0.248689887164862,0.876306680043863,0.951056516295152,0.425779291565075,-0.368124552684681,-0.929776485888252,-0.904827052466019,-0.309016994374941,0.481753674101714,0.968583161128632,0.844327925502013,0.187381314585722,-0.587785252292474,-0.992114701314478,-0.77051324277579,-0.0627905195293083,0.684547105928692,1,0.684547105928687,-0.0627905195293141,-0.770513242775794,-0.992114701314478,-0.587785252292475,0.187381314585735,0.844327925502013,0.968583161128629,0.481753674101709,-0.309016994374953,-0.904827052466022,-0.92977648588825,-0.368124552684675,0.425779291565074,0.951056516295154,0.876306680043864,0.248689887164842,-0.535826794978994,-0.982287250728691,-0.80901699437495,-0.125333233564296,0.637423989748695,0.998026728428272,0.728968627421408,-3.92134567981788e-15,-0.728968627421413,-0.998026728428271,-0.637423989748689,0.125333233564304,0.809016994374955,0.982287250728687,0.535826794979,-0.24868988716485,-0.876306680043868,-0.951056516295151,-0.425779291565067,0.368124552684696,0.929776485888253,0.904827052466018,0.309016994374946,-0.481753674101728,-0.968583161128631,-0.844327925502016,-0.187381314585727,0.587785252292482,0.992114701314479,0.770513242775793,0.0627905195293063,-0.684547105928693,-1,-0.684547105928686,0.0627905195293303,0.77051324277579,0.992114701314478,0.587785252292462,-0.187381314585737,-0.844327925502014,-0.968583161128632,-0.481753674101707,0.309016994374955,0.904827052466023,0.929776485888244,0.368124552684673,-0.425779291565076,-0.951056516295154,-0.876306680043856,-0.248689887164854,0.535826794978996,0.982287250728688,0.809016994374941,0.125333233564294,-0.637423989748686,-0.998026728428272,-0.728968627421407,5.88201851972683e-15,0.728968627421405,0.998026728428271,0.637423989748688,-0.125333233564306,-0.809016994374956,-0.982287250728686,-0.535826794978986,0.248689887164852,0.876306680043868,0.951056516295155,0.425779291565065,-0.368124552684698,-0.929776485888254,-0.904827052466024,-0.309016994374944,0.48175367410173,0.968583161128632,0.844327925502007,0.187381314585697,-0.587785252292483,-0.992114701314477,-0.770513242775783,-0.0627905195292902,0.684547105928694,1,0.684547105928685,-0.0627905195293322,-0.770513242775791,-0.992114701314479,-0.587785252292472,0.187381314585739,0.844327925502015,0.968583161128628,0.481753674101693,-0.309016994374957,-0.904827052466017,-0.929776485888248,-0.368124552684658,0.425779291565078,0.951056516295151,0.876306680043862,0.248689887164839,-0.535826794978998,-0.982287250728691,-0.809016994374948,-0.125333233564292,0.637423989748687,0.998026728428272,0.728968627421415},
-{-0,-0.750111069630459,-0.992114701314478,-0.562083377852131,0.248689887164855,0.891006524188368,0.929776485888252,0.338737920245292,-0.481753674101715,-0.975916761938747,-0.809016994374948,-0.0941083133185159,0.684547105928688,0.999506560365732,0.637423989748691,-0.15643446504023,-0.844327925502015,-0.960293685676943,-0.425779291565073,0.39714789063478,0.951056516295153,0.860742027003944,0.187381314585728,-0.612907053652974,-0.998026728428271,-0.707106781186549,0.0627905195293122,0.79015501237569,0.982287250728689,0.509041415750371,-0.309016994374945,-0.917754625683982,-0.90482705246602,-0.278991106039234,0.535826794978996,0.987688340595137,0.770513242775789,0.0314107590781311,-0.72896862742141,-0.99556196460308,-0.587785252292474,0.218143241396535,0.876306680043863,0.940880768954228,0.368124552684684,-0.453990499739542,-0.96858316112863,-0.827080574274565,-0.125333233564309,0.661311865323649,1,0.661311865323654,-0.125333233564302,-0.827080574274561,-0.968583161128632,-0.453990499739554,0.368124552684671,0.940880768954225,0.876306680043863,0.218143241396548,-0.587785252292469,-0.99556196460308,-0.72896862742141,0.0314107590781243,0.770513242775787,0.987688340595138,0.535826794979005,-0.278991106039227,-0.904827052466019,-0.917754625683982,-0.309016994374955,0.509041415750365,0.982287250728689,0.79015501237569,0.062790519529319,-0.707106781186544,-0.998026728428272,-0.61290705365298,0.187381314585721,0.860742027003942,0.951056516295154,0.397147890634783,-0.425779291565058,-0.960293685676943,-0.844327925502015,-0.156434465040231,0.637423989748679,0.999506560365731,0.684547105928698,-0.0941083133185162,-0.80901699437494,-0.97591676193875,-0.481753674101725,0.338737920245282,0.929776485888248,0.891006524188372,0.248689887164863,-0.562083377852124,-0.992114701314477,-0.750111069630464,-6.85926003649835e-15,0.750111069630446,0.992114701314479,0.562083377852135,-0.24868988716485,-0.891006524188366,-0.929776485888253,-0.338737920245295,0.481753674101713,0.975916761938744,0.809016994374957,0.0941083133185298,-0.684547105928678,-0.999506560365732,-0.63742398974869,0.156434465040232,0.844327925502016,0.960293685676947,0.425779291565084,-0.39714789063477,-0.95105651629515,-0.860742027003949,-0.187381314585735,0.61290705365298,0.998026728428272,0.707106781186554,-0.0627905195293053,-0.790155012375686,-0.98228725072869,-0.509041415750377,0.309016994374942,0.917754625683973,0.904827052466028,0.278991106039247,-0.535826794978993,-0.987688340595137,-0.770513242775791,-0.0314107590781309,0.72896862742141,0.995561964603082,0.587785252292485,-0.218143241396528,-0.876306680043857,-0.94088076895423,-0.368124552684677,0.453990499739548,0.968583161128632,0.827080574274568,0.125333233564315,-0.661311865323644,-1,-0.661311865323659,0.125333233564295,0.827080574274557,0.968583161128633,0.453990499739554,-0.368124552684671,-0.940880768954223,-0.876306680043867,-0.218143241396548,0.587785252292469,0.99556196460308,0.728968627421414,-0.0314107590781245,-0.770513242775769,-0.987688340595143,-0.535826794978999,0.278991106039228,0.904827052466019,0.917754625683981,0.309016994374948,-0.509041415750371,-0.982287250728684,-0.790155012375707,-0.06279051952934,0.707106781186529,0.998026728428273,0.612907053652974,-0.187381314585728,-0.860742027003946,-0.951056516295161,-0.397147890634802,0.425779291565052,0.960293685676937,0.844327925502027,0.156434465040252,-0.637423989748674,-0.999506560365732,-0.684547105928703,0.0941083133184952,0.809016994374936,0.975916761938751,0.481753674101731,-0.338737920245275,-0.929776485888245,-0.891006524188375,-0.24868988716487,0.562083377852118,0.992114701314476,0.750111069630469},
-{-0,-0.770513242775789,-0.982287250728689,-0.481753674101715,0.368124552684678,0.951056516295154,0.844327925502015,0.125333233564305,-0.684547105928689,-0.998026728428272,-0.587785252292473,0.248689887164855,0.90482705246602,0.90482705246602,0.248689887164856,-0.587785252292473,-0.998026728428272,-0.68454710592869,0.125333233564305,0.844327925502016,0.951056516295154,0.368124552684677,-0.481753674101715,-0.982287250728688,-0.770513242775789,-4.40996643820365e-15,0.770513242775788,0.982287250728689,0.481753674101717,-0.368124552684678,-0.951056516295153,-0.844327925502016,-0.125333233564305,0.68454710592869,0.998026728428272,0.587785252292474,-0.248689887164856,-0.904827052466019,-0.904827052466019,-0.248689887164851,0.587785252292472,0.998026728428272,0.684547105928687,-0.125333233564302,-0.844327925502015,-0.951056516295153,-0.368124552684681,0.481753674101714,0.982287250728689,0.770513242775787,8.8199328764073e-15,-0.770513242775785,-0.982287250728689,-0.481753674101717,0.368124552684678,0.951056516295154,0.844327925502017,0.125333233564305,-0.684547105928689,-0.998026728428272,-0.587785252292475,0.248689887164855,0.904827052466017,0.904827052466021,0.248689887164856,-0.587785252292474,-0.998026728428272,-0.684547105928695,0.125333233564298,0.844327925502013,0.951056516295154,0.368124552684678,-0.481753674101717,-0.982287250728688,-0.77051324277579,9.80955400591059e-16,0.770513242775791,0.982287250728688,0.481753674101709,-0.368124552684673,-0.951056516295153,-0.844327925502015,-0.125333233564303,0.684547105928691,0.998026728428271,0.587785252292478,-0.248689887164851,-0.904827052466019,-0.90482705246602,-0.248689887164853,0.587785252292476,0.998026728428271,0.684547105928693,-0.1253332335643,-0.844327925502014,-0.951056516295154,-0.368124552684676,0.481753674101719,0.98228725072869,0.770513242775793,1.76398657528146e-14,-0.770513242775779,-0.982287250728691,-0.481753674101725,0.368124552684669,0.951056516295151,0.844327925502018,0.125333233564307,-0.684547105928688,-0.998026728428271,-0.58778525229247,0.248689887164846,0.904827052466017,0.904827052466021,0.248689887164857,-0.587785252292473,-0.998026728428272,-0.684547105928686,0.125333233564296,0.844327925502012,0.951056516295155,0.36812455268468,-0.481753674101715,-0.982287250728686,-0.770513242775796,-7.83897747581624e-15,0.770513242775786,0.982287250728689,0.481753674101717,-0.368124552684678,-0.951056516295154,-0.844327925502013,-0.125333233564297,0.684547105928695,0.998026728428273,0.587785252292485,-0.248689887164842,-0.904827052466015,-0.904827052466023,-0.248689887164861,0.587785252292469,0.998026728428271,0.684547105928689,-0.125333233564306,-0.844327925502017,-0.951056516295152,-0.368124552684684,0.481753674101699,0.982287250728688,0.770513242775798,-1.96191080118212e-15,-0.770513242775783,-0.982287250728687,-0.48175367410172,0.368124552684688,0.951056516295153,0.844327925502007,0.125333233564302,-0.684547105928682,-0.998026728428273,-0.587785252292478,0.248689887164838,0.904827052466019,0.904827052466025,0.248689887164852,-0.587785252292466,-0.998026728428272,-0.684547105928692,0.125333233564315,0.844327925502015,0.951056516295158,0.368124552684701,-0.481753674101708,-0.982287250728685,-0.770513242775792,-1.66589103522235e-14,0.770513242775789,0.982287250728691,0.481753674101712,-0.36812455268467,-0.951056516295156,-0.844327925502017,-0.12533323356432,0.684547105928689,0.998026728428272,0.58778525229247,-0.248689887164847,-0.904827052466011,-0.904827052466021,-0.24868988716487,0.587785252292474,0.998026728428271,0.684547105928685,-0.125333233564297,-0.84432792550202,-0.951056516295155,-0.368124552684666,0.481753674101716,0.982287250728687,0.770513242775786},
-{-0,-0.79015501237569,-0.968583161128631,-0.397147890634781,0.481753674101715,0.987688340595138,0.728968627421412,-0.0941083133185144,-0.844327925502015,-0.940880768954226,-0.309016994374946,0.56208337785213,0.998026728428271,0.661311865323653,-0.187381314585725,-0.891006524188368,-0.904827052466019,-0.218143241396542,0.637423989748689,0.999506560365732,0.587785252292471,-0.278991106039229,-0.929776485888251,-0.860742027003942,-0.125333233564308,0.707106781186545,0.992114701314478,0.509041415750371,-0.368124552684678,-0.960293685676943,-0.809016994374947,-0.0314107590781274,0.77051324277579,0.975916761938747,0.425779291565071,-0.453990499739548,-0.982287250728688,-0.750111069630458,0.0627905195293117,0.827080574274563,0.951056516295152,0.338737920245296,-0.535826794978996,-0.99556196460308,-0.684547105928689,0.156434465040227,0.876306680043867,0.91775462568398,0.248689887164862,-0.612907053652979,-1,-0.612907053652974,0.248689887164848,0.917754625683983,0.876306680043863,0.156434465040227,-0.684547105928689,-0.99556196460308,-0.535826794978996,0.338737920245296,0.951056516295154,0.827080574274559,0.0627905195293117,-0.750111069630463,-0.982287250728688,-0.453990499739548,0.425779291565075,0.975916761938747,0.770513242775788,-0.0314107590781274,-0.809016994374949,-0.960293685676945,-0.368124552684682,0.509041415750371,0.992114701314478,0.707106781186553,-0.125333233564301,-0.860742027003944,-0.92977648588825,-0.278991106039236,0.587785252292482,0.999506560365732,0.637423989748697,-0.218143241396537,-0.904827052466019,-0.891006524188367,-0.187381314585734,0.661311865323658,0.998026728428272,0.562083377852129,-0.309016994374939,-0.940880768954229,-0.844327925502008,-0.0941083133185259,0.728968627421416,0.987688340595136,0.481753674101728,-0.39714789063477,-0.968583161128633,-0.790155012375684,-1.42096167539288e-14,0.790155012375693,0.968583161128629,0.39714789063477,-0.481753674101703,-0.987688340595138,-0.728968627421406,0.0941083133185259,0.844327925502016,0.940880768954224,0.309016994374939,-0.562083377852141,-0.998026728428272,-0.661311865323648,0.187381314585734,0.891006524188367,0.904827052466019,0.218143241396537,-0.637423989748697,-0.999506560365732,-0.587785252292471,0.278991106039236,0.929776485888255,0.860742027003944,0.125333233564301,-0.707106781186553,-0.992114701314476,-0.509041415750371,0.368124552684682,0.960293685676945,0.809016994374949,0.0314107590781274,-0.770513242775792,-0.975916761938746,-0.425779291565075,0.453990499739548,0.98228725072869,0.750111069630454,-0.0627905195293117,-0.827080574274563,-0.951056516295152,-0.338737920245283,0.535826794978984,0.995561964603079,0.684547105928694,-0.156434465040227,-0.876306680043863,-0.91775462568398,-0.248689887164848,0.612907053652962,1,0.612907053652985,-0.248689887164848,-0.91775462568398,-0.876306680043863,-0.156434465040227,0.684547105928694,0.995561964603082,0.535826794979008,-0.338737920245283,-0.951056516295161,-0.827080574274563,-0.0627905195293117,0.750111069630463,0.982287250728692,0.453990499739561,-0.425779291565062,-0.975916761938752,-0.770513242775792,0.0314107590781274,0.809016994374949,0.960293685676941,0.368124552684695,-0.509041415750359,-0.99211470131448,-0.707106781186532,0.125333233564301,0.860742027003944,0.92977648588825,0.278991106039249,-0.587785252292459,-0.999506560365732,-0.637423989748675,0.218143241396564,0.904827052466031,0.89100652418838,0.187381314585748,-0.661311865323637,-0.998026728428271,-0.562083377852117,0.309016994374966,0.940880768954233,0.844327925502031,0.0941083133185401,-0.728968627421396,-0.987688340595136,-0.481753674101703,0.397147890634797,0.968583161128636,0.790155012375675},
-{-0,-0.809016994374947,-0.951056516295154,-0.309016994374948,0.587785252292473,1,0.587785252292474,-0.309016994374946,-0.951056516295153,-0.809016994374948,-3.67394039744206e-16,0.809016994374946,0.951056516295154,0.309016994374948,-0.587785252292471,-1,-0.587785252292475,0.309016994374945,0.951056516295153,0.809016994374949,7.34788079488412e-16,-0.809016994374946,-0.951056516295155,-0.30901699437495,0.58778525229247,1,0.587785252292474,-0.309016994374945,-0.951056516295152,-0.809016994374951,-1.10218211923262e-15,0.809016994374946,0.951056516295155,0.30901699437495,-0.587785252292469,-1,-0.587785252292474,0.309016994374944,0.951056516295152,0.809016994374951,1.46957615897682e-15,-0.809016994374945,-0.951056516295155,-0.309016994374954,0.587785252292466,1,0.587785252292477,-0.309016994374941,-0.951056516295151,-0.80901699437495,-5.38968387752153e-15,0.809016994374947,0.951056516295154,0.309016994374951,-0.587785252292469,-1,-0.587785252292481,0.309016994374937,0.95105651629515,0.809016994374948,2.20436423846524e-15,-0.809016994374945,-0.951056516295155,-0.309016994374955,0.587785252292465,1,0.587785252292478,-0.30901699437494,-0.951056516295151,-0.809016994374958,9.80955400591059e-16,0.809016994374943,0.951056516295154,0.309016994374958,-0.587785252292468,-1,-0.587785252292481,0.309016994374943,0.951056516295149,0.809016994374952,2.93915231795365e-15,-0.80901699437494,-0.951056516295156,-0.309016994374949,0.587785252292465,1,0.587785252292484,-0.309016994374939,-0.951056516295148,-0.809016994374946,-6.85926003649835e-15,0.809016994374947,0.951056516295157,0.309016994374952,-0.587785252292462,-1,-0.587785252292487,0.309016994374936,0.951056516295151,0.809016994374957,1.07793677550431e-14,-0.809016994374936,-0.951056516295154,-0.30901699437497,0.58778525229247,1,0.587785252292479,-0.309016994374945,-0.95105651629515,-0.809016994374951,-1.46994754735878e-14,0.809016994374942,0.951056516295159,0.30901699437496,-0.587785252292455,-1,-0.587785252292494,0.309016994374942,0.951056516295153,0.809016994374953,4.40872847693047e-15,-0.80901699437494,-0.951056516295156,-0.309016994374964,0.587785252292464,1,0.587785252292485,-0.309016994374924,-0.951056516295148,-0.809016994374947,-2.25396909106772e-14,0.809016994374946,0.951056516295157,0.309016994374954,-0.58778525229246,-1,-0.587785252292489,0.309016994374948,0.951056516295142,0.809016994374958,-1.96191080118212e-15,-0.809016994374943,-0.951056516295159,-0.309016994374971,0.587785252292469,1,0.587785252292492,-0.309016994374917,-0.95105651629515,-0.80901699437496,-3.03799063477666e-14,0.809016994374941,0.95105651629516,0.309016994374948,-0.587785252292466,-1,-0.587785252292495,0.30901699437494,0.951056516295149,0.809016994374962,5.8783046359073e-15,-0.809016994374939,-0.951056516295161,-0.309016994374978,0.587785252292462,1,0.587785252292475,-0.309016994374937,-0.951056516295147,-0.809016994374965,-9.798412354452e-15,0.809016994374936,0.951056516295162,0.309016994374955,-0.587785252292459,-1,-0.587785252292501,0.309016994374906,0.951056516295155,0.80901699437495,1.37185200729967e-14,-0.809016994374917,-0.951056516295155,-0.309016994374959,0.587785252292456,1,0.587785252292482,-0.309016994374929,-0.951056516295145,-0.809016994374953,-1.76386277915414e-14,0.809016994374932,0.951056516295165,0.309016994374963,-0.587785252292453,-1,-0.587785252292485,0.309016994374925,0.951056516295144,0.809016994374972}
-};
\ No newline at end of file
+template <uint32_t N>
+constexpr QuarterWave<N> quarterWave = QuarterWave<N>();
+
+//Window and bins of process()
+static const uint32_t coefficientSamples = 200;
+static const uint32_t coefficientBins = 31;
+
+//cos(2*pi*k*n/N), what cosCoeff[k][n] held
+template <uint32_t N = coefficientSamples>
+inline float cosCoeff(uint32_t k, uint32_t n) {
+    return quarterWave<N>.cos((k * n) % N);
+}
+
+//-sin(2*pi*k*n/N), what sineCoeff[k][n] held - The negation is already done
+template <uint32_t N = coefficientSamples>
+inline float sineCoeff(uint32_t k, uint32_t n) {
+    return quarterWave<N>.negSine((k * n) % N);
+}
+
+#endif
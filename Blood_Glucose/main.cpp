@@ -1,5 +1,9 @@
 #include "mbed.h"
 #include "coefficients.hpp"
+#include "FFT.hpp"
+#include "FixedDFT.hpp"
+#include "Goertzel.hpp"
+#include "SlidingDFT.hpp"
 #include <chrono>
 #include <cstdio>
 #include <cstdint>
@@ -275,8 +279,8 @@ void process() {
             //double xn = xInp[n];
 
             //DFT calcaultion - Coeffs contained in header file
-            xntempreal = xn*cosCoeff[k][n];
-            xntempimag = xn*sineCoeff[k][n];
+            xntempreal = xn*cosCoeff(k, n);
+            xntempimag = xn*sineCoeff(k, n);
 
             //Sumation of DFT cals
             Xkreal = Xkreal + xntempreal;
@@ -320,8 +324,182 @@ void process() {
     }
 }
 */
+
+#if MBED_CONF_APP_FFT_BENCHMARK
+//Power spectrum of a 200 sample window - Global as its buffers are too big for the main thread's stack
+RealFFT<200> fft;
+GoertzelBank<31> goertzel;
+SlidingDFT<200, 31> sliding;
+DFTQ15<200, 31> dftQ15;
+DFTQ31<200, 31> dftQ31;
+
+//The tables coefficients.hpp held before the quarter wave table, 31 x 200 floats of each in flash - Only built for fft-benchmark, so the
+//DFT can be timed on both on the board
+struct FullCoefficients {
+    float cosTable[coefficientBins][coefficientSamples];
+    float sineTable[coefficientBins][coefficientSamples];
+
+    constexpr FullCoefficients() : cosTable(), sineTable() {
+        for (uint32_t k = 0; k < coefficientBins; k++) {
+            for (uint32_t n = 0; n < coefficientSamples; n++) {
+                cosTable[k][n] = quarterWave<coefficientSamples>.cos((k * n) % coefficientSamples);
+                sineTable[k][n] = quarterWave<coefficientSamples>.negSine((k * n) % coefficientSamples);
+            }
+        }
+    }
+};
+
+constexpr FullCoefficients fullCoefficients = FullCoefficients();
+
+//Times the DFT from process(), on the quarter wave table and on the full tables it replaced, against the FFT, the Goertzel bank, the
+//sliding DFT and the fixed point DFTs over the same window - Cycles from the DWT cycle counter and time from tmr. Enabled by
+//fft-benchmark in mbed_app.json. Spectrum_Benchmark checks them against a double DFT on the host
+void fftBenchmark() {
+    static float window[200];
+    static float dftPower[31];
+    static float tablePower[31];
+    static float fftPower[31];
+    static float goertzelPower[31];
+    static float slidingPower[31];
+    static int16_t windowQ15[200];
+    static int32_t windowQ31[200];
+    static int64_t fixedPower[31];
+    static int64_t re[31];
+    static int64_t im[31];
+    static int64_t reScalar[31];
+    static int64_t imScalar[31];
+    static float binTargets[31];
+    Timer tmr;
+
+    //PPG like test window - A 1.2Hz pulse and its second harmonic on a DC level, sampled at 100Hz
+    for (int n = 0; n < 200; n++) {
+        float t = n / 100.0f;
+        window[n] = 2.0f + sinf(2 * 3.14159265f * 1.2f * t) + (0.4f * sinf(2 * 3.14159265f * 2.4f * t));
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    //DFT as process() does it - Double accumulators and the quarter wave coefficients, 6200 multiply-accumulates
+    tmr.start();
+    uint32_t start = DWT->CYCCNT;
+    for (uint32_t k = 0; k < coefficientBins; k++) {
+        double real = 0.0;
+        double imag = 0.0;
+        uint32_t i = 0; //k*n mod 200
+        for (int n = 0; n < 200; n++) {
+            float c;
+            float ns;
+            quarterWave<coefficientSamples>.twiddle(i, c, ns);
+            real += window[n] * c;
+            imag += window[n] * ns;
+            i = (i + k >= coefficientSamples) ? i + k - coefficientSamples : i + k;
+        }
+        dftPower[k] = (real * real) + (imag * imag);
+    }
+    uint32_t dftCycles = DWT->CYCCNT - start;
+    tmr.stop();
+    long long dftUs = tmr.elapsed_time().count();
+
+    //The same loop on the full tables the quarter wave table replaced
+    tmr.reset();
+    tmr.start();
+    start = DWT->CYCCNT;
+    for (uint32_t k = 0; k < coefficientBins; k++) {
+        double real = 0.0;
+        double imag = 0.0;
+        for (int n = 0; n < 200; n++) {
+            real += window[n] * fullCoefficients.cosTable[k][n];
+            imag += window[n] * fullCoefficients.sineTable[k][n];
+        }
+        tablePower[k] = (real * real) + (imag * imag);
+    }
+    uint32_t tableCycles = DWT->CYCCNT - start;
+    tmr.stop();
+    long long tableUs = tmr.elapsed_time().count();
+
+    tmr.reset();
+    tmr.start();
+    start = DWT->CYCCNT;
+    fft.power(window, fftPower, 31);
+    uint32_t fftCycles = DWT->CYCCNT - start;
+    tmr.stop();
+    long long fftUs = tmr.elapsed_time().count();
+
+    //The bank does its work as the samples arrive, so this is the whole window of pushes - Spread over 2s on the board
+    binFrequencies(binTargets, 31, 100.0f, 200);
+    goertzel.configure(binTargets, 31, 100.0f, 200);
+    start = DWT->CYCCNT;
+    for (int n = 0; n < 200; n++) {
+        goertzel.push(window[n]);
+    }
+    uint32_t goertzelCycles = DWT->CYCCNT - start;
+    goertzel.power(goertzelPower);
+
+    //A fresh spectrum after every sample - The cost of one is the window's worth over 200
+    start = DWT->CYCCNT;
+    for (int n = 0; n < 200; n++) {
+        sliding.push(window[n]);
+        sliding.power(slidingPower, 31);
+    }
+    uint32_t slidingCycles = DWT->CYCCNT - start;
+
+    //Fixed point, with full scale 4.0 - The Q15 dual path (SMLALD) timed against its scalar loop and checked bit for bit
+    for (int n = 0; n < 200; n++) {
+        windowQ15[n] = toQ15(window[n], 4.0f);
+        windowQ31[n] = toQ31(window[n], 4.0f);
+    }
+    start = DWT->CYCCNT;
+    dftQ15.transformDual(windowQ15, re, im);
+    uint32_t dualCycles = DWT->CYCCNT - start;
+    start = DWT->CYCCNT;
+    dftQ15.transformScalar(windowQ15, reScalar, imScalar);
+    uint32_t scalarCycles = DWT->CYCCNT - start;
+    int mismatches = 0;
+    for (int k = 0; k < 31; k++) {
+        mismatches += (re[k] != reScalar[k]) || (im[k] != imScalar[k]);
+    }
+    start = DWT->CYCCNT;
+    dftQ31.power(windowQ31, fixedPower, 31);
+    uint32_t q31Cycles = DWT->CYCCNT - start;
+
+    float peak = 0.0f;
+    float worst = 0.0f;
+    float worstGoertzel = 0.0f;
+    float worstSliding = 0.0f;
+    float worstTable = 0.0f;
+    for (int k = 0; k < 31; k++) {
+        peak = (dftPower[k] > peak) ? dftPower[k] : peak;
+    }
+    for (int k = 0; k < 31; k++) {
+        worst = (fabsf(dftPower[k] - fftPower[k]) > worst) ? fabsf(dftPower[k] - fftPower[k]) : worst;
+        worstGoertzel = (fabsf(dftPower[k] - goertzelPower[k]) > worstGoertzel) ? fabsf(dftPower[k] - goertzelPower[k]) : worstGoertzel;
+        worstSliding = (fabsf(dftPower[k] - slidingPower[k]) > worstSliding) ? fabsf(dftPower[k] - slidingPower[k]) : worstSliding;
+        worstTable = (fabsf(dftPower[k] - tablePower[k]) > worstTable) ? fabsf(dftPower[k] - tablePower[k]) : worstTable;
+    }
+
+    printf("DFT from process(): %lu cycles, %lldus per window\n", (unsigned long)dftCycles, dftUs);
+    printf("DFT on the full tables: %lu cycles, %lldus per window (the quarter wave table takes %.2fx the time, %.2e of the peak apart)\n",
+           (unsigned long)tableCycles, tableUs, (float)dftCycles / tableCycles, worstTable / peak);
+    printf("RealFFT<200>: %lu cycles, %lldus per window (%.1fx faster)\n", (unsigned long)fftCycles, fftUs, (float)dftCycles / fftCycles);
+    printf("GoertzelBank<31>: %lu cycles per window, %lu per sample\n", (unsigned long)goertzelCycles, (unsigned long)(goertzelCycles / 200));
+    printf("SlidingDFT<200, 31>: %lu cycles per sample for a fresh spectrum\n", (unsigned long)(slidingCycles / 200));
+    printf("DFTQ15<200, 31>: %lu cycles dual, %lu scalar, %d bins differ\n", (unsigned long)dualCycles, (unsigned long)scalarCycles, mismatches);
+    printf("DFTQ31<200, 31>: %lu cycles\n", (unsigned long)q31Cycles);
+    printf("Largest difference %.2e of the peak for the FFT, %.2e for the Goertzel bank, %.2e for the sliding DFT\n", worst / peak,
+           worstGoertzel / peak, worstSliding / peak);
+    for (int k = 0; k < 31; k++) {
+        printf("Power: %f | Freq: %f\n", fftPower[k], binHz(k, 200, 100.0f));
+    }
+}
+#endif
+
 int main()
 {
+#if MBED_CONF_APP_FFT_BENCHMARK
+    fftBenchmark();
+#endif
 /*
 
     dft.start(dftTask);
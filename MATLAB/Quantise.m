@@ -2,8 +2,11 @@
 %Author: Cameron Stephens
 %Description:
 %This script is a very basic algorithm to quantise the data read from the
-%micro-SD Card. The user must set the correct variables in order for this
-%script to work correctly. 
+%micro-SD Card. The sample rate, period length and period count are read
+%from the profile line the firmware writes at the top of the file. The
+%user must set the remaining ADC variables in order for this script to
+%work correctly. Binary recordings (glucoseresults.bin) are first exported
+%to this text format with the Record_Decoder host tool.
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 %Clears command window and closes all figures
@@ -16,16 +19,36 @@ close all;
 %Programming - https://www.youtube.com/watch?v=0MtpTWKIKrU
 fid = fopen('D:\glucoseresults.txt', 'r');
     if fid == -1
-        disp('Error, check file name')
+        %Nothing below can run without the data, so stop here rather than carry on with no profile or samples
+        error('Could not open D:\glucoseresults.txt - Check the file name')
     else
-        S = textscan(fid, '%f %f', 'Delimiter', ',');
+        %First line holds the sampling profile e.g. "# rate_hz=500 window_s=4 channels=2 samples_per_window=2000"
+        profile = sscanf(fgetl(fid), '# rate_hz=%d window_s=%d channels=%d samples_per_window=%d');
+        if numel(profile) ~= 4
+            frewind(fid); %Older files have no profile line so the data starts at the top
+        end
+        %One column per ADC channel - AC and DC are always the first two
+        if numel(profile) == 4
+            columns = profile(3);
+        else
+            columns = 2;
+        end
+        S = textscan(fid, repmat('%f ', 1, columns), 'Delimiter', ',');
     end
 fclose(fid); %Closes the text file again to prevent corruption
 
+%Sampling variables - Taken from the profile line when there is one
+if numel(profile) == 4
+    sampleRatems = 1000/profile(1); %Sample rate in milliseconds
+    periodLength = profile(2); %Period length in seconds
+    periodCount = floor(numel(S{1})/profile(4)); %How many samples periods ran
+else
+    sampleRatems = 5; %Sample rate in milliseconds
+    periodCount = 2; %How many samples periods ran
+    periodLength = 10; %Period length in seconds
+end
+
 %User set variables
-sampleRatems = 5; %Sample rate in milliseconds
-periodCount = 2; %How many samples periods ran
-periodLength = 10; %Period length in seconds
 ADCBitResolution = 12; %Resolution of the ADC used
 componentSize = 16; %Data size used to store components
 maxADCVoltage = 3.3; %Maximum voltage value for the ADC
@@ -0,0 +1,147 @@
+#include "../Basic_Code/AdcDma.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+/*
+Description:
+- Host driver for the block acquisition engine (AdcDma.hpp) - Runs its simulated timer, ADC and DMA with synthetic inputs and checks
+  what the block handler is given.
+- A tagged source (setSource()) makes every conversion a known function of its channel and scan number, with bits above 12 set so the
+  masking to the ADC's width is checked too. Every block must arrive in order, whole, interleaved as offset() says, and none may arrive
+  once stop() has returned. The time between blocks is checked against BlockSize scan periods.
+- The default PPG like source is run after, and its channels checked to stay inside the ranges it is meant to give.
+- toU16() is checked against AnalogIn::read_u16() scaling at the ends and middle of the range.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 -pthread main.cpp -o acquisition_sim
+*/
+
+static const int blockSize = 50;
+static const int channels = 3;
+static const nanoseconds scanPeriod(500000); //2kHz, so a block every 25ms
+static const int blocksToRun = 40;
+
+static const AdcInput inputs[channels] = {{0, "ppg"}, {1, "ambient"}, {2, "temp"}};
+
+typedef AdcDma<blockSize, channels> Engine;
+
+static mutex blocksLock;
+static vector<vector<uint16_t>> blocks;
+static vector<steady_clock::time_point> arrivals;
+
+//Conversion c of scan n - Bits above 12 are set on purpose, the engine must drop them
+static uint16_t tagged(int channel, uint32_t scan) {
+    return (uint16_t)(0xF000 | ((scan * 7 + channel * 1000) & 0x0FFF));
+}
+
+static uint16_t taggedSource(int channel, double seconds) {
+    uint32_t scan = (uint32_t)llround(seconds / (scanPeriod.count() / 1e9));
+    return tagged(channel, scan);
+}
+
+//Called from the simulation thread as the DMA interrupt would be - Copies the half out, as it is reused BlockSize scans later
+static void onBlock(const uint16_t *block, int scans) {
+    lock_guard<mutex> guard(blocksLock);
+    blocks.emplace_back(block, block + (scans * channels));
+    arrivals.push_back(steady_clock::now());
+}
+
+static size_t blockCount() {
+    lock_guard<mutex> guard(blocksLock);
+    return blocks.size();
+}
+
+static void run(Engine &engine, int count) {
+    {
+        lock_guard<mutex> guard(blocksLock);
+        blocks.clear();
+        arrivals.clear();
+    }
+    engine.start(scanPeriod, onBlock);
+    while (blockCount() < (size_t)count) {
+        this_thread::sleep_for(milliseconds(5));
+    }
+    engine.stop();
+}
+
+static bool checkTagged() {
+    static Engine engine(inputs);
+    engine.setSource(taggedSource);
+    run(engine, blocksToRun);
+
+    size_t stopped = blockCount();
+    this_thread::sleep_for(scanPeriod * blockSize * 3);
+    bool quiet = blockCount() == stopped;
+
+    uint32_t wrong = 0;
+    uint32_t shortBlocks = 0;
+    for (size_t b = 0; b < blocks.size(); b++) {
+        if (blocks[b].size() != (size_t)(blockSize * channels)) {
+            shortBlocks++;
+            continue;
+        }
+        for (int i = 0; i < blockSize; i++) {
+            uint32_t scan = (uint32_t)((b * blockSize) + i);
+            for (int c = 0; c < channels; c++) {
+                wrong += blocks[b][Engine::offset(i, c)] != (tagged(c, scan) & 0x0FFF);
+            }
+        }
+    }
+
+    //Blocks are handed over at the end of each half, so the spacing should be BlockSize scans
+    double expectedMs = duration<double, milli>(scanPeriod * blockSize).count();
+    double spacingMs = duration<double, milli>(arrivals.back() - arrivals.front()).count() / (arrivals.size() - 1);
+    bool onTime = fabs(spacingMs - expectedMs) < (0.1 * expectedMs);
+
+    bool passed = wrong == 0 && shortBlocks == 0 && quiet && onTime;
+    printf("Tagged source: %zu blocks of %d scans x %d channels, %u wrong values, %u short blocks\n", blocks.size(), blockSize, channels, wrong,
+           shortBlocks);
+    printf("Block every %.2fms (expected %.2fms), %s after stop()  %s\n", spacingMs, expectedMs, quiet ? "none" : "more blocks",
+           passed ? "ok" : "FAILED");
+    return passed;
+}
+
+static bool checkDefault() {
+    static Engine engine(inputs);
+    run(engine, 10);
+
+    //Channel 0 is 2048 +/- 600 with +/-2 LSB of noise, the others 3000 - 200c +/- 50
+    uint16_t low[channels] = {0xFFFF, 0xFFFF, 0xFFFF};
+    uint16_t high[channels] = {0, 0, 0};
+    for (const vector<uint16_t> &block : blocks) {
+        for (int i = 0; i < blockSize; i++) {
+            for (int c = 0; c < channels; c++) {
+                uint16_t v = block[Engine::offset(i, c)];
+                low[c] = (v < low[c]) ? v : low[c];
+                high[c] = (v > high[c]) ? v : high[c];
+            }
+        }
+    }
+    bool passed = low[0] >= 2048 - 603 && high[0] <= 2048 + 602;
+    for (int c = 1; c < channels; c++) {
+        int level = 3000 - (200 * c);
+        passed = passed && low[c] >= level - 53 && high[c] <= level + 52;
+    }
+    for (int c = 0; c < channels; c++) {
+        printf("Default source %-8s %4u to %4u\n", engine.input(c).name, low[c], high[c]);
+    }
+    printf("Default source in range  %s\n", passed ? "ok" : "FAILED");
+    return passed;
+}
+
+int main() {
+    bool passed = true;
+    passed = checkTagged() && passed;
+    passed = checkDefault() && passed;
+
+    bool scaled = Engine::toU16(0) == 0 && Engine::toU16(0x0FFF) == 0xFFFF && Engine::toU16(0x0800) == 0x8008;
+    printf("toU16() matches read_u16() scaling  %s\n", scaled ? "ok" : "FAILED");
+    passed = passed && scaled;
+    return passed ? 0 : 1;
+}
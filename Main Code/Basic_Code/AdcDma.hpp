@@ -0,0 +1,293 @@
+#ifndef __ADC_DMA_HPP__
+#define __ADC_DMA_HPP__
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(TARGET_STM32F4)
+#include "mbed.h"
+#include "pinmap.h"
+#include "PeripheralPins.h"
+#include "stm32f4xx_hal.h"
+#else
+#include <atomic>
+#include <cmath>
+#include <thread>
+#endif
+
+#if defined(TARGET_STM32F4)
+typedef PinName AdcPin;
+#else
+typedef int AdcPin; //Only used as a label by the simulation
+#endif
+
+//One entry in the scan list - Any ADC1 capable pin, or ADC_TEMP / ADC_VREF for the internal temperature sensor and reference
+struct AdcInput {
+    AdcPin pin;
+    const char *name; //Used for reports and file headers
+};
+
+/*
+Block acquisition engine for the photodiode channels and any other analog inputs.
+- The inputs are given as a channel list when the engine is created. A hardware timer (TIM3) triggers ADC1 to convert every input in the
+  list as one scan, so all channels of a sample are taken within a few microseconds of each other instead of one blocking read after another.
+  The period is given in nanoseconds so the ADC can be run at a multiple of the output rate when oversampling.
+- DMA2 Stream0 moves each conversion into a circular buffer split into two halves of BlockSize scans.
+- The half and full complete DMA interrupts hand a whole half to the block handler, so nothing runs per sample in software.
+- The handler runs in interrupt context and must only pass the block on (e.g. EventQueue::call) - The half it is given is overwritten again BlockSize scans later.
+- Blocks are interleaved in channel list order and hold raw right aligned 12-bit conversions - offset() gives where a channel of a scan is,
+  and toU16() gives the AnalogIn::read_u16() scaling.
+- When not built for an STM32F4 target, a simulated ADC/DMA fills the buffer from a thread at the same rate so the acquisition path can be run and checked on Linux.
+  Acquisition_Sim drives it with synthetic inputs through setSource().
+*/
+template <int BlockSize, int Channels>
+class AdcDma {
+    static_assert(Channels > 0 && Channels <= 16, "ADC1 can scan between 1 and 16 inputs");
+
+public:
+    typedef void (*BlockHandler)(const uint16_t *block, int scans);
+    typedef uint16_t (*SampleSource)(int channel, double seconds);
+
+    static const int channels = Channels;
+
+private:
+    const AdcInput *inputs;
+    uint16_t dmaBuffer[2 * BlockSize * Channels];
+    BlockHandler handler = nullptr;
+
+#if defined(TARGET_STM32F4)
+    ADC_HandleTypeDef hadc;
+    DMA_HandleTypeDef hdma;
+    TIM_HandleTypeDef htim;
+
+    static AdcDma *instance; //Used by the DMA interrupt vector to find the engine
+
+    static void dmaIrq() {
+        HAL_DMA_IRQHandler(&instance->hdma);
+    }
+
+    static void halfComplete(DMA_HandleTypeDef *dma) {
+        AdcDma *self = (AdcDma *)dma->Parent;
+        self->handler(&self->dmaBuffer[0], BlockSize);
+    }
+
+    static void fullComplete(DMA_HandleTypeDef *dma) {
+        AdcDma *self = (AdcDma *)dma->Parent;
+        self->handler(&self->dmaBuffer[BlockSize * Channels], BlockSize);
+    }
+
+    //Looks up the ADC channel for a pin the same way AnalogIn does - External pins are switched to analog mode,
+    //internal channels need the temperature sensor and reference turned on
+    uint32_t initInput(AdcPin pin) {
+        uint32_t function = pinmap_find_function(pin, PinMap_ADC);
+        if (function != (uint32_t)NC) {
+            pin_function(pin, function);
+        }
+        else {
+            function = pinmap_function(pin, PinMap_ADC_Internal);
+            ADC->CCR |= ADC_CCR_TSVREFE;
+        }
+
+        //On the F4 the HAL ADC_CHANNEL_n values are the channel numbers themselves
+        return STM_PIN_CHANNEL(function);
+    }
+
+    void initDma() {
+        __HAL_RCC_DMA2_CLK_ENABLE();
+
+        hdma.Instance = DMA2_Stream0;
+        hdma.Init.Channel = DMA_CHANNEL_0;
+        hdma.Init.Direction = DMA_PERIPH_TO_MEMORY;
+        hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+        hdma.Init.MemInc = DMA_MINC_ENABLE;
+        hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+        hdma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+        hdma.Init.Mode = DMA_CIRCULAR;
+        hdma.Init.Priority = DMA_PRIORITY_HIGH;
+        hdma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+        HAL_DMA_Init(&hdma);
+
+        hdma.Parent = this;
+        hdma.XferHalfCpltCallback = halfComplete;
+        hdma.XferCpltCallback = fullComplete;
+
+        instance = this;
+        NVIC_SetVector(DMA2_Stream0_IRQn, (uint32_t)&dmaIrq);
+        NVIC_SetPriority(DMA2_Stream0_IRQn, 1);
+        NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+    }
+
+    void initAdc() {
+        __HAL_RCC_ADC1_CLK_ENABLE();
+
+        hadc.Instance = ADC1;
+        hadc.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
+        hadc.Init.Resolution = ADC_RESOLUTION_12B;
+        hadc.Init.ScanConvMode = ENABLE;
+        hadc.Init.ContinuousConvMode = DISABLE;
+        hadc.Init.DiscontinuousConvMode = DISABLE;
+        hadc.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+        hadc.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T3_TRGO;
+        hadc.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+        hadc.Init.NbrOfConversion = Channels;
+        hadc.Init.DMAContinuousRequests = ENABLE;
+        hadc.Init.EOCSelection = ADC_EOC_SEQ_CONV;
+        HAL_ADC_Init(&hadc);
+
+        //Scan order is the channel list order, which is also the interleaving of the blocks
+        for (int c = 0; c < Channels; c++) {
+            ADC_ChannelConfTypeDef channel = {0};
+            channel.Channel = initInput(inputs[c].pin);
+            channel.Rank = c + 1;
+            channel.SamplingTime = ADC_SAMPLETIME_84CYCLES;
+            HAL_ADC_ConfigChannel(&hadc, &channel);
+        }
+    }
+
+    void initTimer(std::chrono::nanoseconds period) {
+        __HAL_RCC_TIM3_CLK_ENABLE();
+
+        //APB1 timers run at twice PCLK1 whenever the APB1 prescaler is not 1
+        uint32_t timerClock = HAL_RCC_GetPCLK1Freq();
+        if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+            timerClock *= 2;
+        }
+
+        //Smallest prescaler that fits the period in the 16-bit counter, keeping as much timing resolution as possible
+        uint32_t ticks = (uint32_t)(((uint64_t)timerClock * period.count()) / 1000000000);
+        uint32_t prescaler = (ticks / 65536) + 1;
+
+        htim.Instance = TIM3;
+        htim.Init.Prescaler = prescaler - 1;
+        htim.Init.CounterMode = TIM_COUNTERMODE_UP;
+        htim.Init.Period = (ticks / prescaler) - 1;
+        htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+        HAL_TIM_Base_Init(&htim);
+
+        TIM_MasterConfigTypeDef master = {0};
+        master.MasterOutputTrigger = TIM_TRGO_UPDATE;
+        master.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+        HAL_TIMEx_MasterConfigSynchronization(&htim, &master);
+    }
+
+#else
+    std::thread simThread;
+    std::atomic<bool> running{false};
+    std::chrono::nanoseconds simPeriod{0};
+    SampleSource source = defaultSource;
+
+    //Synthetic PPG like signal - a 1.2Hz pulse on the first channel and slowly drifting levels on the rest, with a few LSBs of noise like the real ADC
+    static uint16_t defaultSource(int channel, double t) {
+        static uint32_t noise = 1;
+        noise = (noise * 1664525) + 1013904223;
+        double dither = (double)(noise >> 24) / 64.0 - 2.0; //Uniform -2 to +2 LSB
+
+        if (channel == 0) {
+            return (uint16_t)(2048 + 600 * sin(2 * M_PI * 1.2 * t) + dither);
+        }
+        return (uint16_t)((3000 - (200 * (channel % 8))) + 50 * sin(2 * M_PI * 0.05 * t) + dither);
+    }
+
+    //Stands in for the timer, ADC and DMA - fills one half at a time then raises the matching "interrupt"
+    void simulate() {
+        uint32_t sampleNumber = 0;
+        double periodSeconds = simPeriod.count() / 1e9;
+        int half = 0;
+        auto next = std::chrono::steady_clock::now();
+
+        while (running) {
+            uint16_t *block = &dmaBuffer[half * BlockSize * Channels];
+            for (int i = 0; i < BlockSize; i++) {
+                for (int c = 0; c < Channels; c++) {
+                    block[offset(i, c)] = source(c, sampleNumber * periodSeconds) & 0x0FFF;
+                }
+                sampleNumber++;
+            }
+
+            next += simPeriod * BlockSize;
+            std::this_thread::sleep_until(next);
+
+            handler(block, BlockSize);
+            half ^= 1;
+        }
+    }
+#endif
+
+public:
+    //The channel list must stay valid while sampling - Its order sets the scan order and the channel numbers used with offset()
+    explicit AdcDma(const AdcInput (&channelList)[Channels]) : inputs(channelList) {}
+
+    ~AdcDma() {
+        stop();
+    }
+
+    //Position of channel c of scan i within a block
+    static int offset(int i, int c) {
+        return (i * Channels) + c;
+    }
+
+    const AdcInput &input(int c) const {
+        return inputs[c];
+    }
+
+    //Scales a raw 12-bit conversion to the 16-bit range returned by AnalogIn::read_u16()
+    static uint16_t toU16(uint16_t raw) {
+        return (raw << 4) | (raw >> 8);
+    }
+
+#if !defined(TARGET_STM32F4)
+    //Replaces the simulated ADC input - Must be set before start()
+    void setSource(SampleSource newSource) {
+        source = newSource;
+    }
+#endif
+
+    //Starts timer triggered sampling with one scan every period - handler is called once per BlockSize scans
+    void start(std::chrono::nanoseconds period, BlockHandler blockHandler) {
+        handler = blockHandler;
+
+#if defined(TARGET_STM32F4)
+        initDma();
+        initAdc();
+        initTimer(period);
+
+        //DMA is armed before the ADC is enabled so the first conversion is not missed
+        HAL_DMA_Start_IT(&hdma, (uint32_t)&ADC1->DR, (uint32_t)dmaBuffer, 2 * BlockSize * Channels);
+        ADC1->CR2 |= ADC_CR2_DMA | ADC_CR2_DDS;
+        __HAL_ADC_ENABLE(&hadc);
+
+        HAL_TIM_Base_Start(&htim);
+#else
+        simPeriod = period;
+        running = true;
+        simThread = std::thread(&AdcDma::simulate, this);
+#endif
+    }
+
+    //Stops sampling - No further blocks are handed over once this returns
+    void stop() {
+#if defined(TARGET_STM32F4)
+        if (handler == nullptr) {
+            return;
+        }
+        HAL_TIM_Base_Stop(&htim);
+        __HAL_ADC_DISABLE(&hadc);
+        ADC1->CR2 &= ~(ADC_CR2_DMA | ADC_CR2_DDS);
+        HAL_DMA_Abort(&hdma);
+        NVIC_DisableIRQ(DMA2_Stream0_IRQn);
+        handler = nullptr;
+#else
+        running = false;
+        if (simThread.joinable()) {
+            simThread.join();
+        }
+#endif
+    }
+};
+
+#if defined(TARGET_STM32F4)
+template <int BlockSize, int Channels>
+AdcDma<BlockSize, Channels> *AdcDma<BlockSize, Channels>::instance = nullptr;
+#endif
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef __BUFFER_POOL_HPP__
+#define __BUFFER_POOL_HPP__
+
+#include <cstdint>
+#include "SampleRing.hpp"
+
+/*
+Fixed pool of Blocks buffers passed between a filling thread and a writing thread.
+- The filler acquire()s a free buffer, fills it and seal()s it, which puts it on the ready queue.
+- The writer takes buffers off the ready queue with nextReady() and release()s them back to the pool once written.
+- Free and ready queues are SampleRings, so neither side takes a lock and a buffer is never handed to both sides at once.
+- If acquire() finds no free buffer the writer has fallen more than Blocks-1 windows behind - This is counted as a stall rather than overwriting a buffer still being written.
+- Pool_Sim runs it on the host against a card with slow writes and latency spikes.
+*/
+
+template <typename Slot, uint32_t Blocks>
+class BufferPool {
+    static_assert(Blocks >= 2, "BufferPool needs at least two buffers so one can fill while another is written");
+
+private:
+    Slot slots[Blocks];
+    SampleRing<Slot *, ringCapacityFor(Blocks)> freeSlots; //Pushed by the writer, popped by the filler
+    SampleRing<Slot *, ringCapacityFor(Blocks)> readySlots; //Pushed by the filler, popped by the writer
+    uint32_t stallCount = 0;
+    uint32_t lowestFreeCount = Blocks;
+
+public:
+    BufferPool() {
+        for (uint32_t i = 0; i < Blocks; i++) {
+            freeSlots.push(&slots[i]);
+        }
+    }
+
+    //Filler side - Returns a free buffer or nullptr if every buffer is waiting to be written
+    Slot *acquire() {
+        Slot *slot = nullptr;
+        if (!freeSlots.pop(slot)) {
+            stallCount++;
+            return nullptr;
+        }
+        if (freeSlots.size() < lowestFreeCount) {
+            lowestFreeCount = freeSlots.size();
+        }
+        return slot;
+    }
+
+    //Filler side - Hands a full buffer to the writer
+    void seal(Slot *slot) {
+        readySlots.push(slot);
+    }
+
+    //Writer side - Returns the oldest sealed buffer or nullptr if there is nothing to write
+    Slot *nextReady() {
+        Slot *slot = nullptr;
+        readySlots.pop(slot);
+        return slot;
+    }
+
+    //Writer side - Returns a written buffer to the pool
+    void release(Slot *slot) {
+        freeSlots.push(slot);
+    }
+
+    static uint32_t size() {
+        return Blocks;
+    }
+
+    uint32_t freeCount() const {
+        return freeSlots.size();
+    }
+
+    uint32_t readyCount() const {
+        return readySlots.size();
+    }
+
+    //Number of times the filler found no free buffer
+    uint32_t stalls() const {
+        return stallCount;
+    }
+
+    //Fewest free buffers seen after an acquire - 0 means the pool has been completely used at least once
+    uint32_t lowestFree() const {
+        return lowestFreeCount;
+    }
+};
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef __CIC_DECIMATOR_HPP__
+#define __CIC_DECIMATOR_HPP__
+
+#include <cmath>
+#include <cstdint>
+
+/*
+Integer CIC decimator used to oversample a 12-bit ADC channel and trade sample rate for resolution.
+- Ratio raw samples go in for every sample out, through Order integrator and comb stages.
+- All filtering is done in 32-bit unsigned arithmetic - Wrap around cancels out in the combs as long as the filter's bit growth fits in 32 bits.
+- Output is scaled to the 16-bit range of AnalogIn::read_u16(), so the rest of the pipeline and the recorded values keep the same full scale.
+  With Ratio 1 the output is exactly AdcDma::toU16() of the input.
+- The spread of the raw samples inside each group of Ratio is measured as the input noise. Scaled by the filter's noise gain this gives the
+  noise floor of the output and the effective number of bits achieved.
+- Each doubling of the ratio adds half a bit on white input noise. With 2 LSB of input noise the default order 3 gives 10.6 effective
+  bits at ratio 4, 11.6 at 16 and 12.6 at 64, the largest ratio whose growth fits in 32 bits. 14 bits takes ratio 512 at order 2
+  (30 bits of growth), 14.5 ratio 1024 at order 2 (32 bits) and 16 bits ratio 16384 at order 1 (26 bits). The ADC's 200k conversions
+  a second (SamplingConfig.hpp) only allow ratio 128 for the default 500Hz two channel profile, so 14 bits needs under 195Hz a channel
+  with two channels. Orders 1 and 2 also let more of the band above the output rate alias in than order 3.
+- Cic_Check compares it bit for bit with a direct convolution on noisy input on the host, and its noise floor with the one measured.
+*/
+
+constexpr int cicLog2(uint32_t n) {
+    return (n <= 1) ? 0 : 1 + cicLog2(n / 2);
+}
+
+template <uint32_t Ratio, int Order = 3>
+class CicDecimator {
+    static_assert(Ratio > 0 && (Ratio & (Ratio - 1)) == 0, "CIC decimation ratio must be a power of two");
+    static_assert(Order > 0, "CIC needs at least one stage");
+
+public:
+    static const int inputBits = 12;
+    static const int outputBits = inputBits + (Order * cicLog2(Ratio)); //Bits in the filter output before scaling
+    static_assert(outputBits <= 32, "CIC bit growth does not fit in 32 bits - Lower the ratio or order");
+
+private:
+    uint32_t integrators[Order] = {0};
+    uint32_t combs[Order] = {0};
+    uint32_t phase = 0;
+    bool primed = false;
+
+    //Noise measurement for the current group and the running total for the window
+    uint32_t groupSum = 0;
+    uint64_t groupSumSquares = 0;
+    double varianceTotal = 0;
+    uint32_t groups = 0;
+    double gain; //Noise power gain of the filter - Worked out once as it is a loop over the whole impulse response
+
+    //Scales the filter output to 16 bits - Extra bits are rounded off, missing bits are filled by repeating the top bits like read_u16()
+    static const int dropBits = (outputBits > 16) ? (outputBits - 16) : 0;
+    static const int fillBits = (outputBits < 16) ? (16 - outputBits) : 0;
+
+    static uint16_t scale(uint32_t value) {
+        uint64_t rounded = ((uint64_t)value + ((1ull << dropBits) >> 1)) >> dropBits;
+        uint64_t scaled = (rounded << fillBits) | (rounded >> (outputBits - fillBits));
+        return (scaled > 0xFFFF) ? 0xFFFF : (uint16_t)scaled;
+    }
+
+    bool step(uint16_t raw, uint16_t &out) {
+        uint32_t value = raw;
+        for (int i = 0; i < Order; i++) {
+            integrators[i] += value;
+            value = integrators[i];
+        }
+
+        if (++phase < Ratio) {
+            return false;
+        }
+        phase = 0;
+
+        for (int i = 0; i < Order; i++) {
+            uint32_t previous = combs[i];
+            combs[i] = value;
+            value -= previous;
+        }
+        out = scale(value);
+        return true;
+    }
+
+public:
+    CicDecimator() : gain(noiseGain()) {}
+
+    static uint32_t ratio() {
+        return Ratio;
+    }
+
+    //Pushes one raw 12-bit conversion - Returns true and sets out every Ratio samples
+    bool push(uint16_t raw, uint16_t &out) {
+        //The first sample is repeated through the whole filter so it starts as if the input had always been there instead of ramping up from zero
+        if (!primed) {
+            uint16_t discard;
+            for (uint32_t i = 0; i < Ratio * Order; i++) {
+                step(raw, discard);
+            }
+            primed = true;
+        }
+
+        if (Ratio > 1) {
+            groupSum += raw;
+            groupSumSquares += (uint32_t)raw * raw;
+            if (phase == Ratio - 1) {
+                double mean = (double)groupSum / Ratio;
+                varianceTotal += ((double)groupSumSquares - (mean * groupSum)) / (Ratio - 1);
+                groups++;
+                groupSum = 0;
+                groupSumSquares = 0;
+            }
+        }
+
+        return step(raw, out);
+    }
+
+    //Sum of the squared impulse response over its squared sum - How much white input noise power gets through to the output
+    static double noiseGain() {
+        const int length = (Ratio - 1) * Order + 1;
+        double response[(Ratio - 1) * Order + 1] = {0};
+        double next[(Ratio - 1) * Order + 1];
+        response[0] = 1;
+
+        //Impulse response of Order boxcars of length Ratio convolved together
+        for (int stage = 0; stage < Order; stage++) {
+            for (int n = 0; n < length; n++) {
+                next[n] = 0;
+                for (uint32_t k = 0; k < Ratio && k <= (uint32_t)n; k++) {
+                    next[n] += response[n - k];
+                }
+            }
+            for (int n = 0; n < length; n++) {
+                response[n] = next[n];
+            }
+        }
+
+        double sum = 0;
+        double sumSquares = 0;
+        for (int n = 0; n < length; n++) {
+            sum += response[n];
+            sumSquares += response[n] * response[n];
+        }
+        return sumSquares / (sum * sum);
+    }
+
+    //Output noise floor in 16-bit LSBs since the last call - Returns 0 if nothing has been measured (e.g. Ratio 1)
+    double takeNoiseFloor() {
+        double inputVariance = (groups > 0) ? (varianceTotal / groups) : 0;
+        varianceTotal = 0;
+        groups = 0;
+
+        //Input is in 12-bit LSBs and the output is 16-bit, so each input LSB is 16 output LSBs
+        return sqrt(inputVariance * gain) * 16.0;
+    }
+
+    //Effective bits for a given noise floor - Full scale over the RMS quantisation noise the floor is equivalent to
+    static double effectiveBits(double noiseFloor) {
+        if (noiseFloor <= 0) {
+            return 16.0;
+        }
+        double bits = log2(65536.0 / (noiseFloor * sqrt(12.0)));
+        return (bits > 16.0) ? 16.0 : bits;
+    }
+};
+
+#endif
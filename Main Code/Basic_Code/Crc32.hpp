@@ -0,0 +1,193 @@
+#ifndef __CRC32_HPP__
+#define __CRC32_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(TARGET_STM32F4)
+#include "mbed.h"
+#include "stm32f4xx_hal.h"
+#endif
+
+/*
+CRC-32 (ANSI / IEEE 802.3) backends - All give the same result as MbedCRC<POLY_32BIT_ANSI, 32>.
+- Crc32Bytewise is the portable reference using one 256 entry table.
+- Crc32SliceBy8 handles 8 bytes per step using eight tables generated at compile time.
+- Crc32Hardware uses the STM32F4 CRC unit a word at a time with bit reversal so its result matches the reflected ANSI CRC.
+- Crc32 is the fastest backend available for the build and keeps the compute() signature of MbedCRC so it can be dropped in.
+- Crc_Benchmark checks every backend gives the same bits on the host, the hardware one through a model of the CRC unit.
+*/
+
+//Tables generated at compile time - table[0] is the classic bytewise table, table[1..7] extend it to 8 bytes per step
+struct Crc32Tables {
+    uint32_t table[8][256];
+};
+
+constexpr Crc32Tables makeCrc32Tables() {
+    Crc32Tables t{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+        }
+        t.table[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int slice = 1; slice < 8; slice++) {
+            uint32_t previous = t.table[slice - 1][i];
+            t.table[slice][i] = (previous >> 8) ^ t.table[0][previous & 0xFF];
+        }
+    }
+    return t;
+}
+
+inline const Crc32Tables &crc32Tables() {
+    static constexpr Crc32Tables tables = makeCrc32Tables(); //Constant initialised so it is placed in flash
+    return tables;
+}
+
+//Continues a reflected CRC register one byte at a time
+inline uint32_t crc32UpdateBytewise(uint32_t state, const uint8_t *data, size_t size) {
+    const uint32_t *table = crc32Tables().table[0];
+    while (size--) {
+        state = table[(state ^ *data++) & 0xFF] ^ (state >> 8);
+    }
+    return state;
+}
+
+//Reverses the bits of a word - RBIT on the target
+inline uint32_t crc32ReverseBits(uint32_t x) {
+#if defined(TARGET_STM32F4)
+    return __RBIT(x);
+#else
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+    x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+    return (x >> 16) | (x << 16);
+#endif
+}
+
+//The reflected ANSI CRC from a unit that only does the MSB first CRC of whole words with no final XOR - Unit gives reset(), feed(word)
+//and read(). Bit reversed words in and a bit reversed result out give the reflected register, and any bytes left over from the last
+//word are finished in software.
+template <typename Unit>
+uint32_t crc32FromWordUnit(Unit &unit, const void *buffer, size_t size) {
+    const uint8_t *data = (const uint8_t *)buffer;
+    size_t words = size / 4;
+
+    unit.reset();
+    while (words--) {
+        uint32_t word;
+        memcpy(&word, data, 4);
+        unit.feed(crc32ReverseBits(word));
+        data += 4;
+    }
+    uint32_t state = crc32ReverseBits(unit.read());
+    return crc32UpdateBytewise(state, data, size % 4) ^ 0xFFFFFFFF;
+}
+
+class Crc32Bytewise {
+public:
+    static const char *name() {
+        return "bytewise";
+    }
+
+    int compute(const void *buffer, size_t size, uint32_t *crc) {
+        *crc = crc32UpdateBytewise(0xFFFFFFFF, (const uint8_t *)buffer, size) ^ 0xFFFFFFFF;
+        return 0;
+    }
+};
+
+class Crc32SliceBy8 {
+public:
+    static const char *name() {
+        return "slice-by-8";
+    }
+
+    int compute(const void *buffer, size_t size, uint32_t *crc) {
+        const uint32_t (*t)[256] = crc32Tables().table;
+        const uint8_t *data = (const uint8_t *)buffer;
+        uint32_t state = 0xFFFFFFFF;
+
+        while (size >= 8) {
+            //memcpy keeps unaligned buffers safe and compiles to plain loads - Words are little endian on both target and host
+            uint32_t low;
+            uint32_t high;
+            memcpy(&low, data, 4);
+            memcpy(&high, data + 4, 4);
+            low ^= state;
+
+            state = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+                    t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+
+            data += 8;
+            size -= 8;
+        }
+
+        *crc = crc32UpdateBytewise(state, data, size) ^ 0xFFFFFFFF;
+        return 0;
+    }
+};
+
+#if defined(TARGET_STM32F4)
+//The CRC unit only does the MSB first (non-reflected) CRC with no final XOR, so it is driven through crc32FromWordUnit().
+//Whole blocks are fed from the CPU - DMA cannot bit reverse the words on the way in, so a DMA fed unit could only produce the non-reflected CRC.
+class Crc32Hardware {
+private:
+    struct Unit {
+        void reset() {
+            CRC->CR = CRC_CR_RESET;
+        }
+
+        void feed(uint32_t word) {
+            CRC->DR = word;
+        }
+
+        uint32_t read() {
+            return CRC->DR;
+        }
+    };
+
+    Unit unit;
+    Mutex lock; //The CRC unit is shared between the consumer and sdWrite threads
+
+public:
+    Crc32Hardware() {
+        __HAL_RCC_CRC_CLK_ENABLE();
+    }
+
+    static const char *name() {
+        return "hardware";
+    }
+
+    int compute(const void *buffer, size_t size, uint32_t *crc) {
+        lock.lock();
+        *crc = crc32FromWordUnit(unit, buffer, size);
+        lock.unlock();
+        return 0;
+    }
+};
+
+typedef Crc32Hardware Crc32;
+
+//Measures a backend with the DWT cycle counter - Returns bytes processed per CPU cycle
+template <typename Backend>
+float crc32BytesPerCycle(Backend &backend, const void *buffer, size_t size) {
+    uint32_t crc;
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uint32_t start = DWT->CYCCNT;
+    backend.compute(buffer, size, &crc);
+    uint32_t cycles = DWT->CYCCNT - start;
+
+    return (float)size / (float)cycles;
+}
+#else
+typedef Crc32SliceBy8 Crc32;
+#endif
+
+#endif
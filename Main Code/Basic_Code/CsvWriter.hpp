@@ -0,0 +1,116 @@
+#ifndef __CSV_WRITER_HPP__
+#define __CSV_WRITER_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+Sector aligned writer for the CSV text results - Builds the same "ac,dc" lines printf did, without printf.
+- Values are formatted with a two digits at a time lookup table, so a sample costs a couple of divisions and copies instead of a
+  trip through newlib's printf.
+- Rows are built straight into a staging buffer of Size bytes (a multiple of the 512 byte sector). Once it holds a whole Size bytes
+  row() returns true and the caller writes data() / size() in one go and calls written(), so every write to the card is whole
+  sectors at a sector aligned offset in the file. The part row that did not fit is kept for the next write.
+- Whatever is left at the end of a recording (less than Size bytes) is written with pending() / data() and then clear().
+- If a write fails the caller keeps the buffer by not calling written(). It then holds Size bytes or more and takes no more rows
+  until they are written, but room() still allows a short closing text().
+- Nothing here touches the card, so rows can be formatted without holding the SD lock - It is only needed for the writes.
+*/
+
+//Writes value in decimal at out and returns the end - No terminator is added
+inline char *csvFormatU16(char *out, uint16_t value) {
+    static const char digitPairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    char digits[5];
+    char *p = digits + sizeof(digits);
+    uint32_t v = value;
+    while (v >= 100) {
+        uint32_t pair = (v % 100) * 2;
+        v /= 100;
+        *--p = digitPairs[pair + 1];
+        *--p = digitPairs[pair];
+    }
+    if (v >= 10) {
+        *--p = digitPairs[(v * 2) + 1];
+        *--p = digitPairs[v * 2];
+    }
+    else {
+        *--p = (char)('0' + v);
+    }
+
+    size_t length = (digits + sizeof(digits)) - p;
+    memcpy(out, p, length);
+    return out + length;
+}
+
+template <int Size, int LineMax>
+class CsvBlockWriter {
+    static_assert(Size > 0 && (Size % 512) == 0, "Staging must be a whole number of sectors");
+
+private:
+    alignas(4) char staging[Size + LineMax]; //Room for one line past the sectors being filled
+    int used = 0;
+
+public:
+    //Adds one line of comma separated values - Returns true once size() bytes are ready to write
+    bool row(const uint16_t *values, int count) {
+        char *p = staging + used;
+        for (int c = 0; c < count; c++) {
+            if (c > 0) {
+                *p++ = ',';
+            }
+            p = csvFormatU16(p, values[c]);
+        }
+        *p++ = '\n';
+        used = p - staging;
+        return used >= Size;
+    }
+
+    //Adds text of up to LineMax bytes as it is - Returns true once size() bytes are ready to write
+    bool text(const char *line, int length) {
+        memcpy(staging + used, line, length);
+        used += length;
+        return used >= Size;
+    }
+
+    const char *data() const {
+        return staging;
+    }
+
+    static int size() {
+        return Size;
+    }
+
+    //The first size() bytes have been written - The overflow moves to the front
+    void written() {
+        used -= Size;
+        memmove(staging, staging + Size, used);
+    }
+
+    //Checks length more bytes of text() fit behind what is waiting
+    bool room(int length) const {
+        return used + length <= Size + LineMax;
+    }
+
+    //Bytes waiting for a write - Less than size() unless row() or text() returned true
+    int pending() const {
+        return used;
+    }
+
+    void clear() {
+        used = 0;
+    }
+};
+
+#endif
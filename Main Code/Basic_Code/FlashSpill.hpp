@@ -0,0 +1,431 @@
+#ifndef __FLASH_SPILL_HPP__
+#define __FLASH_SPILL_HPP__
+
+#include "Crc32.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__MBED__)
+#include "mbed.h"
+#include "BlockDevice.h"
+#else
+#include "HostBlockDevice.hpp"
+#endif
+
+/*
+Spill area in internal flash for windows the micro-SD card can not take - A card that is missing, failing or behind no longer loses them.
+- A circular log over whole erase sectors of a block device - FlashIAPBlockDevice over spare sectors of the MCU's own flash on the
+  board, a RAM emulation of the flash on the host (Spill_Sim).
+- push() adds a window as an entry, a SpillEntryHeader and the data, to the sector being filled. An entry never crosses a sector.
+  When a sector is full the erased sector with the fewest erases is started next, so wear is spread evenly over the area.
+- Windows come back out oldest first - peek() finds the oldest one waiting, read() reads it back a piece at a time and drained()
+  marks it done by clearing one word of its header, so nothing has to be erased to move on.
+- Every sector starts with a SpillSectorHeader holding its erase count, which is carried across erases, and the order the sector
+  was started in. mount() rebuilds the log from them and the entry headers, so windows spilled before a reset are still there.
+  Each entry carries a CRC so one cut short by the reset is left out - The sector it was in is not written again until it is erased.
+- Erasing a sector of a single bank flash like the F401's stalls the CPU for a second or more, with interrupts held off as the code
+  and vectors are in the same flash. So nothing is erased as a side effect of push() or drained() - eraseNext() erases one spent
+  sector at a time and is only called while sampling is stopped. The area is erased ahead of a recording and only written during it.
+- Each entry is stored with a tag (the RecordFileHeader CRC), so windows left from a build with a different profile can be told apart.
+*/
+
+static const uint32_t spillSectorMagic = 0x4C495053; //"SPIL" in little endian flash
+static const uint32_t spillEntryMagic = 0x59544E45; //"ENTY"
+static const uint32_t spillErased = 0xFFFFFFFF; //A word of erased flash
+static const int spillMaxSectors = 8;
+
+struct SpillSectorHeader {
+    uint32_t magic;
+    uint32_t eraseCount; //Times the sector has been erased
+    uint32_t crc; //CRC32 of the two words above - Written as the sector is erased
+    uint32_t useSequence; //Order the sector was started in - Left erased until the first entry goes in
+};
+
+struct SpillEntryHeader {
+    uint32_t magic;
+    uint32_t tag;
+    uint32_t bytes; //Size of the data after the header
+    uint32_t dataCrc; //CRC32 of the data
+    uint32_t crc; //CRC32 of the four words above
+    uint32_t drained; //Left erased while the entry waits and cleared to 0 once it has been drained
+};
+
+static_assert(sizeof(SpillSectorHeader) == 16 && sizeof(SpillEntryHeader) == 24, "Spill headers must be whole words");
+
+class FlashSpill {
+private:
+    BlockDevice &flash;
+    Crc32SliceBy8 crc;
+    uint8_t scratch[256]; //Reading entries back while mounting
+
+    bd_size_t sectorSize = 0;
+    int sectorCount = 0;
+    bool mounted = false;
+
+    uint32_t erases[spillMaxSectors];
+    uint32_t useSequence[spillMaxSectors]; //spillErased if the sector has not been started since it was erased
+    bool ready[spillMaxSectors]; //Erased with a good header and not started - Can take entries
+    uint32_t usedEnd[spillMaxSectors]; //End of the entries in the sector
+    uint32_t pending[spillMaxSectors]; //Entries waiting to be drained
+    uint32_t readOffset[spillMaxSectors]; //No entry before this offset is waiting
+    int writeSector = -1; //Sector being filled, -1 if a new one has to be started
+    uint32_t nextUse = 0;
+
+    int peekSector = -1; //Entry found by the last peek()
+    uint32_t peekOffset = 0;
+    uint32_t peekBytes = 0;
+
+    uint32_t pushCount = 0;
+    uint32_t drainCount = 0;
+    uint32_t eraseTotal = 0;
+    uint32_t fullCount = 0;
+
+    static uint32_t entrySize(uint32_t bytes) {
+        return (sizeof(SpillEntryHeader) + bytes + 3) & ~3u;
+    }
+
+    bd_addr_t base(int sector) const {
+        return (bd_addr_t)sector * sectorSize;
+    }
+
+    //Programs size bytes - A part word at the end is padded with erased bytes so every program is whole words
+    int programWords(bd_addr_t addr, const void *data, uint32_t size) {
+        uint32_t whole = size & ~3u;
+        int err = (whole > 0) ? flash.program(data, addr, whole) : 0;
+        if (err == 0 && whole < size) {
+            uint8_t tail[4];
+            memset(tail, 0xFF, sizeof(tail));
+            memcpy(tail, (const uint8_t *)data + whole, size - whole);
+            err = flash.program(tail, addr + whole, sizeof(tail));
+        }
+        return err;
+    }
+
+    //Reads the entry at offset in sector - Returns its size in the sector, or 0 if there is no intact entry there
+    uint32_t readEntry(int sector, uint32_t offset, SpillEntryHeader &entry, bool checkData) {
+        uint32_t check;
+        if (offset + sizeof(entry) > sectorSize || flash.read(&entry, base(sector) + offset, sizeof(entry)) != 0) {
+            return 0;
+        }
+        crc.compute(&entry, offsetof(SpillEntryHeader, crc), &check);
+        if (entry.magic != spillEntryMagic || check != entry.crc || offset + entrySize(entry.bytes) > sectorSize) {
+            return 0;
+        }
+
+        if (checkData) {
+            uint32_t state = 0xFFFFFFFF;
+            for (uint32_t done = 0; done < entry.bytes;) {
+                uint32_t part = entry.bytes - done;
+                part = (part < sizeof(scratch)) ? part : sizeof(scratch);
+                if (flash.read(scratch, base(sector) + offset + sizeof(entry) + done, part) != 0) {
+                    return 0;
+                }
+                state = crc32UpdateBytewise(state, scratch, part);
+                done += part;
+            }
+            if ((state ^ 0xFFFFFFFF) != entry.dataCrc) {
+                return 0;
+            }
+        }
+        return entrySize(entry.bytes);
+    }
+
+    //Finds the entries of a started sector - They end at the first one that is not intact
+    void scanSector(int sector) {
+        SpillEntryHeader entry;
+        uint32_t offset = sizeof(SpillSectorHeader);
+        uint32_t size;
+
+        pending[sector] = 0;
+        readOffset[sector] = offset;
+        while ((size = readEntry(sector, offset, entry, true)) != 0) {
+            if (entry.drained == spillErased && pending[sector]++ == 0) {
+                readOffset[sector] = offset;
+            }
+            offset += size;
+        }
+        usedEnd[sector] = offset;
+        if (pending[sector] == 0) {
+            readOffset[sector] = offset;
+        }
+    }
+
+    //Oldest started sector with entries waiting, or -1 if nothing is waiting
+    int oldestPending() const {
+        int oldest = -1;
+        for (int s = 0; s < sectorCount; s++) {
+            if (useSequence[s] != spillErased && pending[s] > 0 && (oldest < 0 || useSequence[s] < useSequence[oldest])) {
+                oldest = s;
+            }
+        }
+        return oldest;
+    }
+
+    //Starts the erased sector with the fewest erases - Returns false if none is left
+    bool startSector() {
+        int next = -1;
+        for (int s = 0; s < sectorCount; s++) {
+            if (ready[s] && (next < 0 || erases[s] < erases[next])) {
+                next = s;
+            }
+        }
+        if (next < 0 || flash.program(&nextUse, base(next) + offsetof(SpillSectorHeader, useSequence), sizeof(nextUse)) != 0) {
+            return false;
+        }
+
+        useSequence[next] = nextUse++;
+        ready[next] = false;
+        usedEnd[next] = sizeof(SpillSectorHeader);
+        pending[next] = 0;
+        readOffset[next] = usedEnd[next];
+        writeSector = next;
+        return true;
+    }
+
+public:
+    explicit FlashSpill(BlockDevice &device) : flash(device) {}
+
+    //Finds the log left in the area - Returns 0, or an error if the device can not hold one (sectors must be the same size, at least
+    //two of them, programmable in whole words and erased to 0xFF)
+    int mount() {
+        int err = flash.init();
+        if (err != 0) {
+            return err;
+        }
+        sectorSize = flash.get_erase_size(0);
+        sectorCount = (int)(flash.size() / sectorSize);
+        sectorCount = (sectorCount < spillMaxSectors) ? sectorCount : spillMaxSectors;
+        if (sectorCount < 2 || (4 % flash.get_program_size()) != 0 || flash.get_erase_value() != 0xFF) {
+            return -1;
+        }
+
+        nextUse = 0;
+        writeSector = -1; //A sector part filled before a reset may hold a torn entry past its last good one, so it is not added to
+        peekSector = -1;
+        for (int s = 0; s < sectorCount; s++) {
+            if (flash.get_erase_size(base(s)) != sectorSize) {
+                return -1;
+            }
+
+            SpillSectorHeader header;
+            uint32_t check;
+            err = flash.read(&header, base(s), sizeof(header));
+            crc.compute(&header, offsetof(SpillSectorHeader, crc), &check);
+            pending[s] = 0;
+            usedEnd[s] = sizeof(SpillSectorHeader);
+            readOffset[s] = usedEnd[s];
+            if (err == 0 && header.magic == spillSectorMagic && check == header.crc) {
+                erases[s] = header.eraseCount;
+                useSequence[s] = header.useSequence;
+                ready[s] = (header.useSequence == spillErased);
+                if (!ready[s]) {
+                    scanSector(s);
+                    nextUse = (header.useSequence >= nextUse) ? header.useSequence + 1 : nextUse;
+                }
+            }
+            else {
+                //Never used for spilling, or the erase was cut short - Erased before it is used
+                erases[s] = 0;
+                useSequence[s] = spillErased;
+                ready[s] = false;
+            }
+        }
+        mounted = true;
+        return 0;
+    }
+
+    //Adds a window to the log - Returns 0, or -1 if there is no erased space left for it
+    int push(uint32_t tag, const void *data, uint32_t size) {
+        uint32_t need = entrySize(size);
+        if (!mounted || need > sectorSize - sizeof(SpillSectorHeader)) {
+            return -1;
+        }
+        if ((writeSector < 0 || usedEnd[writeSector] + need > sectorSize) && !startSector()) {
+            fullCount++;
+            return -1;
+        }
+
+        //Data first and the header after it, so an entry only reads back once all of it is in
+        SpillEntryHeader entry = {spillEntryMagic, tag, size, 0, 0, spillErased};
+        crc.compute(data, size, &entry.dataCrc);
+        crc.compute(&entry, offsetof(SpillEntryHeader, crc), &entry.crc);
+
+        bd_addr_t addr = base(writeSector) + usedEnd[writeSector];
+        int err = programWords(addr + sizeof(entry), data, size);
+        if (err == 0) {
+            err = flash.program(&entry, addr, sizeof(entry));
+        }
+        if (err != 0) {
+            writeSector = -1; //What was programmed can not be taken back, so the sector is finished here
+            return err;
+        }
+
+        if (pending[writeSector]++ == 0) {
+            readOffset[writeSector] = usedEnd[writeSector];
+        }
+        usedEnd[writeSector] += need;
+        pushCount++;
+        return 0;
+    }
+
+    //Finds the oldest window waiting to be drained - Returns false if there is none
+    bool peek(uint32_t &tag, uint32_t &size) {
+        int sector = oldestPending();
+        if (sector < 0) {
+            return false;
+        }
+
+        SpillEntryHeader entry;
+        uint32_t offset = readOffset[sector];
+        uint32_t entryBytes;
+        while ((entryBytes = readEntry(sector, offset, entry, false)) != 0 && entry.drained != spillErased) {
+            offset += entryBytes;
+        }
+        if (entryBytes == 0) {
+            pending[sector] = 0; //The entries counted when mounting have gone - Should not happen
+            return false;
+        }
+
+        readOffset[sector] = offset;
+        peekSector = sector;
+        peekOffset = offset;
+        peekBytes = entry.bytes;
+        tag = entry.tag;
+        size = entry.bytes;
+        return true;
+    }
+
+    //Reads part of the window found by peek()
+    int read(uint32_t offset, void *data, uint32_t size) {
+        if (peekSector < 0 || offset + size > peekBytes) {
+            return -1;
+        }
+        return flash.read(data, base(peekSector) + peekOffset + sizeof(SpillEntryHeader) + offset, size);
+    }
+
+    //Marks the window found by peek() as drained - The next peek() moves on to the one after it
+    int drained() {
+        if (peekSector < 0) {
+            return -1;
+        }
+        const uint32_t zero = 0;
+        int err = flash.program(&zero, base(peekSector) + peekOffset + offsetof(SpillEntryHeader, drained), sizeof(zero));
+        if (err == 0) {
+            pending[peekSector]--;
+            readOffset[peekSector] = peekOffset + entrySize(peekBytes);
+            drainCount++;
+        }
+        peekSector = -1;
+        return err;
+    }
+
+    //Marks every waiting window drained without reading it - For windows that can not be saved
+    int discard() {
+        uint32_t tag;
+        uint32_t size;
+        int err = 0;
+        while (err == 0 && peek(tag, size)) {
+            err = drained();
+        }
+        return err;
+    }
+
+    //Erases one sector with nothing waiting in it that is not already erased - Returns 1 if a sector was erased, 0 if there are none
+    //left or an error. Stalls a single bank flash for the whole erase, so only called while sampling is stopped
+    int eraseNext() {
+        int spent = -1;
+        for (int s = 0; s < sectorCount; s++) {
+            if (!ready[s] && pending[s] == 0 && (spent < 0 || erases[s] < erases[spent])) {
+                spent = s;
+            }
+        }
+        if (!mounted || spent < 0) {
+            return 0;
+        }
+        if (spent == writeSector) {
+            writeSector = -1;
+        }
+
+        //The erase count is written straight after the erase, with the use sequence left erased until the sector is started
+        SpillSectorHeader header = {spillSectorMagic, erases[spent] + 1, 0, spillErased};
+        crc.compute(&header, offsetof(SpillSectorHeader, crc), &header.crc);
+        int err = flash.erase(base(spent), sectorSize);
+        if (err == 0) {
+            err = flash.program(&header, base(spent), offsetof(SpillSectorHeader, useSequence));
+        }
+        if (err != 0) {
+            return err;
+        }
+
+        erases[spent] = header.eraseCount;
+        useSequence[spent] = spillErased;
+        ready[spent] = true;
+        usedEnd[spent] = sizeof(SpillSectorHeader);
+        readOffset[spent] = usedEnd[spent];
+        eraseTotal++;
+        return 1;
+    }
+
+    bool empty() const {
+        return oldestPending() < 0;
+    }
+
+    //Windows waiting to be drained
+    uint32_t waiting() const {
+        uint32_t count = 0;
+        for (int s = 0; s < sectorCount; s++) {
+            count += pending[s];
+        }
+        return count;
+    }
+
+    //Erased space left for new windows, in bytes
+    uint32_t freeBytes() const {
+        uint32_t space = (writeSector >= 0) ? (uint32_t)(sectorSize - usedEnd[writeSector]) : 0;
+        for (int s = 0; s < sectorCount; s++) {
+            space += ready[s] ? (uint32_t)(sectorSize - sizeof(SpillSectorHeader)) : 0;
+        }
+        return space;
+    }
+
+    int sectors() const {
+        return sectorCount;
+    }
+
+    //Fewest and most times any sector of the area has been erased - A spread of more than one means wear is not being levelled
+    uint32_t minErases() const {
+        uint32_t least = erases[0];
+        for (int s = 1; s < sectorCount; s++) {
+            least = (erases[s] < least) ? erases[s] : least;
+        }
+        return least;
+    }
+
+    uint32_t maxErases() const {
+        uint32_t most = erases[0];
+        for (int s = 1; s < sectorCount; s++) {
+            most = (erases[s] > most) ? erases[s] : most;
+        }
+        return most;
+    }
+
+    uint32_t windowsSpilled() const {
+        return pushCount;
+    }
+
+    uint32_t windowsDrained() const {
+        return drainCount;
+    }
+
+    uint32_t sectorsErased() const {
+        return eraseTotal;
+    }
+
+    //Windows turned away because no erased space was left
+    uint32_t timesFull() const {
+        return fullCount;
+    }
+};
+
+#endif
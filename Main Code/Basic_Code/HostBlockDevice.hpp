@@ -0,0 +1,48 @@
+#ifndef __HOST_BLOCK_DEVICE_HPP__
+#define __HOST_BLOCK_DEVICE_HPP__
+
+#include <cstdint>
+
+/*
+Stand in for mbed::BlockDevice when not built for Mbed.
+- Only the parts the storage classes use - Lets WriteBehindBlockDevice.hpp, FlashSpill.hpp and StorageSession.hpp (through
+  HostFileSystem.hpp) run against simulated devices on the host (Write_Behind_Sim, Spill_Sim, Storage_Benchmark).
+*/
+
+#if !defined(__MBED__)
+typedef uint64_t bd_addr_t;
+typedef uint64_t bd_size_t;
+
+class BlockDevice {
+public:
+    virtual ~BlockDevice() {}
+    virtual int init() = 0;
+    virtual int deinit() = 0;
+    virtual int read(void *buffer, bd_addr_t addr, bd_size_t size) = 0;
+    virtual int program(const void *buffer, bd_addr_t addr, bd_size_t size) = 0;
+    virtual int erase(bd_addr_t /*addr*/, bd_size_t /*size*/) {
+        return 0;
+    }
+    virtual int trim(bd_addr_t /*addr*/, bd_size_t /*size*/) {
+        return 0;
+    }
+    virtual int sync() {
+        return 0;
+    }
+    virtual bd_size_t get_read_size() const = 0;
+    virtual bd_size_t get_program_size() const = 0;
+    virtual bd_size_t get_erase_size() const {
+        return get_program_size();
+    }
+    virtual bd_size_t get_erase_size(bd_addr_t /*addr*/) const {
+        return get_erase_size();
+    }
+    virtual int get_erase_value() const {
+        return -1;
+    }
+    virtual bd_size_t size() const = 0;
+    virtual const char *get_type() const = 0;
+};
+#endif
+
+#endif
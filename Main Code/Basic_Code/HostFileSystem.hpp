@@ -0,0 +1,494 @@
+#ifndef __HOST_FILE_SYSTEM_HPP__
+#define __HOST_FILE_SYSTEM_HPP__
+
+#include "HostBlockDevice.hpp"
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+/*
+Stand in for mbed's FATFileSystem and File when not built for Mbed.
+- Only the parts StorageSession.hpp uses - Lets the session run against a file backed block device on the host (Storage_Benchmark).
+- The layout is a much simplified FAT on 512 byte sectors - A boot sector, a table of cluster links, one directory sector and then
+  the clusters. There are no long names, subdirectories or second table copy.
+- The block device sees the same kind of traffic FatFs gives it - mount() reads the boot sector, the table and the directory go
+  through one shared sector window, file data goes through a one sector buffer with whole sectors written straight through, and
+  sync() writes the buffer, the window and the directory entry.
+- Clusters added to a file keep whatever the device held before, as they do with FatFs.
+*/
+
+#if !defined(__MBED__)
+//Microsecond ticker the session times its windows with
+inline uint32_t us_ticker_read() {
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+class File;
+
+class FileSystem {
+    friend class File;
+
+protected:
+    static const uint32_t sectorBytes = 512;
+    static const uint32_t fsMagic = 0x53464648; //"HFFS"
+    static const uint32_t linkFree = 0;
+    static const uint32_t linkEnd = 0xFFFFFFFF;
+    static const uint32_t nameLength = 24;
+    static const uint32_t entries = sectorBytes / 32;
+
+    struct Boot {
+        uint32_t magic;
+        uint32_t clusterSectors;
+        uint32_t clusters; //Numbered from 1, so 0 can mark a file with none
+        uint32_t tableStart;
+        uint32_t tableSectors;
+        uint32_t directoryStart;
+        uint32_t dataStart;
+    };
+
+    struct Entry {
+        char name[nameLength];
+        uint32_t firstCluster;
+        uint32_t size;
+    };
+
+    BlockDevice *device = nullptr;
+    Boot boot = {};
+    uint8_t window[sectorBytes];
+    uint32_t windowSector = linkEnd;
+    bool windowDirty = false;
+    uint32_t lastAllocated = 0;
+
+    int readSector(uint32_t sector, void *data, uint32_t count = 1) {
+        return device->read(data, (bd_addr_t)sector * sectorBytes, (bd_size_t)count * sectorBytes);
+    }
+
+    int writeSector(uint32_t sector, const void *data, uint32_t count = 1) {
+        return device->program(data, (bd_addr_t)sector * sectorBytes, (bd_size_t)count * sectorBytes);
+    }
+
+    int syncWindow() {
+        if (!windowDirty) {
+            return 0;
+        }
+        int err = writeSector(windowSector, window);
+        windowDirty = (err != 0);
+        return err;
+    }
+
+    //Brings a table or directory sector into the window, writing back the one there if it was changed
+    int moveWindow(uint32_t sector) {
+        if (sector == windowSector) {
+            return 0;
+        }
+        int err = syncWindow();
+        if (err == 0 && (err = readSector(sector, window)) == 0) {
+            windowSector = sector;
+        }
+        return err;
+    }
+
+    int link(uint32_t cluster, uint32_t &next) {
+        int err = moveWindow(boot.tableStart + (cluster / (sectorBytes / 4)));
+        if (err == 0) {
+            memcpy(&next, &window[(cluster % (sectorBytes / 4)) * 4], 4);
+        }
+        return err;
+    }
+
+    int setLink(uint32_t cluster, uint32_t next) {
+        int err = moveWindow(boot.tableStart + (cluster / (sectorBytes / 4)));
+        if (err == 0) {
+            memcpy(&window[(cluster % (sectorBytes / 4)) * 4], &next, 4);
+            windowDirty = true;
+        }
+        return err;
+    }
+
+    //Finds a free cluster after the last one handed out and links it on after previous (0 for a new chain) - 0 if the device is full
+    uint32_t allocate(uint32_t previous) {
+        for (uint32_t i = 1; i <= boot.clusters; i++) {
+            uint32_t cluster = ((lastAllocated + i - 1) % boot.clusters) + 1;
+            uint32_t next;
+            if (link(cluster, next) != 0) {
+                return 0;
+            }
+            if (next == linkFree) {
+                if (setLink(cluster, linkEnd) != 0 || (previous != 0 && setLink(previous, cluster) != 0)) {
+                    return 0;
+                }
+                lastAllocated = cluster;
+                return cluster;
+            }
+        }
+        return 0;
+    }
+
+    int freeChain(uint32_t cluster) {
+        while (cluster != 0 && cluster != linkEnd) {
+            uint32_t next;
+            int err = link(cluster, next);
+            if (err == 0) {
+                err = setLink(cluster, linkFree);
+            }
+            if (err != 0) {
+                return err;
+            }
+            cluster = next;
+        }
+        return 0;
+    }
+
+    //Slot of the file in the directory, or -1 if it is not there
+    int findEntry(const char *path, Entry &entry) {
+        if (moveWindow(boot.directoryStart) != 0) {
+            return -1;
+        }
+        for (uint32_t slot = 0; slot < entries; slot++) {
+            memcpy(&entry, &window[slot * sizeof(Entry)], sizeof(Entry));
+            if (entry.name[0] != 0 && strncmp(entry.name, path, nameLength) == 0) {
+                return (int)slot;
+            }
+        }
+        return -1;
+    }
+
+    int createEntry(const char *path, Entry &entry) {
+        if (strlen(path) >= nameLength || moveWindow(boot.directoryStart) != 0) {
+            return -1;
+        }
+        for (uint32_t slot = 0; slot < entries; slot++) {
+            if (window[slot * sizeof(Entry)] == 0) {
+                memset(&entry, 0, sizeof(entry));
+                strncpy(entry.name, path, nameLength - 1);
+                memcpy(&window[slot * sizeof(Entry)], &entry, sizeof(Entry));
+                windowDirty = true;
+                return (int)slot;
+            }
+        }
+        return -1;
+    }
+
+    int writeEntry(int slot, const Entry &entry) {
+        int err = moveWindow(boot.directoryStart);
+        if (err == 0) {
+            memcpy(&window[slot * sizeof(Entry)], &entry, sizeof(Entry));
+            windowDirty = true;
+        }
+        return err;
+    }
+
+    uint32_t clusterBytes() const {
+        return boot.clusterSectors * sectorBytes;
+    }
+
+    uint32_t firstSector(uint32_t cluster) const {
+        return boot.dataStart + ((cluster - 1) * boot.clusterSectors);
+    }
+
+public:
+    explicit FileSystem(const char *) {}
+
+    virtual ~FileSystem() {}
+
+    int mount(BlockDevice *bd) {
+        device = bd;
+        windowSector = linkEnd;
+        windowDirty = false;
+        uint8_t sector[sectorBytes];
+        int err = readSector(0, sector);
+        if (err == 0) {
+            memcpy(&boot, sector, sizeof(boot));
+            err = (boot.magic == fsMagic) ? 0 : -EINVAL;
+        }
+        if (err != 0) {
+            device = nullptr;
+        }
+        return err;
+    }
+
+    int unmount() {
+        int err = (device != nullptr) ? syncWindow() : 0;
+        device = nullptr;
+        return err;
+    }
+
+    int stat(const char *path, struct stat *st) {
+        Entry entry;
+        if (device == nullptr || findEntry(path, entry) < 0) {
+            return -ENOENT;
+        }
+        memset(st, 0, sizeof(*st));
+        st->st_size = entry.size;
+        return 0;
+    }
+};
+
+class FATFileSystem : public FileSystem {
+public:
+    explicit FATFileSystem(const char *name) : FileSystem(name) {}
+
+    //Lays out an empty file system with 32KB clusters, as SD cards come formatted
+    static int format(BlockDevice *bd, bd_size_t clusterSize = 32768) {
+        Boot boot = {};
+        boot.magic = fsMagic;
+        boot.clusterSectors = (uint32_t)(clusterSize / sectorBytes);
+        uint32_t sectors = (uint32_t)(bd->size() / sectorBytes);
+        boot.tableStart = 1;
+        boot.tableSectors = ((sectors / boot.clusterSectors) + (sectorBytes / 4)) / (sectorBytes / 4);
+        boot.directoryStart = boot.tableStart + boot.tableSectors;
+        boot.dataStart = boot.directoryStart + 1;
+        boot.clusters = (sectors - boot.dataStart) / boot.clusterSectors;
+
+        uint8_t sector[sectorBytes] = {};
+        int err = 0;
+        for (uint32_t s = boot.tableStart; err == 0 && s <= boot.directoryStart; s++) {
+            err = bd->program(sector, (bd_addr_t)s * sectorBytes, sectorBytes);
+        }
+        memcpy(sector, &boot, sizeof(boot));
+        return (err == 0) ? bd->program(sector, 0, sectorBytes) : err;
+    }
+};
+
+class File {
+private:
+    FileSystem *fs = nullptr;
+    FileSystem::Entry entry = {};
+    int slot = -1;
+    bool entryChanged = false;
+    off_t position = 0;
+
+    uint8_t buffer[FileSystem::sectorBytes];
+    uint32_t bufferSector = FileSystem::linkEnd;
+    bool bufferDirty = false;
+
+    uint32_t cluster = 0; //Cluster holding clusterIndex, so sequential access does not walk the chain every time
+    uint32_t clusterIndex = 0;
+
+    int flushBuffer() {
+        if (!bufferDirty) {
+            return 0;
+        }
+        int err = fs->writeSector(bufferSector, buffer);
+        bufferDirty = (err != 0);
+        return err;
+    }
+
+    //Cluster holding the index'th cluster of the file - Clusters are added to the end of the chain if grow is set, otherwise 0 past the end
+    uint32_t clusterAt(uint32_t index, bool grow) {
+        if (cluster == 0 || clusterIndex > index) {
+            if (entry.firstCluster == 0) {
+                if (!grow || (entry.firstCluster = fs->allocate(0)) == 0) {
+                    return 0;
+                }
+                entryChanged = true;
+            }
+            cluster = entry.firstCluster;
+            clusterIndex = 0;
+        }
+        while (clusterIndex < index) {
+            uint32_t next;
+            if (fs->link(cluster, next) != 0) {
+                return 0;
+            }
+            if (next == FileSystem::linkEnd) {
+                if (!grow || (next = fs->allocate(cluster)) == 0) {
+                    return 0;
+                }
+            }
+            cluster = next;
+            clusterIndex++;
+        }
+        return cluster;
+    }
+
+    //Sector holding the byte at offset
+    uint32_t sectorAt(off_t offset, bool grow) {
+        uint32_t c = clusterAt((uint32_t)(offset / fs->clusterBytes()), grow);
+        if (c == 0) {
+            return 0;
+        }
+        return fs->firstSector(c) + (uint32_t)((offset % fs->clusterBytes()) / FileSystem::sectorBytes);
+    }
+
+    //Brings a sector of the file into the buffer - It is only read if it already holds part of the file
+    int loadBuffer(uint32_t sector, off_t sectorStart) {
+        if (sector == bufferSector) {
+            return 0;
+        }
+        int err = flushBuffer();
+        if (err == 0 && sectorStart < (off_t)entry.size) {
+            err = fs->readSector(sector, buffer);
+        }
+        bufferSector = (err == 0) ? sector : FileSystem::linkEnd;
+        return err;
+    }
+
+public:
+    int open(FileSystem *fileSystem, const char *path, int flags = O_RDONLY) {
+        fs = fileSystem;
+        slot = fs->findEntry(path, entry);
+        if (slot < 0 && (flags & O_CREAT) != 0) {
+            slot = fs->createEntry(path, entry);
+        }
+        if (slot < 0) {
+            fs = nullptr;
+            return -ENOENT;
+        }
+        if ((flags & O_TRUNC) != 0 && entry.firstCluster != 0) {
+            if (fs->freeChain(entry.firstCluster) != 0) {
+                fs = nullptr;
+                return -EIO;
+            }
+            entry.firstCluster = 0;
+            entry.size = 0;
+            entryChanged = true;
+        }
+        position = 0;
+        cluster = 0;
+        bufferSector = FileSystem::linkEnd;
+        bufferDirty = false;
+        return 0;
+    }
+
+    int close() {
+        int err = sync();
+        fs = nullptr;
+        return err;
+    }
+
+    off_t size() {
+        return entry.size;
+    }
+
+    off_t seek(off_t offset, int whence = SEEK_SET) {
+        off_t base = (whence == SEEK_END) ? (off_t)entry.size : (whence == SEEK_CUR) ? position : 0;
+        if (base + offset < 0) {
+            return -EINVAL;
+        }
+        position = base + offset;
+        return position;
+    }
+
+    ssize_t read(void *data, size_t size) {
+        uint8_t *out = (uint8_t *)data;
+        size_t done = 0;
+        while (done < size && position < (off_t)entry.size) {
+            uint32_t sector = sectorAt(position, false);
+            if (sector == 0 || loadBuffer(sector, position - (position % FileSystem::sectorBytes)) != 0) {
+                return -EIO;
+            }
+            size_t offset = position % FileSystem::sectorBytes;
+            size_t n = FileSystem::sectorBytes - offset;
+            n = (n < size - done) ? n : size - done;
+            n = (n < (size_t)(entry.size - position)) ? n : (size_t)(entry.size - position);
+            memcpy(out + done, buffer + offset, n);
+            done += n;
+            position += n;
+        }
+        return (ssize_t)done;
+    }
+
+    ssize_t write(const void *data, size_t size) {
+        const uint8_t *in = (const uint8_t *)data;
+        size_t done = 0;
+        while (done < size) {
+            uint32_t sector = sectorAt(position, true);
+            if (sector == 0) {
+                return (done > 0) ? (ssize_t)done : -ENOSPC;
+            }
+            size_t offset = position % FileSystem::sectorBytes;
+            int err;
+            size_t n;
+            if (offset == 0 && size - done >= FileSystem::sectorBytes) {
+                //Whole sectors go straight to the device, as many as are left in the cluster
+                uint32_t inCluster = fs->boot.clusterSectors - ((uint32_t)(position % fs->clusterBytes()) / FileSystem::sectorBytes);
+                uint32_t count = (uint32_t)((size - done) / FileSystem::sectorBytes);
+                count = (count < inCluster) ? count : inCluster;
+                if (bufferSector >= sector && bufferSector < sector + count) {
+                    bufferSector = FileSystem::linkEnd;
+                    bufferDirty = false;
+                }
+                n = count * FileSystem::sectorBytes;
+                err = fs->writeSector(sector, in + done, count);
+            }
+            else {
+                n = FileSystem::sectorBytes - offset;
+                n = (n < size - done) ? n : size - done;
+                err = loadBuffer(sector, position - offset);
+                if (err == 0) {
+                    memcpy(buffer + offset, in + done, n);
+                    bufferDirty = true;
+                }
+            }
+            if (err != 0) {
+                return (done > 0) ? (ssize_t)done : err;
+            }
+            done += n;
+            position += n;
+            if (position > (off_t)entry.size) {
+                entry.size = (uint32_t)position;
+            }
+            entryChanged = true;
+        }
+        return (ssize_t)done;
+    }
+
+    //Grows or shrinks the file to length - Clusters added keep whatever the device held
+    int truncate(off_t length) {
+        if (length > (off_t)entry.size) {
+            if (sectorAt(length - 1, true) == 0) {
+                return -ENOSPC;
+            }
+        }
+        else {
+            uint32_t keep = (uint32_t)((length + fs->clusterBytes() - 1) / fs->clusterBytes());
+            int err;
+            if (keep == 0) {
+                err = fs->freeChain(entry.firstCluster);
+                entry.firstCluster = 0;
+            }
+            else {
+                uint32_t last = clusterAt(keep - 1, false);
+                uint32_t next = 0;
+                err = (last == 0) ? -EIO : fs->link(last, next);
+                if (err == 0 && next != FileSystem::linkEnd) {
+                    err = fs->setLink(last, FileSystem::linkEnd);
+                    if (err == 0) {
+                        err = fs->freeChain(next);
+                    }
+                }
+            }
+            if (err != 0) {
+                return err;
+            }
+            cluster = 0;
+        }
+        entry.size = (uint32_t)length;
+        entryChanged = true;
+        return 0;
+    }
+
+    int sync() {
+        if (fs == nullptr) {
+            return 0;
+        }
+        int err = flushBuffer();
+        if (err == 0 && entryChanged && (err = fs->writeEntry(slot, entry)) == 0) {
+            entryChanged = false;
+        }
+        if (err == 0) {
+            err = fs->syncWindow();
+        }
+        return (err == 0) ? fs->device->sync() : err;
+    }
+};
+#endif
+
+#endif
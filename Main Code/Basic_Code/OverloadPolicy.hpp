@@ -0,0 +1,126 @@
+#ifndef __OVERLOAD_POLICY_HPP__
+#define __OVERLOAD_POLICY_HPP__
+
+#include <cstdint>
+
+/*
+Overload policy - What the recorder does when the micro-SD card falls behind, rather than calling the error handler and resetting.
+- A slow write is first soaked up by buffering - The spare window buffers (BufferPool.hpp) and then the sample ring. While the ring
+  has more than headroom samples of space the consumer leaves samples on it and waits for a window buffer to come free.
+- Once the ring is down to headroom samples of space a window that has no buffer is dropped whole - Its samples are taken off the ring
+  and thrown away, so the ring never overflows and the realtime thread never waits. Samples lost before reaching the consumer drop the
+  window they fall in too, so every window that is written is complete.
+- Sequence numbers are never reused, so a dropped window shows as a gap in the first sample numbers of the windows written (window
+  headers and session index) - Record_Decoder reports it as a gap.
+- A write that fails even after remounting the card, or a lock timeout, loses only the window being written. maxFailedWrites of them
+  in a row means the card has gone, and the error handler is called as before.
+- With overloadReset every one of these calls the error handler as older builds did.
+- Decisions are counted here and logged by the caller. Each counter is only changed by one thread - The realtime thread, the consumer
+  or the writer - so no lock is needed and a reader sees each one whole.
+- Plain C++ with no Mbed dependency so Overload_Sim can drive it against slow storage on the host.
+*/
+
+enum OverloadMode : uint32_t {
+    overloadReset = 0, //Any overload calls the error handler
+    overloadDrop = 1 //Buffer, then drop whole windows and carry on
+};
+
+enum WindowDecision {
+    windowWait, //Leave the samples on the ring until a window buffer is free
+    windowDrop //Throw the window away
+};
+
+class OverloadPolicy {
+private:
+    OverloadMode mode;
+    uint32_t headroom;
+    uint32_t maxFailures;
+
+    uint32_t waitCount = 0; //Consumer
+    uint32_t droppedCount = 0; //Consumer
+    uint32_t lostCount = 0; //Consumer
+    uint32_t missedCount = 0; //Realtime thread
+    uint32_t failedCount = 0; //Writer
+    uint32_t timeoutCount = 0; //Writer
+    uint32_t failureRun = 0; //Writer
+
+    bool failed() {
+        return mode == overloadDrop && ++failureRun < maxFailures;
+    }
+
+public:
+    //headroomSamples is the space the ring keeps for the realtime thread, normally a couple of DMA blocks
+    OverloadPolicy(OverloadMode overloadMode, uint32_t headroomSamples, uint32_t maxFailedWrites)
+        : mode(overloadMode), headroom(headroomSamples), maxFailures(maxFailedWrites) {}
+
+    bool dropsWindows() const {
+        return mode == overloadDrop;
+    }
+
+    //Consumer side - A window is due to start but every window buffer is waiting to be written. ringSpace is the free space on the ring
+    WindowDecision noBuffer(uint32_t ringSpace) {
+        if (mode == overloadReset || ringSpace > headroom) {
+            waitCount++;
+            return windowWait;
+        }
+        return windowDrop;
+    }
+
+    //Consumer side - A window was thrown away
+    void windowDropped() {
+        droppedCount++;
+    }
+
+    //Consumer side - Samples that never reached the consumer
+    void addLostSamples(uint32_t samples) {
+        lostCount += samples;
+    }
+
+    //Realtime side - The consumer could not be queued for a block. The next block queues it again and it takes whatever is waiting
+    void wakeupMissed() {
+        missedCount++;
+    }
+
+    //Writer side - A window could not be written. Returns true if the recording carries on without it
+    bool writeFailed() {
+        failedCount++;
+        return failed();
+    }
+
+    //Writer side - The card lock could not be taken in time. Returns true if the recording carries on without the window
+    bool lockTimedOut() {
+        timeoutCount++;
+        return failed();
+    }
+
+    //Writer side - A window was written, so the run of failures is over
+    void writeSucceeded() {
+        failureRun = 0;
+    }
+
+    uint32_t waits() const {
+        return waitCount;
+    }
+
+    uint32_t windowsDropped() const {
+        return droppedCount;
+    }
+
+    uint32_t samplesLost() const {
+        return lostCount;
+    }
+
+    uint32_t wakeupsMissed() const {
+        return missedCount;
+    }
+
+    uint32_t writesFailed() const {
+        return failedCount;
+    }
+
+    uint32_t lockTimeouts() const {
+        return timeoutCount;
+    }
+};
+
+#endif
@@ -0,0 +1,323 @@
+#ifndef __RAW_BLOCK_LOG_HPP__
+#define __RAW_BLOCK_LOG_HPP__
+
+#include "RecordFormat.hpp"
+#include "Crc32.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__MBED__)
+#include "mbed.h"
+#endif
+
+/*
+Raw block device log - Windows are written straight to a reserved region of the card with no file system in the way.
+- The region is split into 512 byte blocks. Blocks 0 and 1 hold two copies of the superblock, written alternately so one is always
+  intact. The superblock holds the start block of every recording session - the only index there is.
+- A session starts with one block holding its RecordFileHeader, followed by its windows. Each window is the RecordWindowHeader
+  and payload used by the results file, padded to a whole number of blocks, so every write starts on a block boundary and is
+  one multi-block write plus at most one padded tail block.
+- Nothing else is written while sampling - The superblock is only written when a session starts, so the hot path has no cluster
+  allocation, FAT update or directory entry to write.
+- The end of the last session is found at open() by walking its window headers, which works even if the board was reset mid-session.
+  The region is erased when the log is first created so old data on the card is never mistaken for windows.
+- Before anything is read or erased the region is checked against block 0 of the card - It must not cover the partition table or
+  any partition listed in it, and a card formatted with no partition table is one file system from end to end so no region on it
+  is allowed. open() returns rawLogRegionInUse instead of formatting over a file system.
+- discard() takes the session just opened back out of the index, so a benchmark does not use up one of the sessions.
+- Record_Decoder --raw reads the log back from an image of the card (or the region) and exports a session as CSV - Only the layout
+  above the class is needed for that, so the class itself is only built for Mbed.
+*/
+
+static const uint32_t rawLogMagic = 0x474F4C52; //"RLOG" in a little endian file
+static const uint16_t rawLogVersion = 1;
+static const uint32_t rawLogBlockSize = 512;
+static const int rawLogMaxSessions = 32;
+static const int rawLogRegionInUse = -2; //open() error - The region overlaps the partition table or a partition
+
+struct RawLogSuperblock {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t blockSize;
+    uint32_t generation; //Incremented every write - The copy with the highest generation and a good CRC is current
+    uint32_t regionBlocks;
+    uint32_t sessionCount;
+    uint32_t sessionStart[rawLogMaxSessions]; //First block (the session header) of each session
+    uint32_t crc; //CRC32 of everything above
+};
+
+static_assert(sizeof(RawLogSuperblock) <= rawLogBlockSize, "Superblock must fit in one block");
+static_assert(sizeof(RecordFileHeader) <= rawLogBlockSize, "Session header must fit in one block");
+
+//Blocks used by a window of the given payload size - headerBytes depends on the version of the session (recordWindowHeaderBytes())
+inline uint32_t rawLogWindowBlocks(uint32_t payloadBytes, uint32_t headerBytes = sizeof(RecordWindowHeader)) {
+    return (headerBytes + payloadBytes + rawLogBlockSize - 1) / rawLogBlockSize;
+}
+
+#if defined(__MBED__)
+class RawBlockLog {
+private:
+    BlockDevice &device;
+    BlockDevice &card; //The whole card the region is part of - Only read, to check the region is clear of its file systems
+    bd_addr_t regionStart; //Byte offset of the region on the card
+    Crc32SliceBy8 crc; //Software CRC so the log never waits on the hardware CRC unit used by the sampling threads
+    RawLogSuperblock super;
+    uint8_t block[rawLogBlockSize]; //Scratch block for headers and padded window tails
+
+    bool opened = false;
+    uint32_t nextBlock = 0; //Where the next window goes
+
+    uint32_t windowCount = 0;
+    uint32_t lastUs = 0;
+    uint32_t worstUs = 0;
+    uint64_t totalUs = 0;
+
+    int readBlock(uint32_t number) {
+        return device.read(block, (bd_addr_t)number * rawLogBlockSize, rawLogBlockSize);
+    }
+
+    int writeSuperblock() {
+        super.generation++;
+        crc.compute(&super, offsetof(RawLogSuperblock, crc), &super.crc);
+
+        memset(block, 0, sizeof(block));
+        memcpy(block, &super, sizeof(super));
+        return device.program(block, (bd_addr_t)(super.generation & 1) * rawLogBlockSize, rawLogBlockSize);
+    }
+
+    //Loads the newest good superblock - Returns false if neither copy is valid
+    bool loadSuperblock() {
+        bool found = false;
+        for (uint32_t copy = 0; copy < 2; copy++) {
+            RawLogSuperblock candidate;
+            uint32_t check;
+            if (readBlock(copy) != 0) {
+                continue;
+            }
+            memcpy(&candidate, block, sizeof(candidate));
+            crc.compute(&candidate, offsetof(RawLogSuperblock, crc), &check);
+            if (candidate.magic == rawLogMagic && candidate.version == rawLogVersion && check == candidate.crc &&
+                candidate.blockSize == rawLogBlockSize && (!found || candidate.generation > super.generation)) {
+                super = candidate;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    //Checks the region against the card's partition table in block 0 - The card must already be initialised
+    bool regionClear() {
+        if (regionStart < rawLogBlockSize || card.read(block, 0, rawLogBlockSize) != 0) {
+            return false;
+        }
+        if (block[510] != 0x55 || block[511] != 0xAA) {
+            return true; //No partition table or boot sector - A blank card
+        }
+        if (block[0] == 0xEB || block[0] == 0xE9) {
+            return false; //A FAT boot sector in block 0 - The file system covers the whole card
+        }
+
+        bd_addr_t regionEnd = regionStart + device.size();
+        for (int p = 0; p < 4; p++) {
+            const uint8_t *entry = block + 446 + (p * 16);
+            uint32_t first;
+            uint32_t count;
+            memcpy(&first, entry + 8, sizeof(first));
+            memcpy(&count, entry + 12, sizeof(count));
+            bd_addr_t partitionStart = (bd_addr_t)first * 512;
+            bd_addr_t partitionEnd = partitionStart + ((bd_addr_t)count * 512);
+            if (entry[4] != 0 && count != 0 && regionStart < partitionEnd && partitionStart < regionEnd) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //Creates an empty log covering the whole region
+    int format(uint32_t regionBlocks) {
+        int err = device.erase(0, (bd_size_t)regionBlocks * rawLogBlockSize);
+        if (err != 0) {
+            return err;
+        }
+        memset(&super, 0, sizeof(super));
+        super.magic = rawLogMagic;
+        super.version = rawLogVersion;
+        super.blockSize = rawLogBlockSize;
+        super.regionBlocks = regionBlocks;
+
+        //Both copies are written so a stale superblock from an older log can never win
+        err = writeSuperblock();
+        return (err == 0) ? writeSuperblock() : err;
+    }
+
+    //Walks the windows of the session starting at start and returns the first block after them
+    //The session may have been written by an older build, so its window headers are read in the layout of its own version
+    uint32_t findSessionEnd(uint32_t start) {
+        uint32_t position = start + 1;
+        uint32_t expected = 0;
+        bool first = true;
+
+        RecordFileHeader session = {};
+        uint32_t magic = 0;
+        session.version = recordVersion;
+        if (readBlock(start) == 0) {
+            memcpy(&magic, block, sizeof(magic));
+        }
+        if (magic == recordFileMagic) {
+            recordLoadFileHeader(block, session);
+        }
+
+        //Windows of an older log left past the end of the session belong to another recording
+        while (position < super.regionBlocks && readBlock(position) == 0) {
+            RecordWindowHeader window;
+            uint32_t check;
+            crc.compute(block, recordLoadWindowHeader(block, session.version, window), &check);
+            if (window.magic != recordWindowMagic || check != window.crc || !recordWindowBelongs(session, window) ||
+                (!first && window.firstSequence < expected)) {
+                break;
+            }
+            expected = window.firstSequence + window.sampleCount;
+            first = false;
+            position += rawLogWindowBlocks(window.payloadBytes, recordWindowHeaderBytes(session.version));
+        }
+        return (position < super.regionBlocks) ? position : super.regionBlocks;
+    }
+
+public:
+    //blockDevice is the region itself, start bytes into wholeCard, e.g. a SlicingBlockDevice over the card
+    RawBlockLog(BlockDevice &blockDevice, BlockDevice &wholeCard, bd_addr_t start) : device(blockDevice), card(wholeCard), regionStart(start) {}
+
+    //Starts a new session described by profile after any sessions already on the card - The log is created if the region does not hold one
+    int open(const RecordFileHeader &profile) {
+        int err = device.init();
+        if (err != 0) {
+            return err;
+        }
+        if (device.get_program_size() > rawLogBlockSize || (rawLogBlockSize % device.get_program_size()) != 0) {
+            device.deinit();
+            return -1;
+        }
+        if (!regionClear()) {
+            device.deinit();
+            return rawLogRegionInUse;
+        }
+
+        uint32_t regionBlocks = device.size() / rawLogBlockSize;
+        if (!loadSuperblock() || super.regionBlocks != regionBlocks) {
+            if ((err = format(regionBlocks)) != 0) {
+                device.deinit();
+                return err;
+            }
+        }
+
+        uint32_t start = (super.sessionCount == 0) ? 2 : findSessionEnd(super.sessionStart[super.sessionCount - 1]);
+        if (super.sessionCount >= (uint32_t)rawLogMaxSessions || start + 1 >= super.regionBlocks) {
+            device.deinit();
+            return -1; //Index or region full - The card has to be read off and the log cleared
+        }
+
+        //Session header first, then the superblock that points at it
+        memset(block, 0, sizeof(block));
+        memcpy(block, &profile, sizeof(profile));
+        err = device.program(block, (bd_addr_t)start * rawLogBlockSize, rawLogBlockSize);
+        if (err == 0) {
+            super.sessionStart[super.sessionCount++] = start;
+            err = writeSuperblock();
+        }
+        if (err != 0) {
+            device.deinit();
+            return err;
+        }
+
+        nextBlock = start + 1;
+        opened = true;
+        return 0;
+    }
+
+    //Writes one window - record points at a RecordWindowHeader directly followed in memory by size - sizeof(RecordWindowHeader) bytes of payload
+    int writeWindow(const void *record, size_t size) {
+        uint32_t startUs = us_ticker_read();
+        uint32_t fullBlocks = size / rawLogBlockSize;
+        uint32_t tail = size % rawLogBlockSize;
+        uint32_t blocks = fullBlocks + ((tail > 0) ? 1 : 0);
+
+        if (!opened || nextBlock + blocks > super.regionBlocks) {
+            return -1;
+        }
+
+        //Whole blocks go straight from the window buffer in one multi-block write, the remainder is padded out in the scratch block
+        int err = 0;
+        if (fullBlocks > 0) {
+            err = device.program(record, (bd_addr_t)nextBlock * rawLogBlockSize, (bd_size_t)fullBlocks * rawLogBlockSize);
+        }
+        if (err == 0 && tail > 0) {
+            memset(block, 0, sizeof(block));
+            memcpy(block, (const uint8_t *)record + (fullBlocks * rawLogBlockSize), tail);
+            err = device.program(block, (bd_addr_t)(nextBlock + fullBlocks) * rawLogBlockSize, rawLogBlockSize);
+        }
+        if (err == 0) {
+            nextBlock += blocks;
+        }
+
+        lastUs = us_ticker_read() - startUs;
+        if (lastUs > worstUs) {
+            worstUs = lastUs;
+        }
+        totalUs += lastUs;
+        windowCount++;
+        return err;
+    }
+
+    int close() {
+        if (!opened) {
+            return 0;
+        }
+        opened = false;
+        int err = device.sync();
+        device.deinit();
+        return err;
+    }
+
+    //Closes the session and takes it back out of the index - The next session starts where this one did and writes over it
+    int discard() {
+        if (!opened) {
+            return 0;
+        }
+        super.sessionCount--;
+        int err = writeSuperblock();
+        int closeErr = close();
+        return (err != 0) ? err : closeErr;
+    }
+
+    uint32_t freeBlocks() const {
+        return opened ? (super.regionBlocks - nextBlock) : 0;
+    }
+
+    uint32_t sessions() const {
+        return super.sessionCount;
+    }
+
+    uint32_t lastWriteUs() const {
+        return lastUs;
+    }
+
+    uint32_t worstWriteUs() const {
+        return worstUs;
+    }
+
+    uint32_t meanWriteUs() const {
+        return (windowCount > 0) ? (uint32_t)(totalUs / windowCount) : 0;
+    }
+
+    //Clears the latency figures - e.g. after a benchmark so the recording starts afresh
+    void resetStats() {
+        windowCount = 0;
+        lastUs = 0;
+        worstUs = 0;
+        totalUs = 0;
+    }
+};
+#endif
+
+#endif
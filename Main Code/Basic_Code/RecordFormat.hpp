@@ -0,0 +1,168 @@
+#ifndef __RECORD_FORMAT_HPP__
+#define __RECORD_FORMAT_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "SampleJitter.hpp"
+
+/*
+Binary recording format used for the results file - Written by the firmware and read back by Record_Decoder on the host.
+- A file starts with one RecordFileHeader holding the sampling profile, the ADC and storage resolution, the channel names and the firmware build.
+  From version 3 the header is padded to a 512 byte block and followed by two commit blocks (RecordJournal.hpp), so the windows of a
+  results file start at recordJournalDataStart. A raw log session is laid out the same as before.
+- Each window follows as a RecordWindowHeader and then the window's raw SampleBlock storage, so writing a window is two writes of data
+  that is already in memory and reading one back is a memcpy.
+- Window payloads are stored channel by channel (struct of arrays). Encoding says whether each sample is a uint16_t or packed 12-bit
+  (see SampleBlock.hpp), or whether the channels are compressed (see RiceCodec.hpp) - payloadBytes then varies from window to window.
+- All fields are little endian and naturally aligned so the structures can be written and read directly on the F401RE and on a PC.
+- Both headers carry a CRC32 of their own fields and the window header carries the CRC of its payload (the window seal), so a damaged
+  header or window is found rather than decoded as garbage.
+- From version 4 the window header also holds the sampling timing while the window was read (JitterSummary, SampleJitter.hpp). Older
+  window headers are 32 bytes with no timing - recordWindowHeaderBytes() and recordLoadWindowHeader() read either.
+- From version 5 the file header holds a recording ID that is different for every recording, and every window header holds the CRC of
+  its recording's file header. Space preallocated on the card still holds whatever was there before, which can be intact windows of an
+  older recording made by the same build - A window whose headerCrc is not its file's is where the data ends, not part of it.
+  recordFileHeaderBytes() and recordLoadFileHeader() read the 208 byte file headers from before it.
+- recordVersion is bumped whenever the layout changes - Readers must reject versions they do not know.
+*/
+
+static const uint32_t recordFileMagic = 0x47505052; //"RPPG" in a little endian file
+static const uint32_t recordWindowMagic = 0x4E495752; //"RWIN" in a little endian file
+static const uint16_t recordVersion = 5; //Version 2 added recordEncodingRice, version 3 the commit blocks in front of the windows, version 4 the window timing,
+                                          //version 5 the recording ID
+
+static const int recordMaxChannels = 16;
+static const int recordNameLength = 8;
+static const int recordBuildLength = 48;
+
+enum RecordEncoding : uint16_t {
+    recordEncodingU16 = 0, //One uint16_t per sample, scaled like AnalogIn::read_u16()
+    recordEncodingPacked12 = 1, //Two 12-bit samples in 3 bytes
+    recordEncodingRice = 2 //Each channel compressed on its own (RiceCodec.hpp) - Decodes to uint16_t samples
+};
+
+struct RecordFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize; //sizeof(RecordFileHeader) for this version
+    uint32_t rateHz;
+    uint32_t windowSeconds;
+    uint32_t samplesPerWindow;
+    uint16_t channels;
+    uint16_t adcBits; //Resolution of the ADC itself
+    uint16_t oversample; //ADC scans per stored sample
+    uint16_t encoding; //RecordEncoding of the window payloads
+    char build[recordBuildLength]; //Firmware build that wrote the file
+    char channelNames[recordMaxChannels][recordNameLength];
+    uint32_t recordingId; //Different for every recording, so no two recordings have the same header CRC
+    uint32_t crc; //CRC32 of everything above
+};
+
+struct RecordWindowHeader {
+    uint32_t magic;
+    uint32_t firstSequence; //Sequence number of the first sample
+    uint64_t startUs; //When the first sample was converted, in microseconds since sampling started
+    uint32_t sampleCount; //Samples per channel
+    uint32_t payloadBytes; //Bytes of sample data following this header
+    uint32_t payloadCrc; //CRC32 of the sample data
+    JitterSummary timing; //How regular the sampling was while the window was read
+    uint32_t headerCrc; //CRC of the file header of the recording the window belongs to
+    uint32_t reserved; //Zero - Keeps the header a whole number of 8 byte words
+    uint32_t crc; //CRC32 of everything above
+};
+
+static_assert(sizeof(RecordFileHeader) == 212, "RecordFileHeader layout changed - Bump recordVersion");
+static_assert(sizeof(RecordWindowHeader) == 96, "RecordWindowHeader layout changed - Bump recordVersion");
+
+//File headers before version 5 - The fields up to the channel names and then the CRC
+static const uint32_t recordFileHeaderV4Bytes = 208;
+
+//Window headers before version 4 - The fields up to payloadCrc and then the CRC. Before version 5 - The fields up to timing and then the CRC
+static const uint32_t recordWindowHeaderV3Bytes = 32;
+static const uint32_t recordWindowHeaderV4Bytes = 88;
+
+//Bytes taken by the file header of a recording of the given version
+inline uint32_t recordFileHeaderBytes(uint16_t version) {
+    return (version >= 5) ? sizeof(RecordFileHeader) : recordFileHeaderV4Bytes;
+}
+
+//Reads a file header as it is stored, in the layout of its own version - A header without a recording ID has it zeroed
+//stored must hold recordFileHeaderBytes() of its version. Returns how many of the stored bytes its CRC covers
+inline uint32_t recordLoadFileHeader(const void *stored, RecordFileHeader &header) {
+    memcpy(&header, stored, recordFileHeaderV4Bytes);
+    if (header.version >= 5) {
+        memcpy(&header, stored, sizeof(header));
+        return offsetof(RecordFileHeader, crc);
+    }
+    const uint32_t covered = offsetof(RecordFileHeader, recordingId);
+    header.recordingId = 0;
+    memcpy(&header.crc, (const uint8_t *)stored + covered, sizeof(header.crc));
+    return covered;
+}
+
+//Whether two file headers describe recordings made by the same build with the same profile - Only the recording ID and CRC may differ
+inline bool recordSameProfile(const RecordFileHeader &a, const RecordFileHeader &b) {
+    return memcmp(&a, &b, offsetof(RecordFileHeader, recordingId)) == 0;
+}
+
+//Bytes taken by each window header in a recording of the given version
+inline uint32_t recordWindowHeaderBytes(uint16_t version) {
+    return (version >= 5) ? sizeof(RecordWindowHeader) : (version == 4) ? recordWindowHeaderV4Bytes : recordWindowHeaderV3Bytes;
+}
+
+//Reads a window header as a recording of the given version stores it - Fields the version does not have are zeroed
+//Returns how many of the stored bytes its CRC covers
+inline uint32_t recordLoadWindowHeader(const void *stored, uint16_t version, RecordWindowHeader &window) {
+    if (version >= 5) {
+        memcpy(&window, stored, sizeof(window));
+        return offsetof(RecordWindowHeader, crc);
+    }
+    const uint32_t covered = (version == 4) ? offsetof(RecordWindowHeader, headerCrc) : offsetof(RecordWindowHeader, timing);
+    memset(&window, 0, sizeof(window));
+    memcpy(&window, stored, covered);
+    memcpy(&window.crc, (const uint8_t *)stored + covered, sizeof(window.crc));
+    return covered;
+}
+
+//Whether a window belongs to the recording with the given file header - Recordings before version 5 can not tell
+inline bool recordWindowBelongs(const RecordFileHeader &header, const RecordWindowHeader &window) {
+    return header.version < 5 || window.headerCrc == header.crc;
+}
+
+//Fills in a file header apart from its CRC - Names are copied in channel order and cut to fit
+//The recording ID is left at 0 - Set it before working out the CRC
+inline void recordFileHeaderInit(RecordFileHeader &header, uint32_t rateHz, uint32_t windowSeconds, uint32_t samplesPerWindow,
+                                 uint16_t channels, uint16_t adcBits, uint16_t oversample, RecordEncoding encoding, const char *build) {
+    memset(&header, 0, sizeof(header));
+    header.magic = recordFileMagic;
+    header.version = recordVersion;
+    header.headerSize = sizeof(RecordFileHeader);
+    header.rateHz = rateHz;
+    header.windowSeconds = windowSeconds;
+    header.samplesPerWindow = samplesPerWindow;
+    header.channels = channels;
+    header.adcBits = adcBits;
+    header.oversample = oversample;
+    header.encoding = encoding;
+    strncpy(header.build, build, recordBuildLength - 1);
+}
+
+inline void recordSetChannelName(RecordFileHeader &header, int channel, const char *name) {
+    strncpy(header.channelNames[channel], name, recordNameLength - 1);
+}
+
+//Bytes used by one channel of an uncompressed window payload
+inline uint32_t recordChannelBytes(uint16_t encoding, uint32_t samples) {
+    return (encoding == recordEncodingPacked12) ? (((samples + 1) / 2) * 3) : (samples * 2);
+}
+
+//The metadata line placed at the top of CSV results - The same line SamplingConfig::describe() writes, built from a file header
+inline int recordDescribe(const RecordFileHeader &header, char *buffer, size_t size) {
+    return snprintf(buffer, size, "# rate_hz=%u window_s=%u channels=%u samples_per_window=%u oversample=%u\n",
+                    (unsigned)header.rateHz, (unsigned)header.windowSeconds, (unsigned)header.channels,
+                    (unsigned)header.samplesPerWindow, (unsigned)header.oversample);
+}
+
+#endif
@@ -0,0 +1,285 @@
+#ifndef __RECORD_JOURNAL_HPP__
+#define __RECORD_JOURNAL_HPP__
+
+#include "RecordFormat.hpp"
+#include "Crc32.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__MBED__)
+#include "mbed.h"
+#include "StorageSession.hpp"
+#endif
+
+/*
+Crash safe journal for the binary results file - A reset part way through a recording costs the windows in flight, not the recording.
+- The file is an append only journal of sealed windows - Each RecordWindowHeader carries its own CRC and the CRC of its payload.
+- The first three 512 byte blocks are reserved. Block 0 holds the RecordFileHeader and blocks 1 and 2 two copies of a commit marker,
+  written alternately so one is always intact. Windows start at recordJournalDataStart.
+- Every commitEvery windows the file is synced and then the marker is written and synced, so a marker only ever points at data that
+  is already on the card. It holds the end of the committed data, the windows written and wanted, and where the sample numbering is up to.
+- recover() reads the header and both markers, then checks the windows after the committed end - At most commitEvery of them can
+  have been written since the last marker, so the scan is bounded however long the recording is. Each window needs a good header CRC,
+  a good payload CRC, the CRC of this recording's file header and the next sequence number, or one a whole number of windows on where
+  windows were dropped. The data is cut back after the last good window so a torn one is written over. Space preallocated past the
+  data (StorageSession.hpp) is not cleared, so an intact window of an older recording can follow the data - Its file header CRC differs,
+  as every recording has its own recording ID (RecordFormat.hpp).
+- Only a recording made by the same build and profile (the file header must match apart from its recording ID) that was not finished
+  is carried on.
+  skipWindow() then skips the sequence numbers of the window lost at the reset, so Record_Decoder reports a gap where the reset was.
+  Windows held elsewhere through the reset (FlashSpill.hpp) can be written after the recovered ones before the skip.
+- finish() marks the recording complete so the next boot starts a new one.
+- A recording split over several files (SessionFiles.hpp) hands over from one to the next - handOver() marks the old file as carried
+  on and carryOn() starts the new one with the window count and sample numbering carried across.
+- Record_Decoder only needs the layout above the class, so the class itself is only built for Mbed.
+*/
+
+static const uint32_t recordCommitMagic = 0x544D4352; //"RCMT" in a little endian file
+static const uint32_t recordJournalBlockSize = 512;
+static const uint32_t recordJournalDataStart = 3 * recordJournalBlockSize; //Header block and two commit blocks
+
+enum RecordCommitState : uint32_t {
+    recordCommitRecording = 1,
+    recordCommitFinished = 2,
+    recordCommitContinued = 3 //The recording carries on in the next file of the session
+};
+
+struct RecordCommit {
+    uint32_t magic;
+    uint32_t generation; //Incremented every write - The copy with the highest generation and a good CRC is current
+    uint32_t headerCrc; //CRC of the file header - Ties the marker to the recording it was written for
+    uint32_t state; //RecordCommitState
+    uint64_t dataEnd; //End of the committed windows in the file
+    uint64_t nextStartUs; //Start time of the window after them
+    uint32_t windows; //Windows committed
+    uint32_t windowsTarget; //Windows the recording was started for - 0 until it is set
+    uint32_t nextSequence; //Sequence number of the first sample of the window after them
+    uint32_t crc; //CRC32 of everything above
+};
+
+static_assert(sizeof(RecordCommit) == 48, "RecordCommit layout changed - Bump recordVersion");
+static_assert(sizeof(RecordFileHeader) <= recordJournalBlockSize, "File header must fit in one block");
+
+#if defined(__MBED__)
+class RecordJournal {
+private:
+    StorageSession &storage;
+    Crc32SliceBy8 crc; //Software CRC so the journal never waits on the hardware CRC unit used by the sampling threads
+    RecordCommit commit;
+    uint8_t block[recordJournalBlockSize]; //Scratch block for the header, markers and reading windows back
+
+    uint32_t commitEvery;
+    uint32_t maxPayload;
+    uint64_t windowUs = 0;
+    uint32_t windowSamples = 0;
+    uint32_t sinceCommit = 0;
+
+    //Syncs the windows then writes the marker over the older copy and syncs that
+    int writeCommit() {
+        int err = storage.sync();
+        if (err != 0) {
+            return err;
+        }
+
+        commit.generation++;
+        crc.compute(&commit, offsetof(RecordCommit, crc), &commit.crc);
+        memset(block, 0, sizeof(block));
+        memcpy(block, &commit, sizeof(commit));
+
+        err = storage.writeAt((1 + (commit.generation & 1)) * recordJournalBlockSize, block, recordJournalBlockSize);
+        if (err == 0) {
+            err = storage.sync();
+        }
+        sinceCommit = 0;
+        return err;
+    }
+
+    //Checks the window at offset is intact, belongs to this recording and carries on from the windows before it - Returns its size in the
+    //file, or 0 if not
+    //Whole windows dropped by the overload policy (OverloadPolicy.hpp) leave a gap of a multiple of the window size in the sequence numbers
+    uint32_t checkWindow(off_t offset) {
+        RecordWindowHeader window;
+        uint32_t check;
+        if (storage.read(offset, &window, sizeof(window)) != 0) {
+            return 0;
+        }
+        crc.compute(&window, offsetof(RecordWindowHeader, crc), &check);
+        if (window.magic != recordWindowMagic || check != window.crc || window.headerCrc != commit.headerCrc ||
+            window.firstSequence < commit.nextSequence || ((window.firstSequence - commit.nextSequence) % windowSamples) != 0 ||
+            window.payloadBytes > maxPayload) {
+            return 0;
+        }
+
+        //The payload is read back a block at a time so no window sized buffer is needed
+        uint32_t state = 0xFFFFFFFF;
+        for (uint32_t done = 0; done < window.payloadBytes;) {
+            uint32_t part = window.payloadBytes - done;
+            part = (part < recordJournalBlockSize) ? part : recordJournalBlockSize;
+            if (storage.read(offset + sizeof(window) + done, block, part) != 0) {
+                return 0;
+            }
+            state = crc32UpdateBytewise(state, block, part);
+            done += part;
+        }
+        if ((state ^ 0xFFFFFFFF) != window.payloadCrc) {
+            return 0;
+        }
+
+        commit.nextSequence = window.firstSequence + window.sampleCount;
+        commit.nextStartUs = window.startUs + windowUs;
+        return sizeof(window) + window.payloadBytes;
+    }
+
+    void setWindowTime(const RecordFileHeader &header) {
+        windowUs = ((uint64_t)header.samplesPerWindow * 1000000) / header.rateHz;
+        windowSamples = header.samplesPerWindow;
+    }
+
+    //Header block, empty marker blocks and the first marker of a file that has just been opened and cleared
+    int startFile(const RecordFileHeader &header) {
+        commit.magic = recordCommitMagic;
+        commit.headerCrc = header.crc;
+        commit.state = recordCommitRecording;
+        commit.dataEnd = recordJournalDataStart;
+        setWindowTime(header);
+
+        memset(block, 0, sizeof(block));
+        memcpy(block, &header, sizeof(header));
+        int err = storage.append(block, recordJournalBlockSize);
+
+        //Both marker blocks start empty so neither can hold a marker from an older recording
+        memset(block, 0, sizeof(block));
+        for (int copy = 0; copy < 2 && err == 0; copy++) {
+            err = storage.append(block, recordJournalBlockSize);
+        }
+        return (err == 0) ? writeCommit() : err;
+    }
+
+public:
+    //A marker is written every commitWindows windows - Windows are never more than maxPayloadBytes of payload
+    RecordJournal(StorageSession &session, uint32_t commitWindows, uint32_t maxPayloadBytes)
+        : storage(session), commitEvery(commitWindows), maxPayload(maxPayloadBytes) {}
+
+    //Starts a new recording in a file that has just been opened and cleared
+    int start(const RecordFileHeader &header) {
+        memset(&commit, 0, sizeof(commit));
+        return startFile(header);
+    }
+
+    //Marks the current file as carried on in the next one - Called just before the session moves on to it
+    int handOver() {
+        commit.state = recordCommitContinued;
+        return writeCommit();
+    }
+
+    //Carries the recording on in a file that has just been opened and cleared - The window count, target and sample numbering carry on
+    int carryOn(const RecordFileHeader &header) {
+        return startFile(header);
+    }
+
+    //Sets how many windows the recording is for - Committed straight away, as only a recording with a target is carried on after a reset
+    int setTarget(uint32_t windows) {
+        commit.windowsTarget = windows;
+        return writeCommit();
+    }
+
+    //Finds where a recording cut short by a reset got to - The file must be open without clearing it. header is the one this build would
+    //start a recording with, and is set to the one the recording was started with. Returns true if the recording can be carried on, with
+    //the write position after its last good window. The marker is written by the skipWindow() that follows
+    bool recover(RecordFileHeader &header) {
+        RecordFileHeader stored;
+        uint32_t headerCheck;
+        if (storage.read(0, &stored, sizeof(stored)) != 0 || !recordSameProfile(stored, header)) {
+            return false;
+        }
+        crc.compute(&stored, offsetof(RecordFileHeader, crc), &headerCheck);
+        if (headerCheck != stored.crc) {
+            return false;
+        }
+        header = stored;
+
+        bool found = false;
+        for (uint32_t copy = 1; copy <= 2; copy++) {
+            RecordCommit candidate;
+            uint32_t check;
+            if (storage.read(copy * recordJournalBlockSize, &candidate, sizeof(candidate)) != 0) {
+                continue;
+            }
+            crc.compute(&candidate, offsetof(RecordCommit, crc), &check);
+            if (candidate.magic == recordCommitMagic && check == candidate.crc && candidate.headerCrc == header.crc &&
+                (!found || candidate.generation > commit.generation)) {
+                commit = candidate;
+                found = true;
+            }
+        }
+        if (!found || commit.state != recordCommitRecording || commit.windowsTarget == 0) {
+            return false;
+        }
+        setWindowTime(header);
+
+        //Windows written since the marker - Anything from the first one that does not check out is the torn tail
+        off_t end = commit.dataEnd;
+        for (uint32_t i = 0; i < commitEvery; i++) {
+            uint32_t size = checkWindow(end);
+            if (size == 0) {
+                break;
+            }
+            end += size;
+            commit.windows++;
+        }
+        commit.dataEnd = end;
+        if (storage.rewind(end) != 0) {
+            return false;
+        }
+
+        //Every window was written and only the final marker was lost
+        if (commit.windows >= commit.windowsTarget) {
+            finish();
+            return false;
+        }
+        return true;
+    }
+
+    //Skips the window that was being filled when a recording was cut short - Its sequence numbers are left out so the gap shows where
+    //the reset was, and the position is committed
+    int skipWindow() {
+        commit.nextSequence += windowSamples;
+        commit.nextStartUs += windowUs;
+        return writeCommit();
+    }
+
+    //Records a window that has just been written to the end of the file - Commits every commitEvery windows
+    int windowWritten(const RecordWindowHeader &window, size_t recordSize) {
+        commit.dataEnd += recordSize;
+        commit.windows++;
+        commit.nextSequence = window.firstSequence + window.sampleCount;
+        commit.nextStartUs = window.startUs + windowUs;
+        return (++sinceCommit >= commitEvery) ? writeCommit() : 0;
+    }
+
+    //Marks the recording complete so it is not carried on at the next boot
+    int finish() {
+        commit.state = recordCommitFinished;
+        return writeCommit();
+    }
+
+    uint32_t windows() const {
+        return commit.windows;
+    }
+
+    uint32_t windowsTarget() const {
+        return commit.windowsTarget;
+    }
+
+    uint32_t nextSequence() const {
+        return commit.nextSequence;
+    }
+
+    uint64_t nextStartUs() const {
+        return commit.nextStartUs;
+    }
+};
+#endif
+
+#endif
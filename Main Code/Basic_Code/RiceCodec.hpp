@@ -0,0 +1,293 @@
+#ifndef __RICE_CODEC_HPP__
+#define __RICE_CODEC_HPP__
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+Lossless compression of window channels - Linear prediction followed by adaptive Rice coding, as FLAC does for audio.
+- PPG samples are smooth, so the difference from a prediction made from the previous one or two samples is only a few bits wide,
+  and the DC channel hardly moves at all.
+- Each channel is coded on its own. The predictor order (0, 1 or 2) with the smallest coded size is picked per channel, and if even
+  that is bigger than the samples themselves the channel is stored verbatim, so a channel never grows by more than its 2-bit order.
+- Samples that came straight from the 12-bit ADC (AdcDma::toU16() scaling, low nibble a copy of the top one) are coded as their 12 bits,
+  so the copied nibble does not cost 4 bits in every residual.
+- Residuals are zigzag mapped to unsigned and Rice coded in partitions of ricePartition samples, each with its own Rice parameter,
+  so the code adapts as the signal gets busier or quieter through the window.
+- The encoder works straight from a channel view (SampleChannel or PackedSampleChannel) into the caller's buffer, with no heap and only
+  a few words of stack - riceMaxChannelBytes() gives the buffer size needed.
+- Bit stream of a channel, most significant bit first:
+    2 bits order (3 = verbatim), 1 bit set if the samples are coded as 12 bits, then order warm up samples of 12 or 16 bits
+    (or every sample when verbatim),
+    then for each partition a 5-bit parameter k followed by each residual as (value >> k) one bits, a zero bit and the low k bits.
+  The channel is padded with zero bits to a whole byte, and the channels of a window follow one another.
+- riceDecodeChannel() is the matching decoder - Used by Record_Decoder on the host. Rice_Check checks both bit for bit against a
+  reference encoder written from the bit stream above.
+*/
+
+static const int ricePartition = 16; //Residuals per Rice parameter
+static const int riceOrderVerbatim = 3;
+static const int riceParamBits = 5;
+static const uint32_t riceMaxParam = 20; //A second order residual of 16-bit samples needs at most 19 bits once zigzag mapped
+
+static const int riceHeaderBits = 3;
+
+//Largest coded size of a channel of the given number of samples - The verbatim size plus the header
+constexpr uint32_t riceMaxChannelBytes(uint32_t samples) {
+    return (riceHeaderBits + (16 * samples) + 7) / 8;
+}
+
+//Maps a signed residual to unsigned - 0, -1, 1, -2, 2... become 0, 1, 2, 3, 4...
+inline uint32_t riceZigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+inline int32_t riceUnzigzag(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+//Prediction of sample i from the samples before it
+inline int32_t ricePredict(int order, int32_t previous, int32_t beforePrevious) {
+    return (order == 0) ? 0 : (order == 1) ? previous : ((2 * previous) - beforePrevious);
+}
+
+//Rice parameter for a partition from the sum of its residuals - The number of bits in the mean
+inline uint32_t riceParameter(uint32_t sum, int count) {
+    uint32_t k = 0;
+    while (k < riceMaxParam && ((uint64_t)count << (k + 1)) <= sum) {
+        k++;
+    }
+    return k;
+}
+
+class RiceBitWriter {
+private:
+    uint8_t *out;
+    uint32_t bytes = 0;
+    uint64_t pending = 0; //Bits not yet written out, in the bottom pendingBits
+    int pendingBits = 0;
+
+public:
+    explicit RiceBitWriter(uint8_t *buffer) : out(buffer) {}
+
+    //Adds the low bits (up to 32) of value
+    void put(uint32_t value, int bits) {
+        if (bits == 0) {
+            return;
+        }
+        pending = (pending << bits) | (value & (0xFFFFFFFFu >> (32 - bits)));
+        pendingBits += bits;
+        while (pendingBits >= 8) {
+            pendingBits -= 8;
+            out[bytes++] = (uint8_t)(pending >> pendingBits);
+        }
+    }
+
+    void putRice(uint32_t value, uint32_t k) {
+        uint32_t q = value >> k;
+        while (q >= 32) {
+            put(0xFFFFFFFF, 32);
+            q -= 32;
+        }
+        put(((1u << q) - 1) << 1, q + 1); //q one bits then the zero that ends them
+        put(value, k);
+    }
+
+    //Pads to a whole byte and returns the bytes written
+    uint32_t finish() {
+        if (pendingBits > 0) {
+            put(0, 8 - pendingBits);
+        }
+        return bytes;
+    }
+};
+
+class RiceBitReader {
+private:
+    const uint8_t *in;
+    uint32_t bitLimit;
+    uint32_t bitCount = 0;
+
+public:
+    RiceBitReader(const uint8_t *buffer, uint32_t size) : in(buffer), bitLimit(size * 8) {}
+
+    //Reading past the end gives zero bits - overrun() reports it
+    uint32_t get(int bits) {
+        uint32_t value = 0;
+        for (int b = 0; b < bits; b++) {
+            uint32_t bit = (bitCount < bitLimit) ? ((in[bitCount >> 3] >> (7 - (bitCount & 7))) & 1) : 0;
+            value = (value << 1) | bit;
+            bitCount++;
+        }
+        return value;
+    }
+
+    uint32_t getRice(uint32_t k) {
+        uint32_t q = 0;
+        while (bitCount < bitLimit && get(1) == 1) {
+            q++;
+        }
+        return (q << k) | get(k);
+    }
+
+    bool overrun() const {
+        return bitCount > bitLimit;
+    }
+
+    uint32_t bytesUsed() const {
+        return (bitCount + 7) / 8;
+    }
+};
+
+//View of a channel holding 12-bit ADC values scaled to 16 bits as its 12-bit values
+template <typename Channel>
+class RiceNarrowChannel {
+private:
+    const Channel &samples;
+
+public:
+    explicit RiceNarrowChannel(const Channel &channel) : samples(channel) {}
+
+    uint16_t operator[](int i) const {
+        return samples[i] >> 4;
+    }
+
+    int size() const {
+        return samples.size();
+    }
+};
+
+//Checks every sample is a 12-bit value scaled to 16 bits the way AdcDma::toU16() does it
+template <typename Channel>
+bool riceIsNarrow(const Channel &samples) {
+    for (int i = 0; i < samples.size(); i++) {
+        uint16_t value = samples[i];
+        if ((value & 0x0F) != (value >> 12)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//Walks the residuals of a channel partition by partition - Used both to size each predictor order and to write the chosen one
+template <typename Channel>
+uint32_t riceCodeResiduals(const Channel &samples, int order, RiceBitWriter *writer) {
+    int count = samples.size();
+    uint32_t bits = 0;
+
+    for (int start = order; start < count; start += ricePartition) {
+        int end = (start + ricePartition < count) ? (start + ricePartition) : count;
+
+        uint32_t sum = 0;
+        for (int i = start; i < end; i++) {
+            int32_t before = (i >= 2) ? samples[i - 2] : 0;
+            sum += riceZigzag((int32_t)samples[i] - ricePredict(order, (i >= 1) ? samples[i - 1] : 0, before));
+        }
+        uint32_t k = riceParameter(sum, end - start);
+
+        bits += riceParamBits;
+        if (writer != nullptr) {
+            writer->put(k, riceParamBits);
+        }
+        for (int i = start; i < end; i++) {
+            int32_t before = (i >= 2) ? samples[i - 2] : 0;
+            uint32_t value = riceZigzag((int32_t)samples[i] - ricePredict(order, (i >= 1) ? samples[i - 1] : 0, before));
+            bits += (value >> k) + 1 + k;
+            if (writer != nullptr) {
+                writer->putRice(value, k);
+            }
+        }
+    }
+    return bits;
+}
+
+//Picks the cheapest predictor order for the samples and writes them after the header
+template <typename Channel>
+void riceWriteChannel(const Channel &samples, int bits, RiceBitWriter &writer) {
+    int count = samples.size();
+    int bestOrder = riceOrderVerbatim;
+    uint32_t bestBits = bits * count;
+
+    for (int order = 0; order < riceOrderVerbatim && order <= count; order++) {
+        uint32_t coded = (bits * order) + riceCodeResiduals(samples, order, nullptr);
+        if (coded < bestBits) {
+            bestBits = coded;
+            bestOrder = order;
+        }
+    }
+
+    writer.put(bestOrder, 2);
+    writer.put((bits == 12) ? 1 : 0, 1);
+    int warmup = (bestOrder == riceOrderVerbatim) ? count : bestOrder;
+    for (int i = 0; i < warmup; i++) {
+        writer.put(samples[i], bits);
+    }
+    if (bestOrder != riceOrderVerbatim) {
+        riceCodeResiduals(samples, bestOrder, &writer);
+    }
+}
+
+//Codes one channel into out, which must hold riceMaxChannelBytes(samples.size()) bytes - Returns the bytes written
+template <typename Channel>
+uint32_t riceEncodeChannel(const Channel &samples, uint8_t *out) {
+    RiceBitWriter writer(out);
+    if (riceIsNarrow(samples)) {
+        riceWriteChannel(RiceNarrowChannel<Channel>(samples), 12, writer);
+    }
+    else {
+        riceWriteChannel(samples, 16, writer);
+    }
+    return writer.finish();
+}
+
+//Codes every channel of a SampleBlock one after another - out must hold riceMaxChannelBytes(Block::size()) * Block::channels bytes
+template <typename Block>
+uint32_t riceEncodeBlock(Block &block, uint8_t *out) {
+    uint32_t used = 0;
+    for (int c = 0; c < Block::channels; c++) {
+        used += riceEncodeChannel(block.channel(c), out + used);
+    }
+    return used;
+}
+
+//Decodes one channel of count samples from in - Returns the bytes used, or 0 if the data is damaged
+inline uint32_t riceDecodeChannel(const uint8_t *in, uint32_t size, uint16_t *samples, int count) {
+    RiceBitReader reader(in, size);
+    int order = reader.get(2);
+    bool narrow = (reader.get(1) == 1);
+    int bits = narrow ? 12 : 16;
+    int32_t limit = (1 << bits) - 1;
+    int warmup = (order == riceOrderVerbatim) ? count : ((order < count) ? order : count);
+
+    //Samples are decoded at their coded width and scaled back up at the end
+    for (int i = 0; i < warmup; i++) {
+        samples[i] = reader.get(bits);
+    }
+    for (int start = warmup; start < count; start += ricePartition) {
+        int end = (start + ricePartition < count) ? (start + ricePartition) : count;
+        uint32_t k = reader.get(riceParamBits);
+        if (k > riceMaxParam) {
+            return 0;
+        }
+        for (int i = start; i < end; i++) {
+            int32_t before = (i >= 2) ? samples[i - 2] : 0;
+            int32_t value = ricePredict(order, (i >= 1) ? samples[i - 1] : 0, before) + riceUnzigzag(reader.getRice(k));
+            if (value < 0 || value > limit) {
+                return 0;
+            }
+            samples[i] = (uint16_t)value;
+        }
+        if (reader.overrun()) {
+            return 0;
+        }
+    }
+
+    if (narrow) {
+        for (int i = 0; i < count; i++) {
+            samples[i] = (samples[i] << 4) | (samples[i] >> 8);
+        }
+    }
+    return reader.overrun() ? 0 : reader.bytesUsed();
+}
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef __SAMPLE_BLOCK_HPP__
+#define __SAMPLE_BLOCK_HPP__
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+Compact storage for a window of samples from any number of ADC channels.
+- Each channel is kept as its own array (struct of arrays) so a channel can be walked directly by the SD writer or a DSP stage.
+- SampleBlock<Samples, Channels> stores each sample as a uint16_t - half the size of the old unsigned long pair.
+- SampleBlock<Samples, Channels, true> packs two 12-bit samples into 3 bytes. The top 12 bits are kept and the bottom 4 are restored the
+  same way AdcDma::toU16() makes them, so values that came from the ADC are given back unchanged.
+- channel(c) returns a view of a channel with operator[], set(), size() and begin()/end() so code using a block does not need to know how it is packed.
+- All channels live in one contiguous block, so a window is still a single CRC and a single write however many channels it holds.
+*/
+
+//View of one channel stored as plain uint16_t values
+class SampleChannel {
+private:
+    uint16_t *samples;
+    int count;
+
+public:
+    SampleChannel(uint16_t *channelSamples, int sampleCount) : samples(channelSamples), count(sampleCount) {}
+
+    uint16_t operator[](int i) const {
+        return samples[i];
+    }
+
+    void set(int i, uint16_t value) {
+        samples[i] = value;
+    }
+
+    int size() const {
+        return count;
+    }
+
+    const uint16_t *begin() const {
+        return samples;
+    }
+
+    const uint16_t *end() const {
+        return samples + count;
+    }
+};
+
+//View of one channel packed as 12-bit values - Sample 2n is in byte 3n and the low nibble of 3n+1, sample 2n+1 is in the high nibble of 3n+1 and byte 3n+2
+class PackedSampleChannel {
+private:
+    uint8_t *bytes;
+    int count;
+
+    static uint16_t unpack(const uint8_t *bytes, int i) {
+        const uint8_t *p = bytes + ((i >> 1) * 3);
+        uint16_t raw = (i & 1) ? ((p[1] >> 4) | (p[2] << 4)) : (p[0] | ((p[1] & 0x0F) << 8));
+        return (raw << 4) | (raw >> 8);
+    }
+
+public:
+    class iterator {
+    private:
+        const uint8_t *bytes;
+        int index;
+
+    public:
+        iterator(const uint8_t *packedBytes, int start) : bytes(packedBytes), index(start) {}
+
+        uint16_t operator*() const {
+            return unpack(bytes, index);
+        }
+
+        iterator &operator++() {
+            index++;
+            return *this;
+        }
+
+        bool operator==(const iterator &other) const {
+            return index == other.index;
+        }
+
+        bool operator!=(const iterator &other) const {
+            return index != other.index;
+        }
+    };
+
+    PackedSampleChannel(uint8_t *packedBytes, int sampleCount) : bytes(packedBytes), count(sampleCount) {}
+
+    uint16_t operator[](int i) const {
+        return unpack(bytes, i);
+    }
+
+    void set(int i, uint16_t value) {
+        uint8_t *p = bytes + ((i >> 1) * 3);
+        uint16_t raw = value >> 4;
+        if (i & 1) {
+            p[1] = (p[1] & 0x0F) | ((raw & 0x0F) << 4);
+            p[2] = raw >> 4;
+        }
+        else {
+            p[0] = raw & 0xFF;
+            p[1] = (p[1] & 0xF0) | (raw >> 8);
+        }
+    }
+
+    int size() const {
+        return count;
+    }
+
+    iterator begin() const {
+        return iterator(bytes, 0);
+    }
+
+    iterator end() const {
+        return iterator(bytes, count);
+    }
+};
+
+template <int Samples, int Channels = 2, bool Packed = false>
+class SampleBlock {
+public:
+    typedef SampleChannel Channel;
+    static const int channels = Channels;
+
+private:
+    uint16_t samples[Channels][Samples];
+
+public:
+    Channel channel(int c) {
+        return Channel(samples[c], Samples);
+    }
+
+    //Stores sample i of every channel - values holds one reading per channel in channel order
+    void store(int i, const uint16_t *values) {
+        for (int c = 0; c < Channels; c++) {
+            samples[c][i] = values[c];
+        }
+    }
+
+    static int size() {
+        return Samples;
+    }
+
+    //Raw storage - Used to CRC or write the whole block in one go
+    const void *raw() const {
+        return samples;
+    }
+
+    static size_t rawSize() {
+        return sizeof(samples);
+    }
+};
+
+template <int Samples, int Channels>
+class SampleBlock<Samples, Channels, true> {
+public:
+    typedef PackedSampleChannel Channel;
+    static const int channels = Channels;
+
+private:
+    static const int channelBytes = ((Samples + 1) / 2) * 3;
+    uint8_t bytes[Channels][channelBytes];
+
+public:
+    Channel channel(int c) {
+        return Channel(bytes[c], Samples);
+    }
+
+    //Stores sample i of every channel - values holds one reading per channel in channel order
+    void store(int i, const uint16_t *values) {
+        for (int c = 0; c < Channels; c++) {
+            channel(c).set(i, values[c]);
+        }
+    }
+
+    static int size() {
+        return Samples;
+    }
+
+    //Raw storage - Used to CRC or write the whole block in one go
+    const void *raw() const {
+        return bytes;
+    }
+
+    static size_t rawSize() {
+        return sizeof(bytes);
+    }
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef __SAMPLE_JITTER_HPP__
+#define __SAMPLE_JITTER_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+/*
+Timing instrumentation for the acquisition path.
+- Conversions are triggered by a hardware timer, so each DMA block is timestamped with a free running microsecond timer when its
+  interrupt fires. Sample i of a block was converted (blockSize - 1 - i) sample periods before that timestamp.
+- The gap between block interrupts is compared with the nominal block period and the error is kept in a histogram, showing how
+  regular the sampling really is.
+- Lateness is the time from the interrupt to the reading thread handling the block. Once a block is handled more than one block
+  period late, DMA has already started overwriting it, so that counts as a missed deadline.
+- takeSummary() returns the figures for the window just finished and starts a new one.
+- Each window's summary is stored in its RecordWindowHeader (RecordFormat.hpp). CSV results have no per window header, so the figures for
+  the whole recording are added up with jitterAccumulate() and written as a "# timing" line after the last window (jitterDescribe()).
+*/
+
+static const int jitterBins = 8;
+
+struct JitterSummary {
+    uint32_t blocks; //Blocks recorded in the window
+    uint32_t binWidthUs; //Width of each histogram bin
+    uint32_t histogram[jitterBins]; //Interval error counts - Bin n holds errors of n to n+1 bin widths, the last bin holds everything larger
+    uint32_t worstIntervalErrorUs; //Largest difference between a block interval and the nominal block period
+    uint32_t worstLatenessUs; //Longest time from a block interrupt to the reading thread
+    uint32_t meanLatenessUs;
+    uint32_t missedDeadlines; //Blocks handled after DMA had started overwriting them
+};
+
+//Adds one window's figures to a total - The mean lateness is weighted by the blocks in each
+inline void jitterAccumulate(JitterSummary &total, const JitterSummary &window) {
+    uint32_t blocks = total.blocks + window.blocks;
+    if (blocks > 0) {
+        total.meanLatenessUs = (uint32_t)((((uint64_t)total.meanLatenessUs * total.blocks) + ((uint64_t)window.meanLatenessUs * window.blocks)) / blocks);
+    }
+    total.blocks = blocks;
+    total.binWidthUs = window.binWidthUs;
+    for (int i = 0; i < jitterBins; i++) {
+        total.histogram[i] += window.histogram[i];
+    }
+    total.worstIntervalErrorUs = (window.worstIntervalErrorUs > total.worstIntervalErrorUs) ? window.worstIntervalErrorUs : total.worstIntervalErrorUs;
+    total.worstLatenessUs = (window.worstLatenessUs > total.worstLatenessUs) ? window.worstLatenessUs : total.worstLatenessUs;
+    total.missedDeadlines += window.missedDeadlines;
+}
+
+//The timing line placed after the last window of CSV results
+inline int jitterDescribe(const JitterSummary &summary, char *buffer, size_t size) {
+    const uint32_t *h = summary.histogram;
+    return snprintf(buffer, size, "# timing blocks=%u worst_interval_error_us=%u worst_lateness_us=%u mean_lateness_us=%u missed_deadlines=%u "
+                    "histogram_bin_us=%u histogram=%u %u %u %u %u %u %u %u\n", (unsigned)summary.blocks, (unsigned)summary.worstIntervalErrorUs,
+                    (unsigned)summary.worstLatenessUs, (unsigned)summary.meanLatenessUs, (unsigned)summary.missedDeadlines,
+                    (unsigned)summary.binWidthUs, (unsigned)h[0], (unsigned)h[1], (unsigned)h[2], (unsigned)h[3], (unsigned)h[4],
+                    (unsigned)h[5], (unsigned)h[6], (unsigned)h[7]);
+}
+
+class JitterMonitor {
+private:
+    uint32_t expectedIntervalUs;
+    uint32_t deadlineUs;
+    uint32_t lastInterruptUs = 0;
+    bool started = false;
+    uint64_t totalLatenessUs = 0;
+    JitterSummary current;
+
+public:
+    JitterMonitor(uint32_t blockPeriodUs, uint32_t binWidthUs) : expectedIntervalUs(blockPeriodUs), deadlineUs(blockPeriodUs) {
+        memset(&current, 0, sizeof(current));
+        current.binWidthUs = binWidthUs;
+    }
+
+    //Records one block - interruptUs is when its DMA interrupt fired and handledUs when the reading thread got to it
+    void record(uint32_t interruptUs, uint32_t handledUs) {
+        if (started) {
+            uint32_t interval = interruptUs - lastInterruptUs;
+            uint32_t error = (interval > expectedIntervalUs) ? (interval - expectedIntervalUs) : (expectedIntervalUs - interval);
+            uint32_t bin = error / current.binWidthUs;
+
+            current.histogram[(bin < jitterBins) ? bin : (jitterBins - 1)]++;
+            if (error > current.worstIntervalErrorUs) {
+                current.worstIntervalErrorUs = error;
+            }
+        }
+        lastInterruptUs = interruptUs;
+        started = true;
+
+        uint32_t lateness = handledUs - interruptUs;
+        totalLatenessUs += lateness;
+        if (lateness > current.worstLatenessUs) {
+            current.worstLatenessUs = lateness;
+        }
+        if (lateness > deadlineUs) {
+            current.missedDeadlines++;
+        }
+        current.blocks++;
+    }
+
+    //Returns the summary for the window just finished and clears it for the next one
+    JitterSummary takeSummary() {
+        JitterSummary finished = current;
+        finished.meanLatenessUs = (finished.blocks > 0) ? (uint32_t)(totalLatenessUs / finished.blocks) : 0;
+
+        uint32_t binWidthUs = current.binWidthUs;
+        memset(&current, 0, sizeof(current));
+        current.binWidthUs = binWidthUs;
+        totalLatenessUs = 0;
+        return finished;
+    }
+};
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef __SAMPLE_RING_HPP__
+#define __SAMPLE_RING_HPP__
+
+#include <atomic>
+#include <cstdint>
+
+/*
+Wait-free single producer / single consumer ring buffer.
+- Exactly one thread may push and exactly one other thread may pop - Neither side ever takes a lock or waits.
+- Capacity must be a power of two so the free running head and tail can simply be masked.
+- Batch push/pop move a whole block of samples per call so the consumer can drain many samples per wakeup.
+- highWaterMark() shows how close the ring has come to filling, overruns() counts items rejected because it was full.
+- Ring_Benchmark checks it on the host and times it against the Mail box it replaced.
+*/
+
+//Smallest power of two that holds at least n items - Used to size a ring for a given number of items
+constexpr uint32_t ringCapacityFor(uint32_t n, uint32_t size = 1) {
+    return (size >= n) ? size : ringCapacityFor(n, size * 2);
+}
+
+template <typename T, uint32_t Capacity>
+class SampleRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SampleRing capacity must be a power of two");
+
+private:
+    static const uint32_t mask = Capacity - 1;
+
+    T items[Capacity];
+    std::atomic<uint32_t> head{0}; //Only written by the producer
+    std::atomic<uint32_t> tail{0}; //Only written by the consumer
+    std::atomic<uint32_t> highWater{0}; //Only written by the producer
+    std::atomic<uint32_t> overrunCount{0}; //Only written by the producer
+
+public:
+    //Producer side - Copies up to count items in and returns how many fitted
+    uint32_t push(const T *src, uint32_t count) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        uint32_t space = Capacity - (h - t);
+        uint32_t n = (count < space) ? count : space;
+
+        for (uint32_t i = 0; i < n; i++) {
+            items[(h + i) & mask] = src[i];
+        }
+        head.store(h + n, std::memory_order_release);
+
+        if (n < count) {
+            overrunCount.store(overrunCount.load(std::memory_order_relaxed) + (count - n), std::memory_order_relaxed);
+        }
+        if ((h + n - t) > highWater.load(std::memory_order_relaxed)) {
+            highWater.store(h + n - t, std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+    bool push(const T &item) {
+        return push(&item, 1) == 1;
+    }
+
+    //Consumer side - Copies up to max items out and returns how many were taken
+    uint32_t pop(T *dst, uint32_t max) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+        uint32_t available = h - t;
+        uint32_t n = (max < available) ? max : available;
+
+        for (uint32_t i = 0; i < n; i++) {
+            dst[i] = items[(t + i) & mask];
+        }
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    bool pop(T &item) {
+        return pop(&item, 1) == 1;
+    }
+
+    uint32_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    static uint32_t capacity() {
+        return Capacity;
+    }
+
+    uint32_t highWaterMark() const {
+        return highWater.load(std::memory_order_relaxed);
+    }
+
+    uint32_t overruns() const {
+        return overrunCount.load(std::memory_order_relaxed);
+    }
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef __SAMPLING_CONFIG_HPP__
+#define __SAMPLING_CONFIG_HPP__
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include "SampleRing.hpp"
+
+//Largest divisor of n that is no bigger than limit - Used to pick a DMA block size that divides exactly into a window
+constexpr uint32_t largestDivisorUpTo(uint32_t n, uint32_t limit) {
+    return (limit <= 1) ? 1 : (((n % limit) == 0) ? limit : largestDivisorUpTo(n, limit - 1));
+}
+
+/*
+Compile time sampling profile - Every buffer size, the timer period and the file metadata are derived from the three parameters.
+- RateHz is the output sample rate, WindowSeconds the length of each window written to the micro-SD card and Channels the number of ADC inputs.
+- Oversample runs the ADC that many times faster than RateHz and decimates back down to RateHz (CicDecimator.hpp) for extra resolution.
+- WindowBuffers sets how many window buffers the pool holds and Packed selects 12-bit packed window storage.
+- The RAM used by the window buffers, sample ring and DMA buffer is checked against ramBudget when compiling, so a profile that will not fit
+  on the NUCLEO-F401RE (96KB RAM) fails to build rather than failing at run time. Basic_Code checks the same budget again with its
+  storage buffers added (compressed window, write behind slots, CSV staging and flash spill), which depend on its build options.
+- Everything is a compile time constant so switching profile costs nothing at run time.
+*/
+template <uint32_t RateHz, uint32_t WindowSeconds, uint32_t Channels, uint32_t Oversample = 1, uint32_t WindowBuffers = 3, bool Packed = false>
+struct SamplingConfig {
+    static_assert(RateHz > 0 && (1000000 % RateHz) == 0, "Sample rate must be a whole number of microseconds per sample");
+    static_assert(WindowSeconds > 0, "Window must be at least one second long");
+    static_assert(Channels > 0 && Channels <= 16, "ADC1 can scan between 1 and 16 channels");
+    static_assert((1000000000 % (RateHz * Oversample)) == 0, "ADC rate must be a whole number of nanoseconds per scan");
+    static_assert(!(Packed && Oversample > 1), "Packed storage only holds 12 bits so would throw away the oversampled resolution");
+
+    static const uint32_t rateHz = RateHz;
+    static const uint32_t windowSeconds = WindowSeconds;
+    static const uint32_t channels = Channels;
+    static const uint32_t oversample = Oversample;
+    static const uint32_t windowBuffers = WindowBuffers;
+    static const bool packed = Packed;
+
+    static const uint32_t samplePeriodUs = 1000000 / RateHz;
+    static const uint32_t samplesPerWindow = RateHz * WindowSeconds;
+
+    //ADC at 21MHz with 84 cycle sampling takes about 4.6us a conversion - Leaves some margin below that
+    static const uint32_t maxConversionsPerSecond = 200000;
+    static_assert(RateHz * Oversample * Channels <= maxConversionsPerSecond, "Oversampled ADC rate is faster than the ADC can convert");
+
+    //DMA hands over a block every 100ms so the reading thread wakes 10 times a second whatever the rate
+    //When oversampling, blocks are shortened so each DMA half stays within 4096 raw conversions - Always a whole number of blocks per window
+    static const uint32_t maxRawBlock = 4096;
+    static const uint32_t tenthSecond = (RateHz >= 10) ? (RateHz / 10) : 1;
+    static const uint32_t rawLimit = maxRawBlock / (Oversample * Channels);
+    static const uint32_t dmaBlockSize = largestDivisorUpTo(samplesPerWindow, (tenthSecond < rawLimit) ? tenthSecond : rawLimit);
+    static const uint32_t rawBlockSize = dmaBlockSize * Oversample; //ADC scans per DMA half
+
+    //Sample ring holds at least four DMA blocks so the consumer can be held up for 400ms without losing samples
+    static const uint32_t ringCapacity = ringCapacityFor(4 * dmaBlockSize);
+
+    //RAM needed for the buffers - Ring entries are a 32-bit sequence number plus a uint16_t per channel, the DMA buffer holds raw scans
+    static const uint32_t windowBytes = Packed ? (((samplesPerWindow + 1) / 2) * 3 * Channels) : (samplesPerWindow * 2 * Channels);
+    static const uint32_t ringBytes = ringCapacity * (4 + (2 * Channels));
+    static const uint32_t dmaBytes = 2 * rawBlockSize * Channels * 2;
+    static const uint32_t ramBytes = (WindowBuffers * windowBytes) + ringBytes + dmaBytes;
+
+    //Leaves about 32KB of the F401RE's 96KB for thread stacks, the file system and everything else
+    static const uint32_t ramBudget = 64 * 1024;
+    static_assert(ramBytes <= ramBudget, "Sampling profile buffers do not fit in the RAM budget - Shorten the window, lower the rate or use fewer window buffers");
+
+    static constexpr std::chrono::microseconds samplePeriod() {
+        return std::chrono::microseconds(samplePeriodUs);
+    }
+
+    //Time between ADC scans - The same as samplePeriod() unless oversampling
+    static constexpr std::chrono::nanoseconds adcPeriod() {
+        return std::chrono::nanoseconds(1000000000 / (RateHz * Oversample));
+    }
+
+    //Writes the metadata line placed at the top of the results file so analysis tools pick up the profile automatically
+    static int describe(char *buffer, size_t size) {
+        return snprintf(buffer, size, "# rate_hz=%u window_s=%u channels=%u samples_per_window=%u oversample=%u\n",
+                        (unsigned)RateHz, (unsigned)WindowSeconds, (unsigned)Channels, (unsigned)samplesPerWindow, (unsigned)Oversample);
+    }
+};
+
+#endif
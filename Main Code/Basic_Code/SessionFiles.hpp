@@ -0,0 +1,306 @@
+#ifndef __SESSION_FILES_HPP__
+#define __SESSION_FILES_HPP__
+
+#include "RecordFormat.hpp"
+#include "Crc32.hpp"
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__MBED__)
+#include "mbed.h"
+#include "StorageSession.hpp"
+#include <ctime>
+#endif
+
+/*
+Session files - Every recording goes into its own numbered files with an index, so nothing on the card is wiped at start up.
+- Session n is written to sNNNNpPP.bin (or .txt), starting at part 01. A new session is numbered one above the highest session with
+  any file on the card, found by listing the root directory once - So a session removed from the middle is never reused, resume()
+  always finds the latest session, and a part file left without its index is never opened over.
+- A session moves on to its next part once the file would pass rotateBytes or every rotateWindows windows of recording, so no one
+  file grows without limit. Rotation only happens between windows and each part stands on its own - A binary part starts with its
+  own file header and journal (RecordJournal.hpp), a text part with the profile line.
+- sNNNN.idx indexes the session - A SessionIndexHeader with the session number, the real time clock at the start, the rotation
+  limits and the RecordFileHeader the session was recorded with, then one SessionIndexEntry per window in order. Window w is found by
+  reading entry w at sizeof(SessionIndexHeader) + w * sizeof(SessionIndexEntry), which gives its part and byte offset, so a host
+  tool can seek straight to any window without reading the data before it. The window count is the number of whole entries.
+- Entries are appended as windows are written and synced with the data, data first. After a reset resume() reopens the last
+  session and recover() brings the index into line with the windows the journal recovered.
+- Record_Decoder --index reads a session back through its index.
+- Only the layout is needed on the host, so the class itself is only built for Mbed.
+*/
+
+static const uint32_t sessionIndexMagic = 0x58444953; //"SIDX" in a little endian file
+static const uint16_t sessionIndexVersion = 2; //Version 2 holds the version 5 RecordFileHeader, with its recording ID
+static const uint32_t sessionMaxId = 9999;
+static const uint16_t sessionMaxParts = 99;
+
+enum SessionFormat : uint16_t {
+    sessionFormatRecords = 0, //Binary records (RecordFormat.hpp) with a journal
+    sessionFormatText = 1 //CSV text
+};
+
+struct SessionIndexHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize; //sizeof(SessionIndexHeader) for this version
+    uint32_t sessionId;
+    uint16_t format; //SessionFormat of the part files
+    uint16_t reserved;
+    uint64_t startTime; //Real time clock at the start of the session in seconds since 1970 - Only meaningful if the clock was set
+    uint32_t rotateBytes; //Part size limit - 0 if parts are not limited by size
+    uint32_t rotateWindows; //Windows between parts - 0 if parts are not limited by time
+    RecordFileHeader record; //Profile the session was recorded with - Every binary part starts with the same header
+    uint32_t crc; //CRC32 of everything above
+};
+
+struct SessionIndexEntry {
+    uint32_t firstSequence; //Sequence number of the window's first sample
+    uint16_t part; //Part file holding the window, from 1
+    uint16_t reserved;
+    uint32_t offset; //Where the window starts in the part file
+    uint32_t bytes; //Bytes of the window in the part file
+};
+
+static_assert(sizeof(SessionIndexHeader) == 248, "SessionIndexHeader layout changed - Bump sessionIndexVersion");
+static_assert(sizeof(SessionIndexEntry) == 16, "SessionIndexEntry layout changed - Bump sessionIndexVersion");
+
+//Names of the files of a session - Short 8.3 names so they work with or without long file name support
+inline void sessionPartName(char *name, size_t size, uint32_t session, uint32_t part, SessionFormat format) {
+    snprintf(name, size, "s%04up%02u.%s", (unsigned)session, (unsigned)part, (format == sessionFormatText) ? "txt" : "bin");
+}
+
+inline void sessionIndexName(char *name, size_t size, uint32_t session) {
+    snprintf(name, size, "s%04u.idx", (unsigned)session);
+}
+
+#if defined(__MBED__)
+class SessionFiles {
+private:
+    StorageSession &storage;
+    Crc32SliceBy8 crc; //Software CRC so the index never waits on the hardware CRC unit used by the sampling threads
+    SessionIndexHeader header;
+    SessionIndexEntry last; //Latest entry in the index
+    char partName[16];
+    char indexName[16];
+
+    SessionFormat format;
+    uint32_t rotateBytes;
+    uint32_t rotateWindows;
+    uint32_t session = 0;
+    uint32_t highestSession = 0; //Found by listing the card
+    uint16_t part = 0;
+    uint32_t windowCount = 0;
+    bool partHasWindows = false;
+
+    void nameFiles() {
+        sessionPartName(partName, sizeof(partName), session, part, format);
+        sessionIndexName(indexName, sizeof(indexName), session);
+    }
+
+    //Notes the session number of a session file - sNNNN.idx or sNNNNpPP.bin/.txt in either case, as 8.3 names can be listed in upper case
+    void noteFile(const char *name) {
+        size_t length = strlen(name);
+        if ((length != 9 && length != 12) || tolower(name[0]) != 's') {
+            return;
+        }
+        uint32_t id = 0;
+        for (int i = 1; i <= 4; i++) {
+            if (!isdigit((unsigned char)name[i])) {
+                return;
+            }
+            id = (id * 10) + (name[i] - '0');
+        }
+        bool index = (length == 9 && name[5] == '.' && tolower(name[6]) == 'i' && tolower(name[7]) == 'd' && tolower(name[8]) == 'x');
+        bool part = (length == 12 && tolower(name[5]) == 'p' && isdigit((unsigned char)name[6]) && isdigit((unsigned char)name[7]) && name[8] == '.');
+        if ((index || part) && id > highestSession) {
+            highestSession = id;
+        }
+    }
+
+    //Highest session number with any file on the card - The card must be mounted. 0 if there are none
+    int findHighestSession() {
+        highestSession = 0;
+        return storage.listFiles(callback(this, &SessionFiles::noteFile));
+    }
+
+    off_t entryOffset(uint32_t window) const {
+        return sizeof(SessionIndexHeader) + ((off_t)window * sizeof(SessionIndexEntry));
+    }
+
+public:
+    //Parts rotate once they would pass rotateLimitBytes or every rotateLimitWindows windows - 0 turns either limit off
+    SessionFiles(StorageSession &storageSession, SessionFormat fileFormat, uint32_t rotateLimitBytes, uint32_t rotateLimitWindows)
+        : storage(storageSession), format(fileFormat), rotateBytes(rotateLimitBytes), rotateWindows(rotateLimitWindows) {}
+
+    //Mounts the card and starts the next session - Opens its first part and writes the index header. profile describes the recording
+    int start(const RecordFileHeader &profile) {
+        int err = storage.openCard();
+        if (err != 0) {
+            return err;
+        }
+        if ((err = findHighestSession()) != 0) {
+            return err;
+        }
+        if (highestSession >= sessionMaxId) {
+            return -1; //The last session number is used - Old sessions have to be read off and removed
+        }
+        session = highestSession + 1;
+        part = 1;
+        windowCount = 0;
+        partHasWindows = false;
+        nameFiles();
+
+        //Nothing above the highest session should exist, but a file that does is never cleared
+        if (storage.exists(partName) || storage.exists(indexName)) {
+            return -1;
+        }
+        if ((err = storage.open(partName, true)) != 0) {
+            return err;
+        }
+        if ((err = storage.openIndex(indexName, true)) != 0) {
+            return err;
+        }
+
+        memset(&header, 0, sizeof(header));
+        header.magic = sessionIndexMagic;
+        header.version = sessionIndexVersion;
+        header.headerSize = sizeof(SessionIndexHeader);
+        header.sessionId = session;
+        header.format = format;
+        header.startTime = (uint64_t)time(NULL);
+        header.rotateBytes = rotateBytes;
+        header.rotateWindows = rotateWindows;
+        header.record = profile;
+        crc.compute(&header, offsetof(SessionIndexHeader, crc), &header.crc);
+        return storage.appendIndex(&header, sizeof(header));
+    }
+
+    //Reopens the last session on the card at the end of its latest part - Fails if it was recorded by a different build or profile
+    int resume(const RecordFileHeader &profile) {
+        int err = storage.openCard();
+        if (err != 0) {
+            return err;
+        }
+        if ((err = findHighestSession()) != 0) {
+            return err;
+        }
+        if ((session = highestSession) == 0) {
+            return -1;
+        }
+        part = 1;
+        nameFiles();
+
+        //A session whose index was never written (a reset as it started) has nothing to carry on
+        uint32_t check;
+        if (!storage.exists(indexName)) {
+            return -1;
+        }
+        if ((err = storage.openIndex(indexName, false)) != 0 || (err = storage.readIndex(0, &header, sizeof(header))) != 0) {
+            return err;
+        }
+        crc.compute(&header, offsetof(SessionIndexHeader, crc), &check);
+        if (header.magic != sessionIndexMagic || header.version != sessionIndexVersion || check != header.crc || header.format != format ||
+            !recordSameProfile(header.record, profile)) {
+            return -1;
+        }
+
+        //The latest part is the one the last window went in, or the one after it if the session had just moved on
+        windowCount = (storage.indexSize() - sizeof(SessionIndexHeader)) / sizeof(SessionIndexEntry);
+        partHasWindows = (windowCount > 0 && storage.readIndex(entryOffset(windowCount - 1), &last, sizeof(last)) == 0);
+        if (partHasWindows) {
+            part = last.part;
+            char nextPart[16];
+            sessionPartName(nextPart, sizeof(nextPart), session, part + 1, format);
+            if (part < sessionMaxParts && storage.exists(nextPart)) {
+                part++;
+                partHasWindows = false;
+            }
+        }
+        else {
+            windowCount = 0;
+        }
+        nameFiles();
+        return storage.open(partName, false);
+    }
+
+    //Brings the index into line with the windows the session really has after a resume - Entries past them are cut off and any
+    //windows written since the index was last synced are added by reading their headers from the part, starting at dataStart
+    int recover(uint32_t sessionWindows, off_t dataStart) {
+        if (windowCount > sessionWindows) {
+            windowCount = sessionWindows;
+            partHasWindows = (windowCount > 0 && storage.readIndex(entryOffset(windowCount - 1), &last, sizeof(last)) == 0 && last.part == part);
+        }
+        int err = storage.cutIndex(entryOffset(windowCount));
+
+        while (err == 0 && windowCount < sessionWindows) {
+            RecordWindowHeader window;
+            off_t offset = partHasWindows ? (off_t)(last.offset + last.bytes) : dataStart;
+            if ((err = storage.read(offset, &window, sizeof(window))) == 0 && window.magic != recordWindowMagic) {
+                err = -1;
+            }
+            if (err == 0) {
+                err = addWindow(window.firstSequence, offset, sizeof(window) + window.payloadBytes);
+            }
+        }
+        return err;
+    }
+
+    //Whether the next window of nextBytes should go in a new part
+    bool rotateDue(size_t nextBytes) const {
+        if (!partHasWindows || part >= sessionMaxParts) {
+            return false;
+        }
+        return (rotateBytes > 0 && storage.size() + (off_t)nextBytes > (off_t)rotateBytes) || (rotateWindows > 0 && (windowCount % rotateWindows) == 0);
+    }
+
+    //Finishes the current part and opens the next one - The index is synced first so every window of the old part is in it
+    int rotate() {
+        int err = storage.sync();
+        if (err == 0) {
+            part++;
+            nameFiles();
+            partHasWindows = false;
+            err = storage.rotate(partName);
+        }
+        return err;
+    }
+
+    //Adds the index entry of a window written at offset in the current part
+    int addWindow(uint32_t firstSequence, off_t offset, uint32_t bytes) {
+        SessionIndexEntry entry = {firstSequence, part, 0, (uint32_t)offset, bytes};
+        int err = storage.appendIndex(&entry, sizeof(entry));
+        if (err == 0) {
+            last = entry;
+            windowCount++;
+            partHasWindows = true;
+        }
+        return err;
+    }
+
+    uint32_t id() const {
+        return session;
+    }
+
+    uint32_t parts() const {
+        return part;
+    }
+
+    uint32_t windows() const {
+        return windowCount;
+    }
+
+    const char *fileName() const {
+        return partName;
+    }
+
+    const char *indexFileName() const {
+        return indexName;
+    }
+};
+#endif
+
+#endif
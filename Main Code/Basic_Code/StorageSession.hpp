@@ -0,0 +1,445 @@
+#ifndef __STORAGE_SESSION_HPP__
+#define __STORAGE_SESSION_HPP__
+
+#if defined(__MBED__)
+#include "mbed.h"
+#include "FATFileSystem.h"
+#else
+#include "HostFileSystem.hpp"
+#endif
+#include <cstdint>
+#include <sys/stat.h>
+
+/*
+Long lived micro-SD session for the results file.
+- The card is initialised and the FAT file system mounted once, and the results file stays open between windows, so a window write
+  is only the write itself rather than an init, mount, open, close and deinit every time.
+- Space is preallocated ahead of the data in preallocateBytes steps with File::truncate(), so the cluster chain is allocated and the
+  file size covers the data before it is written. close() trims the file back to the data actually written.
+- Preallocated space is not cleared and holds whatever the clusters held before, which can be intact windows of an older recording if
+  sampling is cut off before close(). Each window carries the CRC of its own recording's file header (RecordFormat.hpp), so the
+  journal and Record_Decoder take such a window as the end of the data rather than part of this recording.
+- The file is synced every syncEvery windows (0 syncs only on close) and whenever more space is preallocated.
+- A window is written as beginWindow(), any number of append()s and endWindow(). If an append fails the card is re-initialised,
+  remounted and the file reopened at the end of the data, then that append is tried once more.
+- Every window write is timed from beginWindow() to endWindow() - lastWriteUs(), worstWriteUs() and meanWriteUs() report the latency seen by the writer.
+- read() and writeAt() reach back into the data already written and rewind() cuts it back - Used by RecordJournal to find and keep
+  the end of a recording after a reset. The write position is always left at the end of the data.
+- An index file can be kept open alongside the results file (openIndex()) - It is synced, reopened and closed with it but never preallocated.
+  rotate() finishes the results file and carries on in a new one without releasing the card (SessionFiles.hpp).
+- File names are relative to the card's file system, e.g. "s0001p01.bin" - Not the "/sd/..." paths used with fopen().
+- With remountEachWindow set the session goes back to the old behaviour of mounting and opening the file for every window, so both
+  can be measured on the same card.
+- When not built for Mbed, HostFileSystem.hpp stands in for the file system so the session can be timed on the host (Storage_Benchmark).
+*/
+
+//One file of a session - Keeps the end of the data apart from the end of the space preallocated after it
+class StorageFile {
+private:
+    File file;
+    const char *path = nullptr;
+    bool fileOpen = false;
+    off_t dataEnd = 0; //End of the data written so far
+    off_t allocatedEnd = 0; //End of the space preallocated for the file
+    bool positionKnown = false; //Set once dataEnd has been worked out, so a reopen goes back to the end of the data rather than the end of the file
+
+public:
+    //Sets the file the next open() opens
+    void name(const char *filePath) {
+        path = filePath;
+        positionKnown = false;
+    }
+
+    bool named() const {
+        return path != nullptr;
+    }
+
+    bool isOpen() const {
+        return fileOpen;
+    }
+
+    off_t size() const {
+        return dataEnd;
+    }
+
+    //Opens the file with the write position at the end of the data - The file is cleared first if truncate is set
+    int open(FileSystem &fs, bool truncate) {
+        int err = file.open(&fs, path, O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0));
+        if (err != 0) {
+            return err;
+        }
+        fileOpen = true;
+
+        if (truncate) {
+            dataEnd = 0;
+            allocatedEnd = 0;
+        }
+        else if (!positionKnown) {
+            //Existing file opened for the first time - The data ends where the file does
+            dataEnd = file.size();
+            allocatedEnd = dataEnd;
+        }
+        else {
+            //Reopened - Whatever was preallocated and synced before is still there
+            allocatedEnd = file.size();
+        }
+        positionKnown = true;
+        return (file.seek(dataEnd, SEEK_SET) == dataEnd) ? 0 : -1;
+    }
+
+    void close() {
+        if (fileOpen) {
+            file.close();
+            fileOpen = false;
+        }
+    }
+
+    //Makes sure there is room for size more bytes past the end of the data
+    int reserve(size_t size, uint32_t preallocateBytes) {
+        if (preallocateBytes == 0 || (dataEnd + (off_t)size) <= allocatedEnd) {
+            return 0;
+        }
+
+        off_t newEnd = allocatedEnd;
+        while (newEnd < dataEnd + (off_t)size) {
+            newEnd += preallocateBytes;
+        }
+
+        //Truncating beyond the end grows the file and allocates its clusters - Synced straight away so the allocation is on the card
+        int err = file.truncate(newEnd);
+        if (err == 0) {
+            err = file.sync();
+        }
+        if (err == 0 && file.seek(dataEnd, SEEK_SET) != dataEnd) {
+            err = -1;
+        }
+        if (err == 0) {
+            allocatedEnd = newEnd;
+        }
+        return err;
+    }
+
+    int writeAll(const void *data, size_t size, uint32_t preallocateBytes) {
+        int err = reserve(size, preallocateBytes);
+        if (err != 0) {
+            return err;
+        }
+        ssize_t written = file.write(data, size);
+        if (written != (ssize_t)size) {
+            return (written < 0) ? (int)written : -1;
+        }
+        dataEnd += size;
+        return 0;
+    }
+
+    //Reads size bytes at offset back from the file - Returns 0 only if all of them were read
+    int read(off_t offset, void *data, size_t size) {
+        if (!fileOpen || file.seek(offset, SEEK_SET) != offset) {
+            return -1;
+        }
+        ssize_t got = file.read(data, size);
+        if (file.seek(dataEnd, SEEK_SET) != dataEnd) {
+            return -1;
+        }
+        return (got == (ssize_t)size) ? 0 : -1;
+    }
+
+    //Writes over data already in the file - Must end at or before the end of the data
+    int writeAt(off_t offset, const void *data, size_t size) {
+        if (!fileOpen || offset + (off_t)size > dataEnd || file.seek(offset, SEEK_SET) != offset) {
+            return -1;
+        }
+        ssize_t written = file.write(data, size);
+        if (file.seek(dataEnd, SEEK_SET) != dataEnd) {
+            return -1;
+        }
+        return (written == (ssize_t)size) ? 0 : -1;
+    }
+
+    //Moves the end of the data back to end - The next append writes over whatever followed it
+    int rewind(off_t end) {
+        if (!fileOpen || end > dataEnd || file.seek(end, SEEK_SET) != end) {
+            return -1;
+        }
+        dataEnd = end;
+        return 0;
+    }
+
+    //Rewinds and trims the rest of the file off - For an index, where a torn entry left past the end must not be read back later
+    int cut(off_t end) {
+        int err = rewind(end);
+        if (err == 0) {
+            err = file.truncate(dataEnd);
+        }
+        if (err == 0) {
+            allocatedEnd = dataEnd;
+        }
+        return err;
+    }
+
+    int sync() {
+        return fileOpen ? file.sync() : 0;
+    }
+
+    //Trims any preallocated space off and syncs
+    int trim() {
+        int err = 0;
+        if (fileOpen) {
+            if (allocatedEnd > dataEnd) {
+                err = file.truncate(dataEnd);
+                allocatedEnd = dataEnd;
+            }
+            int syncErr = file.sync();
+            err = (err != 0) ? err : syncErr;
+        }
+        return err;
+    }
+};
+
+class StorageSession {
+private:
+    BlockDevice &device;
+    FATFileSystem fs;
+    StorageFile results;
+    StorageFile index;
+
+    bool mounted = false;
+    bool remountEachWindow;
+    uint32_t preallocateBytes;
+    uint32_t syncEvery;
+
+    uint32_t windowsSinceSync = 0;
+    uint32_t windowStartUs = 0;
+
+    uint32_t remountCount = 0;
+    uint32_t windowCount = 0;
+    uint32_t lastUs = 0;
+    uint32_t worstUs = 0;
+    uint64_t totalUs = 0;
+
+    int mount() {
+        if (mounted) {
+            return 0;
+        }
+        int err = device.init();
+        if (err == 0 && (err = fs.mount(&device)) != 0) {
+            device.deinit();
+        }
+        mounted = (err == 0);
+        return err;
+    }
+
+    void unmount() {
+        results.close();
+        index.close();
+        if (mounted) {
+            fs.unmount();
+            device.deinit();
+            mounted = false;
+        }
+    }
+
+    //Brings the card back up with the files open at the end of their data
+    int reopen() {
+        unmount();
+        int err = mount();
+        if (err == 0) {
+            err = results.open(fs, false);
+        }
+        if (err == 0 && index.named()) {
+            err = index.open(fs, false);
+        }
+        return err;
+    }
+
+    //Adds data to the end of a file - A failed write is retried once after remounting the card
+    int appendTo(StorageFile &target, const void *data, size_t size, uint32_t preallocate) {
+        int err = target.writeAll(data, size, preallocate);
+        if (err != 0) {
+            remountCount++;
+            if ((err = reopen()) == 0) {
+                err = target.writeAll(data, size, preallocate);
+            }
+        }
+        return err;
+    }
+
+public:
+    StorageSession(BlockDevice &blockDevice, const char *mountName, uint32_t preallocate, uint32_t syncWindows, bool remountWindows = false)
+        : device(blockDevice), fs(mountName), remountEachWindow(remountWindows), preallocateBytes(preallocate), syncEvery(syncWindows) {}
+
+    ~StorageSession() {
+        close();
+    }
+
+    //Mounts the card without opening a file - So what is already on it can be looked at first
+    int openCard() {
+        return mount();
+    }
+
+    //Mounts the card and opens the results file at filePath - Returns 0 on success or the block device/file system error
+    int open(const char *filePath, bool truncate) {
+        results.name(filePath);
+        int err = mount();
+        if (err == 0 && (err = results.open(fs, truncate)) != 0) {
+            unmount();
+        }
+        return err;
+    }
+
+    //Opens an index file alongside the results file - The session must already be open
+    int openIndex(const char *indexPath, bool truncate) {
+        index.name(indexPath);
+        return mounted ? index.open(fs, truncate) : -1;
+    }
+
+    //Finishes the results file and carries on in a new one at filePath - The card and the index stay open
+    int rotate(const char *filePath) {
+        int err = results.trim();
+        results.close();
+        results.name(filePath);
+        if (err == 0) {
+            err = results.open(fs, true);
+        }
+        return err;
+    }
+
+    //Checks whether a file exists on the card - The session must be open
+    bool exists(const char *filePath) {
+        struct stat st;
+        return mounted && fs.stat(filePath, &st) == 0;
+    }
+
+#if defined(__MBED__)
+    //Calls found with the name of every entry in the root directory of the card - The card must be mounted
+    int listFiles(mbed::Callback<void(const char *)> found) {
+        Dir dir;
+        int err = mounted ? dir.open(&fs, "/") : -1;
+        if (err != 0) {
+            return err;
+        }
+        struct dirent entry;
+        ssize_t got;
+        while ((got = dir.read(&entry)) > 0) {
+            found(entry.d_name);
+        }
+        dir.close();
+        return (got < 0) ? (int)got : 0;
+    }
+#endif
+
+    //Starts timing a window and makes sure the file is open
+    int beginWindow() {
+        windowStartUs = us_ticker_read();
+        return (mounted && results.isOpen()) ? 0 : reopen();
+    }
+
+    //Adds data to the end of the file - A failed write is retried once after remounting the card
+    int append(const void *data, size_t size) {
+        return appendTo(results, data, size, preallocateBytes);
+    }
+
+    int appendIndex(const void *data, size_t size) {
+        return appendTo(index, data, size, 0);
+    }
+
+    //Finishes a window - Syncs if the policy says so and records how long the window took
+    int endWindow() {
+        int err = 0;
+        if (syncEvery > 0 && ++windowsSinceSync >= syncEvery) {
+            err = sync();
+        }
+
+        //Old behaviour - The file is closed and the card released after every window
+        if (err == 0 && remountEachWindow) {
+            err = close();
+        }
+
+        lastUs = us_ticker_read() - windowStartUs;
+        if (lastUs > worstUs) {
+            worstUs = lastUs;
+        }
+        totalUs += lastUs;
+        windowCount++;
+        return err;
+    }
+
+    //Forces everything written so far onto the card - The results file first, so the index never points past its data
+    int sync() {
+        windowsSinceSync = 0;
+        int err = results.sync();
+        return (err == 0) ? index.sync() : err;
+    }
+
+    //Trims the preallocated space, syncs and releases the card - The session can be reopened by the next write
+    int close() {
+        int err = results.trim();
+        int indexErr = index.trim();
+        unmount();
+        return (err != 0) ? err : indexErr;
+    }
+
+    int read(off_t offset, void *data, size_t size) {
+        return results.read(offset, data, size);
+    }
+
+    int writeAt(off_t offset, const void *data, size_t size) {
+        return results.writeAt(offset, data, size);
+    }
+
+    int rewind(off_t end) {
+        return results.rewind(end);
+    }
+
+    int readIndex(off_t offset, void *data, size_t size) {
+        return index.read(offset, data, size);
+    }
+
+    int writeIndexAt(off_t offset, const void *data, size_t size) {
+        return index.writeAt(offset, data, size);
+    }
+
+    //Cuts the index back to end bytes - The file is trimmed too so nothing past it is read back later
+    int cutIndex(off_t end) {
+        return index.cut(end);
+    }
+
+    //Bytes written to the results file and to the index
+    off_t size() const {
+        return results.size();
+    }
+
+    off_t indexSize() const {
+        return index.size();
+    }
+
+    bool isOpen() const {
+        return results.isOpen();
+    }
+
+    uint32_t lastWriteUs() const {
+        return lastUs;
+    }
+
+    uint32_t worstWriteUs() const {
+        return worstUs;
+    }
+
+    uint32_t meanWriteUs() const {
+        return (windowCount > 0) ? (uint32_t)(totalUs / windowCount) : 0;
+    }
+
+    //Clears the latency figures - e.g. after a benchmark so the recording starts afresh
+    void resetStats() {
+        windowCount = 0;
+        lastUs = 0;
+        worstUs = 0;
+        totalUs = 0;
+    }
+
+    uint32_t remounts() const {
+        return remountCount;
+    }
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef __WINDOW_FILLER_HPP__
+#define __WINDOW_FILLER_HPP__
+
+#include <cstdint>
+#include "SampleRing.hpp"
+#include "BufferPool.hpp"
+#include "OverloadPolicy.hpp"
+
+/*
+Window filler - The consumer side of sampling. Takes numbered samples off the sample ring and fills window buffers from a BufferPool,
+waiting for a buffer or dropping whole windows as the overload policy (OverloadPolicy.hpp) says.
+- Only takes what fits in the current window off the ring, and nothing at all until there is a window buffer to put it in. Once the
+  ring is nearly full the window is dropped instead, so its samples are taken off and thrown away.
+- A break in the sequence numbers means samples were lost before reaching here. Windows are aligned to multiples of WindowSamples in
+  the sample sequence, so the windows the gap covers are worked out from it and dropped whole, including the rest of the one the gap
+  ends in. With overloadReset, or a sequence number going backwards, the gap is fatal instead.
+- What is done with the samples is left to Events, so the firmware and Overload_Sim run the same decisions:
+    void bufferWait() - Every window buffer is waiting to be written, so the samples stay on the ring
+    void overloadDrop(uint32_t firstSequence) - No window buffer and the ring is nearly full, so the window is being dropped
+    void sequenceGap(uint32_t expected, uint32_t received, bool fatal) - Samples were lost before reaching the filler
+    void store(Window &window, uint32_t index, const Sample &sample) - Puts a sample into a window
+    void windowDropped(uint32_t firstSequence) - A window ended without being written
+    int windowFull(Window &window, uint32_t firstSequence) - Seals a full window, nonzero stops the filler
+    void windowSealed() - A full window has been handed to the writer
+- Only used from the consumer thread. Plain C++ with no Mbed dependency so Overload_Sim runs it on the host.
+*/
+
+template <typename Window, uint32_t Buffers, uint32_t WindowSamples, typename Events>
+class WindowFiller {
+private:
+    BufferPool<Window, Buffers> &pool;
+    OverloadPolicy &overload;
+    Events &events;
+
+    Window *filling = nullptr; //Window currently being filled
+    bool dropping = false; //Set while the samples of the current window are being thrown away
+    uint32_t sampleCounter = 0; //Samples in the current window so far
+    uint32_t expected = 0; //Sequence number expected next
+    uint32_t firstSequence = 0; //Sequence number of the first sample in the current window
+
+    //Drops the windows samples were lost from - Called with the sequence number of the first sample after the gap
+    void skipToSample(uint32_t sequence) {
+        //Windows that ended inside the gap, including the one being filled if it did
+        uint32_t ended = (sequence / WindowSamples) - (expected / WindowSamples);
+        for (uint32_t i = 0; i < ended; i++) {
+            endDroppedWindow(((expected / WindowSamples) + i) * WindowSamples);
+        }
+
+        overload.addLostSamples(sequence - expected);
+        expected = sequence;
+        sampleCounter = sequence % WindowSamples;
+        firstSequence = sequence - sampleCounter;
+
+        //Part way into a window - The start of it is missing so the rest is dropped too
+        dropping = (sampleCounter != 0);
+    }
+
+    void endDroppedWindow(uint32_t first) {
+        overload.windowDropped();
+        events.windowDropped(first);
+    }
+
+public:
+    WindowFiller(BufferPool<Window, Buffers> &windowPool, OverloadPolicy &overloadPolicy, Events &fillerEvents)
+        : pool(windowPool), overload(overloadPolicy), events(fillerEvents) {}
+
+    //Starts filling from sequence, which has to be on a window boundary - Used when sampling carries on after a reset
+    void restart(uint32_t sequence) {
+        expected = sequence;
+        firstSequence = sequence;
+    }
+
+    uint32_t nextSequence() const {
+        return expected;
+    }
+
+    //Drains every sample waiting on the ring, Block at a time - ringSpace is worked out from the ring for the overload policy.
+    //Returns false if Events stopped the filler
+    template <uint32_t Block, typename Sample, uint32_t Capacity>
+    bool drain(SampleRing<Sample, Capacity> &ring) {
+        Sample payload[Block];
+        uint32_t count;
+
+        while (true) {
+            if (filling == nullptr && !dropping && (filling = pool.acquire()) == nullptr) {
+                if (overload.noBuffer(ring.capacity() - ring.size()) == windowWait) {
+                    events.bufferWait();
+                    return true;
+                }
+                events.overloadDrop(expected);
+                dropping = true;
+            }
+
+            uint32_t space = WindowSamples - sampleCounter;
+            if ((count = ring.pop(payload, (space < Block) ? space : Block)) == 0) {
+                return true;
+            }
+            for (uint32_t i = 0; i < count; i++) {
+                if (!add(payload[i])) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    //Buffers a single sample taken off the ring - Returns false if Events stopped the filler
+    template <typename Sample>
+    bool add(const Sample &sample) {
+        if (sample.sequence != expected) {
+            bool fatal = !overload.dropsWindows() || sample.sequence < expected;
+            events.sequenceGap(expected, sample.sequence, fatal);
+            if (fatal) {
+                return false;
+            }
+            skipToSample(sample.sequence);
+        }
+        expected++;
+
+        //The first sample of a window sets the sequence number recorded for it
+        if (sampleCounter == 0) {
+            firstSequence = sample.sequence;
+
+            //Only after a gap part way through a block - The samples are already off the ring, so with no free buffer the window is dropped
+            if (filling == nullptr && !dropping && (filling = pool.acquire()) == nullptr) {
+                dropping = true;
+            }
+        }
+
+        if (!dropping) {
+            events.store(*filling, sampleCounter, sample);
+        }
+        sampleCounter++;
+
+        if (sampleCounter < WindowSamples) {
+            return true;
+        }
+
+        //A dropped window ends without being sealed - Its buffer, if it had one, is kept for the next window
+        if (dropping) {
+            endDroppedWindow(firstSequence);
+            dropping = false;
+            sampleCounter = 0;
+            return true;
+        }
+
+        if (events.windowFull(*filling, firstSequence) != 0) {
+            return false;
+        }
+        pool.seal(filling);
+        filling = nullptr;
+        sampleCounter = 0;
+        events.windowSealed();
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,313 @@
+#ifndef __WRITE_BEHIND_BLOCK_DEVICE_HPP__
+#define __WRITE_BEHIND_BLOCK_DEVICE_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__MBED__)
+#include "mbed.h"
+#include "BlockDevice.h"
+#else
+#include "HostBlockDevice.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+/*
+Write behind queue in front of a block device - The writer hands over a write and carries on while the worker thread writes it.
+- program() copies the data into one of Slots request slots of SlotBytes each and returns straight away. A worker thread writes the
+  slots to the wrapped device in order, so up to Slots writes are outstanding at once. program() only waits when every slot is full.
+- Completion is signalled with event flags - The writer sleeps on them rather than polling while it waits for a slot or a sync().
+- The worker runs below normal priority. SDBlockDevice does not sleep while the card is busy - It polls the card over SPI, so the
+  worker keeps the CPU for the whole write and the sampling, buffering and writer threads only run by preempting it. The queue
+  shortens how long the writer is held by a write, it does not free the CPU time the card costs for anything else.
+- The transfers are not DMA. SDBlockDevice uses blocking SPI calls, and on the STM32 targets SPI::transfer() (DEVICE_SPI_ASYNCH) is
+  interrupt driven a frame at a time. Using it would mean a new SD driver, and the card's busy time after every block, the larger part
+  of a write, would still be polled.
+- read(), erase(), trim() and sync() wait for the queue to empty first, so the card is always seen as if every write had finished.
+  sync() then syncs the device, so once it returns everything written is on the card.
+- A failed write is kept and returned by the next program() or sync(), so an error is never lost even though the write it came from
+  has already returned.
+- Sits under the file system or raw log like any other block device, e.g. WriteBehindBlockDevice<3, 2048> sdBehind(sd).
+- When not built for Mbed, std::thread stands in for the RTOS so the queue can be run against a simulated card (Write_Behind_Sim).
+*/
+template <int Slots, int SlotBytes>
+class WriteBehindBlockDevice : public BlockDevice {
+    static_assert(Slots > 0 && SlotBytes >= 512 && (SlotBytes % 512) == 0, "Slots must hold whole sectors");
+
+private:
+    struct Request {
+        bd_addr_t addr;
+        bd_size_t size;
+        uint8_t data[SlotBytes];
+    };
+
+    static const uint32_t flagQueued = 1; //A request was added
+    static const uint32_t flagDone = 2; //A request was written
+    static const uint32_t flagStop = 4; //Worker should exit
+
+    BlockDevice &device;
+    Request requests[Slots];
+    int head = 0; //Next request the worker writes
+    int count = 0; //Requests waiting or being written
+    int firstError = 0;
+    bool running = false; //Worker started - It then stays up across deinit() and init() as the card is remounted
+    bool stopping = false;
+
+    uint32_t peakCount = 0;
+    uint32_t fullWaits = 0;
+
+#if defined(__MBED__)
+    rtos::Thread worker;
+    rtos::Mutex lock;
+    rtos::EventFlags flags;
+
+    void lockQueue() {
+        lock.lock();
+    }
+
+    void unlockQueue() {
+        lock.unlock();
+    }
+
+    void signal(uint32_t flag) {
+        flags.set(flag);
+    }
+
+    //Sleeps until flag is set - The queue must not be locked
+    void waitFor(uint32_t flag) {
+        flags.wait_any(flag);
+    }
+
+    void startWorker() {
+        worker.start(mbed::callback(this, &WriteBehindBlockDevice::run));
+    }
+
+    void stopWorker() {
+        worker.join();
+    }
+#else
+    std::thread worker;
+    std::mutex lock;
+    std::condition_variable changed;
+    uint32_t pendingFlags = 0;
+
+    void lockQueue() {
+        lock.lock();
+    }
+
+    void unlockQueue() {
+        lock.unlock();
+    }
+
+    void signal(uint32_t flag) {
+        std::lock_guard<std::mutex> guard(lock);
+        pendingFlags |= flag;
+        changed.notify_all();
+    }
+
+    void waitFor(uint32_t flag) {
+        std::unique_lock<std::mutex> guard(lock);
+        changed.wait(guard, [&] { return (pendingFlags & flag) != 0; });
+        pendingFlags &= ~flag;
+    }
+
+    void startWorker() {
+        worker = std::thread(&WriteBehindBlockDevice::run, this);
+    }
+
+    void stopWorker() {
+        worker.join();
+    }
+#endif
+
+    //Worker thread - Writes requests oldest first until told to stop with nothing left to write
+    void run() {
+        while (true) {
+            lockQueue();
+            bool empty = (count == 0);
+            bool stop = stopping;
+            unlockQueue();
+
+            if (empty) {
+                if (stop) {
+                    return;
+                }
+                waitFor(flagQueued | flagStop);
+                continue;
+            }
+
+            //The slot stays counted until it is written, so the writer can not reuse it mid write
+            Request &request = requests[head];
+            int err = device.program(request.data, request.addr, request.size);
+
+            lockQueue();
+            if (err != 0 && firstError == 0) {
+                firstError = err;
+            }
+            head = (head + 1) % Slots;
+            count--;
+            unlockQueue();
+            signal(flagDone);
+        }
+    }
+
+    //Waits until the worker has written every request
+    void drain() {
+        while (true) {
+            lockQueue();
+            bool empty = (count == 0);
+            unlockQueue();
+            if (empty) {
+                return;
+            }
+            waitFor(flagDone);
+        }
+    }
+
+    int takeError() {
+        lockQueue();
+        int err = firstError;
+        firstError = 0;
+        unlockQueue();
+        return err;
+    }
+
+public:
+#if defined(__MBED__)
+    explicit WriteBehindBlockDevice(BlockDevice &blockDevice) : device(blockDevice), worker(osPriorityBelowNormal, 1536, nullptr, "sdBehind") {}
+#else
+    explicit WriteBehindBlockDevice(BlockDevice &blockDevice) : device(blockDevice) {}
+#endif
+
+    ~WriteBehindBlockDevice() {
+        if (running) {
+            lockQueue();
+            stopping = true;
+            unlockQueue();
+            signal(flagStop);
+            stopWorker();
+        }
+    }
+
+    int init() override {
+        int err = device.init();
+        if (err == 0 && !running) {
+            running = true;
+            startWorker();
+        }
+        return err;
+    }
+
+    //Finishes every queued write before the device is shut down
+    int deinit() override {
+        drain();
+        int err = takeError();
+        int deinitErr = device.deinit();
+        return (err != 0) ? err : deinitErr;
+    }
+
+    //Queues the write and returns - Only waits if every slot is already in use
+    int program(const void *buffer, bd_addr_t addr, bd_size_t size) override {
+        if (!running) {
+            return device.program(buffer, addr, size);
+        }
+
+        const uint8_t *data = (const uint8_t *)buffer;
+        while (size > 0) {
+            bd_size_t part = (size < (bd_size_t)SlotBytes) ? size : (bd_size_t)SlotBytes;
+
+            lockQueue();
+            while (count == Slots) {
+                fullWaits++;
+                unlockQueue();
+                waitFor(flagDone);
+                lockQueue();
+            }
+            Request &request = requests[(head + count) % Slots];
+            unlockQueue();
+
+            //Only this thread adds requests, so the free slot can be filled outside the lock
+            memcpy(request.data, data, part);
+            request.addr = addr;
+            request.size = part;
+
+            lockQueue();
+            count++;
+            peakCount = ((uint32_t)count > peakCount) ? (uint32_t)count : peakCount;
+            unlockQueue();
+            signal(flagQueued);
+
+            data += part;
+            addr += part;
+            size -= part;
+        }
+        return takeError();
+    }
+
+    int read(void *buffer, bd_addr_t addr, bd_size_t size) override {
+        drain();
+        return device.read(buffer, addr, size);
+    }
+
+    int erase(bd_addr_t addr, bd_size_t size) override {
+        drain();
+        return device.erase(addr, size);
+    }
+
+    int trim(bd_addr_t addr, bd_size_t size) override {
+        drain();
+        return device.trim(addr, size);
+    }
+
+    //Returns once every queued write is on the card - Any write that failed since the last sync is reported here
+    int sync() override {
+        drain();
+        int err = takeError();
+        int syncErr = device.sync();
+        return (err != 0) ? err : syncErr;
+    }
+
+    bd_size_t get_read_size() const override {
+        return device.get_read_size();
+    }
+
+    bd_size_t get_program_size() const override {
+        return device.get_program_size();
+    }
+
+    bd_size_t get_erase_size() const override {
+        return device.get_erase_size();
+    }
+
+    bd_size_t get_erase_size(bd_addr_t addr) const override {
+        return device.get_erase_size(addr);
+    }
+
+    int get_erase_value() const override {
+        return device.get_erase_value();
+    }
+
+    bd_size_t size() const override {
+        return device.size();
+    }
+
+    const char *get_type() const override {
+        return device.get_type();
+    }
+
+    //Most writes that were outstanding at once
+    uint32_t peakOutstanding() const {
+        return peakCount;
+    }
+
+    //Times program() had to wait for a free slot
+    uint32_t slotWaits() const {
+        return fullWaits;
+    }
+};
+
+#endif
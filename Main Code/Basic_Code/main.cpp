@@ -1,8 +1,38 @@
 #include "SDBlockDevice.h"
 #include "FATFileSystem.h"
 #include "PushSwitch.hpp"
+#include "AdcDma.hpp"
+#include "SampleRing.hpp"
+#include "Crc32.hpp"
+#include "SampleBlock.hpp"
+#include "BufferPool.hpp"
+#include "SamplingConfig.hpp"
+#include "SampleJitter.hpp"
+#include "CicDecimator.hpp"
+#include "RecordFormat.hpp"
+#include "StorageSession.hpp"
+#include "RecordJournal.hpp"
+#include "SessionFiles.hpp"
+#include "RiceCodec.hpp"
+#include "CsvWriter.hpp"
+#include "WriteBehindBlockDevice.hpp"
+#include "OverloadPolicy.hpp"
+#include "WindowFiller.hpp"
+//The flash spill area holds binary records for session files, so it is left out of text and raw log builds
+#if MBED_CONF_APP_FLASH_SPILL_KB > 0 && MBED_CONF_APP_BINARY_RECORDS && !MBED_CONF_APP_RAW_BLOCK_LOG
+#define FLASH_SPILL 1
+#include "FlashIAPBlockDevice.h"
+#include "FlashSpill.hpp"
+#else
+#define FLASH_SPILL 0
+#endif
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+#include "SlicingBlockDevice.h"
+#include "RawBlockLog.hpp"
+#endif
 #include <chrono>
 #include "mbed.h"
+#include "hal/us_ticker_api.h"
 #include <chrono>
 #include <cstdio>
 #include <cstdint>
@@ -22,9 +52,29 @@ Description:
 - This code is the same as the Project_Sampling_Code_With_Error_Buttons but missing the force error buttons so the code can be ran safety without the extra buttons.
 - This is the main file for the Blood Glucose measuring via PPG signals.
 - Most functions are contained in this main file rather than separate .hpp and .cpp files as the bulk of the code is sampling and writing to an SD Card.
-- RTOS is used for accurate sampling via threads and a MailBox.
-- CRC has been implemented to ensure data integrity throughout the code.
-- An SD Card is required to run this code!
+- Sampling is triggered by a hardware timer with DMA collecting the ADC results (AdcDma.hpp), so samples arrive in blocks rather than one thread wakeup per sample.
+- The analog inputs are set by a channel list and converted together in one ADC scan, so every channel of a sample is taken at the same time.
+- The ADC can be oversampled and decimated back down to the sample rate (CicDecimator.hpp) for more than 12 bits of resolution - The noise floor achieved is reported every window.
+- Every DMA block is timestamped so the regularity of the sampling and the thread latency are reported for each window (SampleJitter.hpp) and kept with the recording - In each window header of binary results, after the last window of CSV results.
+- RTOS threads pass the blocks between each other via a lock free sample ring (SampleRing.hpp).
+- Data integrity is checked end to end - Every sample carries a sequence number so dropped samples are caught, and each full window gets one CRC when it is sealed which is verified just before it is written.
+- Windows are recorded in a binary format (RecordFormat.hpp) by default - Record_Decoder exports them to the same CSV the text mode writes.
+- Binary windows are losslessly compressed (RiceCodec.hpp) before they are written, cutting the data written to the card by 3-5 times for PPG signals.
+- The micro-SD card is mounted once and the results file kept open between windows (StorageSession.hpp), with the write time of every window reported.
+- Every recording is a new session on the card (SessionFiles.hpp) - Numbered files that move on to a new part at a size or time limit,
+  with an index giving the file and offset of every window. Nothing already on the card is wiped.
+- The binary results file is a crash safe journal (RecordJournal.hpp) - After a watchdog or error reset the recording carries on from its last intact window
+  without waiting for the user.
+- Writes to the card go through a write behind queue (WriteBehindBlockDevice.hpp) by default, so the writer hands a window over and carries on
+  while a low priority thread writes it. The SD driver polls the card, so that thread keeps the CPU until a higher priority one preempts it.
+- If the card falls behind, the overload policy (OverloadPolicy.hpp) buffers and then drops whole windows rather than resetting the board,
+  so sampling never stops for the card. Every window dropped and write lost is counted and reported.
+- Windows the card can not take - It is missing at the start, a write failed or it has fallen behind - go to spare sectors of the internal
+  flash instead (FlashSpill.hpp) and are moved across to the card, oldest first, once it catches up. The area is only erased between recordings.
+- With raw-block-log set, windows bypass the file system and go straight to a reserved region of the card (RawBlockLog.hpp) for the highest sustained write rate.
+- A micro-SD Card is needed to keep the results. In binary session builds with flash-spill-kb above 0, sampling starts without one and
+  the windows go to the flash spill area (FlashSpill.hpp) until a card is inserted - Once its flash-spill-kb is full, further windows
+  are lost. Text and raw log builds will not run without a card.
 
 Disclaimer:
 - Some of this code was extracted from code written by me (Cameron Stephens) and James Upfield for the ELEC351 Coursework but implemented for this project.
@@ -32,30 +82,102 @@ Disclaimer:
 
 */
 
-//Structure to store read samples.
+//Sampling profile - Sets the sample rate (Hz), window size (s) and number of ADC channels. Every buffer size below is derived from it and checked against the RAM budget.
+//Switching profile is a one line change - e.g. SamplingConfig<200, 10, 2> is the 5ms/10s profile used by Error_Buttons.
+//The optional fourth parameter oversamples the ADC by that ratio (1 to turn it off), the fifth and sixth set the number of window buffers and whether
+//the 12-bit ADC values are packed into 3 bytes per pair.
+typedef SamplingConfig<500, 4, 2, 16> samplingConfig;
+
+const int bufferSize = samplingConfig::samplesPerWindow; //Samples per window
+const uint32_t dmaBlockSize = samplingConfig::dmaBlockSize; //Decimated samples handed over per DMA half-buffer
+
+//Structure to store read samples - One reading per ADC channel in channel list order.
 struct pdData {
-    unsigned long acRead;
-    unsigned long dcRead; 
+    uint16_t reads[samplingConfig::channels];
 };
 
-//Variables of the structure data type pdData.
-struct pdData readData;
-struct pdData extract;
+//Structure used to pass samples between threads - The sequence number lets the consumer detect any dropped samples.
+struct pdSample {
+    uint32_t sequence;
+    pdData data;
+};
+
+//Structure to record a sealed window - Its CRC is computed once when the window is full and checked once before it is written.
+struct windowSeal {
+    uint32_t firstSequence;
+    uint32_t sampleCount;
+    uint32_t crc;
+    uint64_t startUs; //When the first sample was converted, in microseconds since sampling started
+};
 
-int bufferFlag=0; //Int for buffer switching
-int sampleCounter=0; //Int to count current sample
 int sdDetection; //Int to validate SD Card
+bool cardReady = true; //Cleared while there is no micro-SD Card and windows go to the flash spill area instead
 int sampleFlag=1; //Int to count how many sample periods have occurred.
 int sampleStopFlag=1; //Int for user to input the amount of sample periods.
 
-const chrono::milliseconds sampleRate = 2ms; //Sets the sample rate for the programme 
-const chrono::seconds windowSize = 4s; //Sets the size of the sample window
-const int bufferSize = windowSize/sampleRate;//Const Int for buffer size - Set by the dividing 10s over the sample rate - e.g. 10000/5=2000 samples for 10s
-enum {buf = bufferSize}; //enum created to set the buffers to the bufferSize value
+//Buffers for storing Photodiode data - Each channel is stored as its own uint16_t array.
+typedef SampleBlock<samplingConfig::samplesPerWindow, samplingConfig::channels, samplingConfig::packed> windowBlock;
 
-//Buffers for storing Photodiode data.
-pdData buffer_1[buf];
-pdData buffer_2[buf];
+//A window buffer and the seal for the data held in it
+struct window {
+    RecordWindowHeader record; //Filled in just before writing - Directly in front of the samples so a window is written as one piece
+    windowBlock samples;
+    windowSeal seal;
+    JitterSummary jitter; //Sampling timing while this window was being read
+};
+
+#if !MBED_CONF_APP_BINARY_RECORDS
+//Staging for the CSV text - Two sectors, plus room for the line that crosses into the next pair
+CsvBlockWriter<1024, 128> csvWriter;
+const int csvLockTimeout = -9; //Returned by writeCsvSectors() if sdLock could not be taken
+const uint32_t csvMaxWindowBytes = (bufferSize * samplingConfig::channels * 6) + 2; //Longest a window of text can be - 5 digits and a separator per value
+JitterSummary recordingJitter; //Timing of every window written since sampling started - Written after the last window, as text has no window headers
+#endif
+
+static_assert(offsetof(window, samples) == sizeof(RecordWindowHeader), "Window samples must directly follow the record header");
+
+#if MBED_CONF_APP_COMPRESS_RECORDS && (MBED_CONF_APP_BINARY_RECORDS || MBED_CONF_APP_RAW_BLOCK_LOG)
+//Compressed copy of the window being written - The header sits directly in front of the payload as it does in a window. Only used by writeSDCard()
+struct compressedRecord {
+    RecordWindowHeader record;
+    uint8_t payload[riceMaxChannelBytes(samplingConfig::samplesPerWindow) * samplingConfig::channels];
+} compressedWindow;
+#endif
+
+//Pool of window buffers - More than two lets a slow micro-SD write be absorbed while sampling carries on into the spare buffers
+BufferPool<window, samplingConfig::windowBuffers> windowPool;
+
+//What happens when the card falls behind - Set by the overload- options in mbed_app.json. The ring keeps two DMA blocks of space for pdReading()
+OverloadPolicy overload((OverloadMode)MBED_CONF_APP_OVERLOAD_POLICY, 2 * dmaBlockSize, MBED_CONF_APP_OVERLOAD_MAX_FAILED_WRITES);
+
+uint32_t readSequence=0; //Sequence number given to the next sample read
+uint32_t recordingId=0; //Sets the recording apart from every earlier one - Stored in its file header
+uint32_t recordHeaderCrc=0; //CRC of the recording's file header - Stored in every window header so stale windows are not taken as its own
+
+//What the consumer does with the samples the window filler takes off the sample ring - Defined with consumer()
+struct consumerEvents {
+    void bufferWait();
+    void overloadDrop(uint32_t firstSequence);
+    void sequenceGap(uint32_t expected, uint32_t received, bool fatal);
+    void store(window &w, uint32_t index, const pdSample &payload);
+    void windowDropped(uint32_t firstSequence);
+    int windowFull(window &full, uint32_t firstSequence);
+    void windowSealed();
+} fillerEvents;
+
+//Consumer side of sampling - Fills window buffers from the sample ring, waiting for a buffer or dropping whole windows as the overload policy says
+WindowFiller<window, samplingConfig::windowBuffers, samplingConfig::samplesPerWindow, consumerEvents> filler(windowPool, overload, fillerEvents);
+
+//Sampling timing - Every DMA block is timestamped and the per window summaries are passed to the consumer with the samples
+JitterMonitor jitter(dmaBlockSize * samplingConfig::samplePeriodUs, 10); //Nominal block period with 10us histogram bins
+SampleRing<JitterSummary, 4> jitterSummaries; //Summaries from pdReading() waiting for their window to be sealed
+uint32_t samplesSinceSummary=0; //Samples read since the last jitter summary was taken
+uint64_t sampleClockUs=0; //Time of the latest block interrupt since sampling started - Extended from the 32-bit ticker so it never wraps
+uint32_t lastInterruptUs=0; //Ticker value of the latest block interrupt
+SampleRing<uint64_t, 4> windowStarts; //Start times of windows from pdReading() waiting for their window to be sealed
+
+//Decimation filters for the oversampled ADC - One per channel, fed in step so they all produce a sample at the same time
+CicDecimator<samplingConfig::oversample> decimators[samplingConfig::channels];
 
 Timer tmr1; //Timer
 const uint32_t TIMEOUT_MS = 5000; //Constant for watchdog timeout
@@ -74,9 +196,15 @@ DigitalOut iLED(PA_0, 0); //Turns on the inferred LED for the SFH7060 package
 DigitalOut grnLED(PB_6, 1); //LED used for confirmation
 DigitalOut redLED(PA_1, 0); //LED used for error alerts
 
-//Pins to read in the photodiode data
-AnalogIn acOutput(PC_1);
-AnalogIn dcOutput(PC_0);
+//ADC channel list - Every input is converted in one scan in this order, which is also the channel order of every block, window and results file line.
+//Extra inputs (more photodiodes, a thermistor, ADC_VREF as a supply monitor) are added here along with the channel count in the sampling profile.
+const AdcInput adcInputs[samplingConfig::channels] = {
+    {PC_1, "ac"}, //AC photodiode output (ADC1 IN11)
+    {PC_0, "dc"}, //DC photodiode output (ADC1 IN10)
+};
+
+//Timer triggered ADC with DMA to read in the photodiode data
+AdcDma<samplingConfig::rawBlockSize, samplingConfig::channels> adcDma(adcInputs);
 
 SDBlockDevice sd(PB_5, PB_4, PB_3, PC_7); //SD Card object 
 /* Pin Assignment:
@@ -85,31 +213,84 @@ PB_4    MISO (Master In Slave Out)
 PB_3    SCLK (Serial Clock)
 PC_7    CS (Chip Select) */
 
+#if MBED_CONF_APP_SD_WRITE_BEHIND_SLOTS > 0
+//Write behind queue in front of the card - Set by sd-write-behind-slots and sd-write-behind-slot-kb in mbed_app.json
+WriteBehindBlockDevice<MBED_CONF_APP_SD_WRITE_BEHIND_SLOTS, MBED_CONF_APP_SD_WRITE_BEHIND_SLOT_KB * 1024> sdBehind(sd);
+BlockDevice &card = sdBehind;
+#else
+BlockDevice &card = sd;
+#endif
+
+//micro-SD session - Mounted once and the results file kept open between windows. Set by the sd- options in mbed_app.json
+StorageSession storage(card, "sd", MBED_CONF_APP_SD_PREALLOCATE_KB * 1024, MBED_CONF_APP_SD_SYNC_EVERY, MBED_CONF_APP_SD_REMOUNT_EACH_WINDOW);
+
+#if !MBED_CONF_APP_RAW_BLOCK_LOG
+//Session files on the card - The format is set by binary-records and the part limits by the session-rotate- options in mbed_app.json
+SessionFiles sessions(storage, MBED_CONF_APP_BINARY_RECORDS ? sessionFormatRecords : sessionFormatText, MBED_CONF_APP_SESSION_ROTATE_MB * 1024 * 1024,
+                      (MBED_CONF_APP_SESSION_ROTATE_MINUTES * 60) / samplingConfig::windowSeconds);
+#endif
+
+#if MBED_CONF_APP_BINARY_RECORDS && !MBED_CONF_APP_RAW_BLOCK_LOG
+//Commit markers for the results file so a recording can be carried on after a reset - Set by journal-commit-every in mbed_app.json
+#if MBED_CONF_APP_COMPRESS_RECORDS
+RecordJournal journal(storage, MBED_CONF_APP_JOURNAL_COMMIT_EVERY, sizeof(compressedWindow.payload));
+#else
+RecordJournal journal(storage, MBED_CONF_APP_JOURNAL_COMMIT_EVERY, windowBlock::rawSize());
+#endif
+static_assert(MBED_CONF_APP_JOURNAL_COMMIT_EVERY > 0, "journal-commit-every must be at least 1");
+#endif
+
+#if FLASH_SPILL
+//Spill area in spare sectors of the internal flash for windows the card can not take - Set by the flash-spill- options in mbed_app.json
+FlashIAPBlockDevice spillFlash(MBED_CONF_APP_FLASH_SPILL_START, MBED_CONF_APP_FLASH_SPILL_KB * 1024);
+FlashSpill spill(spillFlash);
+bool spillOn = false; //Set once the area is mounted - Cleared if it still holds windows from an earlier recording that could not be saved
+bool spillDrainQueued = false; //A call to move a spilled window to the card is queued on the writer
+uint32_t spillTag = 0; //CRC of this build's RecordFileHeader with no recording ID - Stored with every spilled window
+uint32_t cardRetry = 0; //Windows since a missing card was last tried
+const uint32_t spillCardRetryWindows = 4; //Windows between tries of a missing card
+#endif
+
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+//Raw log region of the card - Must not overlap a FAT partition. A size of 0 runs to the end of the card. Set by the raw-log- options in mbed_app.json
+//There is no default start - A region from block 0 would erase the partition table, so it has to be chosen for the card
+#if !defined(MBED_CONF_APP_RAW_LOG_START_MB)
+#error "raw-log-start-mb must be set in mbed_app.json to a region clear of the card's partitions"
+#endif
+static_assert(MBED_CONF_APP_RAW_LOG_START_MB > 0, "raw-log-start-mb must be above 0 - Block 0 of the card holds its partition table");
+SlicingBlockDevice rawRegion(&card, (bd_addr_t)MBED_CONF_APP_RAW_LOG_START_MB * 1024 * 1024,
+                             (MBED_CONF_APP_RAW_LOG_SIZE_MB == 0) ? 0 : (bd_addr_t)(MBED_CONF_APP_RAW_LOG_START_MB + MBED_CONF_APP_RAW_LOG_SIZE_MB) * 1024 * 1024);
+RawBlockLog rawLog(rawRegion, card, (bd_addr_t)MBED_CONF_APP_RAW_LOG_START_MB * 1024 * 1024);
+#endif
 
-//CRC//
-MbedCRC<POLY_32BIT_ANSI, 32> ct; //CRC for data checks
-
-//List of ints for the CRC throughout the code.
-uint32_t crcRead;
-uint32_t crcReadAC;
-uint32_t crcReadDC;
-uint32_t crcMessageAC;
-uint32_t crcMessageDC;
-uint32_t crcCon;
-uint32_t crcBuffer;
-uint32_t crcBufferAC;
-uint32_t crcBufferDC;
-uint32_t crcPayloadAC;
-uint32_t crcPayloadDC;
-uint32_t crcExtAC;
-uint32_t crcExtDC;
-uint32_t crcTempAC;
-uint32_t crcTempDC;
-uint32_t crcOutput;
 
+//CRC//
+Crc32 ct; //CRC for data checks - Fastest CRC32 backend for the build, same result as MbedCRC<POLY_32BIT_ANSI, 32>
 
 //Threads//
-Mail<pdData, 32> mail_box; //Mailbox for sending photodiode data between pdReading() and Consumer() Threads
+SampleRing<pdSample, samplingConfig::ringCapacity> sampleRing; //Lock free ring for sending blocks of photodiode data between pdReading() and Consumer() Threads
+
+//Every large buffer as built, checked against the same budget as the sampling profile - samplingConfig::ramBytes only has the window
+//buffers, ring and DMA buffer, and the storage buffers below grow with the window length and the mbed_app.json options
+const uint32_t bufferRamBytes = sizeof(windowPool) + sizeof(sampleRing) + sizeof(adcDma)
+#if MBED_CONF_APP_COMPRESS_RECORDS && (MBED_CONF_APP_BINARY_RECORDS || MBED_CONF_APP_RAW_BLOCK_LOG)
+                                + sizeof(compressedWindow)
+#endif
+#if !MBED_CONF_APP_BINARY_RECORDS
+                                + sizeof(csvWriter)
+#endif
+#if MBED_CONF_APP_SD_WRITE_BEHIND_SLOTS > 0
+                                + sizeof(sdBehind)
+#endif
+#if FLASH_SPILL
+                                + sizeof(spill)
+#endif
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+                                + sizeof(rawLog)
+#endif
+                                ;
+static_assert(bufferRamBytes <= samplingConfig::ramBudget,
+              "Sampling and storage buffers do not fit in the RAM budget - Shorten the window, use fewer window buffers or write behind slots");
 
 Mutex sdLock; //Mutex Lock for writting to the SD Card
 
@@ -159,10 +340,27 @@ void errorTask () {
 
 //Initialsing Functions before main
 //void pwmSwitch(); //Used to control the PWM for the dual-rail
-void pdReading(); //Photodiode Reading Function
+void pdBlockReady(const uint16_t *block, int samples); //DMA interrupt handler for a completed block
+void pdReading(const uint16_t *block, int scans, uint32_t interruptUs); //Photodiode Reading Function
 void consumer(); //Buffering of Photodiode data Function
-int writeSDCard(pdData sendData[bufferSize]); //Function for writing to the SD Card
-int sdMemoryReset(); //Reset SD Card Memory Function
+int sealWindow(window &full, uint32_t firstSequence); //Computes the CRC for a full window
+int writeSDCard(); //Function for writing the next sealed window to the SD Card
+int appendCsvWindow(windowBlock &block); //Writes a window as CSV text
+int writeCsvSectors(); //Writes the CSV text waiting in the staging buffer
+void crcBenchmark(); //Prints the speed of each CRC backend
+void storageBenchmark(); //Prints the write speed of the FAT and raw log paths
+void makeRecordHeader(RecordFileHeader &header, uint32_t id); //Fills in the header describing this build's recordings
+int sdStartSession(); //Starts a new recording on the SD Card
+int rotateSessionFile(); //Moves the session on to its next file
+bool resumeRecording(); //Carries on a recording cut short by a reset
+void mountSpill(); //Mounts the flash spill area
+void saveLeftoverSpill(); //Saves windows left in the flash spill area and erases it ahead of a new recording
+void eraseSpillAhead(); //Erases every spent sector of the flash spill area
+int copySpilledWindow(uint32_t fromSequence); //Moves the oldest spilled window to the card
+void queueSpillDrain(); //Queues the writer to move a spilled window to the card
+int drainSpill(); //Moves a spilled window to the card while the writer is idle
+void startCardLate(); //Starts the session on a card inserted after sampling started
+void finishSpill(); //Moves every spilled window to the card at the end of a recording
 void errorHandler(int errorCode); //Error Handling Function
 
 
@@ -173,64 +371,117 @@ int main ()
     pwmControl.period_us(10);
     pwmControl.pulsewidth_us(5);
 
-    //Introdcution Information for user printed to the terminal
-    printf("Welcome to Blood Glucose Sampling using PPG signals!\n");
-    printf("WARNING: The data produced can only be saved via a connected micro-SD Card.");
-    printf(" Therefore, if an micro-SD Card is not connected, this program will not run!\n");
-    printf("The file 'glucoseResults' on the micro-SD Card will be wiped before sampling begins.");
-    printf(" Due to this, please ensure any wanted data is backed up before continuing\n");
-    printf("Once an micro-SD Card has been connected, please press the blue button to continue.\n");
+#if FLASH_SPILL
+    mountSpill(); //Before anything else so windows spilled before a reset can go back into the recording they came from
+#endif
+
+    //A recording cut short by a reset is carried on straight away - Otherwise the user sets up a new one
+    if (!resumeRecording()) {
+        //Introdcution Information for user printed to the terminal
+        printf("Welcome to Blood Glucose Sampling using PPG signals!\n");
+#if FLASH_SPILL
+        printf("WARNING: The data produced is saved to a connected micro-SD Card.");
+        printf(" Without one, windows are kept in internal flash (up to %u KB) until a card is inserted, then moved across to it.\n",
+               (unsigned)MBED_CONF_APP_FLASH_SPILL_KB);
+#else
+        printf("WARNING: The data produced can only be saved via a connected micro-SD Card.");
+        printf(" Therefore, if an micro-SD Card is not connected, this program will not run!\n");
+#endif
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+        printf("Recordings are added to the raw log region of the micro-SD Card, which is created the first time. Any file system in that region will be lost!\n");
+#else
+        printf("Each recording is saved as a new session on the micro-SD Card - Nothing already on the card is wiped.\n");
+#endif
+        printf("Once an micro-SD Card has been connected, please press the blue button to continue.\n");
     
-    userButton.waitForPress(); //Uses button class to wait for button input
-    ThisThread::sleep_for(50ms); //Thread sent to sleep to prevent switch bounce
-
-    //Checks if SD Card is connected. Memory wipes if it is connected. Returns an init error and system resets if not
-    if ((sdDetection = sd.init())==0) {
-        //SD Card has been initialised so memory wipe can begin
-        printf("Micro-SD Card Detected! Memory wipe in progress...\n"); //Alerts user about SD Card and memory wipe
-        sdMemoryReset(); //Calls memory wipe function
-    }
-    else {
-        //Alerts user of missing SD Card error
-        printf("\nMicro-SD Init failed: system reset in 5 seconds\n");
-        printf("Please insert an Micro-SD Card to begin once system has restarted\n\n");
+        userButton.waitForPress(); //Uses button class to wait for button input
+        ThisThread::sleep_for(50ms); //Thread sent to sleep to prevent switch bounce
+
+#if MBED_CONF_APP_CRC_BENCHMARK
+        crcBenchmark(); //Enabled by crc-benchmark in mbed_app.json
+#endif
+#if MBED_CONF_APP_STORAGE_BENCHMARK
+        storageBenchmark(); //Enabled by storage-benchmark in mbed_app.json
+#endif
+#if FLASH_SPILL
+        saveLeftoverSpill();
+#endif
+
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+        //Checks if SD Card is connected by starting a new session in the raw log region. Returns an init error and system resets if not
+        if ((sdDetection = sdStartSession())==0) {
+            printf("Micro-SD Card Detected! Raw log session %u started, %u blocks free\n", rawLog.sessions(), rawLog.freeBlocks());
+        }
+#else
+        //Checks if SD Card is connected by mounting it and starting a new session after the ones on the card. Returns an init error and system resets if not
+        if ((sdDetection = sdStartSession())==0) {
+            printf("Micro-SD Card Detected! Session %u started in '%s'\n", sessions.id(), sessions.fileName());
+        }
+#endif
+#if FLASH_SPILL
+        //Without a card the recording goes into the flash spill area and the card is tried every few windows
+        else if (spillOn) {
+            storage.close();
+            cardReady = false;
+            printf("No micro-SD Card - Recording into internal flash (%u KB) until one is inserted\n", spill.freeBytes() / 1024);
+        }
+#endif
+        else {
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+            if (sdDetection == rawLogRegionInUse) {
+                printf("\nThe raw log region overlaps the partition table or a file system on this card - Nothing was written.\n");
+                printf("Set raw-log-start-mb and raw-log-size-mb in mbed_app.json to a region clear of its partitions.\n");
+            }
+#endif
+            //Alerts user of missing SD Card error
+            printf("\nMicro-SD Init failed: system reset in 5 seconds\n");
+            printf("Please insert an Micro-SD Card to begin once system has restarted\n\n");
 
-        //Configures LEDs to inform user of missing SD card
-        iLED = 0;
-        grnLED = 0;
-        redLED = 1;
-        //Backup restart if WatchDog Timer fails
-        ThisThread::sleep_for(5s); //Waits 5 seconds before resetting
-        system_reset(); //Resets program
-        return -1;
-    }
+            //Configures LEDs to inform user of missing SD card
+            iLED = 0;
+            grnLED = 0;
+            redLED = 1;
+            //Backup restart if WatchDog Timer fails
+            ThisThread::sleep_for(5s); //Waits 5 seconds before resetting
+            system_reset(); //Resets program
+            return -1;
+        }
     
-    //More user instructions to choose how many sample periods are required
-    printf("A new test can begin.\n");
-    printf("How many window samples are required? Please type the amount in the terminal and press the enter key.\n");
-    cin >> sampleStopFlag; //Used cin to red user input to the terminal.
-
-    //Is called if zero is selected - calls an error
-    if (sampleStopFlag==0) {
-        printf("ERROR: Zero is not a possible choice!\n");
-        printf("System Reset in 5 seconds\n");
-        //Configures LEDs to inform user of missing SD card
-        iLED = 0;
-        grnLED = 0;
-        redLED = 1;
-        //Backup restart if WatchDog Timer fails
-        ThisThread::sleep_for(5s); //Waits 5 seconds before resetting
-        system_reset(); //Resets program
-    }
+        //More user instructions to choose how many sample periods are required
+        printf("A new test can begin.\n");
+        printf("How many window samples are required? Please type the amount in the terminal and press the enter key.\n");
+        cin >> sampleStopFlag; //Used cin to red user input to the terminal.
+
+        //Is called if zero is selected - calls an error
+        if (sampleStopFlag==0) {
+            printf("ERROR: Zero is not a possible choice!\n");
+            printf("System Reset in 5 seconds\n");
+            //Configures LEDs to inform user of missing SD card
+            iLED = 0;
+            grnLED = 0;
+            redLED = 1;
+            //Backup restart if WatchDog Timer fails
+            ThisThread::sleep_for(5s); //Waits 5 seconds before resetting
+            system_reset(); //Resets program
+        }
+
+        printf("%i lots of window samples have been choosen.\n", sampleStopFlag);
+        printf("Please press the black reset button if this is incorrect!\n");
+        printf("Or\n");
+        //User final instruction to press the blue button to begin sampling
+        printf("Please press the blue button to start sampling!\n");
 
-    printf("%i lots of window samples have been choosen.\n", sampleStopFlag);
-    printf("Please press the black reset button if this is incorrect!\n");
-    printf("Or\n");
-    //User final instruction to press the blue button to begin sampling
-    printf("Please press the blue button to start sampling!\n");
+        userButton.waitForPress(); //Uses button class to wait for button input
+        ThisThread::sleep_for(50ms); //Thread sent to sleep to prevent switch bounce
 
-    userButton.waitForPress(); //Uses button class to wait for button input
-    ThisThread::sleep_for(50ms); //Thread sent to sleep to prevent switch bounce
+#if MBED_CONF_APP_BINARY_RECORDS && !MBED_CONF_APP_RAW_BLOCK_LOG
+        //Only once the count is confirmed is the recording committed - A reset at the prompt above starts the set up again rather than
+        //carrying on with a count the user wanted to change. From here on a reset carries on this recording. Without a card it is set once one is inserted
+        if (cardReady && journal.setTarget(sampleStopFlag) != 0) {
+            printf("Warning: The recording could not be committed, so it can not be carried on after a reset\n");
+        }
+#endif
+    }
 
     //Toggles off the green LED as sampling is occurring - Turns on the inferred LED to sample
     grnLED = 0;
@@ -262,7 +513,8 @@ int main ()
     errors.start(errorTask);
 
     //pwmQueue.call_every(1ms, callback(pwmSwitch)); //Calls the pwm thread every 1ms to ensure the pwm switches at a rate of 1kHz as designed for the circuitry 
-    pdReadQueue.call_every(sampleRate, callback(pdReading)); //Calls the Photodiode reading thread every 10ms to ensure a sampling rate of 100Hz.
+    lastInterruptUs = us_ticker_read(); //Sampling clock starts here - From zero, or from where a resumed recording left off
+    adcDma.start(samplingConfig::adcPeriod(), pdBlockReady); //Starts the timer triggered ADC - The Photodiode reading thread is called once per block of samples
 
     mainQueue.dispatch_forever(); //Sets the main thread to dispatch forever so it sleeps until it is given a task
 
@@ -280,7 +532,8 @@ void pwmSwitch() {
 //Critical errors are defined as any error which results in a hardware fault, deadlocks or loss of data.
 void errorHandler (int errorCode) {
 
-    //Terminate running threads so watchdog will reset program 
+    //Stop sampling and terminate running threads so watchdog will reset program 
+    adcDma.stop();
     //pwm.terminate();
     buffer.terminate();
     pdRead.terminate();
@@ -294,10 +547,10 @@ void errorHandler (int errorCode) {
     //Switch case to inform the user of why the error has occurred. Allowing error to be targetted
     switch(errorCode) { 
         case 0:
-            error("CRITICAL ERROR: Mailbox ran out of memory\n"); 
+            error("CRITICAL ERROR: Sample ring overflowed\n"); 
             break;
         case 1:
-            error("CRITICAL ERROR: Failed to put message on mailbox queue\n");
+            error("CRITICAL ERROR: Failed to queue the consumer for a block\n");
             break;
         case 2:
             error("CRITCAL ERROR: Consumer failed to get payload\n");
@@ -323,6 +576,12 @@ void errorHandler (int errorCode) {
         case 9:
             error("CRITCAL ERROR: Writing to micro-SD Card has resulted in a deadlock\n");
             break;
+        case 10:
+            error("CRITCAL ERROR: Samples dropped before being buffered\n");
+            break;
+        case 11:
+            error("CRITCAL ERROR: Writing a window to the micro-SD Card failed\n");
+            break;
         default: 
             error("CRITICAL ERROR: Unkown Error\n");
             break;
@@ -335,412 +594,891 @@ void errorHandler (int errorCode) {
 }
 
 
-//Reads the Photodiode values and passes the data to the consumer thread via a Mailbox.
-void pdReading() {
+//Called from the DMA interrupt once a half-buffer has been filled - Passes the block on to the Photodiode Reading thread.
+void pdBlockReady(const uint16_t *block, int samples) {
+    pdReadQueue.call(pdReading, block, samples, us_ticker_read()); //Block is timestamped with the free running microsecond timer
+}
 
-    //Reading the DC and AC photodiode values.
-    readData.acRead = acOutput.read_u16();
-    readData.dcRead = dcOutput.read_u16();
 
-    int crcReadACCheck = ct.compute((void *)readData.acRead, 32, &crcReadAC); //Computes a CRC for the read AC data
+//Reads the Photodiode values from a DMA block, decimates them and passes the whole block to the consumer thread via the sample ring.
+void pdReading(const uint16_t *block, int scans, uint32_t interruptUs) {
 
-    //Checks if the CRC was successful - If not, the error handler is called to inform the user
-    if (crcReadACCheck==!0) {
-        printQueue.call(printf, "Error with creating CRC for AC Read data!\n");
-        errorQueue.call(errorHandler,5);
-        return;
-    }
+    pdSample readBlock[dmaBlockSize]; //Scaled samples collected so they can be pushed onto the ring in one go
+    int samples = 0; //Decimated samples produced from the block
 
-    int crcReadDCCheck = ct.compute((void *)readData.dcRead, 32, &crcReadDC); //Computs a CRC for the read DC data
+    //Records how regular the block interrupts were and how long this thread took to get to the block
+    jitter.record(interruptUs, us_ticker_read());
 
-    //Checks if the CRC creation was successful - If not, the error handler is called to inform the user
-    if (crcReadDCCheck==!0) {
-        printQueue.call(printf, "Error with creating CRC for DC Read data!\n");
-        errorQueue.call(errorHandler,5);
-        return;
+    //The last sample of a block was converted as its interrupt fired - A block that starts a window gives the window's start time
+    sampleClockUs += interruptUs - lastInterruptUs;
+    lastInterruptUs = interruptUs;
+    if ((readSequence % bufferSize) == 0) {
+        windowStarts.push(sampleClockUs - ((uint64_t)(dmaBlockSize - 1) * samplingConfig::samplePeriodUs));
     }
 
-    //Tries to put the photodiode data on the mailbox.
-    pdData* message = mail_box.try_alloc_for(2s);
+    for (int i = 0; i < scans; i++) {
+        bool ready = false;
 
+        //Filters the raw conversions down to the sample rate - Scaled to match AnalogIn::read_u16() whatever the oversampling ratio
+        for (int c = 0; c < (int)samplingConfig::channels; c++) {
+            ready = decimators[c].push(block[adcDma.offset(i, c)], readBlock[samples].data.reads[c]);
+        }
 
-    //If passing data to the mailbox fails, the mailbox is out of memory and a critical error is called.
-    if (message == NULL) {
-        errorQueue.call(errorHandler,0);
-        return;
+        //Every sample is numbered so the consumer can tell if any go missing
+        if (ready) {
+            readBlock[samples].sequence = readSequence++;
+            samples++;
+        }
     }
 
-    //If attempt of message works, put the new photodiode data onto the message buffer.
-    message->acRead = readData.acRead;
-    message->dcRead = readData.dcRead;
+    //Blocks divide exactly into windows, so a summary is taken each time a window's worth of samples has been read
+    samplesSinceSummary += samples;
+    if (samplesSinceSummary >= (uint32_t)bufferSize) {
+        samplesSinceSummary -= bufferSize;
+        jitterSummaries.push(jitter.takeSummary());
+
+        //Noise floor of the decimated output over the window, in 16-bit LSBs
+        if (samplingConfig::oversample > 1) {
+            for (int c = 0; c < (int)samplingConfig::channels; c++) {
+                double noise = decimators[c].takeNoiseFloor();
+                printQueue.call(printf, "Noise floor %s (x%u oversampling): %.2f LSB (%.1f effective bits)\n", adcInputs[c].name, samplingConfig::oversample,
+                                noise, decimators[c].effectiveBits(noise));
+            }
+        }
+    }
 
-    //Check the message is successfully put onto the mailbox.
-    osStatus stat = mail_box.put(message);
+    //Pushes the block onto the sample ring - This never waits so the realtime thread cannot be held up by the consumer.
+    //If the whole block does not fit, the consumer has fallen behind and samples have been lost - Unless the overload policy drops
+    //windows, a critical error is called. Otherwise the consumer finds the gap in the sequence numbers and drops the windows it falls in
+    if (sampleRing.push(readBlock, samples) != (uint32_t)samples) {
+        printQueue.call(printf, "Sample ring full - %u samples lost (high-water mark %u/%u)\n", sampleRing.overruns(), sampleRing.highWaterMark(), sampleRing.capacity());
+        if (!overload.dropsWindows()) {
+            errorQueue.call(errorHandler,0);
+            return;
+        }
+    }
 
-    //Call an error if not successful
-    if (stat != osOK) {
-        //ERROR
-        printQueue.call(printf, "mail_box.put() Error code: %4Xh, Resource not available\r\n", stat);  
-        mail_box.free(message);
-        errorQueue.call(errorHandler, 1);
-        return;
+    //Calls the consumer thread once for the whole block - If it can not be queued, the next block queues it again
+    if (bufferQueue.call(consumer) == 0) {
+        if (!overload.dropsWindows()) {
+            errorQueue.call(errorHandler,1);
+            return;
+        }
+        overload.wakeupMissed();
     }
 
-    int crcMessageACCheck = ct.compute((void *)message->acRead, 32, &crcMessageAC); //Computes a CRC for the message AC data
+    //Kick the watchdog timer to prevent a software reset
+    Watchdog::get_instance().kick();
+
+} //End of pdReading Thread
 
-    //Checks if the CRC creation was successful - If not, the error handler is called to inform the user
-    if (crcMessageACCheck==!0) {
-        printQueue.call(printf, "Error with creating CRC for DC message data!\n");
-        errorQueue.call(errorHandler,5);
-        return;
-    }
 
-    //Compares the crc for the AC Read data and the Message AC data - If they differ, data corruption has occurred and an error is called
-    if (crcMessageAC==!crcReadAC) {
-        printQueue.call(printf, "Error: AC Message Data Corrupt!\n");
-        errorQueue.call(errorHandler,6); 
+//Drains every sample waiting on the sample ring - A single wakeup can handle several blocks if the consumer has been held up.
+//A window buffer is needed before anything is taken off the ring - If every buffer is still waiting to be written the samples stay on
+//the ring and the consumer is called again once the writer releases a buffer. Once the ring is nearly full the overload policy drops
+//the window instead, so its samples are taken off and thrown away (WindowFiller.hpp)
+void consumer() {
+    filler.drain<dmaBlockSize>(sampleRing);
+
+    //Kick watchdog if no issues to prevent software reset
+    Watchdog::get_instance().kick();
+}
+
+
+void consumerEvents::bufferWait() {
+    printQueue.call(printf, "All %u window buffers are waiting for the micro-SD card - Stall %u\n", windowPool.size(), windowPool.stalls());
+}
+
+
+void consumerEvents::overloadDrop(uint32_t firstSequence) {
+    printQueue.call(printf, "Overload: no window buffer and the sample ring is nearly full - Dropping the window from sample %u\n", firstSequence);
+}
+
+
+//A break in the sequence numbers means samples were lost between pdReading() and here - The window would have a hole in it so an error
+//is called, or the overload policy drops every window with a hole in it and sampling carries on
+void consumerEvents::sequenceGap(uint32_t expected, uint32_t received, bool fatal) {
+    printQueue.call(printf, "Error: Sample sequence gap - expected %u but received %u!\n", expected, received);
+    if (fatal) {
+        errorQueue.call(errorHandler,10);
     }
+}
 
-    int crcMessageDCCheck = ct.compute((void *)message->dcRead, 32, &crcMessageDC); //Computd a CRC for the message DC data
 
-    //Checks if the CRC creation was successful - If not, the error handler is called to inform the user
-    if (crcMessageDCCheck==!0) {
-        printQueue.call(printf, "Error with creating CRC for the AC message data!\n");
+//Data written into the window currently being filled
+void consumerEvents::store(window &w, uint32_t index, const pdSample &payload) {
+    w.samples.store(index, payload.data.reads);
+}
+
+
+//Finishes a window that was thrown away - Its timing is taken off too so the next window sealed gets its own
+void consumerEvents::windowDropped(uint32_t firstSequence) {
+    JitterSummary summary;
+    uint64_t startUs;
+    jitterSummaries.pop(summary);
+    windowStarts.pop(startUs);
+
+    printQueue.call(printf, "Overload: window from sample %u dropped - %u windows and %u samples lost so far\n", firstSequence, overload.windowsDropped(),
+                    overload.samplesLost());
+}
+
+
+//Once a full window of sampling has been reached
+int consumerEvents::windowFull(window &full, uint32_t firstSequence) {
+    printQueue.call(printf, "Window full, starting data send...\n"); //Alerts user of the window being sent
+
+    //Seals the window with a single CRC over the whole buffer - If this fails, the error handler is called to inform the user
+    if (sealWindow(full, firstSequence) != 0) {
+        printQueue.call(printf, "Error with creating CRC for the Buffer data!\n");
         errorQueue.call(errorHandler,5);
-        return;
+        return -1;
     }
+    return 0;
+}
+
+
+//The window has been handed to the writer - Calls the sdWrite thread to write it
+void consumerEvents::windowSealed() {
+    sdWriteQueue.call(writeSDCard);
+}
+
+
+//Seals a full window - Records where it starts in the sample sequence and computes one CRC over the whole buffer
+int sealWindow(window &full, uint32_t firstSequence) {
+    full.seal.firstSequence = firstSequence;
+    full.seal.sampleCount = bufferSize;
 
-    //Compares the crc for the DC Read data and the Message DC data - If they differ, data corruption has occurred and an error is called
-    if (crcMessageDC==!crcReadDC) {
-        printQueue.call(printf, "Error: DC Message Data Corrupt!\n");
-        errorQueue.call(errorHandler, 6); 
+    //Attaches the timing summary taken when the last sample of this window was read
+    if (!jitterSummaries.pop(full.jitter)) {
+        memset(&full.jitter, 0, sizeof(full.jitter));
+    }
+    if (!windowStarts.pop(full.seal.startUs)) {
+        full.seal.startUs = 0;
     }
 
-    //Calls the consumer thread to send the data to the buffer for SD Card writting
-    bufferQueue.call(consumer);
+    return ct.compute(full.samples.raw(), full.samples.rawSize(), &full.seal.crc);
+}
 
-    //Kick the watchdog timer to prevent a software reset
-    Watchdog::get_instance().kick();
 
-} //End of pdReading Thread
+//Writes the oldest sealed window to the SD Card
+int writeSDCard() {  
+    
+    window *sendData = windowPool.nextReady(); //Window to be written
+    uint32_t crcOutput; //CRC of the window as it is about to be written
 
+    if (sendData == nullptr) {
+#if FLASH_SPILL
+        return drainSpill(); //Nothing waiting to be written, so a spilled window is moved to the card
+#else
+        return 0;
+#endif
+    }
 
-//Collects the data from the mailbox to be buffered so it can be written to an SD Card
-void consumer() {
+    //Computed a CRC for the Output data and checks if it was successful - If not, the error handler is called to inform the user
+    if (ct.compute(sendData->samples.raw(), sendData->samples.rawSize(), &crcOutput) != 0) {
+        printQueue.call(printf, "Error with creating CRC for the Output data!\n"); 
+        errorQueue.call(errorHandler,5);
+        return -1;
+    }
 
-    //Creates a payload for the data
-    pdData* payload;
+    //Compares the crc made when the window was sealed and the Output data - If they differ, the buffer has been changed since and an error is called
+    if (crcOutput != sendData->seal.crc) {
+        printQueue.call(printf, "Error: Output Data Corrupted! Window starting at sample %u failed its CRC check\n", sendData->seal.firstSequence);
+        errorQueue.call(errorHandler,6);
+        return -1;
+    }
 
+#if MBED_CONF_APP_BINARY_RECORDS || MBED_CONF_APP_RAW_BLOCK_LOG
+#if MBED_CONF_APP_COMPRESS_RECORDS
+    //Window compressed into its own buffer with the header in front - The payload CRC covers the compressed data as it is stored
+    RecordWindowHeader &record = compressedWindow.record;
+    uint32_t payloadBytes = riceEncodeBlock(sendData->samples, compressedWindow.payload);
+    uint32_t payloadCrc;
+    ct.compute(compressedWindow.payload, payloadBytes, &payloadCrc);
+#else
+    //Window header directly in front of the window storage exactly as it is held in RAM - The payload CRC is the seal just checked
+    RecordWindowHeader &record = sendData->record;
+    uint32_t payloadBytes = sendData->samples.rawSize();
+    uint32_t payloadCrc = sendData->seal.crc;
+#endif
+    record = {recordWindowMagic, sendData->seal.firstSequence, sendData->seal.startUs, sendData->seal.sampleCount, payloadBytes, payloadCrc,
+              sendData->jitter, recordHeaderCrc, 0, 0};
+    ct.compute(&record, offsetof(RecordWindowHeader, crc), &record.crc);
+    const size_t recordSize = sizeof(RecordWindowHeader) + payloadBytes;
+#endif
+
+    int err = 0;
+    bool lockTaken; //Lock taken to safeguard SD Card writes - Should be safe as the window is not handed back to the pool until written - If not, error occurrs
+    bool stored = false; //Set once the whole window is in the file - An error after that loses the sync rather than the window
+    bool spilled = false; //Set if the window went to the flash spill area instead of the card
+
+#if MBED_CONF_APP_BINARY_RECORDS || MBED_CONF_APP_RAW_BLOCK_LOG
+#if FLASH_SPILL
+    //A card missing at the start is tried every few windows
+    if (!cardReady && ++cardRetry >= spillCardRetryWindows) {
+        cardRetry = 0;
+        startCardLate();
+    }
 
-    //Tries to get the payload from the mailbox
-    payload = mail_box.try_get_for(2s);
+    //The window is spilled while there is no card, while older windows are still spilled (so windows reach the card in order) and once the
+    //card has fallen flash-spill-backlog windows behind
+    spilled = spillOn && (!cardReady || !spill.empty() || windowPool.readyCount() >= MBED_CONF_APP_FLASH_SPILL_BACKLOG) &&
+              spill.push(spillTag, &record, recordSize) == 0;
+#endif
 
-    int crcPayloadACCheck = ct.compute((void *)payload->acRead, 32, &crcPayloadAC); //Computed a CRC for the Payload AC data
+    //Writing data to SD Card once the lock has been aquired - The card stays mounted and the file open between windows
+    if (spilled) {
+        lockTaken = true;
+        stored = true;
+    }
+    else if (!cardReady) {
+        lockTaken = true;
+        err = -1; //No card and no room left in the spill area
+    }
+    else if ((lockTaken = sdLock.trylock_for(200ms)) == true) {
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+        err = rawLog.writeWindow(&record, recordSize);
+        stored = (err == 0);
+#else
+        err = storage.beginWindow();
+        if (err == 0 && sessions.rotateDue(recordSize)) {
+            err = rotateSessionFile();
+        }
+        off_t offset = storage.size(); //Where the window goes in the session file - Recorded in the session index
+        if (err == 0) {
+            err = storage.append(&record, recordSize);
+            stored = (err == 0);
+        }
 
-    //Checks if the CRC creation was successful - If not, the error handler is called to inform the user
-    if (crcPayloadACCheck==!0) {
-        mail_box.free(payload);
-        printQueue.call(printf, "Error with creating CRC for the AC payload data!\n");
-        errorQueue.call(errorHandler,5 );
-        //return;
+        //Once the window is in the file it is indexed and journaled even if something after fails, so both stay in step with the data
+        if (stored) {
+            err = sessions.addWindow(record.firstSequence, offset, recordSize);
+            int syncErr = storage.endWindow();
+            int journalErr = journal.windowWritten(record, recordSize);
+            err = (err != 0) ? err : (syncErr != 0) ? syncErr : journalErr;
+        }
+        else {
+            storage.rewind(offset); //Anything written of the window is written over by the next one
+        }
+#endif
+        sdLock.unlock(); //Release lock as finsihed accessing the buffer
     }
 
-    //Compares the crc for the AC Message data and the Payload AC data - If they differ, data corruption has occurred and an error is called
-    if (crcPayloadAC==!crcMessageAC) {
-        printQueue.call(printf, "Error: AC Payload Data Corrupt!\n");
-        errorQueue.call(errorHandler, 6); 
+#if FLASH_SPILL
+    //A window the card could not take is spilled instead - The windows after it follow it into the spill area until the card catches up
+    if (!stored && spillOn && spill.push(spillTag, &record, recordSize) == 0) {
+        printQueue.call(printf, "Overload: window from sample %u spilled to internal flash (%s %d)\n", sendData->seal.firstSequence,
+                        (lockTaken == false) ? "lock timeout" : "error", err);
+        lockTaken = true;
+        stored = true;
+        spilled = true;
+        err = 0;
+    }
+#endif
+#else
+    //Text rows are formatted without holding the lock - It is only taken while the card is used: to start the window, for each run of
+    //whole sectors (writeCsvSectors) and to finish the window
+    //The window's place in the session file counts the text still waiting in the staging buffer
+    off_t offset = 0;
+    if ((lockTaken = sdLock.trylock_for(200ms)) == true) {
+        err = storage.beginWindow();
+        if (err == 0 && sessions.rotateDue(csvMaxWindowBytes)) {
+            err = rotateSessionFile();
+        }
+        offset = storage.size() + csvWriter.pending();
+        sdLock.unlock();
+    }
+    if (lockTaken == true && err == 0) {
+        err = appendCsvWindow(sendData->samples);
+        lockTaken = (err != csvLockTimeout);
+        stored = (err == 0);
+
+        //Text already written can not be taken back - The blank lines close off what there is of the window so the next one starts cleanly
+        if (!stored && csvWriter.room(2)) {
+            csvWriter.text("\n\n", 2);
+        }
     }
+    if (lockTaken == true && (lockTaken = sdLock.trylock_for(200ms)) == true) {
+        if (stored) {
+            err = sessions.addWindow(sendData->seal.firstSequence, offset, (storage.size() + csvWriter.pending()) - offset);
+        }
+        if (err == 0) {
+            err = storage.endWindow();
+        }
+        sdLock.unlock();
+    }
+#endif
+
+    //Not able to acquire the lock means a deadlock, and a failed write, even after remounting the card, means the window is lost
+    //The overload policy decides whether the recording carries on without the window or a critical error is called
+    if (lockTaken == false || err != 0) {
+        bool carryOn = (lockTaken == false) ? overload.lockTimedOut() : overload.writeFailed();
+        if (!carryOn) {
+            if (lockTaken == false) {
+                errorQueue.call(errorHandler,9);
+            }
+            else {
+                printQueue.call(printf, "Error: micro-SD write failed (%d) after %u remounts\n", err, storage.remounts());
+                errorQueue.call(errorHandler,11);
+            }
+            return -1;
+        }
 
-    int crcPayloadDCCheck = ct.compute((void *)payload->dcRead, 32, &crcPayloadDC); //Computed a CRC for the Payload DC data
+        if (!stored) {
+            printQueue.call(printf, "Overload: window from sample %u not written (%s %d) - %u failed writes and %u lock timeouts so far\n",
+                            sendData->seal.firstSequence, (lockTaken == false) ? "lock timeout" : "error", err, overload.writesFailed(), overload.lockTimeouts());
+            windowPool.release(sendData);
+            bufferQueue.call(consumer);
+            return 0;
+        }
+        printQueue.call(printf, "Overload: window from sample %u written but not synced (error %d)\n", sendData->seal.firstSequence, err);
+    }
+    else {
+        overload.writeSucceeded();
+    }
 
-    //Checks if the CRC creation was successful - If not, the error handler is called to inform the user
-    if (crcPayloadDCCheck==!0) {
-        mail_box.free(payload);
-        printQueue.call(printf, "Error with creating CRC for the DC payload data!\n");        
-        errorQueue.call(errorHandler,5);
-        //return;
+    //Alerts the user that the SD Card write has finished and the current data set has been saved to the SD Card
+    printQueue.call(printf, "micro-SD Write done...\n");
+    printQueue.call(printf, "Data set %i saved to %s!\n", sampleFlag, spilled ? "internal flash" : "the micro-SD card");
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+    printQueue.call(printf, "micro-SD raw write took %uus (worst %uus, mean %uus), %u blocks free\n", rawLog.lastWriteUs(), rawLog.worstWriteUs(), rawLog.meanWriteUs(), rawLog.freeBlocks());
+#else
+    printQueue.call(printf, "micro-SD write took %uus (worst %uus, mean %uus), remounts %u\n", storage.lastWriteUs(), storage.worstWriteUs(), storage.meanWriteUs(), storage.remounts());
+#endif
+#if MBED_CONF_APP_SD_WRITE_BEHIND_SLOTS > 0
+    printQueue.call(printf, "Write behind queue: peak %u writes outstanding, %u waits for a free slot\n", sdBehind.peakOutstanding(), sdBehind.slotWaits());
+#endif
+#if MBED_CONF_APP_COMPRESS_RECORDS && (MBED_CONF_APP_BINARY_RECORDS || MBED_CONF_APP_RAW_BLOCK_LOG)
+    printQueue.call(printf, "Window compressed to %u of %u bytes (%.2fx)\n", payloadBytes, (unsigned)windowBlock::rawSize(), (float)windowBlock::rawSize() / payloadBytes);
+#endif
+    printQueue.call(printf, "Window buffers: %u waiting, lowest free %u, stalls %u\n", windowPool.readyCount(), windowPool.lowestFree(), windowPool.stalls());
+#if FLASH_SPILL
+    printQueue.call(printf, "Flash spill area: %u windows waiting, %u KB free, %u spilled, %u moved to the card, full %u times\n", spill.waiting(),
+                    spill.freeBytes() / 1024, spill.windowsSpilled(), spill.windowsDrained(), spill.timesFull());
+#endif
+    printQueue.call(printf, "Overload: %u waits for a buffer, %u windows dropped, %u samples lost, %u missed wakeups, %u failed writes, %u lock timeouts\n",
+                    overload.waits(), overload.windowsDropped(), overload.samplesLost(), overload.wakeupsMissed(), overload.writesFailed(), overload.lockTimeouts());
+    printQueue.call(printf, "Window timing: worst interval error %uus, lateness worst %uus mean %uus, missed deadlines %u\n",
+                    sendData->jitter.worstIntervalErrorUs, sendData->jitter.worstLatenessUs, sendData->jitter.meanLatenessUs, sendData->jitter.missedDeadlines);
+    printQueue.call(printf, "Interval error histogram (%uus bins): %u %u %u %u %u %u %u %u\n\n", sendData->jitter.binWidthUs,
+                    sendData->jitter.histogram[0], sendData->jitter.histogram[1], sendData->jitter.histogram[2], sendData->jitter.histogram[3],
+                    sendData->jitter.histogram[4], sendData->jitter.histogram[5], sendData->jitter.histogram[6], sendData->jitter.histogram[7]);
+
+#if !MBED_CONF_APP_BINARY_RECORDS && !MBED_CONF_APP_RAW_BLOCK_LOG
+    jitterAccumulate(recordingJitter, sendData->jitter);
+#endif
+
+    //Window written so its buffer goes back to the pool - The consumer is called in case it stalled waiting for a free buffer
+    windowPool.release(sendData);
+    bufferQueue.call(consumer);
+#if FLASH_SPILL
+    queueSpillDrain();
+#endif
+    
+    //Check to see if the the amount of samples choosen by the user has been reached. If yes, threads are terminated - ending the program.
+    if (sampleFlag==sampleStopFlag) {
+        adcDma.stop();
+        //pwm.terminate();
+        pdRead.terminate();
+        buffer.terminate();
+
+        //Trims the preallocated space off the file (or finishes the raw log session) and releases the card so it can be removed
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+        rawLog.close();
+#else
+#if MBED_CONF_APP_BINARY_RECORDS
+#if FLASH_SPILL
+        finishSpill();
+#endif
+        if (cardReady) {
+            journal.finish(); //So the next boot starts a new recording rather than carrying this one on
+        }
+#else
+        //The last of the text and the sampling timing of the whole recording - Under the lock like every other write to the card
+        int endErr = csvLockTimeout;
+        if (sdLock.trylock_for(200ms)) {
+            char timing[192];
+            endErr = storage.append(csvWriter.data(), csvWriter.pending());
+            if (endErr == 0) {
+                csvWriter.clear();
+                endErr = storage.append(timing, jitterDescribe(recordingJitter, timing, sizeof(timing)));
+            }
+            sdLock.unlock();
+        }
+        if (endErr != 0) {
+            printQueue.call(printf, "micro-SD: the end of the results could not be written (%s %d) - The windows before it are saved\n",
+                            (endErr == csvLockTimeout) ? "lock timeout" : "error", endErr);
+        }
+#endif
+        storage.close();
+#endif
+            
+        //Turns off the inferred LED and turns on the Green LED, informing the user the system has finished
+        iLED = 0;
+        redLED = 0;
+        grnLED = 1;
+
+        //Alerts user of sampling being complete and the program is about to restart
+        printQueue.call(printf,"Sampling Complete!\n");
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+        printQueue.call(printf,"Please remove the micro-SD card to review sampled data. It is in raw log session %u - Read it off with Record_Decoder --raw.\n", rawLog.sessions());
+#else
+        if (!cardReady) {
+            printQueue.call(printf,"No micro-SD card was inserted - The recording is kept in internal flash and saved to the card inserted at the next start up.\n");
+        }
+        else {
+            printQueue.call(printf,"Please remove the micro-SD card to review sampled data. It is session %u - %u file(s) from s%04up01 and the index '%s'.\n",
+                            sessions.id(), sessions.parts(), sessions.id(), sessions.indexFileName());
+        }
+#endif
+        printQueue.call(printf,"System Restarting in 5 seconds!\n\n");
+
+        //Backup reset of 5 seconds incase WatchDog Timer Fails
+        ThisThread::sleep_for(5s);
+        system_reset();
     }
 
-    //Compares the crc for the DC Message data and the Payload DC data - If they differ, data corruption has occurred and an error is called
-    if (crcPayloadDC==!crcMessageDC) {
-        printQueue.call(printf, "Error: DC Payload Data Corrupt!\n");
-        errorQueue.call(errorHandler, 6); 
+    //If the amount of samples choosen by the user has not been reached, sample flag is incremented and the program still runs
+    else {
+        sampleFlag++;
     }
+    return 0;
+} //End of writeSDCard
 
-    //Collect the data from the payload
-    extract.acRead = payload->acRead;
-    extract.dcRead = payload->dcRead;
 
-    int crcExtACCheck = ct.compute((void *)extract.acRead, 32, &crcExtAC); //Computed a CRC for the Extracted AC data
+//Times each CRC backend over a full window buffer so the build time choice of backend can be checked on the board
+void crcBenchmark() {
+#if defined(TARGET_STM32F4)
+    Crc32Bytewise bytewise;
+    Crc32SliceBy8 sliceBy8;
+    window *bench = windowPool.acquire(); //Borrows a window buffer - Safe as sampling has not started yet
+    const windowBlock &block = bench->samples;
 
-    //Checks if the CRC creation was successful - If not, the error handler is called to inform the user
-    if (crcExtACCheck==!0) {
-        mail_box.free(payload);
-        printQueue.call(printf, "Error with creating CRC for the AC Extract data!\n");    
-        errorQueue.call(errorHandler,5);
-        //return;
+    printf("CRC32 bytes per cycle over %u bytes:\n", (unsigned)block.rawSize());
+    printf("%s: %.3f\n", bytewise.name(), crc32BytesPerCycle(bytewise, block.raw(), block.rawSize()));
+    printf("%s: %.3f\n", sliceBy8.name(), crc32BytesPerCycle(sliceBy8, block.raw(), block.rawSize()));
+    printf("%s: %.3f\n", ct.name(), crc32BytesPerCycle(ct, block.raw(), block.rawSize()));
+
+    windowPool.release(bench);
+#endif
+}
+
+
+//Fills in the header that starts every recording - The sampling profile, channel names, the build that made it and the recording ID
+void makeRecordHeader(RecordFileHeader &header, uint32_t id) {
+    char build[recordBuildLength];
+    snprintf(build, sizeof(build), "Mbed OS %d.%d.%d %s %s", MBED_MAJOR_VERSION, MBED_MINOR_VERSION, MBED_PATCH_VERSION, __DATE__, __TIME__);
+
+    recordFileHeaderInit(header, samplingConfig::rateHz, samplingConfig::windowSeconds, samplingConfig::samplesPerWindow, samplingConfig::channels,
+                         12, samplingConfig::oversample,
+                         MBED_CONF_APP_COMPRESS_RECORDS ? recordEncodingRice : samplingConfig::packed ? recordEncodingPacked12 : recordEncodingU16, build);
+    for (int c = 0; c < (int)samplingConfig::channels; c++) {
+        recordSetChannelName(header, c, adcInputs[c].name);
     }
+    header.recordingId = id;
+    ct.compute(&header, offsetof(RecordFileHeader, crc), &header.crc);
+}
 
-    //Compares the crc for the AC Payload data and the Extracted AC data - If they differ, data corruption has occurred and an error is called
-    if (crcExtAC==!crcPayloadACCheck) {
-        printQueue.call(printf, "Error: AC Extract Data Corrupt!\n");
-        errorQueue.call(errorHandler,6); 
+
+//Starts a new recording on the SD Card - A new session is started after the ones already on the card, so nothing is wiped
+//In raw log mode the raw log region is opened and a new session added after the ones already in the log
+//The recording ID comes from the free running timer, so it depends on when the button was pressed and differs from the last one
+int sdStartSession() {
+    uint32_t id = us_ticker_read();
+    recordingId = (id == 0 || id == recordingId) ? id + 1 : id;
+    RecordFileHeader header;
+    makeRecordHeader(header, recordingId);
+    recordHeaderCrc = header.crc;
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+    return rawLog.open(header);
+#else
+    int err = sessions.start(header);
+
+    //Starts the file with the sampling profile so analysis tools know the rate and window size
+#if MBED_CONF_APP_BINARY_RECORDS
+    //Header block and the commit blocks of the journal
+    if (err == 0) {
+        err = journal.start(header);
+    }
+#else
+    //Goes through the staging buffer like the rows so every write to the file stays sector aligned
+    char line[96];
+    csvWriter.clear();
+    if (err == 0 && csvWriter.text(line, samplingConfig::describe(line, sizeof(line)))) {
+        err = writeCsvSectors();
+    }
+#endif
+    if (err == 0) {
+        err = storage.sync();
     }
+    return err;
+#endif
+}
 
-    int crcExtDCCheck = ct.compute((void *)extract.dcRead, 32, &crcExtDC); //Computed a CRC for the Extracted DC data
 
-    //Checks if the CRC creation was successful - If not, the error handler is called to inform the user
-    if (crcExtDCCheck==!0) {
-        mail_box.free(payload);
-        printQueue.call(printf, "Error with creating CRC for the DC Extract data!\n"); 
-        errorQueue.call(errorHandler,5);
-        //return;
+#if !MBED_CONF_APP_RAW_BLOCK_LOG
+//Moves the session on to its next file - Called by writeSDCard() with sdLock held, between windows. The old file is finished off first so
+//every part reads back on its own
+int rotateSessionFile() {
+#if MBED_CONF_APP_BINARY_RECORDS
+    RecordFileHeader header;
+    makeRecordHeader(header, recordingId);
+    int err = journal.handOver();
+    if (err == 0) {
+        err = sessions.rotate();
+    }
+    if (err == 0) {
+        err = journal.carryOn(header);
+    }
+#else
+    //The last part sector of text goes in the old file - The profile line starts the new one and can not fill the staging buffer on its own
+    //If the text can not be written it is kept and the file is not moved on, so it goes out with the next window
+    int err = storage.append(csvWriter.data(), csvWriter.pending());
+    if (err == 0) {
+        csvWriter.clear();
+        err = sessions.rotate();
+    }
+    if (err == 0) {
+        char line[96];
+        csvWriter.text(line, samplingConfig::describe(line, sizeof(line)));
+    }
+#endif
+    if (err == 0) {
+        printQueue.call(printf, "Session %u moved on to '%s'\n", sessions.id(), sessions.fileName());
     }
+    return err;
+}
+#endif
+
+
+//Carries on a recording cut short by a reset - The journal finds the last intact window and the sample counters carry on after it
+//Returns false if there is nothing to carry on (no card, a finished recording, a different build or profile, or text/raw log mode)
+bool resumeRecording() {
+#if MBED_CONF_APP_BINARY_RECORDS && !MBED_CONF_APP_RAW_BLOCK_LOG
+    RecordFileHeader header;
+    makeRecordHeader(header, 0);
+    if (sessions.resume(header) != 0 || !journal.recover(header) || sessions.recover(journal.windows(), recordJournalDataStart) != 0) {
+        storage.close();
+        return false;
+    }
+    recordingId = header.recordingId; //The recording carries on with the ID it was started with
+    recordHeaderCrc = header.crc;
 
-    //Compares the crc for the DC Payload data and the Extracted DC data - If they differ, data corruption has occurred and an error is called
-    if (crcExtDC==!crcPayloadDCCheck) {
-        printQueue.call(printf, "Error: DC Extract Data Corrupt!\n");
-        errorQueue.call(errorHandler,6); 
+#if FLASH_SPILL
+    //Windows spilled before the reset follow the ones on the card - Any written to the card just before the reset are only marked drained
+    while (spillOn && !spill.empty() && copySpilledWindow(journal.nextSequence()) == 0) {
     }
+    if (spillOn && !spill.empty()) {
+        printf("Warning: %u spilled windows could not be moved to the micro-SD card - They are kept and the spill area is not used\n", spill.waiting());
+        spillOn = false; //Windows spilled from here on would come out after them, out of order
+    }
+    eraseSpillAhead();
+#endif
 
-    //Free the mailbox payload as data has been extracted
-    mail_box.free(payload);
+    //The window that was being filled when the reset came is lost
+    if (journal.skipWindow() != 0) {
+        storage.close();
+        return false;
+    }
 
-    //Data now wrote into one or two buffers, depending on which is free - switch case used to choose
-    switch (bufferFlag) {
-        //Write data into the first buffer
-        case 0:
-            //Data writting into buffer 1
-            buffer_1[sampleCounter].acRead = extract.acRead;
-            buffer_1[sampleCounter].dcRead = extract.dcRead;
-        
-            //Computed a CRC for the Buffer AC data and checks if it was successful - If not, the error handler is called to inform the user
-            if (int crcBufferACCheck = ct.compute((void *)buffer_1[sampleCounter].acRead, 32, &crcBufferAC)==!0) {
-                printQueue.call(printf, "Error with creating CRC for the AC Buffer data!\n"); 
-                errorQueue.call(errorHandler,5); 
-            }
+    sampleFlag = journal.windows() + 1;
+    sampleStopFlag = journal.windowsTarget();
+    readSequence = journal.nextSequence();
+    filler.restart(readSequence);
+    sampleClockUs = journal.nextStartUs();
+
+    printf("Session %u resumed after a reset in '%s' - %u of %u windows recovered, carrying on from sample %u\n", sessions.id(), sessions.fileName(),
+           journal.windows(), journal.windowsTarget(), readSequence);
+    return true;
+#else
+    return false;
+#endif
+}
 
-            //Compares the crc for the AC Extracted data and the Buffer AC data - If they differ, data corruption has occurred and an error is called
-            if (crcBufferAC==!crcExtAC) {
-                printQueue.call(printf, "Error: AC Buffer Data Corrupt!\n");
-                errorQueue.call(errorHandler,6);
-            }
-        
-            //Computed a CRC for the Buffer DC data and checks if it was successful - If not, the error handler is called to inform the user
-            if (int crcBufferDCCheck = ct.compute((void *)buffer_1[sampleCounter].dcRead, 32, &crcBufferDC)==!0) {
-                printQueue.call(printf, "Error with creating CRC for the DC Buffer data!\n"); 
-                errorQueue.call(errorHandler,5); 
-            }
 
-            //Compares the crc for the DC Extracted data and the Buffer DC data - If they differ, data corruption has occurred and an error is called
-            if (crcBufferDC==!crcTempDC) {
-                printQueue.call(printf, "Error: DC Buffer Data Corrupt!\n");
-                errorQueue.call(errorHandler,6);
-            }
+#if FLASH_SPILL
+//Mounts the flash spill area - It is only used if it lies clear of the program, which is checked against the end of the image in flash
+void mountSpill() {
+#ifdef FLASHIAP_APP_ROM_END_ADDR
+    if (MBED_CONF_APP_FLASH_SPILL_START < FLASHIAP_APP_ROM_END_ADDR) {
+        printf("Warning: The flash spill area overlaps the program, so it is not used - flash-spill-start must be past 0x%08x\n", (unsigned)FLASHIAP_APP_ROM_END_ADDR);
+        return;
+    }
+#endif
+    RecordFileHeader header;
+    makeRecordHeader(header, 0); //The tag only tells builds apart - Windows spilled by an earlier recording of this build can still be saved
+    spillTag = header.crc;
 
-            break;
-    
-        //Write data into the second buffer
-        case 1:
-            //Data writting into buffer 2
-            buffer_2[sampleCounter].acRead = extract.acRead;
-            buffer_2[sampleCounter].dcRead = extract.dcRead;
-
-            //Computed a CRC for the Buffer AC data and checks if it was successful - If not, the error handler is called to inform the user
-            if (int crcBufferACCheck = ct.compute((void *)buffer_2[sampleCounter].acRead, 32, &crcBufferAC)==!0) {
-                printQueue.call(printf, "Error with creating CRC for the AC Buffer data!\n"); 
-                errorQueue.call(errorHandler,5); 
-            }
+    if (spill.mount() != 0) {
+        printf("Warning: The flash spill area could not be mounted, so windows the micro-SD card can not take are lost\n");
+        return;
+    }
+    spillOn = true;
+}
 
-            //Compares the crc for the AC Extracted data and the Buffer AC data - If they differ, data corruption has occurred and an error is called
-            if (crcBufferAC==!crcExtAC) {
-                printQueue.call(printf, "Error: AC Buffer Data Corrupt!\n");
-                errorQueue.call(errorHandler,6);
-            }
-        
-            //Computed a CRC for the Buffer DC data and checks if it was successful - If not, the error handler is called to inform the user
-            if (int crcBufferDCCheck = ct.compute((void *)buffer_2[sampleCounter].dcRead, 32, &crcBufferDC)==!0) {
-                printQueue.call(printf, "Error with creating CRC for the DC Buffer data!\n"); 
-                errorQueue.call(errorHandler,5); 
-            }
 
-            //Compares the crc for the DC Extracted data and the Buffer DC data - If they differ, data corruption has occurred and an error is called
-            if (crcBufferDC==!crcTempDC) {
-                printQueue.call(printf, "Error: DC Buffer Data Corrupt!\n");
-                errorQueue.call(errorHandler,6);
-            }
+//Windows left in the spill area by a recording that was not carried on are saved to the card as a session of their own, then the area is
+//erased ahead of the new recording. Windows that can not be saved yet are kept, and the new recording runs without the spill area
+void saveLeftoverSpill() {
+    uint32_t tag;
+    uint32_t bytes;
+    uint32_t waiting = spill.waiting();
 
-            break;
-    
-        //Default case - if reached, error has occurred
-        default:
-            errorQueue.call(errorHandler,3);
-            break;
+    if (spillOn && spill.peek(tag, bytes) && tag != spillTag) {
+        printf("Warning: %u windows in internal flash were recorded by a different build and can not be read back - They are discarded\n", waiting);
+        spill.discard();
     }
-    
-    //Increment the sample counter
-    sampleCounter++;
-
-    //If statement once 10 seconds of sampling has been reached
-    if (sampleCounter==bufferSize) {
-        printQueue.call(printf, "Switching buffer...\n"); //Alerts user of the buffer being switched
-        
-        //Switch case using the buffer flag to determine which buffer contains the data
-        switch (bufferFlag){
-            //Case for buffer 1
-            case 0:
-                bufferFlag=1; //Buffer flag is updated
-                printQueue.call(printf, "Starting data send on buffer 1...\n"); //Alerts user of data send to first buffer
-
-                //Computed a CRC for the Buffer data and checks if it was successful - If not, the error handler is called to inform the user
-                if (int crcBufferCheck = ct.compute((void *)buffer_1, 32, &crcBuffer)==!0) {
-                    printQueue.call(printf, "Error with creating CRC for the Buffer data!\n"); 
-                    errorQueue.call(errorHandler,5);
-                    //return; 
-                }
-
-                sdWriteQueue.call(writeSDCard, buffer_1); //Calls the sdWrite buffer with the buffered data
-                break;
-            
-            //Case for buffer 2
-            case 1:
-                bufferFlag=0; //Buffer flag is updated
-                printQueue.call(printf, "Starting data send on bufffer 2...\n"); //Alrts usert of data send to second buffer
-
-                //Computed a CRC for the Buffer data and checks if it was successful - If not, the error handler is called to inform the user
-                if (int crcBufferCheck = ct.compute((void *)buffer_2, 32, &crcBuffer)==!0) {
-                    printQueue.call(printf, "Error with creating CRC for the Buffer data!\n"); 
-                    errorQueue.call(errorHandler,5);
-                    //return; 
-                }
-
-                sdWriteQueue.call(writeSDCard, buffer_2); //Calls the sdWrite buffer with the buffered data
-                break;
-            
-            //Default case - if reached, error has occurred
-            default:
-                errorQueue.call(errorHandler,4);
-                break;
+    else if (spillOn && waiting > 0) {
+        if (sdStartSession() == 0) {
+            uint32_t saved = 0;
+            while (!spill.empty() && copySpilledWindow(0) == 0) {
+                saved++;
+            }
+            journal.finish();
+            printf("%u of %u windows left in internal flash by an earlier recording saved as session %u\n", saved, waiting, sessions.id());
         }
+        storage.close();
+
+        if (!spill.empty()) {
+            printf("Warning: %u windows from an earlier recording are still in internal flash - The spill area is not used until they are saved to a micro-SD Card\n",
+                   spill.waiting());
+            spillOn = false;
+            return;
+        }
+    }
+    eraseSpillAhead();
+}
 
-            sampleCounter=0; //Sample counter reset to zero
 
+//Erases every spent sector of the spill area - Each erase stalls the flash, and so the whole board, for a second or more, so this is
+//only called while sampling is stopped
+void eraseSpillAhead() {
+    while (spillOn && spill.eraseNext() > 0) {
+        Watchdog::get_instance().kick(); //Has no effect before the watchdog is started
+    }
+    if (spillOn) {
+        printf("Flash spill area: %u KB free in %u sectors, each erased %u to %u times\n", spill.freeBytes() / 1024, spill.sectors(), spill.minErases(),
+               spill.maxErases());
     }
-    //Kick watchdog if no issues to prevent software reset
-    Watchdog::get_instance().kick();
 }
 
 
-//Writes the buffered data to the SD Card
-int writeSDCard(pdData sendData[bufferSize]) {  
-    
-    //Computed a CRC for the Output data and checks if it was successful - If not, the error handler is called to inform the user
-    if (int crcOutputCheck = ct.compute((void *)sendData, 32, &crcOutput)==!0) {
-        printQueue.call(printf, "Error with creating CRC for the Output data!\n"); 
-        errorQueue.call(errorHandler,5);
+//Copies the oldest spilled window to the end of the session and marks it drained - A window that starts before fromSequence is already on
+//the card (written just before a reset), so it is only marked. The copy goes through a small buffer so no window sized buffer is needed
+//A window spilled before the session was started (no card, or left by an earlier recording) is given this recording's header CRC
+int copySpilledWindow(uint32_t fromSequence) {
+    RecordWindowHeader record;
+    uint32_t tag;
+    uint32_t recordSize;
+    if (!spill.peek(tag, recordSize) || recordSize < sizeof(record) || spill.read(0, &record, sizeof(record)) != 0) {
+        return -1;
+    }
+    if (record.firstSequence < fromSequence) {
+        return spill.drained();
+    }
+    if (!sdLock.trylock_for(200ms)) {
+        return -1;
     }
 
-    //Compares the crc for the Buffer data and the Output data - If they differ, data corruption has occurred and an error is called
-    if (crcOutput==!crcBuffer) {
-        printQueue.call(printf, "Error: Output Data Corrupted!\n");
-        errorQueue.call(errorHandler,6);
+    uint8_t piece[512];
+    bool stored = false;
+    int err = storage.beginWindow();
+    if (err == 0 && sessions.rotateDue(recordSize)) {
+        err = rotateSessionFile();
     }
+    off_t offset = storage.size();
+    for (uint32_t done = 0; err == 0 && done < recordSize;) {
+        uint32_t part = (recordSize - done < sizeof(piece)) ? (recordSize - done) : sizeof(piece);
+        err = spill.read(done, piece, part);
+        if (err == 0 && done == 0 && record.headerCrc != recordHeaderCrc) {
+            record.headerCrc = recordHeaderCrc;
+            ct.compute(&record, offsetof(RecordWindowHeader, crc), &record.crc);
+            memcpy(piece, &record, sizeof(record));
+        }
+        if (err == 0) {
+            err = storage.append(piece, part);
+        }
+        done += part;
+    }
+    stored = (err == 0);
+
+    //As in writeSDCard() the window is indexed and journaled once it is in the file, and only then marked drained
+    if (stored) {
+        err = sessions.addWindow(record.firstSequence, offset, recordSize);
+        int syncErr = storage.endWindow();
+        int journalErr = journal.windowWritten(record, recordSize);
+        err = (err != 0) ? err : (syncErr != 0) ? syncErr : journalErr;
+    }
+    else {
+        storage.rewind(offset);
+    }
+    sdLock.unlock();
 
-    printQueue.call(printf, "Checking micro-SD Card - Do not remove the micro-SD Card!\n"); //Informs user that SD Card initialsing occuring
-    
-    //Error checking the SD card initialsation - If failed, error handler is called
-    if (int err = sd.init()==!0) {
-        errorQueue.call(errorHandler,7);
-        return -1;
+    int drainErr = stored ? spill.drained() : 0;
+    return (err != 0) ? err : drainErr;
+}
+
+
+//Queues the writer to move a spilled window to the card - One call is queued at a time and it runs once the windows queued before it are written
+void queueSpillDrain() {
+    if (spillOn && cardReady && !spillDrainQueued && !spill.empty()) {
+        spillDrainQueued = (sdWriteQueue.call(writeSDCard) != 0);
     }
-    
-    FATFileSystem fs("sd", &sd); //Creats an instance allowing SD Card writting
+}
 
-    printQueue.call(printf, "micro-SD check successful, writing to micro-sd...\n"); //Alerts user of SD Card initialisation success
 
-    FILE *fp = fopen("/sd/glucoseresults.txt","a+"); //Set format and attempt to open file in append mode
+//Moves the oldest spilled window to the card - Called by writeSDCard() when no window is waiting, and queued again until the spill area
+//is empty. A window that can not be moved stays spilled and is tried again after the next window is written
+int drainSpill() {
+    spillDrainQueued = false;
+    if (!spillOn || !cardReady || spill.empty()) {
+        return 0;
+    }
+    int err = copySpilledWindow(0);
+    if (err != 0) {
+        printQueue.call(printf, "Flash spill area: window could not be moved to the micro-SD card (%d) - Tried again after the next window\n", err);
+        return err;
+    }
+    queueSpillDrain();
+    return 0;
+}
 
-    //If unable to open file then a critical error has been encountered as data has not been written and will be lost. 
-    if(fp == NULL) {   
-        errorQueue.call(errorHandler,8);
-        return -1;
-    } 
 
-    //If file is opened successfully then write data to sd card. 
+//Starts the session on a card inserted after sampling started - The windows spilled until then move across to it, oldest first
+void startCardLate() {
+    if (!sdLock.trylock_for(200ms)) {
+        return;
+    }
+    int err = sdStartSession();
+    if (err == 0) {
+        cardReady = true;
+        if (journal.setTarget(sampleStopFlag) != 0) {
+            printQueue.call(printf, "Warning: The recording could not be committed, so it can not be carried on after a reset\n");
+        }
+    }
     else {
-        bool lockTaken = sdLock.trylock_for(200ms); //Lock taken to safeguard SD Card write - Should be safe as writting from opposite buffer to write - If not, error occurrs
+        storage.close();
+    }
+    sdLock.unlock();
 
-        //Writing data to SD Card as lock has been aquired
-        if (lockTaken == true) {
-            for(int i=0; i<bufferSize; i++) {
-                fprintf(fp, "%u,%u\n", sendData[i].acRead, sendData[i].dcRead); //Each result wrote to the SD Card
-            }
-            sdLock.unlock(); //Release lock as finsihed accessing the buffer
-        }
-        else {
-            errorQueue.call(errorHandler,9); //If not able to acquire lock then deadlock has occured so reset system
-            return -1;
-        }
+    if (cardReady) {
+        printQueue.call(printf, "Micro-SD Card inserted! Session %u started in '%s' - %u windows to move across from internal flash\n", sessions.id(),
+                        sessions.fileName(), spill.waiting());
+        queueSpillDrain();
+    }
+}
 
-        //Closes fp to end writing to the SD Card
-        fprintf(fp, "\n\n");
-        fclose(fp); 
-
-        //Alerts the user that the SD Card write has finished and the current data set has been saved to the SD Card
-        printQueue.call(printf, "micro-SD Write done...\n");
-        printQueue.call(printf, "Data set %i saved to the micro-SD card!\n\n", sampleFlag);
-
-        //SD Card deinitialised
-        sd.deinit();
-        
-        //Check to see if the the amount of samples choosen by the user has been reached. If yes, threads are terminated - ending the program.
-        if (sampleFlag==sampleStopFlag) {
-            //pwm.terminate();
-            pdRead.terminate();
-            buffer.terminate();
-                
-            //Turns off the inferred LED and turns on the Green LED, informing the user the system has finished
-            iLED = 0;
-            redLED = 0;
-            grnLED = 1;
 
-            //Alerts user of sampling being complete and the program is about to restart
-            printQueue.call(printf,"Sampling Complete!\n");
-            printQueue.call(printf,"Please remove the micro-SD card to review sampled data. The file is called 'glucoseresults'.\n");
-            printQueue.call(printf,"System Restarting in 5 seconds!\n\n");
+//Moves every spilled window to the card once sampling has stopped, then erases the spill area ready for the next recording
+//The watchdog is kicked as it goes, as the threads that normally kick it have stopped
+void finishSpill() {
+    if (!spillOn) {
+        return;
+    }
+    if (!cardReady) {
+        startCardLate();
+    }
+    while (cardReady && !spill.empty() && copySpilledWindow(0) == 0) {
+        Watchdog::get_instance().kick();
+    }
+    if (spill.empty()) {
+        eraseSpillAhead();
+    }
+    else {
+        printQueue.call(printf, "%u windows are still in internal flash - They are saved to the micro-SD card inserted at the next start up\n", spill.waiting());
+    }
+}
+#endif
+
+
+//Writes the same full window through the results file session and the raw log and prints the sustained rate and worst write time of each
+//The file path writes benchmark.bin so the card needs a file system, the raw path writes a session to the raw log region and then discards it
+void storageBenchmark() {
+    const int windows = 16;
+    window *bench = windowPool.acquire(); //Borrows a window buffer - Safe as sampling has not started yet
+    const size_t recordSize = sizeof(RecordWindowHeader) + windowBlock::rawSize();
+    memset(bench, 0, sizeof(window)); //No valid window magic, so the log treats the benchmark windows as free space afterwards
+
+    printf("Storage benchmark - %d windows of %u bytes:\n", windows, (unsigned)recordSize);
 
-            //Backup reset of 5 seconds incase WatchDog Timer Fails
-            ThisThread::sleep_for(5s);
-            system_reset();
+    if (storage.open("benchmark.bin", true) == 0) {
+        uint32_t start = us_ticker_read();
+        for (int i = 0; i < windows; i++) {
+            storage.beginWindow();
+            storage.append(bench, recordSize);
+            storage.endWindow();
         }
+        storage.close();
+        uint32_t elapsed = us_ticker_read() - start;
+        printf("File: %.3f MB/s, worst window %uus\n", (float)(windows * recordSize) / elapsed, storage.worstWriteUs());
+        storage.resetStats();
+    }
+    else {
+        printf("File: no file system on the card\n");
+    }
 
-        //If the amount of samples choosen by the user has not been reached, sample flag is incremented and the program still runs
-        else {
-            sampleFlag++;
+#if MBED_CONF_APP_RAW_BLOCK_LOG
+    RecordFileHeader header;
+    makeRecordHeader(header, 0);
+    if (rawLog.open(header) == 0) {
+        uint32_t start = us_ticker_read();
+        for (int i = 0; i < windows; i++) {
+            rawLog.writeWindow(bench, recordSize);
         }
-        return 0;
-    }    
-} //End of writeSDCard
+        rawLog.discard(); //The next session starts over the benchmark, so it does not use up one of the log's sessions
+        uint32_t elapsed = us_ticker_read() - start;
+        printf("Raw log: %.3f MB/s, worst window %uus\n", (float)(windows * recordSize) / elapsed, rawLog.worstWriteUs());
+        rawLog.resetStats();
+    }
+    else {
+        printf("Raw log: region could not be opened\n");
+    }
+#endif
 
+    windowPool.release(bench);
+}
 
-//Function to reset the memory of the SD Card
-int sdMemoryReset() {
 
-    FATFileSystem fs("sd", &sd); //Creats an instance allowing SD Card writting
+#if !MBED_CONF_APP_BINARY_RECORDS
+//Writes a window as CSV text - One line per sample with the channels in channel list order and two blank lines after the window
+//Lines are formatted into the sector aligned staging buffer and written a whole buffer at a time - Any part sector waits for the next window
+int appendCsvWindow(windowBlock &block) {
+    uint16_t values[samplingConfig::channels];
+    int err = 0;
 
-    //Open in write mode and write no characters to clear the file
-    FILE *fp = fopen("/sd/glucoseresults.txt","w"); 
-    fprintf(fp, "");
-    fclose(fp);
+    //Sectors kept from a write that failed go first - There is no room for more rows behind them
+    if (csvWriter.pending() >= csvWriter.size()) {
+        err = writeCsvSectors();
+    }
 
-    //Deinitialise the SD Card
-    sd.deinit();
+    for (int i = 0; i < bufferSize && err == 0; i++) {
+        for (int c = 0; c < (int)samplingConfig::channels; c++) {
+            values[c] = block.channel(c)[i];
+        }
+        if (csvWriter.row(values, samplingConfig::channels)) {
+            err = writeCsvSectors();
+        }
+    }
 
-    //Alert user of memory clear success
-    printf("Memory Cleared Successfully!\n");
-    return 0;
-} 
- 
+    if (err == 0 && csvWriter.text("\n\n", 2)) {
+        err = writeCsvSectors();
+    }
+    return err;
+}
 
 
+//Writes the whole sectors waiting in the CSV staging buffer - sdLock is only held for the write itself
+//The sectors are only let go of once they are written, so text from a failed write goes out with the next one
+int writeCsvSectors() {
+    if (sdLock.trylock_for(200ms) == false) {
+        return csvLockTimeout;
+    }
+    int err = storage.append(csvWriter.data(), csvWriter.size());
+    sdLock.unlock();
 
+    if (err == 0) {
+        csvWriter.written();
+    }
+    return err;
+}
+#endif
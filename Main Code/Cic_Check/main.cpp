@@ -0,0 +1,171 @@
+#include "../Basic_Code/CicDecimator.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/*
+Description:
+- Host check of the CIC decimator (CicDecimator.hpp) against a reference decimator on noisy input.
+- The reference is the filter written out as what it is - Order boxcars of Ratio samples convolved into one impulse response, applied
+  directly to the input in 64 bit sums at every Ratio'th sample, then rounded or filled to 16 bits. It has no integrators, no combs
+  and nothing wraps, so agreeing with it shows the 32 bit wrap around cancels as the header says it does.
+- The input is a 12-bit PPG like wave with white noise, clipped spikes to 0 and 4095 so the largest sums are reached, and a stretch
+  held at full scale. The first sample is held before the input starts, as the decimator primes itself with it.
+- Every output has to match bit for bit, for ratios 1 to 64 and orders 1 to 4 wherever the bit growth fits in 32 bits, and for
+  ratio 1024 at order 2.
+- takeNoiseFloor() is checked too - On a constant level with known white noise, the noise floor it gives from the spread inside each
+  group has to agree with the spread actually measured on the reference output. That is done at the ratios of the firmware and at
+  the two that reach 14 effective bits with 2 LSB of input noise.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 main.cpp -o cic_check
+*/
+
+static const uint32_t inputSamples = 1 << 16;
+
+//Noisy 12-bit input - A wave with gaussian noise, spikes to either rail and a run held at full scale
+static vector<uint16_t> noisyInput(uint32_t seed) {
+    mt19937 random(seed);
+    normal_distribution<double> noise(0.0, 6.0);
+    uniform_int_distribution<int> spike(0, 199);
+    vector<uint16_t> x(inputSamples);
+    for (uint32_t n = 0; n < inputSamples; n++) {
+        double value = 2048.0 + 1500.0 * sin(n * 0.013) + noise(random);
+        int s = spike(random);
+        value = (s == 0) ? 0.0 : (s == 1) ? 4095.0 : value;
+        value = (n >= 30000 && n < 31000) ? 4095.0 : value;
+        x[n] = (uint16_t)lround((value < 0.0) ? 0.0 : (value > 4095.0) ? 4095.0 : value);
+    }
+    return x;
+}
+
+//Impulse response of Order boxcars of length Ratio convolved together - Integers, as the CIC only adds
+static vector<uint64_t> impulseResponse(uint32_t ratio, int order) {
+    vector<uint64_t> h(1, 1);
+    for (int stage = 0; stage < order; stage++) {
+        vector<uint64_t> next(h.size() + ratio - 1, 0);
+        for (size_t n = 0; n < h.size(); n++) {
+            for (uint32_t k = 0; k < ratio; k++) {
+                next[n + k] += h[n];
+            }
+        }
+        h = next;
+    }
+    return h;
+}
+
+//Filter output of outputBits to 16 bits - Rounded half up when there are more, the top bits repeated below when there are fewer
+static uint16_t referenceScale(uint64_t value, int outputBits) {
+    if (outputBits > 16) {
+        uint64_t half = 1ull << (outputBits - 17);
+        value = (value + half) >> (outputBits - 16);
+    }
+    else if (outputBits < 16) {
+        uint64_t shifted = value << (16 - outputBits);
+        value = shifted | (value >> (2 * outputBits - 16));
+    }
+    return (value > 0xFFFF) ? 0xFFFF : (uint16_t)value;
+}
+
+//Direct form decimator - The input as if x[0] had been there forever, filtered and kept every ratio'th sample
+static vector<uint16_t> referenceDecimate(const vector<uint16_t> &x, uint32_t ratio, int order, int outputBits) {
+    vector<uint64_t> h = impulseResponse(ratio, order);
+    vector<uint16_t> out;
+    for (size_t n = ratio - 1; n < x.size(); n += ratio) {
+        uint64_t sum = 0;
+        for (size_t k = 0; k < h.size(); k++) {
+            sum += h[k] * ((k <= n) ? x[n - k] : x[0]);
+        }
+        out.push_back(referenceScale(sum, outputBits));
+    }
+    return out;
+}
+
+template <uint32_t Ratio, int Order>
+static bool checkExact(const vector<uint16_t> &x) {
+    CicDecimator<Ratio, Order> cic;
+    vector<uint16_t> out;
+    for (uint16_t raw : x) {
+        uint16_t value;
+        if (cic.push(raw, value)) {
+            out.push_back(value);
+        }
+    }
+
+    vector<uint16_t> expected = referenceDecimate(x, Ratio, Order, CicDecimator<Ratio, Order>::outputBits);
+    uint32_t wrong = 0;
+    int worst = 0;
+    for (size_t i = 0; i < expected.size() && i < out.size(); i++) {
+        int difference = abs((int)out[i] - (int)expected[i]);
+        wrong += difference != 0;
+        worst = (difference > worst) ? difference : worst;
+    }
+    bool passed = out.size() == expected.size() && wrong == 0;
+    printf("Ratio %2u order %d (%2d bits)  %6zu outputs, %u differ (worst %d LSB)  %s\n", Ratio, Order, CicDecimator<Ratio, Order>::outputBits,
+           out.size(), wrong, worst, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+//Noise floor reported from the input against the spread of the output around its mean, both in 16-bit LSBs
+template <uint32_t Ratio, int Order>
+static bool checkNoiseFloor(double sigma) {
+    mt19937 random(7);
+    normal_distribution<double> noise(0.0, sigma);
+    vector<uint16_t> x((Ratio * 4096 > inputSamples) ? Ratio * 4096 : inputSamples); //At least 4096 outputs for the measured spread
+    for (uint16_t &raw : x) {
+        raw = (uint16_t)lround(2000.0 + noise(random));
+    }
+
+    CicDecimator<Ratio, Order> cic;
+    for (uint16_t raw : x) {
+        uint16_t value;
+        cic.push(raw, value);
+    }
+    double reported = cic.takeNoiseFloor();
+
+    vector<uint16_t> out = referenceDecimate(x, Ratio, Order, CicDecimator<Ratio, Order>::outputBits);
+    double mean = 0.0;
+    for (uint16_t v : out) {
+        mean += v;
+    }
+    mean /= out.size();
+    double variance = 0.0;
+    for (uint16_t v : out) {
+        variance += (v - mean) * (v - mean);
+    }
+    double measured = sqrt(variance / (out.size() - 1));
+
+    bool passed = fabs(reported - measured) < 0.1 * measured;
+    printf("Ratio %2u order %d, input noise %.1f LSB  noise floor %.1f reported, %.1f measured, %.2f effective bits  %s\n", Ratio, Order, sigma,
+           reported, measured, CicDecimator<Ratio, Order>::effectiveBits(reported), passed ? "ok" : "FAILED");
+    return passed;
+}
+
+int main() {
+    vector<uint16_t> x = noisyInput(1);
+    bool passed = true;
+    passed = checkExact<1, 3>(x) && passed;
+    passed = checkExact<2, 3>(x) && passed;
+    passed = checkExact<4, 3>(x) && passed;
+    passed = checkExact<8, 3>(x) && passed;
+    passed = checkExact<16, 3>(x) && passed;
+    passed = checkExact<32, 3>(x) && passed;
+    passed = checkExact<64, 3>(x) && passed;
+    passed = checkExact<4, 1>(x) && passed;
+    passed = checkExact<16, 1>(x) && passed;
+    passed = checkExact<16, 2>(x) && passed;
+    passed = checkExact<8, 4>(x) && passed;
+    passed = checkExact<32, 4>(x) && passed;
+    passed = checkExact<1024, 2>(x) && passed;
+
+    passed = checkNoiseFloor<4, 3>(2.0) && passed;
+    passed = checkNoiseFloor<16, 3>(2.0) && passed;
+    passed = checkNoiseFloor<16, 3>(8.0) && passed;
+
+    //The ratios and orders that reach 14 bits within 32 bits of growth (CicDecimator.hpp)
+    passed = checkNoiseFloor<1024, 1>(2.0) && passed;
+    passed = checkNoiseFloor<1024, 2>(2.0) && passed;
+    return passed ? 0 : 1;
+}
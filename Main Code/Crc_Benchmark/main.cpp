@@ -0,0 +1,180 @@
+#include "../Basic_Code/Crc32.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace std;
+using namespace std::chrono;
+
+/*
+Description:
+- Host bit exactness check and micro-benchmark of the CRC-32 backends (Crc32.hpp).
+- Each backend is checked against a bit at a time CRC written straight from the ANSI definition - The standard check value of
+  "123456789", then random buffers of every length up to 1100 bytes at every alignment in a word, so the slice-by-8 loop and the
+  leftover bytes after it are both covered.
+- The hardware backend is checked through CrcUnitModel, a bit at a time model of the STM32F4 CRC unit (MSB first, reset to
+  0xFFFFFFFF, no final XOR) driven by the same crc32FromWordUnit() the board uses.
+- The benchmark times the two software backends over a window sized buffer in MB/s, and in bytes per cycle on x86 to compare with the
+  board. The cycles are time stamp counter ticks (rdtsc), which run at the CPU's nominal clock whatever its actual clock - Turbo or
+  power saving shift the figure, so it is only a guide. The board's numbers, including the CRC unit, come from crc-benchmark in
+  mbed_app.json, which prints bytes per cycle of the core clock.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 main.cpp -o crc_benchmark
+*/
+
+//Reflected ANSI CRC-32 one bit at a time
+static uint32_t referenceCrc(const uint8_t *data, size_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+        }
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+//The STM32F4 CRC unit - Each word written to DR is shifted in MSB first through polynomial 0x04C11DB7
+class CrcUnitModel {
+private:
+    uint32_t state = 0xFFFFFFFF;
+
+public:
+    void reset() {
+        state = 0xFFFFFFFF;
+    }
+
+    void feed(uint32_t word) {
+        state ^= word;
+        for (int bit = 0; bit < 32; bit++) {
+            state = (state & 0x80000000u) ? ((state << 1) ^ 0x04C11DB7u) : (state << 1);
+        }
+    }
+
+    uint32_t read() {
+        return state;
+    }
+};
+
+class Crc32UnitModel {
+private:
+    CrcUnitModel unit;
+
+public:
+    static const char *name() {
+        return "hardware (model)";
+    }
+
+    int compute(const void *buffer, size_t size, uint32_t *crc) {
+        *crc = crc32FromWordUnit(unit, buffer, size);
+        return 0;
+    }
+};
+
+static bool report(const char *name, bool passed) {
+    printf("%-48s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+template <typename Backend>
+static bool checkBackend(Backend &backend, const vector<uint8_t> &data) {
+    const char *check = "123456789";
+    uint32_t crc;
+    backend.compute(check, 9, &crc);
+    bool passed = crc == 0xCBF43926;
+
+    uint32_t wrong = 0;
+    for (size_t offset = 0; offset < 4; offset++) {
+        for (size_t size = 0; size <= 1100; size++) {
+            backend.compute(data.data() + offset, size, &crc);
+            wrong += crc != referenceCrc(data.data() + offset, size);
+        }
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "%s matches the reference", backend.name());
+    if (wrong != 0) {
+        printf("%s: %u of %u buffers differ\n", backend.name(), wrong, 4 * 1101);
+    }
+    return report(name, passed && wrong == 0);
+}
+
+//Time stamp counter ticks - 0 where there is no counter, so no bytes per cycle are reported
+static uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct Rate {
+    double bytesPerNs;
+    double bytesPerCycle; //0 where there is no time stamp counter
+};
+
+//Best of a few runs of a backend over the buffer
+template <typename Backend>
+static Rate timeBackend(Backend &backend, const vector<uint8_t> &data, uint32_t &crc) {
+    Rate best = {0.0, 0.0};
+    for (int run = 0; run < 5; run++) {
+        auto start = steady_clock::now();
+        uint64_t startCycles = cycles();
+        for (int i = 0; i < 2000; i++) {
+            backend.compute(data.data(), data.size(), &crc);
+        }
+        uint64_t elapsedCycles = cycles() - startCycles;
+        double ns = (double)duration_cast<nanoseconds>(steady_clock::now() - start).count();
+        best.bytesPerNs = max(best.bytesPerNs, (2000.0 * data.size()) / ns);
+        if (elapsedCycles > 0) {
+            best.bytesPerCycle = max(best.bytesPerCycle, (2000.0 * data.size()) / elapsedCycles);
+        }
+    }
+    return best;
+}
+
+static void printRate(const char *name, const Rate &rate, const Rate &baseline) {
+    char perCycle[16] = "-";
+    if (rate.bytesPerCycle > 0.0) {
+        snprintf(perCycle, sizeof(perCycle), "%.3f", rate.bytesPerCycle);
+    }
+    printf("%-20s %10.1f %12s %7.2fx\n", name, rate.bytesPerNs * 1000.0, perCycle, rate.bytesPerNs / baseline.bytesPerNs);
+}
+
+int main() {
+    vector<uint8_t> data(1104);
+    uint32_t seed = 1;
+    for (uint8_t &byte : data) {
+        seed = (seed * 1103515245) + 12345;
+        byte = (uint8_t)(seed >> 16);
+    }
+
+    Crc32Bytewise bytewise;
+    Crc32SliceBy8 sliceBy8;
+    Crc32UnitModel hardware;
+    bool passed = true;
+    passed = checkBackend(bytewise, data) && passed;
+    passed = checkBackend(sliceBy8, data) && passed;
+    passed = checkBackend(hardware, data) && passed;
+
+    //A 2000 sample, two channel window of uint16_t, as the default profile seals
+    vector<uint8_t> window(8000);
+    for (size_t i = 0; i < window.size(); i++) {
+        window[i] = data[i % data.size()];
+    }
+    uint32_t crcBytewise;
+    uint32_t crcSliceBy8;
+    Rate bytewiseRate = timeBackend(bytewise, window, crcBytewise);
+    Rate sliceBy8Rate = timeBackend(sliceBy8, window, crcSliceBy8);
+    passed = report("Timed CRCs agree", crcBytewise == crcSliceBy8) && passed;
+
+    printf("\nCRC32 of a %zu byte window\n", window.size());
+    printf("%-20s %10s %12s %8s\n", "Backend", "MB/s", "Bytes/cycle", "Speedup");
+    printRate(bytewise.name(), bytewiseRate, bytewiseRate);
+    printRate(sliceBy8.name(), sliceBy8Rate, bytewiseRate);
+    return passed ? 0 : 1;
+}
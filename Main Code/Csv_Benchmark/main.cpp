@@ -0,0 +1,135 @@
+#include "../Basic_Code/CsvWriter.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*
+Description:
+- Host micro-benchmark for the CSV text writer (CsvWriter.hpp) against the snprintf formatting it replaced.
+- Both format the same windows of samples - first every value from 0 to 65535 so each digit count is covered, then PPG like windows -
+  and the two outputs are compared byte for byte before any timing is reported.
+- The snprintf path is the old appendCsvWindow(): one snprintf per value into a 512 byte buffer, written whenever the next line might not fit.
+- Writes go to a memory buffer so only the formatting and buffering are timed. Newlib on the F401RE is slower than glibc, so the
+  speedup on the board is larger than the one shown here.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 main.cpp -o csv_benchmark
+*/
+
+static const int channels = 2;
+static const int windowSamples = 2000;
+static const int lineMax = (6 * channels) + 1;
+
+//Stands in for StorageSession::append()
+static void append(string &out, const char *data, size_t size) {
+    out.append(data, size);
+}
+
+static void snprintfWindow(string &out, const uint16_t (*samples)[windowSamples]) {
+    char text[512];
+    int used = 0;
+
+    for (int i = 0; i < windowSamples; i++) {
+        for (int c = 0; c < channels; c++) {
+            used += snprintf(text + used, sizeof(text) - used, (c == 0) ? "%u" : ",%u", samples[c][i]);
+        }
+        text[used++] = '\n';
+
+        if (used > (int)sizeof(text) - lineMax) {
+            append(out, text, used);
+            used = 0;
+        }
+    }
+    text[used++] = '\n';
+    text[used++] = '\n';
+    append(out, text, used);
+}
+
+static void blockWindow(string &out, CsvBlockWriter<1024, 128> &writer, const uint16_t (*samples)[windowSamples]) {
+    uint16_t values[channels];
+
+    for (int i = 0; i < windowSamples; i++) {
+        for (int c = 0; c < channels; c++) {
+            values[c] = samples[c][i];
+        }
+        if (writer.row(values, channels)) {
+            append(out, writer.data(), writer.size());
+            writer.written();
+        }
+    }
+    if (writer.text("\n\n", 2)) {
+        append(out, writer.data(), writer.size());
+        writer.written();
+    }
+}
+
+int main() {
+    //Every 16-bit value once, then PPG like windows scaled the way AdcDma::toU16() does
+    vector<uint16_t> values;
+    for (uint32_t v = 0; v <= 0xFFFF; v++) {
+        values.push_back((uint16_t)v);
+    }
+    uint32_t noise = 1;
+    for (int i = 0; i < 20 * windowSamples * channels; i++) {
+        noise = (noise * 1664525) + 1013904223;
+        uint16_t raw = (uint16_t)(2048 + ((i / channels) % 400) + (noise >> 29));
+        values.push_back((raw << 4) | (raw >> 8));
+    }
+    //Stored channel by channel like a SampleBlock
+    int windows = values.size() / (windowSamples * channels);
+    vector<uint16_t> storage(windows * channels * windowSamples);
+    for (int w = 0; w < windows; w++) {
+        for (int i = 0; i < windowSamples; i++) {
+            for (int c = 0; c < channels; c++) {
+                storage[(((w * channels) + c) * windowSamples) + i] = values[(((w * windowSamples) + i) * channels) + c];
+            }
+        }
+    }
+    const uint16_t (*blocks)[windowSamples] = reinterpret_cast<const uint16_t (*)[windowSamples]>(storage.data());
+
+    //Outputs must match before the timings mean anything
+    string expected;
+    string actual;
+    CsvBlockWriter<1024, 128> writer;
+    for (int w = 0; w < windows; w++) {
+        snprintfWindow(expected, &blocks[w * channels]);
+        blockWindow(actual, writer, &blocks[w * channels]);
+    }
+    actual.append(writer.data(), writer.pending());
+    writer.clear();
+    if (expected != actual) {
+        printf("Output differs - %zu bytes from snprintf, %zu from CsvBlockWriter\n", expected.size(), actual.size());
+        return 1;
+    }
+    printf("%d windows of %d samples, %zu bytes of CSV identical\n", windows, windowSamples, expected.size());
+
+    const int repeats = 20;
+    double seconds[2];
+    for (int method = 0; method < 2; method++) {
+        string out;
+        out.reserve(expected.size());
+        auto start = chrono::steady_clock::now();
+        for (int r = 0; r < repeats; r++) {
+            out.clear();
+            for (int w = 0; w < windows; w++) {
+                if (method == 0) {
+                    snprintfWindow(out, &blocks[w * channels]);
+                }
+                else {
+                    blockWindow(out, writer, &blocks[w * channels]);
+                }
+            }
+            writer.clear();
+        }
+        seconds[method] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    double rows = (double)repeats * windows * windowSamples;
+    printf("snprintf:       %.1f ns per row\n", 1e9 * seconds[0] / rows);
+    printf("CsvBlockWriter: %.1f ns per row\n", 1e9 * seconds[1] / rows);
+    printf("Speedup: %.1fx\n", seconds[0] / seconds[1]);
+    return 0;
+}
@@ -0,0 +1,394 @@
+#include "../Basic_Code/RecordFormat.hpp"
+#include "../Basic_Code/RecordJournal.hpp"
+#include "../Basic_Code/SampleBlock.hpp"
+#include "../Basic_Code/Crc32.hpp"
+#include "../Basic_Code/RiceCodec.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+
+using namespace std;
+
+/*
+Description:
+- Host fault injection for the binary results file - Damaged and cut short recordings are fed to Record_Decoder, which must report
+  every one of them rather than export garbage or stop quietly.
+- Recordings are built the way the firmware writes them (RecordFormat.hpp, RecordJournal.hpp) - A header block, a commit marker for
+  the finished recording and sealed windows - in each sample encoding, uint16_t, packed 12-bit and Rice compressed.
+- The clean recording must decode to exactly the samples written, with the timing from its window headers added up after them. Then single bits are flipped through the file header, the window
+  headers and the payloads, the file is cut short at window boundaries and part way through windows, and windows are left out or
+  swapped. Each must give the decoder's damaged or gap exit code, and the windows that were not touched must still be exported.
+- Intact windows of an older recording left after the data, as the firmware's preallocated space can hold, must not be exported.
+- The window seal itself is checked on its own - Every single bit flip of a sealed window's storage must change its CRC, as that is
+  what writeSDCard() relies on to find a window changed since it was sealed.
+- The decoder is run as a separate program, so what is checked is the tool that is used - Build Record_Decoder first.
+- Built with any C++14 compiler on Linux or macOS, e.g. g++ -std=c++14 -O2 main.cpp -o fault_injection
+  Run as fault_injection [path to record_decoder], by default ./record_decoder. It writes two scratch files in the current folder.
+*/
+
+static const uint32_t windowSamples = 250;
+static const int channels = 2;
+static const uint32_t windowCount = 8;
+static const char *scratchRecording = "fault_injection.bin";
+static const char *scratchCsv = "fault_injection.csv";
+
+typedef SampleBlock<windowSamples, channels> PlainBlock;
+typedef SampleBlock<windowSamples, channels, true> PackedBlock;
+
+//A recording in memory and where each of its windows starts
+struct Recording {
+    vector<uint8_t> bytes;
+    vector<size_t> windowStarts;
+    vector<vector<uint16_t>> samples; //Samples of each window in CSV order, one sample of every channel at a time
+};
+
+//What the decoder made of a file
+struct Decoded {
+    int exitCode;
+    uint32_t windows;
+    uint32_t damaged;
+    uint32_t gaps;
+    uint32_t exportedWindows;
+    uint32_t timingBlocks; //From the "# timing" line after the last window
+    vector<uint16_t> values;
+};
+
+static string decoder = "./record_decoder";
+
+//A PPG like 12-bit signal with noise, scaled to 16 bits as AdcDma::toU16() does so every encoding stores it exactly
+static uint16_t sampleValue(uint32_t sequence, int channel) {
+    static uint32_t seed = 12345;
+    seed = (seed * 1103515245) + 12345;
+    int32_t raw = 2048 + (int32_t)(600.0 * sin(sequence * 0.05 + channel)) + (int32_t)((seed >> 16) % 9) - 4;
+    uint16_t adc = (uint16_t)((raw < 0) ? 0 : (raw > 4095) ? 4095 : raw);
+    return (uint16_t)((adc << 4) | (adc >> 8));
+}
+
+template <typename Block>
+static void fillBlock(Block &block, uint32_t firstSequence, vector<uint16_t> &csvOrder) {
+    csvOrder.clear();
+    for (uint32_t i = 0; i < windowSamples; i++) {
+        uint16_t values[channels];
+        for (int c = 0; c < channels; c++) {
+            values[c] = sampleValue(firstSequence + i, c);
+            csvOrder.push_back(values[c]);
+        }
+        block.store(i, values);
+    }
+}
+
+static void append(vector<uint8_t> &bytes, const void *data, size_t size) {
+    const uint8_t *p = (const uint8_t *)data;
+    bytes.insert(bytes.end(), p, p + size);
+}
+
+//Builds a finished recording - sequences gives the first sample of each window, so leaving one out makes a gap
+static Recording buildRecording(RecordEncoding encoding, const vector<uint32_t> &sequences, uint32_t recordingId = 1) {
+    Crc32 crc;
+    Recording recording;
+    RecordFileHeader header;
+    recordFileHeaderInit(header, 250, 1, windowSamples, channels, 12, 1, encoding, "fault_injection");
+    recordSetChannelName(header, 0, "ac");
+    recordSetChannelName(header, 1, "dc");
+    header.recordingId = recordingId;
+    crc.compute(&header, offsetof(RecordFileHeader, crc), &header.crc);
+
+    //Header block, then the commit blocks - The second copy is left blank as if only one marker had been written
+    append(recording.bytes, &header, sizeof(header));
+    recording.bytes.resize(recordJournalDataStart, 0);
+
+    static PlainBlock plain;
+    static PackedBlock packed;
+    static uint8_t coded[riceMaxChannelBytes(windowSamples) * channels];
+    for (uint32_t sequence : sequences) {
+        vector<uint16_t> csvOrder;
+        const void *payload;
+        uint32_t payloadBytes;
+        if (encoding == recordEncodingPacked12) {
+            fillBlock(packed, sequence, csvOrder);
+            payload = packed.raw();
+            payloadBytes = PackedBlock::rawSize();
+        }
+        else {
+            fillBlock(plain, sequence, csvOrder);
+            payload = plain.raw();
+            payloadBytes = PlainBlock::rawSize();
+            if (encoding == recordEncodingRice) {
+                payloadBytes = riceEncodeBlock(plain, coded);
+                payload = coded;
+            }
+        }
+
+        JitterSummary timing = {};
+        timing.blocks = windowSamples / 50;
+        timing.binWidthUs = 10;
+        timing.histogram[0] = timing.blocks;
+        RecordWindowHeader window = {recordWindowMagic, sequence, (uint64_t)sequence * 4000, windowSamples, payloadBytes, 0, timing, header.crc, 0, 0};
+        crc.compute(payload, payloadBytes, &window.payloadCrc);
+        crc.compute(&window, offsetof(RecordWindowHeader, crc), &window.crc);
+        recording.windowStarts.push_back(recording.bytes.size());
+        append(recording.bytes, &window, sizeof(window));
+        append(recording.bytes, payload, payloadBytes);
+        recording.samples.push_back(csvOrder);
+    }
+
+    RecordCommit commit = {recordCommitMagic, 1, header.crc, recordCommitFinished, recording.bytes.size(), 0, (uint32_t)sequences.size(),
+                           (uint32_t)sequences.size(), sequences.empty() ? 0 : sequences.back() + windowSamples, 0};
+    crc.compute(&commit, offsetof(RecordCommit, crc), &commit.crc);
+    memcpy(recording.bytes.data() + recordJournalBlockSize, &commit, sizeof(commit));
+    return recording;
+}
+
+static vector<uint32_t> inOrder(uint32_t count) {
+    vector<uint32_t> sequences;
+    for (uint32_t w = 0; w < count; w++) {
+        sequences.push_back(w * windowSamples);
+    }
+    return sequences;
+}
+
+//Runs the decoder on a file image and reads back its summary and the CSV it exported
+static Decoded decode(const vector<uint8_t> &bytes) {
+    Decoded result = {-1, 0, 0, 0, 0, 0, {}};
+    FILE *file = fopen(scratchRecording, "wb");
+    if (file == NULL) {
+        return result;
+    }
+    fwrite(bytes.data(), 1, bytes.size(), file);
+    fclose(file);
+
+    string command = "\"" + decoder + "\" " + scratchRecording + " " + scratchCsv + " 2>&1";
+    FILE *log = popen(command.c_str(), "r");
+    if (log == NULL) {
+        return result;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), log) != NULL) {
+        unsigned windows, damaged, gaps;
+        if (sscanf(line, "%u windows, %u damaged, %u gaps", &windows, &damaged, &gaps) == 3) {
+            result.windows = windows;
+            result.damaged = damaged;
+            result.gaps = gaps;
+        }
+    }
+    int status = pclose(log);
+    result.exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+
+    //Sample lines hold digits, a window ends with two blank lines and the profile line starts with '#'
+    FILE *csv = fopen(scratchCsv, "r");
+    if (csv != NULL) {
+        uint32_t blankLines = 0;
+        while (fgets(line, sizeof(line), csv) != NULL) {
+            if (line[0] == '\n') {
+                blankLines++;
+                continue;
+            }
+            unsigned values[channels];
+            sscanf(line, "# timing blocks=%u", &result.timingBlocks);
+            if (line[0] != '#' && sscanf(line, "%u,%u", &values[0], &values[1]) == channels) {
+                result.values.push_back((uint16_t)values[0]);
+                result.values.push_back((uint16_t)values[1]);
+            }
+        }
+        result.exportedWindows = blankLines / 2;
+        fclose(csv);
+    }
+    return result;
+}
+
+static const char *encodingName(RecordEncoding encoding) {
+    return (encoding == recordEncodingPacked12) ? "packed 12-bit" : (encoding == recordEncodingRice) ? "Rice" : "uint16_t";
+}
+
+static bool report(const char *check, RecordEncoding encoding, uint32_t runs, uint32_t missed) {
+    char name[96];
+    snprintf(name, sizeof(name), "%s, %s", check, encodingName(encoding));
+    printf("%-52s %5u runs, %3u missed  %s\n", name, runs, missed, (missed == 0) ? "ok" : "FAILED");
+    return missed == 0;
+}
+
+//The samples of every window apart from the ones listed, in file order
+static vector<uint16_t> expectedValues(const Recording &recording, uint32_t fromWindow, uint32_t toWindow, int leftOut) {
+    vector<uint16_t> values;
+    for (uint32_t w = fromWindow; w < toWindow; w++) {
+        if ((int)w != leftOut) {
+            values.insert(values.end(), recording.samples[w].begin(), recording.samples[w].end());
+        }
+    }
+    return values;
+}
+
+static bool checkClean(RecordEncoding encoding, const Recording &recording) {
+    Decoded decoded = decode(recording.bytes);
+    bool passed = decoded.exitCode == 0 && decoded.windows == windowCount && decoded.damaged == 0 && decoded.gaps == 0 &&
+                  decoded.values == expectedValues(recording, 0, windowCount, -1) && decoded.timingBlocks == windowCount * (windowSamples / 50);
+    return report("Clean recording decodes exactly", encoding, 1, passed ? 0 : 1);
+}
+
+//Flips one bit in every file header byte that its CRC covers - The decoder must refuse the file
+static bool checkFileHeaderFlips(RecordEncoding encoding, const Recording &recording) {
+    uint32_t runs = 0;
+    uint32_t missed = 0;
+    for (size_t i = 0; i < offsetof(RecordFileHeader, crc); i += 3) {
+        vector<uint8_t> bytes = recording.bytes;
+        bytes[i] ^= (uint8_t)(1 << (i % 8));
+        Decoded decoded = decode(bytes);
+        runs++;
+        missed += decoded.exitCode != 2 || decoded.exportedWindows != 0;
+    }
+    return report("File header bit flips refused", encoding, runs, missed);
+}
+
+//Flips one bit in bytes spread through the windows - A payload flip must cost that window only, a header flip the rest of the file
+static bool checkWindowFlips(RecordEncoding encoding, const Recording &recording) {
+    uint32_t runs = 0;
+    uint32_t missed = 0;
+    for (size_t i = recordJournalDataStart; i < recording.bytes.size(); i += 29) {
+        vector<uint8_t> bytes = recording.bytes;
+        bytes[i] ^= (uint8_t)(1 << (i % 8));
+
+        uint32_t w = 0;
+        while (w + 1 < windowCount && recording.windowStarts[w + 1] <= i) {
+            w++;
+        }
+        bool inHeader = i < recording.windowStarts[w] + sizeof(RecordWindowHeader);
+
+        Decoded decoded = decode(bytes);
+        runs++;
+        if (inHeader) {
+            missed += decoded.exitCode != 1 || decoded.values != expectedValues(recording, 0, w, -1);
+        }
+        else {
+            missed += decoded.exitCode != 1 || decoded.damaged != 1 || decoded.values != expectedValues(recording, 0, windowCount, (int)w);
+        }
+    }
+    return report("Window bit flips found", encoding, runs, missed);
+}
+
+//Cuts the file short at every window boundary and at points through the windows - Only the whole windows before the cut may be exported
+static bool checkTruncation(RecordEncoding encoding, const Recording &recording) {
+    vector<size_t> cuts(recording.windowStarts.begin(), recording.windowStarts.end());
+    for (size_t i = recordJournalDataStart + 1; i < recording.bytes.size(); i += 61) {
+        cuts.push_back(i);
+    }
+
+    uint32_t runs = 0;
+    uint32_t missed = 0;
+    for (size_t cut : cuts) {
+        vector<uint8_t> bytes(recording.bytes.begin(), recording.bytes.begin() + cut);
+        uint32_t whole = 0;
+        while (whole < windowCount && (whole + 1 == windowCount ? recording.bytes.size() : recording.windowStarts[whole + 1]) <= cut) {
+            whole++;
+        }
+        Decoded decoded = decode(bytes);
+        runs++;
+        missed += decoded.exitCode != 1 || decoded.values != expectedValues(recording, 0, whole, -1);
+    }
+    return report("Cut short recordings found", encoding, runs, missed);
+}
+
+//A window torn in its header in a recording that never wrote a marker - The tear itself has to be reported
+static bool checkTornWithoutMarker(RecordEncoding encoding, const Recording &recording) {
+    uint32_t runs = 0;
+    uint32_t missed = 0;
+    for (size_t part = 1; part < sizeof(RecordWindowHeader); part += 5) {
+        size_t cut = recording.windowStarts[windowCount - 1] + part;
+        vector<uint8_t> bytes(recording.bytes.begin(), recording.bytes.begin() + cut);
+        memset(bytes.data() + recordJournalBlockSize, 0, recordJournalBlockSize);
+        Decoded decoded = decode(bytes);
+        runs++;
+        missed += decoded.exitCode != 1 || decoded.damaged != 1 || decoded.values != expectedValues(recording, 0, windowCount - 1, -1);
+    }
+    return report("Torn window header without a marker found", encoding, runs, missed);
+}
+
+//Intact windows of an older recording by the same build left after the data, as in space the firmware preallocated - They carry on
+//the sequence numbers, so only the file header CRC in their headers tells them apart. They must be taken as the end of the data
+static bool checkStaleWindows(RecordEncoding encoding, const Recording &recording) {
+    Recording older = buildRecording(encoding, inOrder(windowCount + 2), 2);
+    vector<uint8_t> bytes = recording.bytes;
+    bytes.insert(bytes.end(), older.bytes.begin() + older.windowStarts[windowCount], older.bytes.end());
+    Decoded decoded = decode(bytes);
+    bool passed = decoded.exitCode == 0 && decoded.windows == windowCount && decoded.values == expectedValues(recording, 0, windowCount, -1);
+    return report("Older recording's windows ignored", encoding, 1, passed ? 0 : 1);
+}
+
+//Windows left out or written out of order - Each intact but in the wrong place, so the sequence numbers have to catch them
+static bool checkSequence(RecordEncoding encoding) {
+    uint32_t runs = 0;
+    uint32_t missed = 0;
+    for (uint32_t w = 1; w < windowCount; w++) {
+        //Leaving out the last window only makes a shorter recording, so windows are left out from the middle
+        vector<uint32_t> sequences = inOrder(windowCount);
+        if (w + 1 < windowCount) {
+            sequences.erase(sequences.begin() + w);
+            Decoded decoded = decode(buildRecording(encoding, sequences).bytes);
+            runs++;
+            missed += decoded.exitCode != 1 || decoded.gaps != 1 || decoded.damaged != 0 || decoded.exportedWindows != windowCount - 1;
+        }
+
+        sequences = inOrder(windowCount);
+        swap(sequences[w - 1], sequences[w]);
+        Decoded decoded = decode(buildRecording(encoding, sequences).bytes);
+        runs++;
+        missed += decoded.exitCode != 1 || decoded.gaps == 0 || decoded.damaged != 0;
+    }
+    return report("Missing and swapped windows found", encoding, runs, missed);
+}
+
+//Every single bit flip of a sealed window must change the seal - The check writeSDCard() makes before a window is written
+static bool checkSeal() {
+    static PlainBlock block;
+    vector<uint16_t> csvOrder;
+    fillBlock(block, 0, csvOrder);
+
+    Crc32 crc;
+    uint32_t seal;
+    crc.compute(block.raw(), PlainBlock::rawSize(), &seal);
+
+    uint8_t *bytes = (uint8_t *)block.raw();
+    uint32_t runs = 0;
+    uint32_t missed = 0;
+    for (size_t bit = 0; bit < PlainBlock::rawSize() * 8; bit++) {
+        uint32_t check;
+        bytes[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        crc.compute(block.raw(), PlainBlock::rawSize(), &check);
+        bytes[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        runs++;
+        missed += check == seal;
+    }
+    printf("%-52s %5u runs, %3u missed  %s\n", "Window seal single bit flips", runs, missed, (missed == 0) ? "ok" : "FAILED");
+    return missed == 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        decoder = argv[1];
+    }
+
+    bool passed = checkSeal();
+    const RecordEncoding encodings[] = {recordEncodingU16, recordEncodingPacked12, recordEncodingRice};
+    for (RecordEncoding encoding : encodings) {
+        Recording recording = buildRecording(encoding, inOrder(windowCount));
+        if (!checkClean(encoding, recording)) {
+            printf("The clean recording did not decode - Is %s a built Record_Decoder?\n", decoder.c_str());
+            passed = false;
+            continue;
+        }
+        passed = checkFileHeaderFlips(encoding, recording) && passed;
+        passed = checkWindowFlips(encoding, recording) && passed;
+        passed = checkTruncation(encoding, recording) && passed;
+        passed = checkTornWithoutMarker(encoding, recording) && passed;
+        passed = checkStaleWindows(encoding, recording) && passed;
+        passed = checkSequence(encoding) && passed;
+    }
+
+    remove(scratchRecording);
+    remove(scratchCsv);
+    return passed ? 0 : 1;
+}
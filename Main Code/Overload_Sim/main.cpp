@@ -0,0 +1,295 @@
+#include "../Basic_Code/SampleRing.hpp"
+#include "../Basic_Code/BufferPool.hpp"
+#include "../Basic_Code/OverloadPolicy.hpp"
+#include "../Basic_Code/WindowFiller.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+/*
+Description:
+- Host simulation of the overload policy (OverloadPolicy.hpp) and the window filler (WindowFiller.hpp) - Checks that sampling never
+  stops for a slow or failing micro-SD card and that only whole windows are lost.
+- Three threads stand in for the firmware's. The producer pushes a numbered block onto a SampleRing every block period like
+  pdReading() and never waits. The consumer fills window buffers from a BufferPool with the firmware's WindowFiller, waiting or
+  dropping windows as the policy says. The writer takes sealed windows and "writes" them like writeSDCard(), taking as long, or
+  failing, as the storage profile says.
+- Each storage profile models a card - Steady writes, garbage collection pauses, a card slower than the data rate, a long stall, a run
+  of failed writes and a card that has gone. The last is run with the old reset policy as well.
+- Every window written is checked to be complete and in order, and the windows written, dropped and lost to failed writes must add up
+  to every window sampled. The longest the producer was held up for is reported.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 -pthread main.cpp -o overload_sim
+*/
+
+//Scaled down profile - 50 sample blocks every 5ms and 10 blocks to a window, so a window is 50ms
+static const uint32_t blockSamples = 50;
+static const uint32_t windowSamples = 500;
+static const microseconds blockPeriod(5000);
+static const uint32_t windows = 120;
+static const uint32_t windowBuffers = 3;
+static const uint32_t maxFailedWrites = 4;
+
+struct Sample {
+    uint32_t sequence;
+    uint16_t value;
+};
+
+struct Window {
+    uint32_t firstSequence;
+    uint16_t values[windowSamples];
+};
+
+//How long the write of window n takes, and whether it fails
+struct StorageProfile {
+    const char *name;
+    OverloadMode mode;
+    int (*write)(uint32_t n, microseconds &delay);
+    bool expectReset;
+};
+
+static int steadyWrite(uint32_t /*n*/, microseconds &delay) {
+    delay = microseconds(12000);
+    return 0;
+}
+
+static int pausingWrite(uint32_t n, microseconds &delay) {
+    delay = microseconds(((n % 16) == 15) ? 180000 : 12000);
+    return 0;
+}
+
+static int slowWrite(uint32_t /*n*/, microseconds &delay) {
+    delay = microseconds(70000);
+    return 0;
+}
+
+static int stallingWrite(uint32_t n, microseconds &delay) {
+    delay = microseconds((n == 30) ? 1000000 : 12000);
+    return 0;
+}
+
+static int flakyWrite(uint32_t n, microseconds &delay) {
+    delay = microseconds(12000);
+    return (n >= 40 && n < 43) ? -5005 : 0;
+}
+
+static int deadWrite(uint32_t n, microseconds &delay) {
+    delay = microseconds(12000);
+    return (n >= 40) ? -5005 : 0;
+}
+
+class Recorder {
+private:
+    SampleRing<Sample, ringCapacityFor(4 * blockSamples)> ring;
+    BufferPool<Window, windowBuffers> pool;
+    OverloadPolicy overload;
+    const StorageProfile &profile;
+
+    //Consumer - The filler calls back into the recorder for what the firmware does with each window
+    struct Events {
+        Recorder &recorder;
+
+        void bufferWait() {}
+        void overloadDrop(uint32_t) {}
+
+        void sequenceGap(uint32_t, uint32_t, bool fatal) {
+            if (fatal) {
+                recorder.reset = true;
+            }
+        }
+
+        void store(Window &window, uint32_t index, const Sample &sample) {
+            window.values[index] = sample.value;
+        }
+
+        void windowDropped(uint32_t) {}
+
+        int windowFull(Window &window, uint32_t firstSequence) {
+            window.firstSequence = firstSequence;
+            return 0;
+        }
+
+        void windowSealed() {
+            recorder.signal(recorder.writerDue);
+        }
+    } events{*this};
+    WindowFiller<Window, windowBuffers, windowSamples, Events> filler{pool, overload, events};
+
+    //Writer state
+    uint32_t writes = 0;
+    uint32_t lostToWrites = 0;
+    vector<Window> card;
+
+    mutex lock;
+    condition_variable wake;
+    bool consumerDue = false;
+    bool writerDue = false;
+    atomic<bool> stop{false};
+    atomic<bool> reset{false};
+
+    void signal(bool &due) {
+        lock_guard<mutex> guard(lock);
+        due = true;
+        wake.notify_all();
+    }
+
+    bool waitFor(bool &due) {
+        unique_lock<mutex> guard(lock);
+        wake.wait_for(guard, milliseconds(2), [&] { return due || stop; });
+        bool was = due;
+        due = false;
+        return was;
+    }
+
+    void consumer() {
+        if (!reset) {
+            filler.drain<blockSamples>(ring);
+        }
+    }
+
+    void writer() {
+        Window *sendData;
+        while (!reset && (sendData = pool.nextReady()) != nullptr) {
+            microseconds delay;
+            int err = profile.write(writes++, delay);
+            this_thread::sleep_for(delay);
+
+            if (err != 0) {
+                if (!overload.writeFailed()) {
+                    reset = true;
+                    return;
+                }
+                lostToWrites++;
+            }
+            else {
+                overload.writeSucceeded();
+                card.push_back(*sendData);
+            }
+            pool.release(sendData);
+            signal(consumerDue);
+        }
+    }
+
+public:
+    uint32_t worstPushUs = 0;
+
+    explicit Recorder(const StorageProfile &storageProfile)
+        : overload(storageProfile.mode, 2 * blockSamples, maxFailedWrites), profile(storageProfile) {}
+
+    //Runs a whole recording - Returns true if it behaved as the profile expects
+    bool run() {
+        thread consumerThread([&] {
+            while (!stop || consumerDue) {
+                waitFor(consumerDue);
+                consumer();
+            }
+        });
+        thread writerThread([&] {
+            while (!stop || writerDue) {
+                waitFor(writerDue);
+                writer();
+            }
+        });
+
+        //Producer - Never waits on anything but its own clock, as pdReading() never waits
+        uint32_t sequence = 0;
+        auto next = steady_clock::now();
+        for (uint32_t b = 0; b < (windows * windowSamples) / blockSamples && !reset; b++) {
+            Sample block[blockSamples];
+            for (uint32_t i = 0; i < blockSamples; i++) {
+                block[i] = {sequence, (uint16_t)sequence};
+                sequence++;
+            }
+
+            auto start = steady_clock::now();
+            ring.push(block, blockSamples);
+            if (!overload.dropsWindows() && ring.overruns() > 0) {
+                reset = true;
+            }
+            signal(consumerDue);
+            worstPushUs = max(worstPushUs, (uint32_t)duration_cast<microseconds>(steady_clock::now() - start).count());
+
+            next += blockPeriod;
+            this_thread::sleep_until(next);
+        }
+
+        //Lets the writer finish what is queued - The last window may still be on the ring if the consumer was waiting for a buffer
+        for (int i = 0; i < 200 && !reset && (pool.readyCount() > 0 || ring.size() > 0); i++) {
+            signal(consumerDue);
+            signal(writerDue);
+            this_thread::sleep_for(milliseconds(10));
+        }
+        stop = true;
+        wake.notify_all();
+        consumerThread.join();
+        writerThread.join();
+
+        printf("%-9s %-6s %8u %8u %8u %8u %8u %8u %9uus  ", profile.name, (profile.mode == overloadDrop) ? "drop" : "reset", (unsigned)card.size(),
+               overload.windowsDropped(), lostToWrites, overload.samplesLost(), overload.waits(), overload.writesFailed(), worstPushUs);
+
+        if (reset) {
+            printf("%s\n", profile.expectReset ? "reset as expected" : "RESET");
+            return profile.expectReset;
+        }
+        if (profile.expectReset) {
+            printf("NO RESET\n");
+            return false;
+        }
+
+        //Every window written is whole, in order and on a window boundary
+        uint32_t last = 0;
+        for (size_t w = 0; w < card.size(); w++) {
+            const Window &window = card[w];
+            bool whole = (window.firstSequence % windowSamples) == 0 && (w == 0 || window.firstSequence > last);
+            for (uint32_t i = 0; i < windowSamples && whole; i++) {
+                whole = (window.values[i] == (uint16_t)(window.firstSequence + i));
+            }
+            if (!whole) {
+                printf("BROKEN WINDOW at sample %u\n", window.firstSequence);
+                return false;
+            }
+            last = window.firstSequence;
+        }
+
+        //Every window sampled is accounted for
+        uint32_t accounted = (uint32_t)card.size() + overload.windowsDropped() + lostToWrites;
+        if (accounted != windows) {
+            printf("%u OF %u WINDOWS ACCOUNTED FOR\n", accounted, windows);
+            return false;
+        }
+        printf("ok\n");
+        return true;
+    }
+};
+
+int main() {
+    const StorageProfile profiles[] = {
+        {"steady", overloadDrop, steadyWrite, false},
+        {"pauses", overloadDrop, pausingWrite, false},
+        {"slow", overloadDrop, slowWrite, false},
+        {"stall", overloadDrop, stallingWrite, false},
+        {"flaky", overloadDrop, flakyWrite, false},
+        {"dead", overloadDrop, deadWrite, true},
+        {"stall", overloadReset, stallingWrite, true},
+    };
+
+    printf("%u windows of %u samples, a %lldus block of %u samples at a time, %u window buffers\n", windows, windowSamples,
+           (long long)blockPeriod.count(), blockSamples, windowBuffers);
+    printf("%-9s %-6s %8s %8s %8s %8s %8s %8s %11s  %s\n", "Storage", "Policy", "Written", "Dropped", "Failed", "Lost", "Waits", "Errors",
+           "Worst push", "Result");
+
+    bool passed = true;
+    for (const StorageProfile &profile : profiles) {
+        Recorder recorder(profile);
+        passed = recorder.run() && passed;
+    }
+    return passed ? 0 : 1;
+}
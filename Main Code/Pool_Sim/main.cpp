@@ -0,0 +1,164 @@
+#include "../Basic_Code/BufferPool.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <thread>
+
+using namespace std;
+using namespace std::chrono;
+
+/*
+Description:
+- Host simulation of the window buffer pool (BufferPool.hpp) in front of a micro-SD card whose writes are slow.
+- A sampling thread does what pdReading() and consumer() do on the board - Every millisecond a batch of numbered samples is pushed
+  onto a sample ring, and the ring is drained into the window being filled. When acquire() finds no free buffer the samples are left
+  on the ring, and once the ring is full as well new samples are lost and counted.
+- A writer thread takes sealed windows and holds each one for as long as the card profile says a write takes. It checks the window
+  before and after the write, so a buffer changed while it is being written is caught, and checks the samples are in order.
+- Three card profiles:
+  - Latency spikes shorter than the spare buffers - Nothing stalls and nothing is lost.
+  - Spikes longer than the spare buffers but shorter than the buffers and the ring together - The pool runs out and stalls are
+    counted, but the samples wait on the ring and none are lost.
+  - Every write slower than a window - The pool and the ring both run out and samples are lost, but every window that is written is
+    still whole and unchanged, and the samples written and lost add up to the samples taken.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 -pthread main.cpp -o pool_sim
+*/
+
+static const uint32_t windowSamples = 100;
+static const uint32_t batchSamples = 10; //Per millisecond, so a window every 10ms
+static const uint32_t poolBlocks = 3;
+static const uint32_t windowsToRun = 60;
+
+struct SimWindow {
+    uint32_t samples[windowSamples];
+};
+
+struct Result {
+    uint32_t windowsWritten;
+    uint32_t samplesWritten;
+    uint32_t samplesLost;
+    uint32_t samplesTaken;
+    uint32_t stalls;
+    uint32_t lowestFree;
+    uint32_t changedWhileWritten;
+    uint32_t outOfOrder;
+};
+
+static uint64_t checksum(const SimWindow &w) {
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < windowSamples; i++) {
+        sum = (sum * 31) + w.samples[i];
+    }
+    return sum;
+}
+
+//Runs a recording with writeTime(n) giving how long the card takes over write n
+static Result run(function<microseconds(uint32_t)> writeTime) {
+    BufferPool<SimWindow, poolBlocks> pool;
+    SampleRing<uint32_t, 256> ring; //25.6ms of samples
+    Result result = {};
+    atomic<bool> sampling(true);
+    atomic<uint32_t> windowsWritten(0); //Read by the sampling thread, so kept apart from the writer's own counts
+
+    thread writer([&] {
+        uint32_t written = 0;
+        uint32_t last = 0;
+        bool first = true;
+        while (true) {
+            SimWindow *w = pool.nextReady();
+            if (w == nullptr) {
+                if (!sampling) {
+                    break;
+                }
+                this_thread::sleep_for(microseconds(200));
+                continue;
+            }
+
+            uint64_t before = checksum(*w);
+            this_thread::sleep_for(writeTime(written++));
+            result.changedWhileWritten += checksum(*w) != before;
+            for (uint32_t i = 0; i < windowSamples; i++) {
+                result.outOfOrder += !first && w->samples[i] <= last;
+                last = w->samples[i];
+                first = false;
+            }
+            result.samplesWritten += windowSamples;
+            pool.release(w);
+            windowsWritten++;
+        }
+    });
+
+    //Sampling thread - The timer pushes a batch every millisecond and the consumer drains the ring into windows
+    SimWindow *filling = nullptr;
+    uint32_t filled = 0;
+    uint32_t sequence = 0;
+    auto tick = steady_clock::now();
+    while (windowsWritten + pool.readyCount() < windowsToRun) {
+        tick += milliseconds(1);
+        this_thread::sleep_until(tick);
+
+        uint32_t batch[batchSamples];
+        for (uint32_t i = 0; i < batchSamples; i++) {
+            batch[i] = sequence++;
+        }
+        result.samplesTaken += batchSamples;
+        result.samplesLost += batchSamples - ring.push(batch, batchSamples);
+
+        while (!ring.empty()) {
+            if (filling == nullptr && (filling = pool.acquire()) == nullptr) {
+                break; //Left on the ring until the writer frees a buffer
+            }
+            filled += ring.pop(filling->samples + filled, windowSamples - filled);
+            if (filled == windowSamples) {
+                pool.seal(filling);
+                filling = nullptr;
+                filled = 0;
+            }
+        }
+    }
+    sampling = false;
+    writer.join();
+    result.windowsWritten = windowsWritten;
+
+    //Samples still on the ring or in the window being filled when sampling stopped were neither written nor lost
+    result.samplesTaken -= ring.size() + filled;
+    result.stalls = pool.stalls();
+    result.lowestFree = pool.lowestFree();
+    return result;
+}
+
+static bool report(const char *name, const Result &r, bool passed) {
+    printf("%s\n", name);
+    printf("  %u windows written, %u samples lost of %u, %u stalls, lowest free %u of %u  %s\n", r.windowsWritten, r.samplesLost,
+           r.samplesTaken, r.stalls, r.lowestFree, poolBlocks, passed ? "ok" : "FAILED");
+    if (r.changedWhileWritten != 0 || r.outOfOrder != 0) {
+        printf("  %u windows changed while being written, %u samples out of order\n", r.changedWhileWritten, r.outOfOrder);
+    }
+    return passed;
+}
+
+int main() {
+    bool passed = true;
+
+    //Two spare buffers cover 20ms - A 12ms spike every 8th write fits in them
+    Result spikes = run([](uint32_t n) { return microseconds(((n % 8) == 7) ? 12000 : 2000); });
+    passed = report("Short latency spikes (12ms every 8th write)", spikes,
+                    spikes.stalls == 0 && spikes.samplesLost == 0 && spikes.changedWhileWritten == 0 && spikes.outOfOrder == 0 &&
+                    spikes.samplesWritten == spikes.samplesTaken) && passed;
+
+    //35ms is more than the spare buffers hold but less than them and the 25.6ms ring
+    Result longSpikes = run([](uint32_t n) { return microseconds(((n % 12) == 11) ? 35000 : 2000); });
+    passed = report("Long latency spikes (35ms every 12th write)", longSpikes,
+                    longSpikes.stalls > 0 && longSpikes.lowestFree == 0 && longSpikes.samplesLost == 0 &&
+                    longSpikes.changedWhileWritten == 0 && longSpikes.outOfOrder == 0 &&
+                    longSpikes.samplesWritten == longSpikes.samplesTaken) && passed;
+
+    //Every write takes 15ms for a 10ms window, so the backlog only grows
+    Result slow = run([](uint32_t) { return microseconds(15000); });
+    passed = report("Card slower than sampling (15ms per 10ms window)", slow,
+                    slow.stalls > 0 && slow.lowestFree == 0 && slow.samplesLost > 0 && slow.changedWhileWritten == 0 &&
+                    slow.outOfOrder == 0 && slow.samplesWritten + slow.samplesLost == slow.samplesTaken) && passed;
+    return passed ? 0 : 1;
+}
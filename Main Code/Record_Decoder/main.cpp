@@ -0,0 +1,602 @@
+#include "../Basic_Code/RecordFormat.hpp"
+#include "../Basic_Code/SampleBlock.hpp"
+#include "../Basic_Code/Crc32.hpp"
+#include "../Basic_Code/RawBlockLog.hpp"
+#include "../Basic_Code/RecordJournal.hpp"
+#include "../Basic_Code/RiceCodec.hpp"
+#include "../Basic_Code/SessionFiles.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*
+Description:
+- Host side decoder for the binary results file (glucoseresults.bin) written by Basic_Code when binary-records is enabled,
+  and for the raw block log written when raw-block-log is enabled (RawBlockLog.hpp).
+- Checks the file header, every window header and every window payload against their CRCs and the sample sequence numbers for gaps.
+- Version 3 results files carry commit markers (RecordJournal.hpp) - Whether the recording was finished or cut short by a reset is reported,
+  and data that ends before the committed windows do is reported as damaged.
+- Session files (SessionFiles.hpp) are read through their index - Each window is found from its entry in sNNNN.idx without
+  reading the parts before it, so one window of a long session can be pulled out on its own.
+- Compressed windows (recordEncodingRice) are decompressed and every channel checked to decode exactly to its sample count.
+- Exports the samples as the same CSV the firmware writes in text mode - the profile line, one line per sample with the channels
+  separated by commas, two blank lines after each window and the "# timing" line at the end - so Quantise.m and the other MATLAB
+  scripts read it unchanged. The timing is added up from the window headers, which hold it from version 4.
+- From version 5 a window that holds the CRC of another recording's file header is taken as the end of the data - It is left over in
+  space the firmware preallocated.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 main.cpp -o record_decoder
+
+Usage:
+  record_decoder glucoseresults.bin [glucoseresults.txt]
+  record_decoder --raw card.img [--offset bytes] [--session n] [glucoseresults.txt]
+  record_decoder --index s0001.idx [--window n] [glucoseresults.txt]
+  The CSV goes to standard output when no output file is given. A summary of the recording is printed to standard error.
+  card.img is an image of the card or of the raw log region (e.g. from dd) - --offset is where the region starts in the image.
+  Without --session the sessions in the raw log are listed, otherwise session n (from 1) is exported.
+  With --index the parts are read from the index's folder - Every window is exported, or only window n (from 0) with --window.
+  Returns 0 if every window was intact, 1 if any window was damaged or missing and 2 if the file could not be read at all.
+*/
+
+//Writes one window payload as CSV lines - Channels are stored one after another so each line takes one sample from each
+static void exportWindow(FILE *out, const RecordFileHeader &header, const uint8_t *payload, uint32_t samples) {
+    uint32_t channelBytes = recordChannelBytes(header.encoding, samples);
+
+    for (uint32_t i = 0; i < samples; i++) {
+        for (int c = 0; c < header.channels; c++) {
+            const uint8_t *channel = payload + (c * channelBytes);
+            uint16_t value;
+            if (header.encoding == recordEncodingPacked12) {
+                value = PackedSampleChannel((uint8_t *)channel, samples)[i];
+            }
+            else {
+                memcpy(&value, channel + (i * 2), sizeof(value));
+            }
+            fprintf(out, (c == 0) ? "%u" : ",%u", value);
+        }
+        fprintf(out, "\n");
+    }
+    fprintf(out, "\n\n");
+}
+
+//Reads a file header in the layout of its version and works out the CRC of what was stored - Returns false if the file is too short
+static bool readFileHeader(FILE *in, RecordFileHeader &header, uint32_t &check) {
+    Crc32 crc;
+    uint8_t stored[sizeof(RecordFileHeader)];
+    if (fread(stored, 1, recordFileHeaderV4Bytes, in) != recordFileHeaderV4Bytes) {
+        return false;
+    }
+    uint16_t version;
+    memcpy(&version, stored + offsetof(RecordFileHeader, version), sizeof(version));
+    size_t rest = recordFileHeaderBytes(version) - recordFileHeaderV4Bytes;
+    if (rest > 0 && fread(stored + recordFileHeaderV4Bytes, 1, rest, in) != rest) {
+        return false;
+    }
+    crc.compute(stored, recordLoadFileHeader(stored, header), &check);
+    return true;
+}
+
+//Checks a file header (with check, from readFileHeader()) is a version this decoder knows with an intact CRC and prints its summary
+//Returns false if not
+static bool checkFileHeader(const RecordFileHeader &header, uint32_t check, const char *name) {
+    if (header.magic != recordFileMagic) {
+        fprintf(stderr, "%s is not a binary recording\n", name);
+        return false;
+    }
+    if (header.version == 0 || header.version > recordVersion || header.headerSize != recordFileHeaderBytes(header.version)) {
+        fprintf(stderr, "Recording format version %u is not supported (decoder reads version %u)\n", header.version, recordVersion);
+        return false;
+    }
+    if (check != header.crc || header.channels == 0 || header.channels > recordMaxChannels) {
+        fprintf(stderr, "File header is damaged\n");
+        return false;
+    }
+    if (header.encoding > recordEncodingRice) {
+        fprintf(stderr, "Sample encoding %u is not supported\n", header.encoding);
+        return false;
+    }
+
+    fprintf(stderr, "Recording from %.*s\n", recordBuildLength, header.build);
+    fprintf(stderr, "%u Hz, %u s windows of %u samples, %u-bit ADC oversampled x%u, channels:", header.rateHz, header.windowSeconds,
+            header.samplesPerWindow, header.adcBits, header.oversample);
+    for (int c = 0; c < header.channels; c++) {
+        fprintf(stderr, " %.*s", recordNameLength, header.channelNames[c]);
+    }
+    fprintf(stderr, "\n");
+    return true;
+}
+
+//Decompresses every channel of a window into a plain uint16_t payload - Returns false if any channel does not decode cleanly
+static bool decompressWindow(const RecordFileHeader &header, const vector<uint8_t> &coded, uint32_t samples, vector<uint8_t> &payload) {
+    vector<uint16_t> values(samples);
+    payload.resize(recordChannelBytes(recordEncodingU16, samples) * header.channels);
+
+    uint32_t used = 0;
+    for (int c = 0; c < header.channels; c++) {
+        uint32_t channelBytes = riceDecodeChannel(coded.data() + used, coded.size() - used, values.data(), samples);
+        if (channelBytes == 0) {
+            return false;
+        }
+        used += channelBytes;
+        memcpy(payload.data() + (c * samples * 2), values.data(), samples * 2);
+    }
+    return used == coded.size();
+}
+
+//Reads the next window header in the layout of the file's version and works out the CRC of what was stored - Returns the bytes read,
+//which is fewer than recordWindowHeaderBytes() where the data ends
+static size_t readWindowHeader(FILE *in, const RecordFileHeader &header, RecordWindowHeader &window, uint32_t &check) {
+    Crc32 crc;
+    uint8_t stored[sizeof(RecordWindowHeader)];
+    size_t bytes = recordWindowHeaderBytes(header.version);
+    size_t got = fread(stored, 1, bytes, in);
+    if (got == bytes) {
+        crc.compute(stored, recordLoadWindowHeader(stored, header.version, window), &check);
+    }
+    return got;
+}
+
+//Checks a window header's CRC (check, from readWindowHeader()) and that its payload is a size the file's encoding can produce
+static bool checkWindowHeader(const RecordFileHeader &header, const RecordWindowHeader &window, uint32_t check) {
+    bool compressed = (header.encoding == recordEncodingRice);
+    uint32_t maxBytes = compressed ? (riceMaxChannelBytes(window.sampleCount) * header.channels)
+                                   : (recordChannelBytes(header.encoding, window.sampleCount) * header.channels);
+    return check == window.crc && window.payloadBytes <= maxBytes && (compressed || window.payloadBytes == maxBytes);
+}
+
+//Writes the sampling timing of the exported windows after them, as the firmware does at the end of CSV results, and to the summary
+//Files from before version 4 have no timing
+static void reportTiming(FILE *out, const RecordFileHeader &header, const JitterSummary &timing) {
+    if (header.version < 4 || timing.blocks == 0) {
+        return;
+    }
+    char line[192];
+    jitterDescribe(timing, line, sizeof(line));
+    fputs(line, out);
+    fprintf(stderr, "Sampling timing: worst interval error %uus, lateness worst %uus mean %uus, %u missed deadlines in %u blocks\n",
+            timing.worstIntervalErrorUs, timing.worstLatenessUs, timing.meanLatenessUs, timing.missedDeadlines, timing.blocks);
+}
+
+//Decodes the windows that follow a file header until the data ends and exports them - Each window starts on a multiple of align bytes
+//(1 in a results file, the block size in the raw log). committedEnd is where the last commit marker says the windows reach, or 0 if
+//there is none - Data that ends before it has lost committed windows. Returns the exit code
+static int exportWindows(FILE *in, FILE *out, const RecordFileHeader &header, uint32_t align, uint64_t committedEnd) {
+    Crc32 crc;
+    uint32_t check;
+
+    char profile[128];
+    recordDescribe(header, profile, sizeof(profile));
+    fputs(profile, out);
+
+    //Compressed windows are exported as the plain samples they decode to
+    bool compressed = (header.encoding == recordEncodingRice);
+    RecordFileHeader plain = header;
+    plain.encoding = compressed ? (uint16_t)recordEncodingU16 : (uint16_t)header.encoding;
+
+    //Windows follow one after another until the end of the file
+    vector<uint8_t> payload;
+    vector<uint8_t> samples;
+    RecordWindowHeader window;
+    uint32_t windows = 0;
+    uint32_t damaged = 0;
+    uint32_t gaps = 0;
+    uint32_t nextSequence = 0;
+    uint64_t dataEnd = ftell(in);
+    size_t headerBytes = recordWindowHeaderBytes(header.version);
+    size_t got;
+    uint32_t headerCheck = 0;
+    JitterSummary timing = {};
+
+    while ((got = readWindowHeader(in, header, window, headerCheck)) == headerBytes) {
+        //Space preallocated by the firmware is only trimmed off when sampling finishes cleanly - Anything that is not a window is the end of the data
+        if (window.magic != recordWindowMagic) {
+            break;
+        }
+
+        if (!checkWindowHeader(header, window, headerCheck)) {
+            //Without a good header the payload length is unknown so nothing after this point can be trusted
+            fprintf(stderr, "Window header %u is damaged - Stopping\n", windows);
+            damaged++;
+            break;
+        }
+
+        //The preallocated space is not cleared either, so an intact window of an older recording is the end of the data too
+        if (!recordWindowBelongs(header, window)) {
+            break;
+        }
+
+        payload.resize(window.payloadBytes);
+        if (fread(payload.data(), 1, window.payloadBytes, in) != window.payloadBytes) {
+            fprintf(stderr, "Window %u is cut short - The recording was probably interrupted\n", windows);
+            damaged++;
+            break;
+        }
+
+        //Skips the padding after the window so the next read starts on its boundary
+        uint32_t used = (headerBytes + window.payloadBytes) % align;
+        if (used != 0) {
+            fseek(in, align - used, SEEK_CUR);
+        }
+        dataEnd = ftell(in);
+
+        crc.compute(payload.data(), payload.size(), &check);
+        if (check != window.payloadCrc) {
+            fprintf(stderr, "Window %u (first sample %u) failed its CRC check - Skipped\n", windows, window.firstSequence);
+            damaged++;
+            windows++;
+            continue;
+        }
+
+        if (window.firstSequence != nextSequence) {
+            fprintf(stderr, "Gap before window %u - Expected sample %u but it starts at %u\n", windows, nextSequence, window.firstSequence);
+            gaps++;
+        }
+        nextSequence = window.firstSequence + window.sampleCount;
+
+        if (compressed && !decompressWindow(header, payload, window.sampleCount, samples)) {
+            fprintf(stderr, "Window %u (first sample %u) did not decompress - Skipped\n", windows, window.firstSequence);
+            damaged++;
+            windows++;
+            continue;
+        }
+
+        exportWindow(out, plain, compressed ? samples.data() : payload.data(), window.sampleCount);
+        jitterAccumulate(timing, window.timing);
+        windows++;
+    }
+
+    //Part of a header with nothing after it is a window torn as it was written
+    if (got > 0 && got < headerBytes) {
+        fprintf(stderr, "Window %u is cut short in its header - The recording was probably interrupted\n", windows);
+        damaged++;
+    }
+    if (dataEnd < committedEnd) {
+        fprintf(stderr, "The windows end at byte %llu but were committed up to byte %llu - Committed windows are missing\n",
+                (unsigned long long)dataEnd, (unsigned long long)committedEnd);
+        damaged++;
+    }
+
+    reportTiming(out, header, timing);
+    fprintf(stderr, "%u windows, %u damaged, %u gaps\n", windows, damaged, gaps);
+    return (damaged > 0 || gaps > 0) ? 1 : 0;
+}
+
+//Reports the newest intact commit marker of a version 3 results file and returns the end of the data it commits, or 0 if there is none
+//The windows are decoded whatever it says, as ones after it may be intact too
+static uint64_t reportCommit(FILE *in, const RecordFileHeader &header) {
+    Crc32 crc;
+    RecordCommit commit;
+    bool found = false;
+
+    for (long copy = 1; copy <= 2; copy++) {
+        RecordCommit candidate;
+        uint32_t check;
+        if (fseek(in, copy * recordJournalBlockSize, SEEK_SET) != 0 || fread(&candidate, sizeof(candidate), 1, in) != 1) {
+            continue;
+        }
+        crc.compute(&candidate, offsetof(RecordCommit, crc), &check);
+        if (candidate.magic == recordCommitMagic && check == candidate.crc && candidate.headerCrc == header.crc &&
+            (!found || candidate.generation > commit.generation)) {
+            commit = candidate;
+            found = true;
+        }
+    }
+
+    if (!found) {
+        fprintf(stderr, "No intact commit marker\n");
+        return 0;
+    }
+    if (commit.state == recordCommitFinished) {
+        fprintf(stderr, "Recording finished - %u of %u windows\n", commit.windows, commit.windowsTarget);
+    }
+    else {
+        fprintf(stderr, "Recording was not finished - %u of %u windows committed\n", commit.windows, commit.windowsTarget);
+    }
+    return commit.dataEnd;
+}
+
+//Reads the newest intact superblock of a raw log starting at offset - Returns false if there is no log there
+static bool readSuperblock(FILE *in, long offset, RawLogSuperblock &super) {
+    Crc32 crc;
+    bool found = false;
+
+    for (long copy = 0; copy < 2; copy++) {
+        RawLogSuperblock candidate;
+        uint32_t check;
+        if (fseek(in, offset + (copy * rawLogBlockSize), SEEK_SET) != 0 || fread(&candidate, sizeof(candidate), 1, in) != 1) {
+            continue;
+        }
+        crc.compute(&candidate, offsetof(RawLogSuperblock, crc), &check);
+        if (candidate.magic == rawLogMagic && candidate.version == rawLogVersion && check == candidate.crc &&
+            candidate.blockSize == rawLogBlockSize && candidate.sessionCount <= (uint32_t)rawLogMaxSessions &&
+            (!found || candidate.generation > super.generation)) {
+            super = candidate;
+            found = true;
+        }
+    }
+    return found;
+}
+
+//Lists the sessions of a raw log or exports one of them
+static int decodeRaw(FILE *in, FILE *out, const char *name, long offset, int session) {
+    RawLogSuperblock super = {};
+    if (!readSuperblock(in, offset, super)) {
+        fprintf(stderr, "%s has no raw log at offset %ld\n", name, offset);
+        return 2;
+    }
+
+    RecordFileHeader header;
+    uint32_t check;
+    if (session <= 0) {
+        fprintf(stderr, "Raw log of %u blocks with %u sessions:\n", super.regionBlocks, super.sessionCount);
+        for (uint32_t i = 0; i < super.sessionCount; i++) {
+            fseek(in, offset + ((long)super.sessionStart[i] * rawLogBlockSize), SEEK_SET);
+            if (readFileHeader(in, header, check) && header.magic == recordFileMagic) {
+                fprintf(stderr, "%u: block %u, %u Hz, %u channels, %.*s\n", i + 1, super.sessionStart[i], header.rateHz, header.channels,
+                        recordBuildLength, header.build);
+            }
+            else {
+                fprintf(stderr, "%u: block %u, no session header\n", i + 1, super.sessionStart[i]);
+            }
+        }
+        return 0;
+    }
+
+    if ((uint32_t)session > super.sessionCount) {
+        fprintf(stderr, "The raw log only holds %u sessions\n", super.sessionCount);
+        return 2;
+    }
+
+    //Session header block, then its windows each starting on a block boundary
+    fseek(in, offset + ((long)super.sessionStart[session - 1] * rawLogBlockSize), SEEK_SET);
+    if (!readFileHeader(in, header, check) || !checkFileHeader(header, check, name)) {
+        return 2;
+    }
+    fseek(in, offset + ((long)(super.sessionStart[session - 1] + 1) * rawLogBlockSize), SEEK_SET);
+    return exportWindows(in, out, header, rawLogBlockSize, 0);
+}
+
+//Reads the window an index entry points at from its part and exports it - Returns false if it is damaged or does not match the entry
+//The window's timing is added to timing
+static bool exportIndexedWindow(FILE *part, FILE *out, const SessionIndexHeader &index, const SessionIndexEntry &entry, uint32_t number,
+                                JitterSummary &timing) {
+    if (fseek(part, entry.offset, SEEK_SET) != 0) {
+        fprintf(stderr, "Window %u is past the end of part %u\n", number, entry.part);
+        return false;
+    }
+
+    //Text windows are copied out as they are
+    if (index.format == sessionFormatText) {
+        vector<char> text(entry.bytes);
+        if (fread(text.data(), 1, entry.bytes, part) != entry.bytes) {
+            fprintf(stderr, "Window %u is cut short in part %u\n", number, entry.part);
+            return false;
+        }
+        fwrite(text.data(), 1, entry.bytes, out);
+        return true;
+    }
+
+    const RecordFileHeader &header = index.record;
+    Crc32 crc;
+    uint32_t check = 0;
+    RecordWindowHeader window;
+    size_t headerBytes = recordWindowHeaderBytes(header.version);
+    if (readWindowHeader(part, header, window, check) != headerBytes || window.magic != recordWindowMagic ||
+        !checkWindowHeader(header, window, check) || !recordWindowBelongs(header, window) || window.firstSequence != entry.firstSequence ||
+        headerBytes + window.payloadBytes != entry.bytes) {
+        fprintf(stderr, "Window %u (part %u at %u) does not match its index entry\n", number, entry.part, entry.offset);
+        return false;
+    }
+
+    vector<uint8_t> payload(window.payloadBytes);
+    if (fread(payload.data(), 1, window.payloadBytes, part) != window.payloadBytes) {
+        fprintf(stderr, "Window %u is cut short in part %u\n", number, entry.part);
+        return false;
+    }
+    crc.compute(payload.data(), payload.size(), &check);
+    if (check != window.payloadCrc) {
+        fprintf(stderr, "Window %u (first sample %u) failed its CRC check - Skipped\n", number, window.firstSequence);
+        return false;
+    }
+
+    RecordFileHeader plain = header;
+    if (header.encoding == recordEncodingRice) {
+        vector<uint8_t> samples;
+        if (!decompressWindow(header, payload, window.sampleCount, samples)) {
+            fprintf(stderr, "Window %u (first sample %u) did not decompress - Skipped\n", number, window.firstSequence);
+            return false;
+        }
+        plain.encoding = recordEncodingU16;
+        exportWindow(out, plain, samples.data(), window.sampleCount);
+    }
+    else {
+        exportWindow(out, plain, payload.data(), window.sampleCount);
+    }
+    jitterAccumulate(timing, window.timing);
+    return true;
+}
+
+//Exports a session through its index - Every window, or only window number when it is not negative
+static int decodeIndex(FILE *in, FILE *out, const char *name, long number) {
+    Crc32 crc;
+    uint32_t check;
+    SessionIndexHeader index;
+
+    if (fread(&index, sizeof(index), 1, in) != 1 || index.magic != sessionIndexMagic) {
+        fprintf(stderr, "%s is not a session index\n", name);
+        return 2;
+    }
+    crc.compute(&index, offsetof(SessionIndexHeader, crc), &check);
+    if (index.version != sessionIndexVersion || index.headerSize != sizeof(SessionIndexHeader) || check != index.crc ||
+        index.format > sessionFormatText) {
+        fprintf(stderr, "Session index header is damaged or a version this decoder does not read\n");
+        return 2;
+    }
+    crc.compute(&index.record, offsetof(RecordFileHeader, crc), &check);
+    if (!checkFileHeader(index.record, check, name)) {
+        return 2;
+    }
+
+    //Whole entries only - A torn last entry is left out the same way the firmware leaves it out
+    fseek(in, 0, SEEK_END);
+    long windows = (ftell(in) - (long)sizeof(index)) / (long)sizeof(SessionIndexEntry);
+    time_t started = (time_t)index.startTime;
+    fprintf(stderr, "Session %u started %s", index.sessionId, ctime(&started));
+    fprintf(stderr, "%ld windows in %s files\n", windows, (index.format == sessionFormatText) ? "text" : "binary");
+    if (number >= windows) {
+        fprintf(stderr, "The session only holds %ld windows\n", windows);
+        return 2;
+    }
+
+    //Parts sit in the same folder as the index
+    string folder(name);
+    size_t slash = folder.find_last_of("/\\");
+    folder = (slash == string::npos) ? string() : folder.substr(0, slash + 1);
+
+    char profile[128];
+    recordDescribe(index.record, profile, sizeof(profile));
+    fputs(profile, out);
+
+    FILE *part = NULL;
+    uint32_t openPart = 0;
+    uint32_t damaged = 0;
+    uint32_t gaps = 0;
+    uint32_t nextSequence = 0;
+    JitterSummary timing = {};
+    long first = (number < 0) ? 0 : number;
+    long last = (number < 0) ? windows : number + 1;
+
+    for (long w = first; w < last; w++) {
+        SessionIndexEntry entry;
+        fseek(in, sizeof(index) + (w * sizeof(SessionIndexEntry)), SEEK_SET);
+        if (fread(&entry, sizeof(entry), 1, in) != 1) {
+            damaged++;
+            break;
+        }
+
+        if (entry.part != openPart) {
+            char partName[16];
+            sessionPartName(partName, sizeof(partName), index.sessionId, entry.part, (SessionFormat)index.format);
+            if (part != NULL) {
+                fclose(part);
+            }
+            part = fopen((folder + partName).c_str(), "rb");
+            openPart = entry.part;
+            if (part == NULL) {
+                fprintf(stderr, "Could not open part %s\n", partName);
+            }
+        }
+        if (w > first && entry.firstSequence != nextSequence) {
+            fprintf(stderr, "Gap before window %ld - Expected sample %u but it starts at %u\n", w, nextSequence, entry.firstSequence);
+            gaps++;
+        }
+        nextSequence = entry.firstSequence + index.record.samplesPerWindow;
+
+        if (part == NULL || !exportIndexedWindow(part, out, index, entry, (uint32_t)w, timing)) {
+            damaged++;
+        }
+    }
+    if (part != NULL) {
+        fclose(part);
+    }
+    if (index.format != sessionFormatText) {
+        reportTiming(out, index.record, timing);
+    }
+
+    fprintf(stderr, "%ld windows exported, %u damaged, %u gaps\n", last - first - (long)damaged, damaged, gaps);
+    return (damaged > 0 || gaps > 0) ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+    bool raw = false;
+    bool indexed = false;
+    long offset = 0;
+    long window = -1;
+    int session = 0;
+    const char *inName = NULL;
+    const char *outName = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--raw") == 0) {
+            raw = true;
+        }
+        else if (strcmp(argv[i], "--index") == 0) {
+            indexed = true;
+        }
+        else if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+            window = strtol(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--offset") == 0 && i + 1 < argc) {
+            offset = strtol(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--session") == 0 && i + 1 < argc) {
+            session = atoi(argv[++i]);
+        }
+        else if (inName == NULL) {
+            inName = argv[i];
+        }
+        else {
+            outName = argv[i];
+        }
+    }
+
+    if (inName == NULL) {
+        fprintf(stderr, "Usage: %s <recording.bin> [output.csv]\n", argv[0]);
+        fprintf(stderr, "       %s --raw <card.img> [--offset bytes] [--session n] [output.csv]\n", argv[0]);
+        fprintf(stderr, "       %s --index <sNNNN.idx> [--window n] [output.csv]\n", argv[0]);
+        return 2;
+    }
+
+    FILE *in = fopen(inName, "rb");
+    if (in == NULL) {
+        fprintf(stderr, "Could not open %s\n", inName);
+        return 2;
+    }
+
+    FILE *out = (outName != NULL) ? fopen(outName, "w") : stdout;
+    if (out == NULL) {
+        fprintf(stderr, "Could not create %s\n", outName);
+        fclose(in);
+        return 2;
+    }
+
+    int result;
+    if (raw) {
+        result = decodeRaw(in, out, inName, offset, session);
+    }
+    else if (indexed) {
+        result = decodeIndex(in, out, inName, window);
+    }
+    else {
+        //File header - Must be a version this decoder knows with an intact CRC
+        RecordFileHeader header;
+        uint32_t check;
+        if (!readFileHeader(in, header, check)) {
+            fprintf(stderr, "%s is not a binary recording\n", inName);
+            result = 2;
+        }
+        else {
+            result = checkFileHeader(header, check, inName) ? 0 : 2;
+            uint64_t committedEnd = 0;
+            if (result == 0 && header.version >= 3) {
+                committedEnd = reportCommit(in, header);
+                fseek(in, recordJournalDataStart, SEEK_SET);
+            }
+            if (result == 0) {
+                result = exportWindows(in, out, header, 1, committedEnd);
+            }
+        }
+    }
+
+    fclose(in);
+    if (out != stdout) {
+        fclose(out);
+    }
+    return result;
+}
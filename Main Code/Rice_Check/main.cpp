@@ -0,0 +1,349 @@
+#include "../Basic_Code/RiceCodec.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+/*
+Description:
+- Host bit exactness check of the window compression (RiceCodec.hpp).
+- A reference encoder is written straight from the bit stream described in the header, one bit at a time into a vector<bool> - Every
+  predictor order is coded in full and the shortest kept. The encoder has to produce the same bytes, and the decoder has to give back
+  every sample from them and report every byte as used.
+- Channels cover edge values (all 0, all 0xFFFF, full scale square waves and alternating rails), constant runs with steps between
+  them, 12-bit ADC values scaled as AdcDma::toU16() does and plain 16-bit values, noise that only stores verbatim, and lengths
+  from 1 sample to a whole window including ones shorter than the predictor order and ones that end part way through a partition.
+- Each predictor order is also forced through riceCodeResiduals() on every channel, so the orders the encoder does not pick, and
+  the largest residuals and longest unary runs they give, are decoded too.
+- Rice parameter adaptation is checked on a channel that goes quiet, busy and quiet again - The k read back from each partition has
+  to be the one worked out from that partition's residuals, and it has to change between them.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 main.cpp -o rice_check
+*/
+
+struct VectorChannel {
+    const vector<uint16_t> &samples;
+
+    uint16_t operator[](int i) const {
+        return samples[i];
+    }
+
+    int size() const {
+        return (int)samples.size();
+    }
+};
+
+//Bit stream of a channel written from the format description
+class ReferenceStream {
+public:
+    vector<bool> bits;
+
+    void put(uint32_t value, int count) {
+        for (int b = count - 1; b >= 0; b--) {
+            bits.push_back(((value >> b) & 1) != 0);
+        }
+    }
+
+    vector<uint8_t> bytes() const {
+        vector<uint8_t> out((bits.size() + 7) / 8, 0);
+        for (size_t i = 0; i < bits.size(); i++) {
+            out[i / 8] |= bits[i] ? (0x80 >> (i % 8)) : 0;
+        }
+        return out;
+    }
+};
+
+//Smallest k with count * 2^(k + 1) above the sum of the partition's mapped residuals, at most 20
+static uint32_t referenceParameter(uint64_t sum, int count) {
+    uint32_t k = 0;
+    while (k < 20 && ((uint64_t)count << (k + 1)) <= sum) {
+        k++;
+    }
+    return k;
+}
+
+static uint32_t referenceMapped(const vector<uint16_t> &x, int order, int i) {
+    int32_t previous = (i >= 1) ? x[i - 1] : 0;
+    int32_t before = (i >= 2) ? x[i - 2] : 0;
+    int32_t predicted = (order == 0) ? 0 : (order == 1) ? previous : (2 * previous) - before;
+    int32_t residual = (int32_t)x[i] - predicted;
+    return (residual >= 0) ? (uint32_t)(2 * residual) : (uint32_t)((-2 * residual) - 1);
+}
+
+//Codes the samples (already at their coded width) with the given order - The data bits only, after the 3 header bits
+static ReferenceStream referenceOrder(const vector<uint16_t> &x, int order, int width) {
+    ReferenceStream s;
+    int count = (int)x.size();
+    for (int i = 0; i < order; i++) {
+        s.put(x[i], width);
+    }
+    for (int start = order; start < count; start += 16) {
+        int end = (start + 16 < count) ? start + 16 : count;
+        uint64_t sum = 0;
+        for (int i = start; i < end; i++) {
+            sum += referenceMapped(x, order, i);
+        }
+        uint32_t k = referenceParameter(sum, end - start);
+        s.put(k, 5);
+        for (int i = start; i < end; i++) {
+            uint32_t value = referenceMapped(x, order, i);
+            for (uint32_t q = 0; q < (value >> k); q++) {
+                s.bits.push_back(true);
+            }
+            s.bits.push_back(false);
+            s.put(value, k);
+        }
+    }
+    return s;
+}
+
+static vector<uint8_t> referenceEncode(const vector<uint16_t> &samples) {
+    bool narrow = true;
+    for (uint16_t v : samples) {
+        narrow = narrow && ((v & 0x0F) == (v >> 12));
+    }
+    int width = narrow ? 12 : 16;
+    vector<uint16_t> x(samples);
+    for (uint16_t &v : x) {
+        v = narrow ? (v >> 4) : v;
+    }
+
+    //Verbatim unless an order is strictly shorter, and the lowest order wins a tie
+    int bestOrder = 3;
+    ReferenceStream best;
+    for (uint16_t v : x) {
+        best.put(v, width);
+    }
+    for (int order = 0; order < 3 && order <= (int)x.size(); order++) {
+        ReferenceStream coded = referenceOrder(x, order, width);
+        if (coded.bits.size() < best.bits.size()) {
+            best = coded;
+            bestOrder = order;
+        }
+    }
+
+    ReferenceStream s;
+    s.put(bestOrder, 2);
+    s.put(narrow ? 1 : 0, 1);
+    s.bits.insert(s.bits.end(), best.bits.begin(), best.bits.end());
+    return s.bytes();
+}
+
+static bool report(const char *name, bool passed) {
+    printf("%-56s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+//Encodes, compares with the reference and decodes - Returns false and says why on the first difference
+static bool roundTrip(const char *name, const vector<uint16_t> &samples, bool quiet = false) {
+    VectorChannel channel = {samples};
+    vector<uint8_t> coded(riceMaxChannelBytes(samples.size()) + 8, 0xA5);
+    uint32_t used = riceEncodeChannel(channel, coded.data());
+    coded.resize(used);
+
+    vector<uint8_t> expected = referenceEncode(samples);
+    vector<uint16_t> decoded(samples.size());
+    uint32_t read = riceDecodeChannel(coded.data(), used, decoded.data(), (int)samples.size());
+
+    bool passed = true;
+    if (coded != expected) {
+        printf("  %s: %u coded bytes differ from the reference's %zu\n", name, used, expected.size());
+        passed = false;
+    }
+    if (used > riceMaxChannelBytes(samples.size())) {
+        printf("  %s: %u bytes is over the %u byte bound\n", name, used, riceMaxChannelBytes(samples.size()));
+        passed = false;
+    }
+    if (read != used || decoded != samples) {
+        printf("  %s: decoded %u of %u bytes, samples %s\n", name, read, used, (decoded == samples) ? "match" : "differ");
+        passed = false;
+    }
+    if (!quiet || !passed) {
+        char line[96];
+        snprintf(line, sizeof(line), "%s (%zu samples, %u bytes)", name, samples.size(), used);
+        report(line, passed);
+    }
+    return passed;
+}
+
+//Writes the samples with a forced predictor order, as riceWriteChannel() would if it had picked it, and decodes them
+static bool forcedOrder(const vector<uint16_t> &samples, int order) {
+    if (order > (int)samples.size()) {
+        return true;
+    }
+    VectorChannel channel = {samples};
+    vector<uint8_t> coded(riceMaxChannelBytes(samples.size()) * 4 + 64);
+    RiceBitWriter writer(coded.data());
+    writer.put(order, 2);
+    writer.put(0, 1);
+    for (int i = 0; i < order; i++) {
+        writer.put(samples[i], 16);
+    }
+    riceCodeResiduals(channel, order, &writer);
+    uint32_t used = writer.finish();
+
+    ReferenceStream reference;
+    reference.put(order, 2);
+    reference.put(0, 1);
+    ReferenceStream body = referenceOrder(samples, order, 16);
+    reference.bits.insert(reference.bits.end(), body.bits.begin(), body.bits.end());
+
+    vector<uint16_t> decoded(samples.size());
+    uint32_t read = riceDecodeChannel(coded.data(), used, decoded.data(), (int)samples.size());
+    coded.resize(used);
+    return coded == reference.bytes() && read == used && decoded == samples;
+}
+
+//Walks a coded channel the way the decoder does and collects the Rice parameter of every partition
+static vector<uint32_t> streamParameters(const vector<uint8_t> &coded, int count, int &order) {
+    RiceBitReader reader(coded.data(), coded.size());
+    order = reader.get(2);
+    int bits = (reader.get(1) == 1) ? 12 : 16;
+    vector<uint32_t> ks;
+    if (order == riceOrderVerbatim) {
+        return ks;
+    }
+    reader.get(bits * order);
+    for (int start = order; start < count; start += ricePartition) {
+        int end = (start + ricePartition < count) ? start + ricePartition : count;
+        uint32_t k = reader.get(riceParamBits);
+        ks.push_back(k);
+        for (int i = start; i < end; i++) {
+            reader.getRice(k);
+        }
+    }
+    return ks;
+}
+
+static vector<uint16_t> narrowed(const vector<uint16_t> &raw) {
+    vector<uint16_t> x(raw.size());
+    for (size_t i = 0; i < raw.size(); i++) {
+        x[i] = (raw[i] << 4) | (raw[i] >> 8);
+    }
+    return x;
+}
+
+int main() {
+    bool passed = true;
+    mt19937 random(3);
+    vector<vector<uint16_t>> all;
+
+    //Edge values
+    all.push_back(vector<uint16_t>(2000, 0));
+    all.push_back(vector<uint16_t>(2000, 0xFFFF));
+    vector<uint16_t> rails(2000);
+    vector<uint16_t> square(2000);
+    for (size_t i = 0; i < rails.size(); i++) {
+        rails[i] = (i & 1) ? 0xFFFF : 0;
+        square[i] = ((i / 50) & 1) ? 0xFFFF : 0;
+    }
+    all.push_back(rails);
+    all.push_back(square);
+    passed = roundTrip("All zero", all[0]) && passed;
+    passed = roundTrip("All 0xFFFF", all[1]) && passed;
+    passed = roundTrip("Alternating rails every sample", rails) && passed;
+    passed = roundTrip("Full scale square wave", square) && passed;
+    vector<uint16_t> narrowRails = narrowed(vector<uint16_t>(2000, 4095));
+    for (size_t i = 0; i < narrowRails.size(); i += 2) {
+        narrowRails[i] = 0;
+    }
+    all.push_back(narrowRails);
+    passed = roundTrip("Alternating 12-bit rails", narrowRails) && passed;
+
+    //Constant runs with steps between them, like the DC channel
+    vector<uint16_t> runs(2000);
+    for (size_t i = 0; i < runs.size(); i++) {
+        runs[i] = (uint16_t)(1000 + ((i / 300) * 97));
+    }
+    all.push_back(narrowed(runs));
+    passed = roundTrip("12-bit constant runs with steps", narrowed(runs)) && passed;
+    for (uint16_t &v : runs) {
+        v = (uint16_t)(v * 13 + 1);
+    }
+    all.push_back(runs);
+    passed = roundTrip("16-bit constant runs with steps", runs) && passed;
+
+    //PPG like channels and noise that can only be stored verbatim
+    normal_distribution<double> noise(0.0, 3.0);
+    uniform_int_distribution<int> anything(0, 0xFFFF);
+    vector<uint16_t> wave(2000);
+    vector<uint16_t> wide(2000);
+    vector<uint16_t> white(2000);
+    for (size_t i = 0; i < wave.size(); i++) {
+        double value = 2048.0 + 900.0 * sin(i * 0.02) + noise(random);
+        wave[i] = (uint16_t)((value < 0) ? 0 : (value > 4095) ? 4095 : value);
+        wide[i] = (uint16_t)(30000.0 + 20000.0 * sin(i * 0.01) + 40.0 * noise(random));
+        white[i] = (uint16_t)anything(random);
+    }
+    all.push_back(narrowed(wave));
+    all.push_back(wide);
+    all.push_back(white);
+    passed = roundTrip("12-bit PPG like wave", narrowed(wave)) && passed;
+    passed = roundTrip("16-bit wave with noise", wide) && passed;
+    passed = roundTrip("White noise (verbatim)", white) && passed;
+
+    //Every length up to a few partitions, including ones shorter than the predictor order
+    bool lengths = true;
+    for (size_t count = 1; count <= 70; count++) {
+        vector<uint16_t> start(wave.begin(), wave.begin() + count);
+        vector<uint16_t> flat(count, 0x1234);
+        lengths = roundTrip("Short", narrowed(start), true) && roundTrip("Short", flat, true) &&
+                  roundTrip("Short", vector<uint16_t>(white.begin(), white.begin() + count), true) && lengths;
+        all.push_back(start);
+    }
+    passed = report("Every length from 1 to 70 samples", lengths) && passed;
+
+    //Orders the encoder did not pick are still decoded right, however large the residuals
+    bool orders = true;
+    for (const vector<uint16_t> &x : all) {
+        for (int order = 0; order < riceOrderVerbatim; order++) {
+            orders = forcedOrder(x, order) && orders;
+        }
+    }
+    passed = report("Every predictor order forced on every channel", orders) && passed;
+
+    //Quiet, busy then quiet - The parameter has to follow the residuals of each partition
+    vector<uint16_t> bursts(640);
+    for (size_t i = 0; i < bursts.size(); i++) {
+        double spread = (i >= 200 && i < 400) ? 400.0 : 1.0;
+        bursts[i] = (uint16_t)(20000.0 + spread * noise(random));
+    }
+    VectorChannel channel = {bursts};
+    vector<uint8_t> coded(riceMaxChannelBytes(bursts.size()));
+    coded.resize(riceEncodeChannel(channel, coded.data()));
+    int order;
+    vector<uint32_t> ks = streamParameters(coded, (int)bursts.size(), order);
+    bool adapted = order != riceOrderVerbatim && !ks.empty();
+    uint32_t lowest = 20;
+    uint32_t highest = 0;
+    for (size_t p = 0; p < ks.size() && adapted; p++) {
+        int start = order + (int)(p * ricePartition);
+        int end = (start + ricePartition < (int)bursts.size()) ? start + ricePartition : (int)bursts.size();
+        uint64_t sum = 0;
+        for (int i = start; i < end; i++) {
+            sum += referenceMapped(bursts, order, i);
+        }
+        adapted = ks[p] == referenceParameter(sum, end - start);
+        lowest = (ks[p] < lowest) ? ks[p] : lowest;
+        highest = (ks[p] > highest) ? ks[p] : highest;
+    }
+    printf("Bursts: order %d, %zu partitions, k from %u to %u\n", order, ks.size(), lowest, highest);
+    passed = report("Rice parameter follows each partition", adapted && highest >= lowest + 4) && passed;
+    passed = roundTrip("Quiet, busy and quiet again", bursts) && passed;
+
+    //Unary runs of more than 32 ones go through putRice()'s loop
+    vector<uint8_t> stream(64, 0);
+    RiceBitWriter writer(stream.data());
+    writer.putRice(100, 0);
+    writer.putRice(262139, 12);
+    writer.putRice(0, 20);
+    uint32_t used = writer.finish();
+    RiceBitReader reader(stream.data(), used);
+    uint32_t a = reader.getRice(0);
+    uint32_t b = reader.getRice(12);
+    uint32_t c = reader.getRice(20);
+    passed = report("Long unary runs", a == 100 && b == 262139 && c == 0 && !reader.overrun()) && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,326 @@
+#include "../Basic_Code/SampleRing.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+/*
+Description:
+- Host checks and micro-benchmark of the sample ring (SampleRing.hpp) against the Mail box it replaced.
+- Single thread checks - An empty ring gives nothing, a full one takes nothing more and counts the overrun, batches that straddle the
+  end of the buffer come back in order, and the free running head and tail keep working after they pass 2^32.
+- A producer and a consumer thread then move two million numbered items in batches of random sizes, and every item has to arrive once
+  and in order. Either side sleeps briefly when the ring is full or empty, so it also runs on a single core.
+- The benchmark moves the same samples between two threads the old way, one Mail alloc/put and one EventQueue call per sample, and
+  the new way, one push and one consumer wakeup per 50 sample block. HostMail stands in for rtos::Mail - A memory pool and a queue each
+  behind a lock, with the getter woken on put, as RTX does with its kernel lock. Times on the board differ, but the per sample work
+  that goes away is the same.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 -pthread main.cpp -o ring_benchmark
+*/
+
+struct Sample {
+    uint16_t ac;
+    uint16_t dc;
+};
+
+static bool report(const char *name, bool passed) {
+    printf("%-48s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+static bool checkEmptyAndFull() {
+    static SampleRing<uint32_t, 8> ring;
+    uint32_t out[16];
+    bool passed = ring.empty() && ring.pop(out, 16) == 0 && ring.overruns() == 0;
+
+    uint32_t in[12];
+    for (uint32_t i = 0; i < 12; i++) {
+        in[i] = i;
+    }
+    passed = passed && ring.push(in, 12) == 8 && ring.size() == 8 && ring.overruns() == 4;
+    passed = passed && !ring.push(in[0]) && ring.overruns() == 5 && ring.highWaterMark() == 8;
+    passed = passed && ring.pop(out, 16) == 8 && ring.empty();
+    for (uint32_t i = 0; i < 8; i++) {
+        passed = passed && out[i] == i;
+    }
+    return report("Empty, full and overrun", passed);
+}
+
+//Batches of 3 through a ring of 8 land across the end of the buffer every few pushes
+static bool checkWrap() {
+    static SampleRing<uint32_t, 8> ring;
+    uint32_t next = 0;
+    uint32_t expected = 0;
+    bool passed = true;
+    for (int round = 0; round < 1000; round++) {
+        uint32_t in[3] = {next, next + 1, next + 2};
+        passed = passed && ring.push(in, 3) == 3;
+        next += 3;
+        uint32_t out[3];
+        uint32_t n = ring.pop(out, (round % 2 == 0) ? 2 : 3);
+        for (uint32_t i = 0; i < n; i++) {
+            passed = passed && out[i] == expected++;
+        }
+        uint32_t rest = ring.pop(out, 3);
+        for (uint32_t i = 0; i < rest; i++) {
+            passed = passed && out[i] == expected++;
+        }
+    }
+    return report("Batches across the end of the buffer", passed && expected == next && ring.highWaterMark() == 3);
+}
+
+//Runs the counters past 2^32 - Whole ring batches of bytes, so it only takes a few seconds
+static bool checkCounterWrap() {
+    static SampleRing<uint8_t, 65536> ring;
+    static uint8_t in[65536];
+    static uint8_t out[65536];
+    bool passed = true;
+    for (uint32_t i = 0; i < 65536; i++) {
+        in[i] = (uint8_t)(i * 31);
+    }
+
+    //65536 batches of 65536 is 2^32, a few more take the counters round and into the next lap
+    for (uint32_t batch = 0; batch < 65536 + 4; batch++) {
+        uint32_t offset = batch % 7; //Keeps the position in the buffer moving
+        passed = passed && ring.push(in, offset) == offset && ring.pop(out, offset) == offset;
+        passed = passed && ring.push(in, 65536 - offset) == 65536 - offset;
+        passed = passed && ring.size() == 65536 - offset;
+        passed = passed && ring.pop(out, 65536) == 65536 - offset;
+        passed = passed && out[0] == in[0] && out[65535 - offset] == in[65535 - offset];
+    }
+    passed = passed && ring.empty() && ring.overruns() == 0;
+    return report("Head and tail past 2^32", passed);
+}
+
+static bool checkThreads() {
+    static SampleRing<uint32_t, 256> ring;
+    const uint32_t items = 2000000;
+    bool inOrder = true;
+    uint32_t received = 0;
+
+    thread consumer([&] {
+        uint32_t seed = 99;
+        uint32_t out[64];
+        while (received < items) {
+            seed = (seed * 1103515245) + 12345;
+            uint32_t n = ring.pop(out, 1 + ((seed >> 16) % 64));
+            if (n == 0) {
+                this_thread::sleep_for(microseconds(20));
+            }
+            for (uint32_t i = 0; i < n; i++) {
+                inOrder = inOrder && out[i] == received++;
+            }
+        }
+    });
+
+    uint32_t seed = 7;
+    uint32_t in[64];
+    uint32_t sent = 0;
+    while (sent < items) {
+        seed = (seed * 1103515245) + 12345;
+        uint32_t n = min<uint32_t>(1 + ((seed >> 16) % 64), items - sent);
+        for (uint32_t i = 0; i < n; i++) {
+            in[i] = sent + i;
+        }
+        uint32_t pushed = 0;
+        while (pushed < n) {
+            uint32_t more = ring.push(in + pushed, n - pushed);
+            pushed += more;
+            if (more == 0) {
+                this_thread::sleep_for(microseconds(20));
+            }
+        }
+        sent += n;
+    }
+    consumer.join();
+    printf("%u items between threads, high water %u of %u, %u overruns while the producer retried\n", items, ring.highWaterMark(),
+           ring.capacity(), ring.overruns());
+    return report("Every item once and in order", inOrder && received == items);
+}
+
+//rtos::Mail on the host - A fixed pool and a queue, each behind a lock
+template <typename T, uint32_t Size>
+class HostMail {
+private:
+    T pool[Size];
+    vector<T *> freeList;
+    deque<T *> queue;
+    mutex poolLock;
+    mutex queueLock;
+    condition_variable ready;
+
+public:
+    HostMail() {
+        for (uint32_t i = 0; i < Size; i++) {
+            freeList.push_back(&pool[i]);
+        }
+    }
+
+    T *try_alloc() {
+        lock_guard<mutex> guard(poolLock);
+        if (freeList.empty()) {
+            return nullptr;
+        }
+        T *mail = freeList.back();
+        freeList.pop_back();
+        return mail;
+    }
+
+    void put(T *mail) {
+        {
+            lock_guard<mutex> guard(queueLock);
+            queue.push_back(mail);
+        }
+        ready.notify_one();
+    }
+
+    T *get() {
+        unique_lock<mutex> guard(queueLock);
+        ready.wait(guard, [&] { return !queue.empty(); });
+        T *mail = queue.front();
+        queue.pop_front();
+        return mail;
+    }
+
+    void free(T *mail) {
+        lock_guard<mutex> guard(poolLock);
+        freeList.push_back(mail);
+    }
+};
+
+//EventQueue on the host - Each call is a queued wakeup for the consumer thread
+class HostEvents {
+private:
+    uint32_t pending = 0;
+    bool stopping = false;
+    mutex lock;
+    condition_variable ready;
+
+public:
+    void call() {
+        {
+            lock_guard<mutex> guard(lock);
+            pending++;
+        }
+        ready.notify_one();
+    }
+
+    void stop() {
+        {
+            lock_guard<mutex> guard(lock);
+            stopping = true;
+        }
+        ready.notify_one();
+    }
+
+    //Waits for the next call - False once stopped and drained
+    bool wait() {
+        unique_lock<mutex> guard(lock);
+        ready.wait(guard, [&] { return pending > 0 || stopping; });
+        if (pending == 0) {
+            return false;
+        }
+        pending--;
+        return true;
+    }
+};
+
+static const uint32_t benchSamples = 500000;
+static const uint32_t blockSamples = 50;
+
+//Old path - pdSample() allocated and put each sample, queued consumer() for it, and consumer() got and freed it
+static double mailNsPerSample() {
+    HostMail<Sample, 32> mail;
+    HostEvents events;
+    uint64_t sum = 0;
+
+    auto start = steady_clock::now();
+    thread consumer([&] {
+        while (events.wait()) {
+            Sample *s = mail.get();
+            sum += s->ac + s->dc;
+            mail.free(s);
+        }
+    });
+    for (uint32_t i = 0; i < benchSamples; i++) {
+        Sample *s;
+        while ((s = mail.try_alloc()) == nullptr) {
+            this_thread::sleep_for(microseconds(20));
+        }
+        *s = {(uint16_t)i, (uint16_t)(i >> 16)};
+        mail.put(s);
+        events.call();
+    }
+    events.stop();
+    consumer.join();
+    double ns = (double)duration_cast<nanoseconds>(steady_clock::now() - start).count();
+    return (sum != 0) ? ns / benchSamples : 0.0;
+}
+
+//New path - pdReading() pushes a block and queues the consumer once, consumer() drains everything waiting
+static double ringNsPerSample() {
+    SampleRing<Sample, 256> ring;
+    HostEvents events;
+    uint64_t sum = 0;
+
+    auto start = steady_clock::now();
+    thread consumer([&] {
+        Sample out[256];
+        while (events.wait()) {
+            uint32_t n;
+            while ((n = ring.pop(out, 256)) > 0) {
+                for (uint32_t i = 0; i < n; i++) {
+                    sum += out[i].ac + out[i].dc;
+                }
+            }
+        }
+    });
+    Sample block[blockSamples];
+    for (uint32_t i = 0; i < benchSamples; i += blockSamples) {
+        for (uint32_t j = 0; j < blockSamples; j++) {
+            block[j] = {(uint16_t)(i + j), (uint16_t)((i + j) >> 16)};
+        }
+        uint32_t pushed = 0;
+        while (pushed < blockSamples) {
+            uint32_t more = ring.push(block + pushed, blockSamples - pushed);
+            pushed += more;
+            if (more == 0) {
+                this_thread::sleep_for(microseconds(20));
+            }
+        }
+        events.call();
+    }
+    events.stop();
+    consumer.join();
+    double ns = (double)duration_cast<nanoseconds>(steady_clock::now() - start).count();
+    return (sum != 0) ? ns / benchSamples : 0.0;
+}
+
+int main() {
+    bool passed = true;
+    passed = checkEmptyAndFull() && passed;
+    passed = checkWrap() && passed;
+    passed = checkCounterWrap() && passed;
+    passed = checkThreads() && passed;
+
+    //Best of a few runs, as thread scheduling is noisy
+    double mail = 1e30;
+    double ring = 1e30;
+    for (int run = 0; run < 3; run++) {
+        mail = min(mail, mailNsPerSample());
+        ring = min(ring, ringNsPerSample());
+    }
+    printf("\n%u samples between two threads\n", benchSamples);
+    printf("%-40s %10s %8s\n", "Method", "ns/sample", "Speedup");
+    printf("%-40s %10.1f %8s\n", "Mail, one put and event per sample", mail, "1.00x");
+    printf("%-40s %10.1f %7.2fx\n", "SampleRing, one push and event per block", ring, mail / ring);
+    return passed ? 0 : 1;
+}
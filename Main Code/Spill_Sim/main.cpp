@@ -0,0 +1,418 @@
+#include "../Basic_Code/FlashSpill.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+/*
+Description:
+- Host simulation of the flash spill area (FlashSpill.hpp) in front of a micro-SD card that is missing, slow or failing.
+- SimFlash stands in for FlashIAPBlockDevice over the F401's 128KB sectors - Programming can only clear bits, as on the real flash,
+  and the time each erase and program would stall the board is added up on a simulated clock (about a second per sector erase and
+  16us per word programmed). Erasing while sampling is counted as a failure, as it would hold off the sampling interrupts.
+- Recordings are run a window at a time the way writeSDCard() decides - A window is spilled while the card is missing, while older
+  windows are still spilled or while the card is behind, and spilled windows are moved to the card while it has nothing else to do.
+  The area is erased ahead of each recording, with sampling stopped.
+- Every card profile must end with every window on the card, whole and in order. A reset part way through a spill is simulated by
+  cutting the power during a program and mounting the area again, and many recordings in a row check the erases are spread evenly.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 main.cpp -o spill_sim
+*/
+
+//F401RE flash timing - Worst case sector erase and word program times from the datasheet are 2s and 100us, typical 1s and 16us
+static const bd_size_t sectorBytes = 128 * 1024;
+static const uint64_t eraseUs = 1000000;
+static const uint64_t wordUs = 16;
+static const uint64_t windowUs = 4000000; //Window period of the default profile
+static const uint32_t windowSamples = 2000;
+static const uint32_t cardRetryWindows = 4;
+static const uint32_t drainPerWindow = 3; //Windows the card can take from the spill area in a window period once it has caught up
+
+class SimFlash : public BlockDevice {
+private:
+    vector<uint8_t> image;
+
+public:
+    bool sampling = false;
+    uint64_t clockUs = 0;
+    uint64_t worstProgramUs = 0;
+    uint32_t erasesWhileSampling = 0;
+    uint32_t badPrograms = 0; //Programs that would have had to set a bit
+    int64_t cutAfterBytes = -1; //Bytes programmed before the power is cut - -1 never cuts
+
+    explicit SimFlash(int sectors) : image(sectors * sectorBytes, 0xFF) {}
+
+    int init() override {
+        return 0;
+    }
+
+    int deinit() override {
+        return 0;
+    }
+
+    int read(void *buffer, bd_addr_t addr, bd_size_t size) override {
+        if (addr + size > image.size()) {
+            return -1;
+        }
+        memcpy(buffer, &image[addr], size);
+        return 0;
+    }
+
+    int program(const void *buffer, bd_addr_t addr, bd_size_t size) override {
+        if (addr + size > image.size() || (addr % 4) != 0 || (size % 4) != 0) {
+            return -1;
+        }
+        const uint8_t *data = (const uint8_t *)buffer;
+        for (bd_size_t i = 0; i < size; i++) {
+            if (cutAfterBytes == 0) {
+                return -1; //Power cut - Whatever was programmed so far stays
+            }
+            if ((image[addr + i] & data[i]) != data[i]) {
+                badPrograms++;
+            }
+            image[addr + i] &= data[i];
+            cutAfterBytes = (cutAfterBytes > 0) ? cutAfterBytes - 1 : cutAfterBytes;
+        }
+        uint64_t us = (size / 4) * wordUs;
+        clockUs += us;
+        worstProgramUs = max(worstProgramUs, us);
+        return 0;
+    }
+
+    int erase(bd_addr_t addr, bd_size_t size) override {
+        if ((addr % sectorBytes) != 0 || (size % sectorBytes) != 0 || addr + size > image.size()) {
+            return -1;
+        }
+        if (sampling) {
+            erasesWhileSampling++;
+        }
+        memset(&image[addr], 0xFF, size);
+        clockUs += (size / sectorBytes) * eraseUs;
+        return 0;
+    }
+
+    bd_size_t get_read_size() const override {
+        return 1;
+    }
+
+    bd_size_t get_program_size() const override {
+        return 4;
+    }
+
+    bd_size_t get_erase_size() const override {
+        return sectorBytes;
+    }
+
+    int get_erase_value() const override {
+        return 0xFF;
+    }
+
+    bd_size_t size() const override {
+        return image.size();
+    }
+
+    const char *get_type() const override {
+        return "SIMFLASH";
+    }
+};
+
+//Window n as it would be written - Compressed windows vary in size, so the size does too. The first word is the sequence number
+static vector<uint8_t> makeWindow(uint32_t n) {
+    vector<uint8_t> data(2000 + ((n * 7919) % 6000));
+    uint32_t sequence = n * windowSamples;
+    memcpy(data.data(), &sequence, sizeof(sequence));
+    for (size_t i = sizeof(sequence); i < data.size(); i++) {
+        data[i] = (uint8_t)(n * 31 + i * 7);
+    }
+    return data;
+}
+
+//What the card does with window n of a recording
+struct CardProfile {
+    const char *name;
+    uint32_t windows;
+    bool (*present)(uint32_t n); //Card inserted by window n
+    bool (*behind)(uint32_t n); //Card still busy with earlier windows at window n - flash-spill-backlog of them are waiting
+    bool (*fails)(uint32_t n); //Direct write of window n fails
+};
+
+static bool always(uint32_t /*n*/) {
+    return true;
+}
+
+static bool never(uint32_t /*n*/) {
+    return false;
+}
+
+static bool insertedLate(uint32_t n) {
+    return n >= 22;
+}
+
+static bool behindForAWhile(uint32_t n) {
+    return n >= 30 && n < 50;
+}
+
+static bool failsForAWhile(uint32_t n) {
+    return n >= 40 && n < 43;
+}
+
+class Recording {
+private:
+    SimFlash &flash;
+    FlashSpill &spill;
+    const CardProfile &profile;
+    const uint32_t tag = 0x1234ABCD;
+
+    bool cardReady = true;
+    uint32_t cardRetry = 0;
+
+    bool drainOne() {
+        uint32_t entryTag;
+        uint32_t size;
+        if (!spill.peek(entryTag, size) || entryTag != tag) {
+            return false;
+        }
+        vector<uint8_t> data(size);
+        for (uint32_t done = 0; done < size;) {
+            uint32_t part = min<uint32_t>(512, size - done);
+            if (spill.read(done, &data[done], part) != 0) {
+                return false;
+            }
+            done += part;
+        }
+        card.push_back(data);
+        return spill.drained() == 0;
+    }
+
+public:
+    vector<vector<uint8_t>> card;
+    uint32_t lost = 0;
+    uint64_t worstWindowStallUs = 0;
+
+    Recording(SimFlash &simFlash, FlashSpill &flashSpill, const CardProfile &cardProfile) : flash(simFlash), spill(flashSpill), profile(cardProfile) {}
+
+    //Runs windows [first, last) - Returns false if the power was cut part way through
+    bool run(uint32_t first, uint32_t last) {
+        cardReady = profile.present(first);
+        flash.sampling = true;
+        for (uint32_t n = first; n < last; n++) {
+            if (!cardReady && ++cardRetry >= cardRetryWindows) {
+                cardRetry = 0;
+                cardReady = profile.present(n);
+            }
+
+            vector<uint8_t> window = makeWindow(n);
+            uint64_t start = flash.clockUs;
+            bool behind = profile.behind(n);
+            bool stored = (!cardReady || !spill.empty() || behind) && spill.push(tag, window.data(), window.size()) == 0;
+            if (flash.cutAfterBytes == 0) {
+                return false;
+            }
+            if (!stored && cardReady && !profile.fails(n)) {
+                card.push_back(window);
+                stored = true;
+            }
+            if (!stored && spill.push(tag, window.data(), window.size()) == 0) {
+                stored = true;
+            }
+            lost += stored ? 0 : 1;
+            worstWindowStallUs = max(worstWindowStallUs, flash.clockUs - start);
+
+            //The writer is idle until the next window - Spilled windows move across while the card keeps up
+            for (uint32_t d = 0; d < drainPerWindow && cardReady && !behind && !spill.empty(); d++) {
+                drainOne();
+            }
+        }
+        flash.sampling = false;
+        return true;
+    }
+
+    //End of the recording - Sampling has stopped, so everything left is moved across and the area erased
+    void finish() {
+        flash.sampling = false;
+        cardReady = cardReady || profile.present(profile.windows);
+        while (cardReady && !spill.empty() && drainOne()) {
+        }
+        if (spill.empty()) {
+            while (spill.eraseNext() > 0) {
+            }
+        }
+    }
+
+    //Every window from first on is on the card, whole and in order, apart from any counted as lost
+    bool check(uint32_t first, uint32_t windows) const {
+        uint32_t expected = first;
+        for (const vector<uint8_t> &window : card) {
+            uint32_t sequence;
+            memcpy(&sequence, window.data(), sizeof(sequence));
+            uint32_t n = sequence / windowSamples;
+            if (n < expected || window != makeWindow(n)) {
+                printf("WINDOW %u OUT OF ORDER OR DAMAGED  ", n);
+                return false;
+            }
+            expected = n + 1;
+        }
+        if (card.size() + lost != windows) {
+            printf("%u OF %u WINDOWS ON THE CARD  ", (unsigned)(card.size()), windows);
+            return false;
+        }
+        return true;
+    }
+};
+
+static bool flashChecks(const SimFlash &flash) {
+    if (flash.erasesWhileSampling > 0 || flash.badPrograms > 0) {
+        printf("%u ERASES WHILE SAMPLING, %u PROGRAMS OVER UNERASED FLASH\n", flash.erasesWhileSampling, flash.badPrograms);
+        return false;
+    }
+    return true;
+}
+
+static bool runProfile(const CardProfile &profile) {
+    SimFlash flash(2);
+    FlashSpill spill(flash);
+    if (spill.mount() != 0) {
+        printf("MOUNT FAILED\n");
+        return false;
+    }
+    while (spill.eraseNext() > 0) {
+    }
+
+    Recording recording(flash, spill, profile);
+    recording.run(0, profile.windows);
+    recording.finish();
+
+    //Windows still spilled at the end are saved at the next start up with a card in, as saveLeftoverSpill() does
+    if (!spill.empty()) {
+        const CardProfile inserted = {profile.name, 0, always, never, never};
+        FlashSpill remounted(flash);
+        remounted.mount();
+        Recording leftovers(flash, remounted, inserted);
+        leftovers.finish();
+        recording.card.insert(recording.card.end(), leftovers.card.begin(), leftovers.card.end());
+    }
+
+    printf("%-8s %8u %8u %8u %8u %8u %10.1fms  ", profile.name, (unsigned)recording.card.size(), spill.windowsSpilled(), spill.windowsDrained(),
+           recording.lost, spill.sectorsErased(), recording.worstWindowStallUs / 1000.0);
+    if (!recording.check(0, profile.windows) || !flashChecks(flash)) {
+        printf("FAILED\n");
+        return false;
+    }
+    if (recording.worstWindowStallUs >= windowUs / 10) {
+        printf("SPILL TOO SLOW\n");
+        return false;
+    }
+    printf("ok\n");
+    return true;
+}
+
+//The card is missing, windows spill and the power is cut part way through programming one - Mounting again must find every window
+//spilled before it, leave the torn one out and carry on spilling after it
+static bool runReset() {
+    const CardProfile missing = {"reset", 40, never, never, never};
+    const CardProfile inserted = {"reset", 40, always, never, never};
+    SimFlash flash(2);
+    bool passed = true;
+    uint32_t spilledBeforeCut;
+    {
+        FlashSpill spill(flash);
+        spill.mount();
+        while (spill.eraseNext() > 0) {
+        }
+        Recording recording(flash, spill, missing);
+        recording.run(0, 20);
+        spilledBeforeCut = spill.waiting();
+        flash.cutAfterBytes = 3000; //Part way into window 20
+        passed = !recording.run(20, 21);
+        flash.cutAfterBytes = -1;
+    }
+
+    //After the reset - The recording carries on with the card in
+    FlashSpill spill(flash);
+    passed = (spill.mount() == 0) && passed;
+    uint32_t recovered = spill.waiting();
+    Recording recording(flash, spill, inserted);
+    recording.run(21, 40);
+    recording.finish();
+
+    printf("%-8s %8u %8u %8u %8u %8u %10s  ", "reset", (unsigned)recording.card.size(), spilledBeforeCut, spill.windowsDrained(), recording.lost, spill.sectorsErased(), "-");
+    if (!passed || recovered != spilledBeforeCut) {
+        printf("%u OF %u SPILLED WINDOWS FOUND AFTER THE RESET\n", recovered, spilledBeforeCut);
+        return false;
+    }
+    //Window 20 was lost in the reset, as it is without the spill area
+    recording.lost++;
+    if (!recording.check(0, 40) || !flashChecks(flash)) {
+        printf("FAILED\n");
+        return false;
+    }
+    printf("ok\n");
+    return true;
+}
+
+//Many recordings in a row, each spilling a different amount, over three sectors - The erases must stay within one of each other
+static bool runWear() {
+    const CardProfile profile = {"wear", 0, always, behindForAWhile, never};
+    SimFlash flash(3);
+    FlashSpill spill(flash);
+    spill.mount();
+    while (spill.eraseNext() > 0) {
+    }
+
+    uint32_t windows = 0;
+    uint32_t onCard = 0;
+    for (uint32_t r = 0; r < 300; r++) {
+        CardProfile run = profile;
+        run.windows = 30 + ((r * 13) % 40);
+        Recording recording(flash, spill, run);
+        recording.run(0, run.windows);
+        recording.finish();
+        if (!recording.check(0, run.windows)) {
+            printf("RECORDING %u FAILED\n", r);
+            return false;
+        }
+        windows += run.windows;
+        onCard += recording.card.size();
+
+        //Remounted between recordings as a reboot would
+        FlashSpill remounted(flash);
+        remounted.mount();
+        if (remounted.minErases() != spill.minErases() || remounted.maxErases() != spill.maxErases()) {
+            printf("ERASE COUNTS LOST ON REMOUNT\n");
+            return false;
+        }
+    }
+
+    printf("%-8s %8u %8u %8u %8u %8u %10s  erased %u to %u times  ", "wear", onCard, spill.windowsSpilled(), spill.windowsDrained(), windows - onCard,
+           spill.sectorsErased(), "-", spill.minErases(), spill.maxErases());
+    if (spill.maxErases() - spill.minErases() > 1 || !flashChecks(flash)) {
+        printf("WEAR NOT LEVELLED\n");
+        return false;
+    }
+    printf("ok\n");
+    return true;
+}
+
+int main() {
+    const CardProfile profiles[] = {
+        {"steady", 80, always, never, never},
+        {"late", 80, insertedLate, never, never},
+        {"behind", 80, always, behindForAWhile, never},
+        {"failing", 80, always, never, failsForAWhile},
+        {"missing", 80, never, never, never},
+    };
+
+    printf("%u KB sectors, %.1fs per erase, %lluus per word programmed, window every %.1fs\n", (unsigned)(sectorBytes / 1024), eraseUs / 1e6,
+           (unsigned long long)wordUs, windowUs / 1e6);
+    printf("%-8s %8s %8s %8s %8s %8s %12s  %s\n", "Card", "On card", "Spilled", "Drained", "Lost", "Erases", "Worst stall", "Result");
+
+    bool passed = true;
+    for (const CardProfile &profile : profiles) {
+        passed = runProfile(profile) && passed;
+    }
+    passed = runReset() && passed;
+    passed = runWear() && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+#include "../Basic_Code/StorageSession.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+/*
+Description:
+- Host comparison of the per window write latency of the long lived storage session (StorageSession.hpp) against the old way of
+  initialising the card, mounting, opening, writing, closing and deinitialising for every window.
+- SimFileCard is a block device backed by a temporary file. Every call holds the caller for a modelled SPI card time - The command
+  overhead, the transfer and the busy time per block written, and a card initialisation on init(). The model's figures are set
+  below, so the times are only as good as they are. The device calls, sectors and initialisations counted per window are exact for
+  this file system, which is a simplified FAT (HostFileSystem.hpp).
+- Each mode writes the same windows through StorageSession and reads the file back afterwards to check it.
+- Preallocation is compared with and without at the same sync interval, so the difference is down to the preallocation alone.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 main.cpp -o storage_benchmark
+*/
+
+//Latency model - 12.5MHz SPI, 200us per command, 250us busy per block written and 100ms for the card to come out of idle on init()
+static const double spiBytesPerUs = 12.5 / 8;
+static const int commandUs = 200;
+static const int blockBusyUs = 250;
+static const int initUs = 100000;
+
+class SimFileCard : public BlockDevice {
+private:
+    FILE *image;
+    bd_size_t bytes;
+
+    void hold(int us) {
+        this_thread::sleep_for(microseconds(us));
+    }
+
+public:
+    uint32_t inits = 0;
+    uint32_t calls = 0;
+    uint64_t sectorsRead = 0;
+    uint64_t sectorsWritten = 0;
+
+    //Fills the image with fill - The contents a reused card has before it is formatted
+    SimFileCard(bd_size_t size, uint8_t fill) : image(tmpfile()), bytes(size) {
+        vector<uint8_t> block(65536, fill);
+        for (bd_size_t done = 0; image != nullptr && done < size; done += block.size()) {
+            fwrite(block.data(), 1, block.size(), image);
+        }
+    }
+
+    ~SimFileCard() override {
+        if (image != nullptr) {
+            fclose(image);
+        }
+    }
+
+    bool ok() const {
+        return image != nullptr;
+    }
+
+    int init() override {
+        inits++;
+        hold(initUs);
+        return 0;
+    }
+
+    int deinit() override {
+        return 0;
+    }
+
+    int read(void *buffer, bd_addr_t addr, bd_size_t size) override {
+        calls++;
+        sectorsRead += size / 512;
+        hold(commandUs + (int)(size / spiBytesPerUs));
+        fseek(image, (long)addr, SEEK_SET);
+        return (fread(buffer, 1, size, image) == size) ? 0 : -5004; //SD_BLOCK_DEVICE_ERROR_READ
+    }
+
+    int program(const void *buffer, bd_addr_t addr, bd_size_t size) override {
+        calls++;
+        sectorsWritten += size / 512;
+        hold(commandUs + (int)(size / spiBytesPerUs) + (int)((size / 512) * blockBusyUs));
+        fseek(image, (long)addr, SEEK_SET);
+        return (fwrite(buffer, 1, size, image) == size) ? 0 : -5005; //SD_BLOCK_DEVICE_ERROR_WRITE
+    }
+
+    int sync() override {
+        return fflush(image);
+    }
+
+    bd_size_t get_read_size() const override {
+        return 512;
+    }
+
+    bd_size_t get_program_size() const override {
+        return 512;
+    }
+
+    bd_size_t size() const override {
+        return bytes;
+    }
+
+    const char *get_type() const override {
+        return "SIMFILE";
+    }
+};
+
+struct Result {
+    uint32_t meanUs;
+    uint32_t worstUs;
+    double initsPerWindow;
+    double callsPerWindow;
+    double sectorsReadPerWindow;
+    double sectorsWrittenPerWindow;
+    bool readBack;
+};
+
+static const uint32_t windows = 100; //800KB - Most of one preallocated step
+static const size_t windowBytes = 8192; //A 2000 sample, two channel window of uint16_t with its header, padded to sectors
+static const char *resultsPath = "s0001p01.bin";
+
+static void fillWindow(vector<uint8_t> &window, uint32_t w) {
+    for (size_t i = 0; i < window.size(); i++) {
+        window[i] = (uint8_t)((w * 131) + (i * 7) + (i >> 8));
+    }
+}
+
+//Writes the windows through a session and checks what ends up in the file
+static Result run(uint32_t preallocateBytes, uint32_t syncEvery, bool remountEachWindow) {
+    Result result = {};
+    SimFileCard card(16 * 1024 * 1024, 0xA5);
+    if (!card.ok() || FATFileSystem::format(&card) != 0) {
+        return result;
+    }
+
+    vector<uint8_t> window(windowBytes);
+    bool written = true;
+    {
+        StorageSession session(card, "sd", preallocateBytes, syncEvery, remountEachWindow);
+        written = session.open(resultsPath, true) == 0;
+        if (remountEachWindow) {
+            session.close();
+        }
+        card.inits = 0;
+        card.calls = 0;
+        card.sectorsRead = 0;
+        card.sectorsWritten = 0;
+
+        for (uint32_t w = 0; w < windows && written; w++) {
+            fillWindow(window, w);
+            written = session.beginWindow() == 0 && session.append(window.data(), window.size()) == 0 && session.endWindow() == 0;
+        }
+        result.meanUs = session.meanWriteUs();
+        result.worstUs = session.worstWriteUs();
+        result.initsPerWindow = (double)card.inits / windows;
+        result.callsPerWindow = (double)card.calls / windows;
+        result.sectorsReadPerWindow = (double)card.sectorsRead / windows;
+        result.sectorsWrittenPerWindow = (double)card.sectorsWritten / windows;
+    }
+
+    //The session has closed and trimmed the file - It should hold exactly the windows
+    FATFileSystem fs("sd");
+    File file;
+    vector<uint8_t> stored(windowBytes);
+    if (written && fs.mount(&card) == 0 && file.open(&fs, resultsPath, O_RDONLY) == 0) {
+        result.readBack = file.size() == (off_t)(windows * windowBytes);
+        for (uint32_t w = 0; w < windows && result.readBack; w++) {
+            fillWindow(window, w);
+            result.readBack = file.read(stored.data(), stored.size()) == (ssize_t)stored.size() && stored == window;
+        }
+        file.close();
+        fs.unmount();
+    }
+    return result;
+}
+
+static bool report(const char *name, const Result &r, bool passed) {
+    printf("%-48s %8u %8u %7.1f %7.1f %9.1f %9.1f  %s\n", name, r.meanUs, r.worstUs, r.initsPerWindow, r.callsPerWindow, r.sectorsReadPerWindow,
+           r.sectorsWrittenPerWindow, passed ? "ok" : "FAILED");
+    if (!r.readBack) {
+        printf("  The file read back did not match the windows written\n");
+    }
+    return passed;
+}
+
+int main() {
+    printf("%u windows of %zu bytes on a modelled SPI card\n", windows, windowBytes);
+    printf("%-48s %8s %8s %7s %7s %9s %9s\n", "Mode", "Mean us", "Worst us", "Inits", "Calls", "Rd sect", "Wr sect");
+
+    //The old firmware had no preallocation and released the card after every window
+    Result old = run(0, 0, true);
+    bool passed = report("Mount, open, write, close every window", old, old.readBack && old.initsPerWindow == 1.0);
+
+    Result synced = run(0, 1, false);
+    passed = report("Session, no preallocation, sync every window", synced, synced.readBack && synced.initsPerWindow == 0.0) && passed;
+
+    //Firmware defaults - sd-preallocate-kb 0, sd-sync-every 4
+    Result unallocated = run(0, 4, false);
+    passed = report("Session, no preallocation, sync every 4", unallocated, unallocated.readBack && unallocated.initsPerWindow == 0.0) && passed;
+
+    //sd-preallocate-kb 1024 - Slightly fewer card calls and a lower mean, but the window that adds the space is the worst of the run
+    Result session = run(1024 * 1024, 4, false);
+    passed = report("Session, 1MB preallocated, sync every 4", session, session.readBack && session.initsPerWindow == 0.0) && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+#include "../Basic_Code/WriteBehindBlockDevice.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+/*
+Description:
+- Host simulation of the write behind queue (WriteBehindBlockDevice.hpp) in front of a micro-SD card on an SPI bus.
+- SimSpiCard stands in for SDBlockDevice - Every program() holds the caller for the command overhead, the SPI transfer of the data
+  and the card's busy time per block, and every so often for a long internal garbage collection pause like a real card.
+- The card time is a sleep, so the host CPU is free while it passes. SDBlockDevice polls the card instead, so on the board the
+  worker uses the CPU for that time and other threads only run by preempting it. What the sim shows is how long each write holds
+  the writer with and without the queue - It does not show the card time overlapping other work.
+- The writer thread writes a window every period like writeSDCard() and syncs every few windows. The time each write holds the writer
+  is measured with the card used directly and through the queue, then the card contents are checked against what was written.
+- A failing card is simulated last to check a write error comes back from the next program() or sync().
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 -pthread main.cpp -o write_behind_sim
+*/
+
+//Latency model - 12.5MHz SPI, 250us busy per block, 200us per command and an 80ms pause for every 128KB written
+static const double spiBytesPerUs = 12.5 / 8;
+static const int blockBusyUs = 250;
+static const int commandUs = 200;
+static const size_t pauseEvery = 128 * 1024;
+static const int pauseUs = 80000;
+
+class SimSpiCard : public BlockDevice {
+private:
+    vector<uint8_t> image;
+    int writes = 0;
+    size_t sincePause = 0;
+
+public:
+    int failAfter = -1; //Writes that succeed before every write fails - -1 never fails
+
+    explicit SimSpiCard(size_t bytes) : image(bytes, 0xFF) {}
+
+    int init() override {
+        return 0;
+    }
+
+    int deinit() override {
+        return 0;
+    }
+
+    int read(void *buffer, bd_addr_t addr, bd_size_t size) override {
+        memcpy(buffer, &image[addr], size);
+        return 0;
+    }
+
+    int program(const void *buffer, bd_addr_t addr, bd_size_t size) override {
+        int blocks = (size + 511) / 512;
+        int us = commandUs + (int)(size / spiBytesPerUs) + (blocks * blockBusyUs);
+        writes++;
+        sincePause += size;
+        if (sincePause >= pauseEvery) {
+            sincePause -= pauseEvery;
+            us += pauseUs;
+        }
+        this_thread::sleep_for(microseconds(us));
+
+        if (failAfter >= 0 && writes > failAfter) {
+            return -5005; //SD_BLOCK_DEVICE_ERROR_WRITE
+        }
+        memcpy(&image[addr], buffer, size);
+        return 0;
+    }
+
+    bd_size_t get_read_size() const override {
+        return 512;
+    }
+
+    bd_size_t get_program_size() const override {
+        return 512;
+    }
+
+    bd_size_t size() const override {
+        return image.size();
+    }
+
+    const char *get_type() const override {
+        return "SIMSPI";
+    }
+
+    const vector<uint8_t> &contents() const {
+        return image;
+    }
+};
+
+struct Result {
+    double meanUs;
+    double worstUs;
+    double syncWorstUs;
+    double blockedUs; //Everything the writer spent in program() and sync(), per window
+    bool intact;
+};
+
+//Writes windows of windowBytes every period, syncing every syncEvery windows, and times how long each call holds the writer
+static Result runWriter(BlockDevice &device, SimSpiCard &card, int windows, size_t windowBytes, microseconds period, int syncEvery) {
+    vector<uint8_t> window(windowBytes);
+    vector<uint8_t> expected(card.size(), 0xFF);
+    double total = 0;
+    double worst = 0;
+    double syncWorst = 0;
+    double syncTotal = 0;
+
+    device.init();
+    auto next = steady_clock::now();
+    for (int w = 0; w < windows; w++) {
+        for (size_t i = 0; i < windowBytes; i++) {
+            window[i] = (uint8_t)((w * 31) + i);
+        }
+        bd_addr_t addr = (bd_addr_t)w * windowBytes;
+        memcpy(&expected[addr], window.data(), windowBytes);
+
+        auto start = steady_clock::now();
+        device.program(window.data(), addr, windowBytes);
+        double us = duration<double, micro>(steady_clock::now() - start).count();
+        total += us;
+        worst = max(worst, us);
+
+        if (((w + 1) % syncEvery) == 0) {
+            start = steady_clock::now();
+            device.sync();
+            us = duration<double, micro>(steady_clock::now() - start).count();
+            syncTotal += us;
+            syncWorst = max(syncWorst, us);
+        }
+
+        //The window buffer is free again as soon as program() returns, so it is overwritten straight away
+        memset(window.data(), 0, windowBytes);
+        next += period;
+        this_thread::sleep_until(next);
+    }
+    device.sync();
+    device.deinit();
+
+    return {total / windows, worst, syncWorst, (total + syncTotal) / windows, card.contents() == expected};
+}
+
+int main() {
+    const int windows = 96;
+    const size_t windowBytes = 8192;
+    const microseconds period(40000);
+    const int syncEvery = 4;
+
+    printf("%d windows of %zu bytes every %lldms, synced every %d windows\n", windows, windowBytes, (long long)period.count() / 1000, syncEvery);
+
+    SimSpiCard directCard(windows * windowBytes);
+    Result direct = runWriter(directCard, directCard, windows, windowBytes, period, syncEvery);
+    printf("Direct:       write mean %7.0fus worst %7.0fus, sync worst %7.0fus, blocked %7.0fus per window, card %s\n", direct.meanUs,
+           direct.worstUs, direct.syncWorstUs, direct.blockedUs, direct.intact ? "intact" : "CORRUPT");
+
+    SimSpiCard queuedCard(windows * windowBytes);
+    WriteBehindBlockDevice<3, 2048> queue(queuedCard);
+    Result queued = runWriter(queue, queuedCard, windows, windowBytes, period, syncEvery);
+    printf("Write behind: write mean %7.0fus worst %7.0fus, sync worst %7.0fus, blocked %7.0fus per window, card %s\n", queued.meanUs,
+           queued.worstUs, queued.syncWorstUs, queued.blockedUs, queued.intact ? "intact" : "CORRUPT");
+    printf("              peak %u writes outstanding, %u waits for a free slot\n", queue.peakOutstanding(), queue.slotWaits());
+
+    //Errors from writes that have already returned must come back from a later call
+    SimSpiCard failingCard(16 * 2048);
+    failingCard.failAfter = 2;
+    WriteBehindBlockDevice<3, 2048> failingQueue(failingCard);
+    vector<uint8_t> data(2048, 0x5A);
+    failingQueue.init();
+    int err = 0;
+    for (int i = 0; i < 6 && err == 0; i++) {
+        err = failingQueue.program(data.data(), i * 2048, 2048);
+    }
+    int syncErr = failingQueue.sync();
+    bool reported = (err != 0 || syncErr != 0);
+    printf("Failing card: write error %s (program %d, sync %d)\n", reported ? "reported" : "LOST", err, syncErr);
+
+    return (direct.intact && queued.intact && reported) ? 0 : 1;
+}
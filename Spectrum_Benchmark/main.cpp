@@ -0,0 +1,558 @@
+#include "../Blood_Glucose/FFT.hpp"
+#include "../Blood_Glucose/FixedDFT.hpp"
+#include "../Blood_Glucose/coefficients.hpp"
+#include "../Blood_Glucose/Goertzel.hpp"
+#include "../Blood_Glucose/SlidingDFT.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace std;
+using namespace std::chrono;
+
+/*
+Description:
+- Host check and micro-benchmark of the spectrum code in Blood_Glucose (FFT.hpp, Goertzel.hpp, SlidingDFT.hpp, FixedDFT.hpp) against
+  the DFT in its process().
+- Every transform is first checked against a DFT worked out in double - The 200 point window, other mixed radix lengths, and lengths
+  with larger prime factors that go through Bluestein's algorithm.
+- The Goertzel banks, float and fixed point, are fed a sample at a time and checked against a direct DFT, on the bins of process()
+  and on frequencies between bins. The fixed point bank is also run at full scale over its longest window.
+- SlidingDFT is run over a stream of a million samples (2.8 hours at 100Hz), with and without re-anchoring, and checked against the DFT
+  of its last window worked out again in double every few hundred samples - The worst error is shown per decade of the stream.
+- The fixed point kernels have their dual multiply-accumulate path (the C version of SMLALD here) checked bit for bit against the
+  scalar one, on odd lengths, every step through the tables and extreme values, then DFTQ15 and DFTQ31 against the DFT in double, of the quantised samples (the
+  kernels' own error) and of the float window (including the quantising).
+- The quarter wave coefficients (coefficients.hpp) are checked against cos and sin in double, for the 200 sample window and for
+  lengths that are not a multiple of 4.
+- The DFT is the loop from process() - A double accumulator per bin and the 31 x 200 float coefficient tables coefficients.hpp used
+  to hold, 6200 multiply-accumulates for the 31 bins of a 200 sample window. Timed against the same loop on the quarter wave table,
+  and against RealFFT<200>::power() for the same 31 bins.
+- Times are per window, as the best of several runs. Cycles come from the time stamp counter on x86 - The same benchmark runs on the
+  board with fft-benchmark set in Blood_Glucose/mbed_app.json, where the gap is wider as the M4F does doubles in software.
+- Built with any C++14 compiler, e.g. g++ -std=c++14 -O2 main.cpp -o spectrum_benchmark
+*/
+
+static const uint32_t windowSamples = 200;
+static const uint32_t dftBins = 31;
+static const float rateHz = 100.0f;
+static const int runs = 2000;
+
+//Coefficient tables as coefficients.hpp used to hold them - cos(2*pi*k*n/N) and -sin(2*pi*k*n/N)
+static float fullCos[dftBins][windowSamples];
+static float fullSine[dftBins][windowSamples];
+
+static void makeCoefficients() {
+    const double pi = 3.14159265358979323846;
+    for (uint32_t k = 0; k < dftBins; k++) {
+        for (uint32_t n = 0; n < windowSamples; n++) {
+            fullCos[k][n] = (float)cos((2 * pi * k * n) / windowSamples);
+            fullSine[k][n] = (float)-sin((2 * pi * k * n) / windowSamples);
+        }
+    }
+}
+
+//process() without the prints - Power of each of the first dftBins bins
+static void dftPower(const float *x, float *power) {
+    for (uint32_t k = 0; k < dftBins; k++) {
+        double real = 0.0;
+        double imag = 0.0;
+        for (uint32_t n = 0; n < windowSamples; n++) {
+            real += x[n] * fullCos[k][n];
+            imag += x[n] * fullSine[k][n];
+        }
+        power[k] = (float)((real * real) + (imag * imag));
+    }
+}
+
+//The same loop on the quarter wave table, stepping k*n mod N as the board's fft-benchmark does
+static void dftPowerQuarterWave(const float *x, float *power) {
+    for (uint32_t k = 0; k < dftBins; k++) {
+        double real = 0.0;
+        double imag = 0.0;
+        uint32_t i = 0;
+        for (uint32_t n = 0; n < windowSamples; n++) {
+            float c;
+            float ns;
+            quarterWave<windowSamples>.twiddle(i, c, ns);
+            real += x[n] * c;
+            imag += x[n] * ns;
+            i = (i + k >= windowSamples) ? i + k - windowSamples : i + k;
+        }
+        power[k] = (float)((real * real) + (imag * imag));
+    }
+}
+
+//Every coefficient of bins 0 to N/2 against cos and -sin in double - Float rounding is 3e-8 at most
+template <uint32_t N>
+static bool checkQuarterWave() {
+    const double pi = 3.14159265358979323846;
+    static_assert(quarterWave<N>.cos(0) == 1.0f, "The quarter wave table is built at compile time");
+    double worst = 0.0;
+    for (uint32_t k = 0; k <= N / 2; k++) {
+        for (uint32_t n = 0; n < N; n++) {
+            double phase = (2 * pi * (double)((k * n) % N)) / N;
+            worst = max(worst, fabs(cosCoeff<N>(k, n) - cos(phase)));
+            worst = max(worst, fabs(sineCoeff<N>(k, n) + sin(phase)));
+        }
+    }
+    bool passed = worst < 3e-8;
+    printf("QuarterWave<%u> %5u bytes, worst error %.2e  %s\n", N, (unsigned)sizeof(QuarterWave<N>), worst, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+//Reference power spectrum in double
+static vector<double> referencePower(const vector<float> &x, uint32_t bins) {
+    const double pi = 3.14159265358979323846;
+    vector<double> power(bins);
+    for (uint32_t k = 0; k < bins; k++) {
+        double real = 0.0;
+        double imag = 0.0;
+        for (size_t n = 0; n < x.size(); n++) {
+            double phase = (-2 * pi * (double)((k * n) % x.size())) / x.size();
+            real += x[n] * cos(phase);
+            imag += x[n] * sin(phase);
+        }
+        power[k] = (real * real) + (imag * imag);
+    }
+    return power;
+}
+
+//PPG like test window - A pulse at 1.2Hz with harmonics, breathing and noise around a DC level
+static vector<float> makeWindow(uint32_t n) {
+    const double pi = 3.14159265358979323846;
+    vector<float> x(n);
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < n; i++) {
+        double t = i / (double)rateHz;
+        seed = (seed * 1103515245) + 12345;
+        x[i] = (float)(2.0 + sin(2 * pi * 1.2 * t) + (0.4 * sin(2 * pi * 2.4 * t + 0.5)) + (0.2 * sin(2 * pi * 0.25 * t)) +
+                       (0.05 * (((seed >> 16) & 0x7FFF) / 32768.0 - 0.5)));
+    }
+    return x;
+}
+
+//Checks RealFFT<N> against the reference - Errors are relative to the largest bin
+template <uint32_t N>
+static bool check(const char *path) {
+    static RealFFT<N> fft;
+    vector<float> x = makeWindow(N);
+    vector<float> power(RealFFT<N>::bins);
+    fft.power(x.data(), power.data(), RealFFT<N>::bins);
+    vector<double> reference = referencePower(x, RealFFT<N>::bins);
+
+    double peak = *max_element(reference.begin(), reference.end());
+    double worst = 0.0;
+    for (uint32_t k = 0; k < RealFFT<N>::bins; k++) {
+        worst = max(worst, fabs(power[k] - reference[k]) / peak);
+    }
+    bool passed = worst < 1e-4;
+    printf("N = %-4u %-22s worst error %.2e of the peak  %s\n", N, path, worst, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+//Power of the window at frequencyHz worked out directly in double - |sum of x[n]e^(-iwn)|^2
+static double directPower(const vector<double> &x, double frequencyHz) {
+    const double pi = 3.14159265358979323846;
+    double real = 0.0;
+    double imag = 0.0;
+    for (size_t n = 0; n < x.size(); n++) {
+        double phase = (-2 * pi * frequencyHz * n) / rateHz;
+        real += x[n] * cos(phase);
+        imag += x[n] * sin(phase);
+    }
+    return (real * real) + (imag * imag);
+}
+
+//Feeds a window through both banks a sample at a time and checks each bin against the direct DFT - Errors are relative to the largest bin.
+//The float bank is allowed more near DC, see Goertzel.hpp
+static bool checkGoertzel(const char *name, const vector<float> &x, const float *frequencies, uint32_t bins) {
+    static GoertzelBank<dftBins> bank;
+    static GoertzelBankQ<dftBins> bankQ;
+    bool configured = bank.configure(frequencies, bins, rateHz, x.size()) && bankQ.configure(frequencies, bins, rateHz, x.size());
+
+    //The fixed point bank takes the samples as integers, so the reference for it is the same integers
+    vector<double> samples(x.begin(), x.end());
+    vector<double> samplesQ(x.size());
+    bool ended = false;
+    bool endedQ = false;
+    for (size_t n = 0; n < x.size(); n++) {
+        int32_t q = (int32_t)lround(x[n]);
+        samplesQ[n] = q;
+        ended = bank.push(x[n]);
+        endedQ = bankQ.push(q);
+    }
+
+    float power[dftBins];
+    int64_t powerQ[dftBins];
+    bank.power(power);
+    bankQ.power(powerQ);
+
+    double peak = 0.0;
+    double peakQ = 0.0;
+    vector<double> reference(bins);
+    vector<double> referenceQ(bins);
+    for (uint32_t b = 0; b < bins; b++) {
+        reference[b] = directPower(samples, frequencies[b]);
+        referenceQ[b] = directPower(samplesQ, frequencies[b]);
+        peak = max(peak, reference[b]);
+        peakQ = max(peakQ, referenceQ[b]);
+    }
+    double worst = 0.0;
+    double worstQ = 0.0;
+    for (uint32_t b = 0; b < bins; b++) {
+        worst = max(worst, fabs(power[b] - reference[b]) / peak);
+        worstQ = max(worstQ, fabs((double)powerQ[b] - referenceQ[b]) / peakQ);
+    }
+
+    bool passed = configured && ended && endedQ && worst < 1e-3 && worstQ < 1e-4;
+    printf("Goertzel %-30s worst error %.2e float, %.2e fixed  %s\n", name, worst, worstQ, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+//Slides both ways over a long stream, checking the last window against the reference as it goes - Errors are relative to the largest bin
+static bool checkSliding() {
+    const uint32_t streamSamples = 1000000;
+    const uint32_t checkEvery = 487; //Prime, so the checks land all over the anchor window
+    static SlidingDFT<windowSamples, dftBins> anchored;
+    static SlidingDFT<windowSamples, dftBins> free;
+    free.setAnchoring(false);
+    vector<float> stream = makeWindow(streamSamples);
+
+    printf("%-22s %14s %14s\n", "SlidingDFT samples", "re-anchored", "free running");
+    bool passed = true;
+    double worst = 0.0;
+    double worstFree = 0.0;
+    uint32_t decade = 1000;
+    for (uint32_t n = 0; n < streamSamples; n++) {
+        anchored.push(stream[n]);
+        free.push(stream[n]);
+        if (n + 1 < windowSamples || ((n % checkEvery) != 0 && n + 1 != streamSamples)) {
+            continue;
+        }
+
+        vector<float> window(stream.begin() + (n + 1 - windowSamples), stream.begin() + (n + 1));
+        vector<double> reference = referencePower(window, dftBins);
+        double peak = *max_element(reference.begin(), reference.end());
+        float power[dftBins];
+        float powerFree[dftBins];
+        anchored.power(power, dftBins);
+        free.power(powerFree, dftBins);
+        for (uint32_t k = 0; k < dftBins; k++) {
+            worst = max(worst, fabs(power[k] - reference[k]) / peak);
+            worstFree = max(worstFree, fabs(powerFree[k] - reference[k]) / peak);
+        }
+        passed = passed && anchored.ready();
+
+        if (n + 1 >= decade || n + 1 == streamSamples) {
+            printf("up to %-16u %14.2e %14.2e\n", decade, worst, worstFree);
+            decade *= 10;
+        }
+    }
+    passed = passed && worst < 1e-4;
+    printf("Re-anchored sliding DFT %s\n", passed ? "ok" : "FAILED");
+    return passed;
+}
+
+//Dual and scalar Q15 paths give the same bits, and both fixed point DFTs are within bounds of the double DFT
+static bool checkFixed() {
+    bool passed = true;
+
+    //Bins of every length up to 9 and the window at every step through the tables, with random values and with every value -32768
+    uint32_t seed = 777;
+    vector<int16_t> a(windowSamples + 1);
+    vector<int16_t> b(windowSamples + 1);
+    vector<int16_t> c(windowSamples + 1);
+    uint32_t mismatches = 0;
+    for (int fill = 0; fill < 2; fill++) {
+        for (size_t i = 0; i < a.size(); i++) {
+            seed = (seed * 1103515245) + 12345;
+            a[i] = (fill == 0) ? (int16_t)(seed >> 16) : -32768;
+            seed = (seed * 1103515245) + 12345;
+            b[i] = (fill == 0) ? (int16_t)(seed >> 16) : -32768;
+            seed = (seed * 1103515245) + 12345;
+            c[i] = (fill == 0) ? (int16_t)(seed >> 16) : -32768;
+        }
+        for (uint32_t n = 1; n <= windowSamples + 1; n = (n < 9) ? n + 1 : n + 95) {
+            //Starting one in, so pairs are loaded across 32 bit boundaries too
+            for (uint32_t offset = 0; offset < 2 && n + offset <= a.size(); offset++) {
+                for (uint32_t k = 0; k < n; k++) {
+                    int64_t re[2];
+                    int64_t im[2];
+                    binQ15Dual(a.data() + offset, b.data(), c.data(), n, k, re[0], im[0]);
+                    binQ15Scalar(a.data() + offset, b.data(), c.data(), n, k, re[1], im[1]);
+                    mismatches += (re[0] != re[1]) || (im[0] != im[1]);
+                }
+            }
+        }
+    }
+
+    //The window at full scale 4.0, and as the largest values Q15 has
+    static DFTQ15<windowSamples, dftBins> dftQ15;
+    static DFTQ31<windowSamples, dftBins> dftQ31;
+    const float fullScale = 4.0f;
+    vector<float> x = makeWindow(windowSamples);
+    vector<int16_t> xQ15(windowSamples);
+    vector<int32_t> xQ31(windowSamples);
+    vector<float> quantisedQ15(windowSamples);
+    vector<float> quantisedQ31(windowSamples);
+    for (uint32_t n = 0; n < windowSamples; n++) {
+        xQ15[n] = toQ15(x[n], fullScale);
+        xQ31[n] = toQ31(x[n], fullScale);
+        quantisedQ15[n] = xQ15[n] / 32768.0f;
+        quantisedQ31[n] = (float)(xQ31[n] / 2147483648.0);
+    }
+    int64_t re[dftBins];
+    int64_t im[dftBins];
+    int64_t reDual[dftBins];
+    int64_t imDual[dftBins];
+    vector<int16_t> extremes(windowSamples);
+    for (uint32_t n = 0; n < windowSamples; n++) {
+        extremes[n] = (n % 3 == 0) ? 32767 : -32768;
+    }
+    for (const vector<int16_t> *samples : {&xQ15, &extremes}) {
+        dftQ15.transformScalar(samples->data(), re, im);
+        dftQ15.transformDual(samples->data(), reDual, imDual);
+        for (uint32_t k = 0; k < dftBins; k++) {
+            mismatches += (re[k] != reDual[k]) || (im[k] != imDual[k]);
+        }
+    }
+    passed = passed && mismatches == 0;
+    printf("Q15 dual multiply-accumulate against scalar: %u mismatches  %s\n", mismatches, (mismatches == 0) ? "ok" : "FAILED");
+
+    //References in double, the quantised samples in 1.0 = full scale and the float window scaled the same
+    vector<float> scaled(windowSamples);
+    for (uint32_t n = 0; n < windowSamples; n++) {
+        scaled[n] = x[n] / fullScale;
+    }
+    vector<double> reference = referencePower(scaled, dftBins);
+    vector<double> referenceQ15 = referencePower(quantisedQ15, dftBins);
+    vector<double> referenceQ31 = referencePower(quantisedQ31, dftBins);
+    double peak = *max_element(reference.begin(), reference.end());
+    int64_t powerQ15[dftBins];
+    int64_t powerQ31[dftBins];
+    dftQ15.power(xQ15.data(), powerQ15, dftBins);
+    dftQ31.power(xQ31.data(), powerQ31, dftBins);
+
+    double kernelQ15 = 0.0;
+    double kernelQ31 = 0.0;
+    double totalQ15 = 0.0;
+    double totalQ31 = 0.0;
+    for (uint32_t k = 0; k < dftBins; k++) {
+        double q15 = powerQ15[k] / 1073741824.0; //2^30
+        double q31 = powerQ31[k] / 70368744177664.0; //2^46
+        kernelQ15 = max(kernelQ15, fabs(q15 - referenceQ15[k]) / peak);
+        kernelQ31 = max(kernelQ31, fabs(q31 - referenceQ31[k]) / peak);
+        totalQ15 = max(totalQ15, fabs(q15 - reference[k]) / peak);
+        totalQ31 = max(totalQ31, fabs(q31 - reference[k]) / peak);
+    }
+    bool bounded = kernelQ15 < 2e-4 && totalQ15 < 2e-4 && kernelQ31 < 1e-8 && totalQ31 < 1e-8;
+    passed = passed && bounded;
+    printf("DFTQ15 worst error %.2e of the peak, %.2e with the quantising\n", kernelQ15, totalQ15);
+    printf("DFTQ31 worst error %.2e of the peak, %.2e with the quantising  %s\n", kernelQ31, totalQ31, bounded ? "ok" : "FAILED");
+    return passed;
+}
+
+struct Timing {
+    double ns;
+    double cycles;
+};
+
+template <typename Function>
+static Timing timeWindow(Function function) {
+    Timing best = {1e30, 1e30};
+    for (int r = 0; r < runs; r++) {
+#if defined(__x86_64__) || defined(__i386__)
+        uint64_t startCycles = __rdtsc();
+#endif
+        auto start = steady_clock::now();
+        function();
+        double ns = (double)duration_cast<nanoseconds>(steady_clock::now() - start).count();
+        best.ns = min(best.ns, ns);
+#if defined(__x86_64__) || defined(__i386__)
+        best.cycles = min(best.cycles, (double)(__rdtsc() - startCycles));
+#else
+        best.cycles = 0;
+#endif
+    }
+    return best;
+}
+
+int main() {
+    bool passed = true;
+    passed = check<200>("real, packed 4.5.5") && passed;
+    passed = check<100>("real, packed 2.5.5") && passed;
+    passed = check<60>("real, packed 2.3.5") && passed;
+    passed = check<64>("real, packed 4.4.2") && passed;
+    passed = check<45>("complex 3.3.5") && passed;
+    passed = check<250>("real, packed 5.5.5") && passed;
+    passed = check<197>("Bluestein, prime") && passed;
+    passed = check<202>("Bluestein, 2.101") && passed;
+    passed = check<7>("Bluestein, prime") && passed;
+    printf("\n");
+
+    printf("coefficients.hpp used to hold %u bytes of tables\n", (unsigned)(sizeof(fullCos) + sizeof(fullSine)));
+    passed = checkQuarterWave<200>() && passed;
+    passed = checkQuarterWave<199>() && passed;
+    passed = checkQuarterWave<250>() && passed;
+    passed = checkQuarterWave<7>() && passed;
+    printf("\n");
+
+    //The 31 bins of process(), then targets between bins - The window is scaled to 12 bit ADC counts for the fixed point bank
+    float binTargets[dftBins];
+    binFrequencies(binTargets, dftBins, rateHz, windowSamples);
+    const float offBinTargets[] = {0.25f, 0.9f, 1.2f, 1.23f, 2.46f, 3.333f, 7.7f, 14.2f, 15.9f};
+    const uint32_t offBins = sizeof(offBinTargets) / sizeof(offBinTargets[0]);
+    vector<float> counts = makeWindow(windowSamples);
+    for (float &v : counts) {
+        v *= 1000.0f;
+    }
+    passed = checkGoertzel("31 bins of process()", counts, binTargets, dftBins) && passed;
+    passed = checkGoertzel("9 targets between bins", counts, offBinTargets, offBins) && passed;
+
+    //Full scale DC and a full scale tone over the longest window the fixed point bank takes
+    vector<float> fullScale(GoertzelBankQ<dftBins>::maxWindowSamples);
+    for (size_t n = 0; n < fullScale.size(); n++) {
+        fullScale[n] = (n % 2 == 0) ? 32767.0f : (float)lround(16383.0 + 16383.0 * sin(n * 0.3));
+    }
+    const float fullScaleTargets[] = {0.0f, 0.5f, 4.77f, 50.0f};
+    passed = checkGoertzel("full scale, 360 samples", fullScale, fullScaleTargets, 4) && passed;
+    printf("\n");
+    passed = checkSliding() && passed;
+    printf("\n");
+    passed = checkFixed() && passed;
+
+    //Old DFT against the FFT over the same window and bins - Results compared so neither is optimised away
+    makeCoefficients();
+    static RealFFT<windowSamples> fft;
+    vector<float> x = makeWindow(windowSamples);
+    float dft[dftBins];
+    float fast[dftBins];
+    float full[RealFFT<windowSamples>::bins];
+
+    float dftQuarter[dftBins];
+    Timing dftTime = timeWindow([&] { dftPower(x.data(), dft); });
+    Timing quarterTime = timeWindow([&] { dftPowerQuarterWave(x.data(), dftQuarter); });
+    Timing fftTime = timeWindow([&] { fft.power(x.data(), fast, dftBins); });
+    Timing fullTime = timeWindow([&] { fft.power(x.data(), full, RealFFT<windowSamples>::bins); });
+
+    //The banks are timed over a whole window of pushes and for the single push that ends it, which also works out the power
+    static GoertzelBank<dftBins> bank;
+    static GoertzelBankQ<dftBins> bankQ;
+    bank.configure(binTargets, dftBins, rateHz, windowSamples);
+    bankQ.configure(binTargets, dftBins, rateHz, windowSamples);
+    vector<int32_t> xQ(windowSamples);
+    for (uint32_t n = 0; n < windowSamples; n++) {
+        xQ[n] = (int32_t)lround(x[n] * 1000.0f);
+    }
+    float goertzel[dftBins];
+    Timing bankTime = timeWindow([&] {
+        for (uint32_t n = 0; n < windowSamples; n++) {
+            bank.push(x[n]);
+        }
+    });
+    Timing bankQTime = timeWindow([&] {
+        for (uint32_t n = 0; n < windowSamples; n++) {
+            bankQ.push(xQ[n]);
+        }
+    });
+    for (uint32_t n = 0; n < windowSamples - 1; n++) {
+        bank.push(x[n]);
+    }
+    Timing lastPushTime = timeWindow([&] {
+        bank.push(x[windowSamples - 1]);
+        bank.restart();
+        for (uint32_t n = 0; n < windowSamples - 1; n++) {
+            bank.push(x[n]);
+        }
+    });
+    Timing catchUpTime = timeWindow([&] {
+        bank.restart();
+        for (uint32_t n = 0; n < windowSamples - 1; n++) {
+            bank.push(x[n]);
+        }
+    });
+    bank.push(x[windowSamples - 1]);
+    bank.power(goertzel);
+
+    //Fixed point kernels over the same window - On the host the Q15 one takes the scalar path
+    static DFTQ15<windowSamples, dftBins> dftQ15;
+    static DFTQ31<windowSamples, dftBins> dftQ31;
+    vector<int16_t> xQ15(windowSamples);
+    vector<int32_t> xQ31(windowSamples);
+    for (uint32_t n = 0; n < windowSamples; n++) {
+        xQ15[n] = toQ15(x[n], 4.0f);
+        xQ31[n] = toQ31(x[n], 4.0f);
+    }
+    //The bins are summed into a volatile so the compiler can not drop the work as unused
+    int64_t fixedPower[dftBins];
+    volatile int64_t fixedSink = 0;
+    auto keep = [&] {
+        int64_t sum = 0;
+        for (uint32_t k = 0; k < dftBins; k++) {
+            sum += fixedPower[k];
+        }
+        fixedSink = fixedSink + sum;
+    };
+    Timing q15Time = timeWindow([&] {
+        dftQ15.power(xQ15.data(), fixedPower, dftBins);
+        keep();
+    });
+    Timing q31Time = timeWindow([&] {
+        dftQ31.power(xQ31.data(), fixedPower, dftBins);
+        keep();
+    });
+
+    //A fresh 31 bin spectrum every sample - One push and power() for the sliding DFT, a whole DFT or FFT of the last window otherwise
+    static SlidingDFT<windowSamples, dftBins> sliding;
+    float slid[dftBins];
+    for (uint32_t n = 0; n < windowSamples; n++) {
+        sliding.push(x[n]);
+    }
+    Timing slidingTime = timeWindow([&] {
+        for (uint32_t n = 0; n < windowSamples; n++) {
+            sliding.push(x[n]);
+            sliding.power(slid, dftBins);
+        }
+    });
+
+    float peak = *max_element(dft, dft + dftBins);
+    float worst = 0.0f;
+    float worstGoertzel = 0.0f;
+    float worstQuarter = 0.0f;
+    for (uint32_t k = 0; k < dftBins; k++) {
+        worst = max(worst, fabs(dft[k] - fast[k]) / peak);
+        worstGoertzel = max(worstGoertzel, fabs(dft[k] - goertzel[k]) / peak);
+        worstQuarter = max(worstQuarter, fabs(dft[k] - dftQuarter[k]) / peak);
+    }
+    passed = (worst < 1e-4f) && (worstGoertzel < 1e-4f) && (worstQuarter < 1e-6f) && passed;
+
+    printf("\n%u sample window, %u bins (%u multiply-accumulates for the DFT)\n", windowSamples, dftBins, windowSamples * dftBins);
+    printf("%-32s %10s %12s %8s\n", "Method", "ns/window", "cycles", "Speedup");
+    printf("%-32s %10.0f %12.0f %8s\n", "DFT from process() (double)", dftTime.ns, dftTime.cycles, "1.00x");
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "DFT, quarter wave coefficients", quarterTime.ns, quarterTime.cycles, dftTime.ns / quarterTime.ns);
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "RealFFT<200>, 31 bins", fftTime.ns, fftTime.cycles, dftTime.ns / fftTime.ns);
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "RealFFT<200>, all 101 bins", fullTime.ns, fullTime.cycles, dftTime.ns / fullTime.ns);
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "GoertzelBank, 31 bins", bankTime.ns, bankTime.cycles, dftTime.ns / bankTime.ns);
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "GoertzelBankQ, 31 bins", bankQTime.ns, bankQTime.cycles, dftTime.ns / bankQTime.ns);
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "DFTQ15<200, 31>", q15Time.ns, q15Time.cycles, dftTime.ns / q15Time.ns);
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "DFTQ31<200, 31>", q31Time.ns, q31Time.cycles, dftTime.ns / q31Time.ns);
+    printf("Goertzel work per sample %.0fns, the push that ends the window %.0fns - The DFT and FFT land all at once after it\n",
+           bankTime.ns / windowSamples, max(0.0, lastPushTime.ns - catchUpTime.ns));
+    printf("Largest difference from the DFT %.2e of the peak for the FFT, %.2e for GoertzelBank, %.2e on the quarter wave table\n", worst,
+           worstGoertzel, worstQuarter);
+
+    printf("\nA fresh %u bin spectrum after every sample\n", dftBins);
+    printf("%-32s %10s %12s %8s\n", "Method", "ns/sample", "cycles", "Speedup");
+    printf("%-32s %10.0f %12.0f %8s\n", "DFT from process() (double)", dftTime.ns, dftTime.cycles, "1.00x");
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "RealFFT<200>, 31 bins", fftTime.ns, fftTime.cycles, dftTime.ns / fftTime.ns);
+    printf("%-32s %10.0f %12.0f %7.2fx\n", "SlidingDFT<200, 31>", slidingTime.ns / windowSamples, slidingTime.cycles / windowSamples,
+           (dftTime.ns * windowSamples) / slidingTime.ns);
+    return passed ? 0 : 1;
+}